@@ -41,6 +41,11 @@ let package = Package(
     .library(
       name: "SwiftDriverExecution",
       targets: ["SwiftDriverExecution"]),
+    /// A stand-in for libSwiftScan, which tests load in its place.
+    .library(
+      name: "MockSwiftScan",
+      type: .dynamic,
+      targets: ["MockSwiftScan"]),
   ],
   targets: [
 
@@ -96,6 +101,12 @@ let package = Package(
       dependencies: ["SwiftDriver"],
       path: "Tests/ToolingTestShim"),
 
+    .target(
+      name: "MockSwiftScan",
+      dependencies: ["CSwiftScan"],
+      path: "Tests/MockSwiftScan",
+      exclude: ["CMakeLists.txt"]),
+
     /// The options library.
     .target(
       name: "SwiftOptions",
@@ -133,6 +144,8 @@ let package = Package(
     .executableTarget(
       name: "makeOptions",
       dependencies: [],
+      // Included by makeOptions.cpp rather than compiled.
+      exclude: ["DriverOptions.def"],
       // Do not enforce checks for LLVM's ABI-breaking build settings.
       // makeOptions runtime uses some header-only code from LLVM's ADT classes,
       // but we do not want to link libSupport into the executable.
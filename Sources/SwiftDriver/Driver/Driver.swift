@@ -28,7 +28,6 @@ import struct TSCBasic.Diagnostic
 import struct TSCBasic.FileInfo
 import struct TSCBasic.ProcessResult
 import struct TSCBasic.RelativePath
-import struct TSCBasic.SHA256
 import var TSCBasic.localFileSystem
 import var TSCBasic.stderrStream
 import var TSCBasic.stdoutStream
@@ -224,9 +223,12 @@ public struct Driver {
   /// The set of input files
   @_spi(Testing) public let inputFiles: [TypedVirtualPath]
 
-  /// The last time each input file was modified, and the file's SHA256 hash, recorded at the start of the build.
+  /// The last time each input file was modified, and the file's hash, recorded at the start of the build.
   @_spi(Testing) public let recordedInputMetadata: [TypedVirtualPath: FileMetadata]
 
+  /// The hashes of the inputs of earlier builds, with `-enable-incremental-file-hashing`.
+  let inputHashCache: InputHashCache?
+
   /// The mapping from input files to output files for each kind.
   let outputFileMap: OutputFileMap?
 
@@ -293,10 +295,22 @@ public struct Driver {
   /// CAS/Caching related options.
   let enableCaching: Bool
   let useClangIncludeTree: Bool
+  /// The size budget for the on-disk CAS, in bytes, from `-cas-size-limit`.
+  /// Without one, the CAS is left to grow.
+  let casSizeLimit: Int64?
 
   /// CAS instance used for compilation.
   @_spi(Testing) public var cas: SwiftScanCAS? = nil
 
+  /// Whether compile jobs are being planned without their output cache keys,
+  /// which are then computed for all of them at once by
+  /// `computeCompileJobCacheKeysInBatch`.
+  var defersCompileJobCacheKeys = false
+
+  /// The dependency graph of the variant module, when it was scanned in the
+  /// same batch as the target module's and has not been planned yet.
+  var batchScannedVariantDependencyGraph: InterModuleDependencyGraph? = nil
+
   /// Is swift caching enabled.
   lazy var isCachingEnabled: Bool = {
     return enableCaching && isFeatureSupported(.compilation_caching)
@@ -1044,21 +1058,6 @@ public struct Driver {
     let inputFiles = try Self.collectInputFiles(&self.parsedOptions, diagnosticsEngine: diagnosticsEngine, fileSystem: self.fileSystem)
     self.inputFiles = inputFiles
 
-    let incrementalFileHashes = parsedOptions.hasFlag(positive: .enableIncrementalFileHashing,
-                                                      negative: .disableIncrementalFileHashing,
-                                                      default: false)
-    self.recordedInputMetadata = .init(uniqueKeysWithValues:
-      Set(inputFiles).compactMap { inputFile -> (TypedVirtualPath, FileMetadata)? in
-        guard let modTime = try? fileSystem.lastModificationTime(for: inputFile.file) else { return nil }
-        if incrementalFileHashes {
-            guard let data = try? fileSystem.readFileContents(inputFile.file)  else { return nil }
-            let hash = SHA256().hash(data).hexadecimalRepresentation
-            return (inputFile, FileMetadata(mTime: modTime, hash: hash))
-        } else {
-            return (inputFile, FileMetadata(mTime: modTime))
-        }
-    })
-
     do {
       let outputFileMap: OutputFileMap?
       // Initialize an empty output file map, which will be populated when we start creating jobs.
@@ -1082,6 +1081,28 @@ public struct Driver {
       }
     }
 
+    // Stat, and maybe hash, the inputs, reusing the hashes of an earlier build
+    // next to the build record.
+    let incrementalFileHashes = parsedOptions.hasFlag(positive: .enableIncrementalFileHashing,
+                                                      negative: .disableIncrementalFileHashing,
+                                                      default: false)
+    let inputHashFunction = incrementalFileHashes ?
+      Self.inputHashFunction(&parsedOptions, diagnosticsEngine: diagnosticsEngine) : nil
+    var inputHashCache: InputHashCache? = nil
+    if let inputHashFunction, let outputFileMap = self.outputFileMap,
+       let buildRecordPath = try? BuildRecordInfo.buildRecordPath(
+         outputFileMap: outputFileMap,
+         workingDirectory: self.workingDirectory ?? fileSystem.currentWorkingDirectory) {
+      inputHashCache = InputHashCache(path: BuildRecordInfo.inputHashCachePath(buildRecordPath: buildRecordPath),
+                                      hashFunction: inputHashFunction,
+                                      fileSystem: fileSystem)
+    }
+    self.inputHashCache = inputHashCache
+    self.recordedInputMetadata = Self.recordInputMetadata(of: inputFiles,
+                                                          hashFunction: inputHashFunction,
+                                                          hashCache: inputHashCache,
+                                                          fileSystem: fileSystem)
+
     self.fileListThreshold = try Self.computeFileListThreshold(&self.parsedOptions, diagnosticsEngine: diagnosticsEngine)
     self.shouldUseInputFileList = inputFiles.count > fileListThreshold
 
@@ -1207,6 +1228,7 @@ public struct Driver {
     } else {
       self.enableCaching = false
     }
+    self.casSizeLimit = Self.determineCASSizeLimit(&parsedOptions, diagnosticsEngine: diagnosticEngine)
 
     // PCH related options.
     if parsedOptions.hasArgument(.importObjcHeader) {
@@ -1595,168 +1617,14 @@ extension Driver {
     }
   }
 
-  /// Tokenize a single line in a response file.
-  ///
-  /// This method supports response files with:
-  /// 1. Double slash comments at the beginning of a line.
-  /// 2. Backslash escaping.
-  /// 3. Shell Quoting
-  ///
-  /// - Returns: An array of 0 or more command line arguments
-  ///
-  /// - Complexity: O(*n*), where *n* is the length of the line.
-  private static func tokenizeResponseFileLine<S: StringProtocol>(_ line: S) -> [String] {
-    // Support double dash comments only if they start at the beginning of a line.
-    if line.hasPrefix("//") { return [] }
-
-    var tokens: [String] = []
-    var token: String = ""
-    // Conservatively assume ~1 token per line.
-    token.reserveCapacity(line.count)
-    // Indicates if we just parsed an escaping backslash.
-    var isEscaping = false
-    // Indicates if we are currently parsing quoted text.
-    var quoted = false
-
-    for char in line {
-      // Backslash escapes to the next character.
-      if char == #"\"#, !isEscaping {
-        isEscaping = true
-        continue
-      } else if isEscaping {
-        // Disable escaping and keep parsing.
-        isEscaping = false
-      } else if char.isShellQuote {
-        // If an unescaped shell quote appears, begin or end quoting.
-        quoted.toggle()
-        continue
-      } else if char.isWhitespace && !quoted {
-        // This is unquoted, unescaped whitespace, start a new token.
-        if !token.isEmpty {
-          tokens.append(token)
-          token = ""
-        }
-        continue
-      }
-
-      token.append(char)
-    }
-    // Add the final token
-    if !token.isEmpty {
-      tokens.append(token)
-    }
-
-    return tokens
-  }
-
-  // https://docs.microsoft.com/en-us/previous-versions//17w5ykft(v=vs.85)?redirectedfrom=MSDN
-  private static func tokenizeWindowsResponseFile(_ content: String) -> [String] {
-    let whitespace: [Character] = [" ", "\t", "\r", "\n", "\0" ]
-
-    var content = content
-    var tokens: [String] = []
-    var token: String = ""
-    var quoted: Bool = false
-
-    while !content.isEmpty {
-      // Eat whitespace at the beginning
-      if token.isEmpty {
-        if let end = content.firstIndex(where: { !whitespace.contains($0) }) {
-          let count = content.distance(from: content.startIndex, to: end)
-          content.removeFirst(count)
-        }
-
-        // Stop if this was trailing whitespace.
-        if content.isEmpty { break }
-      }
-
-      // Treat whitespace, double quotes, and backslashes as special characters.
-      if let next = content.firstIndex(where: { (quoted ? ["\\", "\""] : [" ", "\t", "\r", "\n", "\0", "\\", "\""]).contains($0) }) {
-        let count = content.distance(from: content.startIndex, to: next)
-        token.append(contentsOf: content[..<next])
-        content.removeFirst(count)
-
-        switch content.first {
-        case " ", "\t", "\r", "\n", "\0":
-          tokens.append(token)
-          token = ""
-          content.removeFirst(1)
-
-        case "\\":
-          // Backslashes are interpreted in a special manner due to use as both
-          // a path separator and an escape character.  Consume runs of
-          // backslashes and following double quote if escaped.
-          //
-          //  - If an even number of backslashes is followed by a double quote,
-          //  one backslash is emitted for each pair, and the last double quote
-          //  remains unconsumed.  The quote will be processed as the start or
-          //  end of a quoted string by the tokenizer.
-          //
-          //  - If an odd number of backslashes is followed by a double quote,
-          //  one backslash is emitted for each pair, and a double quote is
-          //  emitted for the trailing backslash and quote pair.  The double
-          //  quote is consumed.
-          //
-          //  - Otherwise, backslashes are treated literally.
-          if let next = content.firstIndex(where: { $0 != "\\" }) {
-            let count = content.distance(from: content.startIndex, to: next)
-            if content[next] == "\"" {
-              token.append(String(repeating: "\\", count: count / 2))
-              content.removeFirst(count)
-
-              if count % 2 != 0 {
-                token.append("\"")
-                content.removeFirst(1)
-              }
-            } else {
-              token.append(String(repeating: "\\", count: count))
-              content.removeFirst(count)
-            }
-          } else {
-            token.append(String(repeating: "\\", count: content.count))
-            content.removeFirst(content.count)
-          }
-
-        case "\"":
-          content.removeFirst(1)
-
-          if quoted, content.first == "\"" {
-            // Consecutive double quotes inside a quoted string implies one quote
-            token.append("\"")
-            content.removeFirst(1)
-          }
-
-          quoted.toggle()
-
-        default:
-          fatalError("unexpected character '\(content.first!)'")
-        }
-      } else {
-        // Consume to end of content.
-        token.append(content)
-        content.removeFirst(content.count)
-        break
-      }
-    }
-
-    if !token.isEmpty { tokens.append(token) }
-    return tokens.filter { !$0.isEmpty }
-  }
-
   /// Tokenize each line of the response file, omitting empty lines.
   ///
   /// - Parameter content: response file's content to be tokenized.
-  private static func tokenizeResponseFile(_ content: String) -> [String] {
+  private static func tokenizeResponseFile(_ content: UnsafeRawBufferPointer) -> [String] {
     #if !canImport(Darwin) && !os(Linux) && !os(Android) && !os(OpenBSD) && !os(Windows)
       #warning("Response file tokenization unimplemented for platform; behavior may be incorrect")
     #endif
-#if os(Windows)
-    return content.split { $0 == "\n" || $0 == "\r\n" }
-                  .flatMap { tokenizeWindowsResponseFile(String($0)) }
-#else
-    return content.split { $0 == "\n" || $0 == "\r\n" }
-                  .flatMap { tokenizeResponseFileLine($0) }
-#endif
+    return ResponseFileTokenizer.arguments(in: content)
   }
 
   /// Resolves the absolute path for a response file.
@@ -1834,8 +1702,8 @@ extension Driver {
           visitedResponseFiles.remove(visitationToken)
         }
 
-        let contents = try fileSystem.readFileContents(responseFile).cString
-        let lines = tokenizeResponseFile(contents)
+        let lines = try withResponseFileContents(responseFile, fileSystem: fileSystem,
+                                                 tokenizeResponseFile)
         result.append(contentsOf: try expandResponseFiles(lines, fileSystem: fileSystem, diagnosticsEngine: diagnosticsEngine, relativeTo: basePath, visitedResponseFiles: &visitedResponseFiles))
       } else {
         result.append(arg)
@@ -2058,6 +1926,7 @@ extension Driver {
       mode: mode,
       buildRecordInfo: buildRecordInfo,
       showJobLifecycle: showJobLifecycle,
+      reportsCacheQueries: parsedOptions.contains(.parseableOutputCacheQueries),
       argsResolver: executor.resolver,
       diagnosticEngine: diagnosticEngine,
       reproducerCallback: supportsReproducer ? Driver.generateReproducer : nil,
@@ -2071,10 +1940,37 @@ extension Driver {
     forceResponseFiles: Bool
   ) throws {
     let continueBuildingAfterErrors = computeContinueBuildingAfterErrors()
+    var workload = DriverExecutorWorkload(allJobs,
+                                          incrementalCompilationState,
+                                          continueBuildingAfterErrors: continueBuildingAfterErrors)
+    let plannedJobs = incrementalCompilationState.map { $0.mandatoryJobsInOrder + $0.jobsAfterCompiles } ?? allJobs
+    var prefetcher: CachedOutputPrefetcher? = nil
+    if let cacheQueryResults = queryOutputCacheKeys(of: plannedJobs) {
+      if parsedOptions.contains(.cacheRemarks) {
+        diagnosticEngine.emit(.remark_cache_query_summary(cacheQueryResults))
+      }
+      jobExecutionDelegate.cacheQueried(results: cacheQueryResults)
+      workload.cacheQueryResults = cacheQueryResults
+      prefetcher = startPrefetchingCachedOutputs(of: plannedJobs, missingFrom: cacheQueryResults)
+    }
+    let casStorageManager = startManagingCASStorage()
+    defer {
+      if let casStorageManager = casStorageManager {
+        finishManagingCASStorage(casStorageManager, jobs: plannedJobs)
+      }
+    }
+    defer {
+      if let prefetcher = prefetcher {
+        // Whatever hasn't arrived by now is of no use to this build.
+        prefetcher.cancel()
+        let statistics = prefetcher.wait()
+        if parsedOptions.contains(.cacheRemarks) {
+          diagnosticEngine.emit(.remark_cache_prefetch_summary(statistics, maxInFlight: prefetcher.maxInFlight))
+        }
+      }
+    }
     try executor.execute(
-      workload: .init(allJobs,
-                      incrementalCompilationState,
-                      continueBuildingAfterErrors: continueBuildingAfterErrors),
+      workload: workload,
       delegate: jobExecutionDelegate,
       numParallelJobs: numParallelJobs ?? 1,
       forceResponseFiles: forceResponseFiles,
@@ -2082,6 +1978,9 @@ extension Driver {
   }
 
   public func writeIncrementalBuildInformation(_ jobs: [Job]) {
+    // Without the input hashes, the next build just hashes every input again.
+    try? inputHashCache?.save(fileSystem: fileSystem)
+
     // In case the write fails, don't crash the build.
     // A mitigation to rdar://76359678.
     // If the write fails, import incrementality is lost, but it is not a fatal error.
@@ -2243,7 +2142,7 @@ extension Driver {
   /// If the parsed option does contain an option with this value, but the
   /// value is not parsable as an `Int`, emits an error and returns `nil`.
   /// Otherwise, returns the parsed value.
-  private static func parseIntOption(
+  static func parseIntOption(
     _ parsedOptions: inout ParsedOptions,
     option: Option,
     diagnosticsEngine: DiagnosticsEngine
@@ -2392,7 +2291,7 @@ extension Driver {
                                             to parsedOptions: inout ParsedOptions) throws {
     try parsedOptions.forEachModifying { parsedOption in
       // Only translate options whose arguments are paths.
-      if !parsedOption.option.attributes.contains(.argumentIsPath) { return }
+      if !parsedOption.option.hasAttributes(.argumentIsPath) { return }
 
       let translatedArgument: ParsedOption.Argument
       switch parsedOption.argument {
@@ -2669,6 +2568,21 @@ extension Driver {
     return numJobs
   }
 
+  /// Parses `-cas-size-limit`, which takes a `K`, `M` or `G` suffix.
+  static func determineCASSizeLimit(
+    _ parsedOptions: inout ParsedOptions,
+    diagnosticsEngine: DiagnosticsEngine
+  ) -> Int64? {
+    guard let limit = parsedOptions.getLastArgument(.casSizeLimit)?.asSingle else {
+      return nil
+    }
+    guard let size = CASStorageManager.parseSize(limit) else {
+      diagnosticsEngine.emit(.error_invalid_arg_value(arg: .casSizeLimit, value: limit))
+      return nil
+    }
+    return size
+  }
+
   private mutating func computeContinueBuildingAfterErrors() -> Bool {
     // Note: Batch mode handling of serialized diagnostics requires that all
     // batches get to run, in order to make sure that all diagnostics emitted
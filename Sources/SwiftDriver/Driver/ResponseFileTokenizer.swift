@@ -0,0 +1,439 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import protocol TSCBasic.FileSystem
+import struct Foundation.Data
+import struct Foundation.URL
+import struct TSCBasic.AbsolutePath
+import var TSCBasic.localFileSystem
+
+/// Splits the contents of a response file into arguments, working directly on
+/// the bytes of the file.
+///
+/// Each line of the file is tokenized on its own, with either the POSIX shell
+/// rules of `tokenizeResponseFileLine` or the Microsoft C runtime rules of
+/// `tokenizeWindowsResponseFile`. Ordinary bytes are skipped a word at a time,
+/// and an argument which needs no unescaping is passed on as a slice of the
+/// contents rather than being copied.
+struct ResponseFileTokenizer {
+  enum Style {
+    /// Shell-like quoting and backslash escaping, and `//` comments at the
+    /// beginning of a line.
+    case posix
+    /// The rules for parsing C command-line arguments on Windows.
+    /// https://docs.microsoft.com/en-us/previous-versions//17w5ykft(v=vs.85)
+    case windows
+
+    /// The rules for the host platform.
+    #if os(Windows)
+    static let host = Style.windows
+    #else
+    static let host = Style.posix
+    #endif
+  }
+
+  private let bytes: UnsafeRawBufferPointer
+  private let style: Style
+
+  /// The position of the next byte to tokenize.
+  private var position = 0
+  /// The start of the argument being tokenized, if its bytes so far are a
+  /// contiguous slice of `bytes` ending at `position`.
+  private var sliceStart: Int? = nil
+  /// The unescaped bytes of the argument being tokenized, once it can no
+  /// longer be represented by a slice.
+  private var unescaped: [UInt8] = []
+
+  private init(bytes: UnsafeRawBufferPointer, style: Style) {
+    self.bytes = bytes
+    self.style = style
+  }
+
+  /// Calls `body` with each argument in the given response file contents.
+  ///
+  /// The buffer passed to `body` is only valid for the duration of the call.
+  ///
+  /// - Complexity: O(*n*), where *n* is the size of the contents.
+  static func forEachArgument(
+    in bytes: UnsafeRawBufferPointer,
+    style: Style = .host,
+    _ body: (UnsafeRawBufferPointer) throws -> Void
+  ) rethrows {
+    var tokenizer = ResponseFileTokenizer(bytes: bytes, style: style)
+    while tokenizer.position < bytes.count {
+      let end = tokenizer.endOfLine()
+      switch style {
+      case .posix:
+        try tokenizer.tokenizePOSIXLine(upTo: end, body)
+      case .windows:
+        try tokenizer.tokenizeWindowsLine(upTo: end, body)
+      }
+      // Skip the line terminator.
+      tokenizer.position = end
+      if tokenizer.position < bytes.count, bytes[tokenizer.position] == .carriageReturn {
+        tokenizer.position += 1
+      }
+      tokenizer.position += 1
+    }
+  }
+
+  /// Returns the arguments in the given response file contents.
+  static func arguments(in bytes: UnsafeRawBufferPointer, style: Style = .host) -> [String] {
+    var result: [String] = []
+    forEachArgument(in: bytes, style: style) {
+      result.append(String(decoding: $0, as: UTF8.self))
+    }
+    return result
+  }
+
+  /// Returns the end of the current line, which excludes its `\n` or `\r\n`
+  /// terminator.
+  private func endOfLine() -> Int {
+    let end = Self.firstCandidate(in: bytes, from: position, where: Self.newlineMask)
+    if end < bytes.count, end > position, bytes[end - 1] == .carriageReturn {
+      return end - 1
+    }
+    return end
+  }
+
+  // MARK: POSIX rules
+
+  /// Tokenizes a line with the rules of `tokenizeResponseFileLine`.
+  private mutating func tokenizePOSIXLine(
+    upTo end: Int,
+    _ body: (UnsafeRawBufferPointer) throws -> Void
+  ) rethrows {
+    // Support double slash comments only if they start at the beginning of a line.
+    if end - position >= 2, bytes[position] == .slash, bytes[position + 1] == .slash {
+      return
+    }
+    var quoted = false
+    while position < end {
+      let next = Self.firstCandidate(
+        in: bytes, from: position, upTo: end,
+        where: quoted ? Self.posixQuotedMask : Self.posixUnquotedMask)
+      extendArgument(to: next)
+      guard next < end else { break }
+
+      let byte = bytes[next]
+      switch byte {
+      case .backslash:
+        // A backslash escapes the next character, if there is one on this line.
+        breakSlice(at: next)
+        position = min(next + 1 + Self.scalarLength(at: next + 1, in: bytes), end)
+        unescaped.append(contentsOf: bytes[(next + 1)..<position])
+      case .doubleQuote, .singleQuote:
+        // An unescaped shell quote begins or ends quoting.
+        breakSlice(at: next)
+        quoted.toggle()
+        position = next + 1
+      default:
+        let length = min(Self.scalarLength(at: next, in: bytes), end - next)
+        if !quoted && Self.isWhitespace(at: next, length: length, in: bytes) {
+          // Unquoted, unescaped whitespace ends the argument.
+          try finishArgument(body)
+          position = next + length
+        } else {
+          // Control characters and non-ASCII scalars are usually ordinary.
+          extendArgument(to: next + length)
+        }
+      }
+    }
+    try finishArgument(body)
+  }
+
+  // MARK: Windows rules
+
+  /// Tokenizes a line with the rules of `tokenizeWindowsResponseFile`.
+  private mutating func tokenizeWindowsLine(
+    upTo end: Int,
+    _ body: (UnsafeRawBufferPointer) throws -> Void
+  ) rethrows {
+    var quoted = false
+    while position < end {
+      // Eat whitespace at the beginning of an argument.
+      if !hasArgument {
+        while position < end, Self.isWindowsWhitespace(bytes[position]) {
+          position += 1
+        }
+        if position == end { break }
+      }
+
+      let next = Self.firstCandidate(
+        in: bytes, from: position, upTo: end,
+        where: quoted ? Self.windowsQuotedMask : Self.windowsUnquotedMask)
+      extendArgument(to: next)
+      guard next < end else { break }
+
+      let byte = bytes[next]
+      switch byte {
+      case .backslash:
+        // Backslashes are interpreted in a special manner due to use as both
+        // a path separator and an escape character. Runs of backslashes are
+        // literal unless they are followed by a double quote, in which case
+        // one backslash is emitted for each pair, and an odd backslash
+        // escapes the double quote.
+        var afterRun = next
+        while afterRun < end, bytes[afterRun] == .backslash {
+          afterRun += 1
+        }
+        if afterRun < end, bytes[afterRun] == .doubleQuote {
+          let count = afterRun - next
+          breakSlice(at: next)
+          unescaped.append(contentsOf: repeatElement(.backslash, count: count / 2))
+          if count % 2 != 0 {
+            unescaped.append(.doubleQuote)
+            position = afterRun + 1
+          } else {
+            position = afterRun
+          }
+        } else {
+          extendArgument(to: afterRun)
+        }
+      case .doubleQuote:
+        breakSlice(at: next)
+        position = next + 1
+        if quoted, position < end, bytes[position] == .doubleQuote {
+          // Consecutive double quotes inside a quoted string implies one quote.
+          unescaped.append(.doubleQuote)
+          position += 1
+        }
+        quoted.toggle()
+      default:
+        if Self.isWindowsWhitespace(byte) {
+          try finishArgument(body)
+          position = next + 1
+        } else {
+          extendArgument(to: next + 1)
+        }
+      }
+    }
+    try finishArgument(body)
+  }
+
+  // MARK: Building arguments
+
+  /// Whether any bytes have been added to the current argument.
+  private var hasArgument: Bool {
+    sliceStart != nil || !unescaped.isEmpty
+  }
+
+  /// Adds the bytes from `position` up to `end` to the current argument.
+  private mutating func extendArgument(to end: Int) {
+    if end > position {
+      if !unescaped.isEmpty {
+        unescaped.append(contentsOf: bytes[position..<end])
+      } else if sliceStart == nil {
+        sliceStart = position
+      }
+    }
+    position = end
+  }
+
+  /// Copies the current argument out of `bytes`, because the byte at `index`
+  /// is about to be dropped from it.
+  private mutating func breakSlice(at index: Int) {
+    if let start = sliceStart {
+      unescaped.append(contentsOf: bytes[start..<index])
+      sliceStart = nil
+    }
+  }
+
+  /// Passes the current argument, if it is not empty, to `body`.
+  private mutating func finishArgument(
+    _ body: (UnsafeRawBufferPointer) throws -> Void
+  ) rethrows {
+    if let start = sliceStart, unescaped.isEmpty {
+      try body(UnsafeRawBufferPointer(rebasing: bytes[start..<position]))
+    } else {
+      breakSlice(at: position)
+      if !unescaped.isEmpty {
+        try unescaped.withUnsafeBytes(body)
+      }
+    }
+    sliceStart = nil
+    unescaped.removeAll(keepingCapacity: true)
+  }
+
+  // MARK: Classifying bytes
+
+  /// A byte that may need to be handled specially, as a bit in a 256-bit
+  /// mask.
+  private typealias CandidateMask = (UInt64, UInt64, UInt64, UInt64)
+
+  private static func mask(_ bytes: [UInt8], nonASCII: Bool = false,
+                           controls: Bool = false) -> CandidateMask {
+    var words: [UInt64] = [0, 0, 0, 0]
+    for byte in bytes {
+      words[Int(byte / 64)] |= 1 << UInt64(byte % 64)
+    }
+    if controls {
+      // Every byte up to and including the space.
+      words[0] |= (1 << 33) - 1
+    }
+    if nonASCII {
+      words[2] = .max
+      words[3] = .max
+    }
+    return (words[0], words[1], words[2], words[3])
+  }
+
+  private static let newlineMask = mask([.newline])
+  private static let posixUnquotedMask = mask(
+    [.doubleQuote, .singleQuote, .backslash], nonASCII: true, controls: true)
+  private static let posixQuotedMask = mask(
+    [.doubleQuote, .singleQuote, .backslash])
+  private static let windowsUnquotedMask = mask(
+    [.doubleQuote, .backslash], controls: true)
+  private static let windowsQuotedMask = mask(
+    [.doubleQuote, .backslash])
+
+  private static func isCandidate(_ byte: UInt8, _ mask: CandidateMask) -> Bool {
+    let word: UInt64
+    switch byte / 64 {
+    case 0: word = mask.0
+    case 1: word = mask.1
+    case 2: word = mask.2
+    default: word = mask.3
+    }
+    return word & (1 << UInt64(byte % 64)) != 0
+  }
+
+  /// Returns the index of the first byte in `bytes[start..<end]` which is in
+  /// the given mask, or `end` if there isn't one.
+  ///
+  /// Ordinary bytes are skipped eight at a time. Each mask only contains
+  /// bytes that are either less than `!`, non-ASCII, or one of the newline,
+  /// quote and backslash characters, which can all be detected across a whole
+  /// word with a few arithmetic operations. The exact mask is then checked a
+  /// byte at a time within a word that may have a match.
+  private static func firstCandidate(
+    in bytes: UnsafeRawBufferPointer, from start: Int, upTo end: Int? = nil,
+    where mask: CandidateMask
+  ) -> Int {
+    let end = end ?? bytes.count
+    var index = start
+    while index + 8 <= end {
+      let word = UInt64(littleEndian: bytes.loadUnaligned(fromByteOffset: index, as: UInt64.self))
+      var matches = equalBytes(word, .newline)
+      if mask.0 & (1 << UInt64(UInt8.doubleQuote)) != 0 {
+        matches |= equalBytes(word, .doubleQuote)
+      }
+      if mask.0 & (1 << UInt64(UInt8.singleQuote)) != 0 {
+        matches |= equalBytes(word, .singleQuote)
+      }
+      if mask.1 & (1 << UInt64(UInt8.backslash - 64)) != 0 {
+        matches |= equalBytes(word, .backslash)
+      }
+      if mask.0 & 1 != 0 {
+        matches |= bytesLessThan(word, .space + 1)
+      }
+      if mask.2 != 0 {
+        matches |= word & 0x8080_8080_8080_8080
+      }
+      if matches != 0 {
+        // Only the lowest set bit is exact, so recheck the rest of the word.
+        for candidate in (index + matches.trailingZeroBitCount / 8)..<(index + 8)
+            where isCandidate(bytes[candidate], mask) {
+          return candidate
+        }
+      }
+      index += 8
+    }
+    while index < end {
+      if isCandidate(bytes[index], mask) {
+        return index
+      }
+      index += 1
+    }
+    return end
+  }
+
+  /// Sets the high bit of every byte of `word` which is equal to `byte`. Only
+  /// the lowest set bit is guaranteed to be exact.
+  private static func equalBytes(_ word: UInt64, _ byte: UInt8) -> UInt64 {
+    bytesLessThan(word ^ (0x0101_0101_0101_0101 &* UInt64(byte)), 1)
+  }
+
+  /// Sets the high bit of every byte of `word` which is less than `bound`,
+  /// which is at most 128. Only the lowest set bit is guaranteed to be exact.
+  private static func bytesLessThan(_ word: UInt64, _ bound: UInt8) -> UInt64 {
+    (word &- 0x0101_0101_0101_0101 &* UInt64(bound)) & ~word & 0x8080_8080_8080_8080
+  }
+
+  /// The number of bytes in the UTF-8 encoded scalar starting at `index`, or 1
+  /// if it is not a valid lead byte. Returns 0 at the end of the bytes.
+  private static func scalarLength(at index: Int, in bytes: UnsafeRawBufferPointer) -> Int {
+    guard index < bytes.count else { return 0 }
+    switch bytes[index] {
+    case 0xC0...0xDF: return 2
+    case 0xE0...0xEF: return 3
+    case 0xF0...0xF7: return 4
+    default: return 1
+    }
+  }
+
+  /// Whether the scalar at the given position is whitespace, according to
+  /// `Character.isWhitespace`.
+  private static func isWhitespace(at index: Int, length: Int,
+                                   in bytes: UnsafeRawBufferPointer) -> Bool {
+    let byte = bytes[index]
+    if byte < 0x80 {
+      return (0x09...0x0D).contains(byte) || byte == .space
+    }
+    var decoder = UTF8()
+    var iterator = bytes[index..<(index + length)].makeIterator()
+    guard case .scalarValue(let scalar) = decoder.decode(&iterator) else {
+      return false
+    }
+    return scalar.properties.isWhitespace
+  }
+
+  private static func isWindowsWhitespace(_ byte: UInt8) -> Bool {
+    byte == .space || byte == .tab || byte == .carriageReturn ||
+      byte == .newline || byte == 0
+  }
+}
+
+fileprivate extension UInt8 {
+  static let tab = UInt8(ascii: "\t")
+  static let newline = UInt8(ascii: "\n")
+  static let carriageReturn = UInt8(ascii: "\r")
+  static let space = UInt8(ascii: " ")
+  static let doubleQuote = UInt8(ascii: "\"")
+  static let singleQuote = UInt8(ascii: "'")
+  static let slash = UInt8(ascii: "/")
+  static let backslash = UInt8(ascii: "\\")
+}
+
+extension Driver {
+  /// Calls `body` with the contents of a response file. The file is mapped
+  /// into memory rather than read when it is on the local file system.
+  ///
+  /// A file which can't be mapped is read through `fileSystem` instead, so
+  /// that failures are still reported as the `FileSystemError`s callers
+  /// expect, rather than as Foundation errors.
+  static func withResponseFileContents<T>(
+    _ path: AbsolutePath,
+    fileSystem: FileSystem,
+    _ body: (UnsafeRawBufferPointer) throws -> T
+  ) throws -> T {
+    if fileSystem.isLocal,
+       let data = try? Data(contentsOf: URL(fileURLWithPath: path.pathString),
+                            options: .alwaysMapped) {
+      return try data.withUnsafeBytes(body)
+    }
+    return try fileSystem.readFileContents(path).contents.withUnsafeBytes(body)
+  }
+}
@@ -58,6 +58,9 @@ import class TSCBasic.Process
   public let mode: Mode
   public let buildRecordInfo: BuildRecordInfo?
   public let showJobLifecycle: Bool
+  /// Whether parseable output includes the `cache-queried` message, which
+  /// consumers only expecting the documented kinds of message may reject.
+  public let reportsCacheQueries: Bool
   public let diagnosticEngine: DiagnosticsEngine
   public var anyJobHadAbnormalExit: Bool = false
 
@@ -75,6 +78,7 @@ import class TSCBasic.Process
   @_spi(Testing) public init(mode: ToolExecutionDelegate.Mode,
                              buildRecordInfo: BuildRecordInfo?,
                              showJobLifecycle: Bool,
+                             reportsCacheQueries: Bool = false,
                              argsResolver: ArgsResolver,
                              diagnosticEngine: DiagnosticsEngine,
                              reproducerCallback: ReproducerCallback? = nil,
@@ -83,6 +87,7 @@ import class TSCBasic.Process
     self.mode = mode
     self.buildRecordInfo = buildRecordInfo
     self.showJobLifecycle = showJobLifecycle
+    self.reportsCacheQueries = reportsCacheQueries
     self.diagnosticEngine = diagnosticEngine
     self.argsResolver = argsResolver
     self.nextBatchQuasiPID = ToolExecutionDelegate.QUASI_PID_START
@@ -189,6 +194,20 @@ import class TSCBasic.Process
     }
   }
 
+  public func cacheQueried(results: CacheQueryResults) {
+    switch mode {
+    case .regular, .verbose, .silent:
+      break
+    case .parsableOutput:
+      guard reportsCacheQueries else { return }
+      let queriedMessage = CacheQueriedMessage(keys: results.keys.count,
+                                               hits: results.hitCount,
+                                               misses: results.missCount,
+                                               latencyMilliseconds: results.latencyNanoseconds / 1_000_000)
+      emit(ParsableMessage(name: "cache-query", kind: .cacheQueried(queriedMessage)))
+    }
+  }
+
   public func getReproducerJob(job: Job, output: VirtualPath) -> Job? {
     guard let reproducerCallback = reproducerCallback else {
       return nil
@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import class Dispatch.DispatchGroup
+import class Dispatch.DispatchQueue
+
+/// Keeps an on-disk CAS within a size budget, and reports what it holds.
+///
+/// The CAS evicts the least recently used data in generations: once it grows
+/// past its size limit, the data still in use is moved to a new generation
+/// and the older ones can be pruned. Pruning deletes those directories, so it
+/// runs in the background, alongside the build's jobs, which don't use them.
+public final class CASStorageManager {
+  /// The on-disk sizes of the CAS before and after it was pruned.
+  public struct PruneResult {
+    public let sizeBefore: Int64?
+    public let sizeAfter: Int64?
+    public let sizeLimit: Int64
+  }
+
+  /// The outputs of a set of cached compilations, by output kind.
+  public struct Usage: Equatable {
+    /// How many outputs of each kind the compilations have.
+    public var outputs: [String: Int] = [:]
+    /// How many of those are in the local CAS, rather than only in a remote
+    /// cache.
+    public var materializedOutputs: [String: Int] = [:]
+    /// How many of the queried cache keys had no cached compilation.
+    public var missingKeys = 0
+  }
+
+  public let cas: SwiftScanCAS
+  public let sizeLimit: Int64
+
+  private let queue = DispatchQueue(label: "org.swift.swift-driver.cas-storage-manager")
+  private let group = DispatchGroup()
+  private var pruneResult: Result<PruneResult, Swift.Error>? = nil
+
+  /// Returns nil if the CAS can't manage its size.
+  public init?(cas: SwiftScanCAS, sizeLimit: Int64) {
+    guard cas.supportsSizeManagement else {
+      return nil
+    }
+    self.cas = cas
+    self.sizeLimit = sizeLimit
+  }
+
+  /// Sets the CAS's size limit, which it enforces when it is closed, and
+  /// prunes its data from before the limit was last exceeded.
+  public func enforceSizeLimit() throws -> PruneResult {
+    try cas.setSizeLimit(sizeLimit)
+    let sizeBefore = try cas.getStorageSize()
+    try cas.prune()
+    return PruneResult(sizeBefore: sizeBefore, sizeAfter: try cas.getStorageSize(),
+                       sizeLimit: sizeLimit)
+  }
+
+  /// Calls `enforceSizeLimit()` on a background queue. Its result is returned
+  /// by `wait()`.
+  public func startEnforcingSizeLimit() {
+    queue.async(group: group) {
+      self.pruneResult = Result { try self.enforceSizeLimit() }
+    }
+  }
+
+  /// Waits for the size limit to have been enforced, returning the result, or
+  /// nil if it wasn't started.
+  public func wait() throws -> PruneResult? {
+    group.wait()
+    return try queue.sync { try pruneResult?.get() }
+  }
+
+  /// Counts the outputs of the compilations cached under `keys` in the local
+  /// CAS, by the kind of output.
+  public func usage(ofCacheKeys keys: [String]) throws -> Usage {
+    var usage = Usage()
+    for key in Set(keys) {
+      guard let compilation = try cas.queryCacheKey(key, globally: false) else {
+        usage.missingKeys += 1
+        continue
+      }
+      for output in compilation {
+        let kind = try output.getOutputKindName()
+        usage.outputs[kind, default: 0] += 1
+        if output.isMaterialized {
+          usage.materializedOutputs[kind, default: 0] += 1
+        }
+      }
+    }
+    return usage
+  }
+
+  /// Parses a size in bytes, optionally with a `K`, `M` or `G` suffix for
+  /// multiples of 1024.
+  public static func parseSize(_ string: String) -> Int64? {
+    var digits = Substring(string)
+    var multiplier: Int64 = 1
+    switch digits.last?.uppercased() {
+    case "K": multiplier = 1 << 10
+    case "M": multiplier = 1 << 20
+    case "G": multiplier = 1 << 30
+    default: break
+    }
+    if multiplier != 1 {
+      digits = digits.dropLast()
+    }
+    guard let size = Int64(digits), size >= 0 else {
+      return nil
+    }
+    let (result, overflow) = size.multipliedReportingOverflow(by: multiplier)
+    return overflow ? nil : result
+  }
+}
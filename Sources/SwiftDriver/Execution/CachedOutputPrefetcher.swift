@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import class Foundation.NSCondition
+import class Foundation.NSLock
+
+/// Something that can bring the cached outputs of a cache key into the local
+/// CAS, such as a `SwiftScanCAS` backed by a remote cache.
+public protocol CachedOutputFetcher: AnyObject {
+  /// Starts fetching the outputs of `key` and returns without waiting for it.
+  ///
+  /// Every asynchronous operation must be registered with `cancellation`
+  /// before it is started, so that a cancellation which arrives while it
+  /// starts still reaches it. `completion` is called at most once, from any
+  /// thread, with whether all of the outputs are now in the local CAS; it
+  /// need not be called once the fetch is cancelled.
+  func fetchOutputs(of key: String,
+                    cancellation: CachedOutputPrefetcher.Cancellation,
+                    completion: @escaping (Result<Bool, Swift.Error>) -> Void)
+}
+
+/// Fetches the cached outputs of jobs that are about to run into the local
+/// CAS, so that the download latency overlaps with other jobs instead of
+/// delaying the job which needs them.
+///
+/// Keys are fetched in the order they are given, with at most `maxInFlight`
+/// fetches at a time. Prefetching is only an optimization: a job whose
+/// outputs haven't arrived yet fetches them itself.
+public final class CachedOutputPrefetcher {
+  /// Cancels the asynchronous operations of a single fetch.
+  public final class Cancellation {
+    private let lock = NSLock()
+    private var cancelled = false
+    private var handlers: [() -> Void] = []
+
+    public var isCancelled: Bool {
+      lock.lock()
+      defer { lock.unlock() }
+      return cancelled
+    }
+
+    /// Adds an action to run when the fetch is cancelled. It runs right away
+    /// if the fetch has already been cancelled.
+    public func register(_ handler: @escaping () -> Void) {
+      lock.lock()
+      guard !cancelled else {
+        lock.unlock()
+        return handler()
+      }
+      handlers.append(handler)
+      lock.unlock()
+    }
+
+    fileprivate func cancel() {
+      lock.lock()
+      cancelled = true
+      let handlers = self.handlers
+      self.handlers.removeAll()
+      lock.unlock()
+      handlers.forEach { $0() }
+    }
+  }
+
+  public struct Statistics: Equatable {
+    /// The keys whose outputs are all in the local CAS now.
+    public var fetched = 0
+    /// The keys that aren't cached, or only partially.
+    public var unavailable = 0
+    /// The keys whose fetch failed.
+    public var failed = 0
+    /// The keys that were never fetched because of cancellation.
+    public var skipped = 0
+    /// The fetches that were still in flight when they were cancelled, which
+    /// nobody waits for, since nothing needs their outputs any more.
+    public var abandoned = 0
+    /// The largest number of fetches that were in flight at once.
+    public var peakInFlight = 0
+  }
+
+  private let fetcher: CachedOutputFetcher
+  public let maxInFlight: Int
+
+  /// Guards the state below, and signals whenever the last fetch in flight
+  /// completes or is abandoned.
+  private let condition = NSCondition()
+  private var pendingKeys: [String] = []
+  private var nextPendingKey = 0
+  private var inFlight: [Int: Cancellation] = [:]
+  private var nextFetchID = 0
+  private var isCancelled = false
+  private var statistics = Statistics()
+
+  public init(fetcher: CachedOutputFetcher, maxInFlight: Int) {
+    precondition(maxInFlight > 0, "prefetching needs at least one fetch in flight")
+    self.fetcher = fetcher
+    self.maxInFlight = maxInFlight
+  }
+
+  /// Queues `keys` to be fetched after the ones queued before them.
+  public func prefetch(_ keys: [String]) {
+    condition.lock()
+    guard !isCancelled else {
+      statistics.skipped += keys.count
+      condition.unlock()
+      return
+    }
+    pendingKeys.append(contentsOf: keys)
+    let started = startFetchesLocked()
+    condition.unlock()
+    started.forEach(fetch)
+  }
+
+  /// Drops the keys that haven't been fetched yet, and cancels and abandons
+  /// the fetches that are in flight.
+  public func cancel() {
+    condition.lock()
+    isCancelled = true
+    statistics.skipped += pendingKeys.count - nextPendingKey
+    pendingKeys.removeAll()
+    nextPendingKey = 0
+    let inFlight = Array(self.inFlight.values)
+    statistics.abandoned += inFlight.count
+    self.inFlight.removeAll()
+    condition.broadcast()
+    condition.unlock()
+    inFlight.forEach { $0.cancel() }
+  }
+
+  /// Blocks until every fetch that has started has completed or been
+  /// cancelled, and returns what happened to the queued keys.
+  ///
+  /// This does not wait for cancelled fetches to wind down, so that a build
+  /// never waits on downloads nobody needs.
+  public func wait() -> Statistics {
+    condition.lock()
+    defer { condition.unlock() }
+    while !inFlight.isEmpty {
+      condition.wait()
+    }
+    return statistics
+  }
+
+  /// Takes as many keys off the queue as there are free fetch slots.
+  private func startFetchesLocked() -> [(id: Int, key: String, cancellation: Cancellation)] {
+    var started: [(id: Int, key: String, cancellation: Cancellation)] = []
+    while inFlight.count < maxInFlight, nextPendingKey < pendingKeys.count {
+      let cancellation = Cancellation()
+      let id = nextFetchID
+      nextFetchID += 1
+      inFlight[id] = cancellation
+      started.append((id, pendingKeys[nextPendingKey], cancellation))
+      nextPendingKey += 1
+    }
+    statistics.peakInFlight = max(statistics.peakInFlight, inFlight.count)
+    return started
+  }
+
+  /// Fetches outside of the lock, since `completion` may be called before
+  /// `fetchOutputs` returns.
+  private func fetch(_ fetch: (id: Int, key: String, cancellation: Cancellation)) {
+    // Don't start what has been cancelled since it was taken off the queue.
+    guard !fetch.cancellation.isCancelled else {
+      return
+    }
+    fetcher.fetchOutputs(of: fetch.key, cancellation: fetch.cancellation) { result in
+      self.condition.lock()
+      // An abandoned fetch has already been accounted for.
+      guard self.inFlight.removeValue(forKey: fetch.id) != nil else {
+        self.condition.unlock()
+        return
+      }
+      switch result {
+      case .success(true):
+        self.statistics.fetched += 1
+      case .success(false):
+        self.statistics.unavailable += 1
+      case .failure:
+        self.statistics.failed += 1
+      }
+      let started = self.startFetchesLocked()
+      if self.inFlight.isEmpty {
+        self.condition.broadcast()
+      }
+      self.condition.unlock()
+      started.forEach(self.fetch)
+    }
+  }
+}
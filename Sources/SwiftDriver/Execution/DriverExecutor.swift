@@ -113,6 +113,10 @@ public struct DriverExecutorWorkload {
 
   public let kind: Kind
 
+  /// If non-nil, which of the jobs' outputs were found in the compilation
+  /// cache before execution, so that the executor can order them.
+  public var cacheQueryResults: CacheQueryResults? = nil
+
   @available(*, deprecated, message: "use of 'interModuleDependencyGraph' on 'DriverExecutorWorkload' is deprecated")
   public let interModuleDependencyGraph: InterModuleDependencyGraph? = nil
 
@@ -136,6 +140,55 @@ public struct DriverExecutorWorkload {
   }
 }
 
+/// The answers to the compilation cache queries made for the output cache
+/// keys of the planned jobs, before any of them is executed.
+public struct CacheQueryResults {
+  /// Whether a job's outputs can be replayed from the cache.
+  public enum Status {
+    /// Every output of the job is available in the cache.
+    case hit
+    /// At least one output of the job must be compiled.
+    case miss
+  }
+
+  /// Whether each queried cache key was a hit. Keys whose query failed are
+  /// misses, since their jobs will have to run the compiler.
+  public let keys: [String: Bool]
+
+  /// The time between issuing the first query and receiving the last answer.
+  public let latencyNanoseconds: UInt64
+
+  public init(keys: [String: Bool], latencyNanoseconds: UInt64) {
+    self.keys = keys
+    self.latencyNanoseconds = latencyNanoseconds
+  }
+
+  public var hitCount: Int {
+    keys.values.lazy.filter { $0 }.count
+  }
+
+  public var missCount: Int {
+    keys.count - hitCount
+  }
+
+  /// Returns whether all of `job`'s outputs are cached, or nil if none of its
+  /// cache keys were queried.
+  public func status(of job: Job) -> Status? {
+    var status: Status? = nil
+    for key in job.outputCacheKeys.values {
+      switch keys[key] {
+      case .none:
+        continue
+      case .some(false):
+        return .miss
+      case .some(true):
+        status = .hit
+      }
+    }
+    return status
+  }
+}
+
 @_spi(Testing) public enum JobExecutionError: Error {
   case jobFailedWithNonzeroExitCode(Int, String)
   case failedToReadJobOutput
@@ -211,6 +264,14 @@ public protocol JobExecutionDelegate {
 
   /// Create a new job that constructs a reproducer for the providing job.
   func getReproducerJob(job: Job, output: VirtualPath) -> Job?
+
+  /// Called when the compilation cache has been queried for the planned jobs,
+  /// before any of them starts.
+  func cacheQueried(results: CacheQueryResults)
+}
+
+extension JobExecutionDelegate {
+  public func cacheQueried(results: CacheQueryResults) {}
 }
 
 @_spi(Testing) public extension ProcessEnvironmentBlock {
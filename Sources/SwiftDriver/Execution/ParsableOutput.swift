@@ -22,6 +22,7 @@ import class Foundation.JSONEncoder
     case abnormal(AbnormalExitMessage)
     case signalled(SignalledMessage)
     case skipped(SkippedMessage)
+    case cacheQueried(CacheQueriedMessage)
   }
 
   public let name: String
@@ -111,6 +112,27 @@ import class Foundation.JSONEncoder
   }
 }
 
+@_spi(Testing) public struct CacheQueriedMessage: Encodable {
+  public let keys: Int
+  public let hits: Int
+  public let misses: Int
+  public let latencyMilliseconds: UInt64
+
+  public init(keys: Int, hits: Int, misses: Int, latencyMilliseconds: UInt64) {
+    self.keys = keys
+    self.hits = hits
+    self.misses = misses
+    self.latencyMilliseconds = latencyMilliseconds
+  }
+
+  private enum CodingKeys: String, CodingKey {
+    case keys
+    case hits
+    case misses
+    case latencyMilliseconds = "latency-ms"
+  }
+}
+
 @_spi(Testing) public struct FinishedMessage: Encodable {
   let exitStatus: Int
   let pid: Int
@@ -208,6 +230,9 @@ import class Foundation.JSONEncoder
     case .skipped(let msg):
       try container.encode("skipped", forKey: .kind)
       try msg.encode(to: encoder)
+    case .cacheQueried(let msg):
+      try container.encode("cache-queried", forKey: .kind)
+      try msg.encode(to: encoder)
 
     }
   }
@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import protocol TSCBasic.FileSystem
+import struct TSCBasic.ByteString
+import struct TSCBasic.SHA256
+import class Foundation.JSONDecoder
+import class Foundation.JSONEncoder
+
+/// The dependency scanner's cache, kept on disk next to the build record so
+/// that a driver invocation which is not incremental, such as a clean build
+/// in a CI shard, starts from the modules an earlier invocation discovered.
+///
+/// The scanner reads and writes the cache itself. Alongside it, the driver
+/// records the module interfaces and module maps the cache was built from,
+/// and only lets the scanner load it while all of them are unchanged.
+@_spi(Testing) public struct DependencyScannerState {
+  /// Incremented whenever the manifest's format changes.
+  static let manifestVersion = 1
+  /// How many keys keep a cache next to the same build record. Recording the
+  /// inputs of one removes the least recently recorded caches beyond this.
+  @_spi(Testing) public static let maxCachedKeys = 4
+
+  enum Error: Swift.Error {
+    case inputModifiedDuringScan(String)
+  }
+
+  /// Identifies the toolchain, SDK and compilation context the cache is for.
+  /// Each key has its own cache, so alternating between a few keeps them warm.
+  @_spi(Testing) public let key: String
+  /// Where the scanner serializes its cache.
+  @_spi(Testing) public let cachePath: VirtualPath
+  /// Where the driver records the inputs the cache was built from.
+  @_spi(Testing) public let manifestPath: VirtualPath
+
+  /// When the inputs of the cache were last seen.
+  struct InputStamp: Codable, Equatable {
+    var seconds: UInt64
+    var nanoseconds: UInt32
+    var hash: String
+
+    var modTime: TimePoint {
+      TimePoint(seconds: seconds, nanoseconds: nanoseconds)
+    }
+  }
+
+  struct Manifest: Codable {
+    var version: Int
+    var key: String
+    /// The module interfaces, binary modules and module maps of the scanned
+    /// modules, by path.
+    var inputs: [String: InputStamp]
+  }
+
+  @_spi(Testing) public init(buildRecordPath: VirtualPath, compilerVersion: String,
+                             compilerPath: String, sdkPath: String?, contextHash: String) {
+    var hasher = StableHasher()
+    hasher.combine(Self.manifestVersion)
+    hasher.combine(compilerVersion)
+    hasher.combine(compilerPath)
+    hasher.combine(sdkPath ?? "")
+    hasher.combine(contextHash)
+    let hash = String(hasher.finalize(), radix: 16)
+    self.key = String(repeating: "0", count: 16 - hash.count) + hash
+
+    let filename = buildRecordPath.basenameWithoutExt + "-" + key
+    self.cachePath = buildRecordPath.parentDirectory
+      .appending(component: filename + ".swiftmoduledeps")
+    self.manifestPath = buildRecordPath.parentDirectory
+      .appending(component: filename + ".swiftmoduledeps.json")
+  }
+
+  /// Whether the scanner may load the cache: it must have been written by
+  /// this version of the driver for the same key, and none of its inputs may
+  /// have been removed or had their contents changed.
+  @_spi(Testing) public func canReuseCache(fileSystem: FileSystem) -> Bool {
+    guard (try? fileSystem.exists(cachePath)) == true,
+          let manifest = readManifest(fileSystem: fileSystem) else {
+      return false
+    }
+    return manifest.inputs.allSatisfy { path, stamp in
+      guard let virtualPath = try? VirtualPath(path: path),
+            let modTime = try? fileSystem.lastModificationTime(for: virtualPath) else {
+        return false
+      }
+      // A touched file, e.g. after a fresh checkout, doesn't need a cold scan.
+      return modTime == stamp.modTime || Self.hash(of: virtualPath, fileSystem: fileSystem) == stamp.hash
+    }
+  }
+
+  /// Records the inputs of the modules in `graph`, which the scanner has just
+  /// serialized into the cache, then removes the caches of the least recently
+  /// recorded keys beyond `maxCachedKeys`.
+  ///
+  /// `scanStartTime` is when the driver began preparing the scan. The cache
+  /// describes inputs as the scanner read them, so an input modified since
+  /// then may not match it, and this throws instead of recording it. Only
+  /// inputs which are new or have been modified since the last manifest are
+  /// read to compute their hashes.
+  @_spi(Testing) public func recordInputs(of graph: InterModuleDependencyGraph,
+                                          scannedSince scanStartTime: TimePoint,
+                                          fileSystem: FileSystem) throws {
+    // File systems which only keep whole seconds may date a modification
+    // made during the scan's first second before the scan.
+    let modifiedDuringScanTime = TimePoint(seconds: scanStartTime.seconds, nanoseconds: 0)
+    let priorInputs = readManifest(fileSystem: fileSystem)?.inputs ?? [:]
+    var inputs: [String: InputStamp] = [:]
+    for moduleId in graph.moduleIds {
+      guard let inputPath = try graph.inputPath(of: moduleId) else { continue }
+      let path = VirtualPath.lookup(inputPath.path)
+      guard inputs[path.name] == nil,
+            let modTime = try? fileSystem.lastModificationTime(for: path) else {
+        continue
+      }
+      guard modTime < modifiedDuringScanTime else {
+        throw Error.inputModifiedDuringScan(path.name)
+      }
+      if let priorStamp = priorInputs[path.name], priorStamp.modTime == modTime {
+        inputs[path.name] = priorStamp
+      } else if let hash = Self.hash(of: path, fileSystem: fileSystem) {
+        inputs[path.name] = InputStamp(seconds: modTime.seconds, nanoseconds: modTime.nanoseconds,
+                                       hash: hash)
+      }
+    }
+    let manifest = Manifest(version: Self.manifestVersion, key: key, inputs: inputs)
+    try fileSystem.writeFileContents(manifestPath,
+                                     bytes: ByteString(JSONEncoder().encode(manifest)),
+                                     atomically: true)
+    pruneCachesOfOtherKeys(fileSystem: fileSystem)
+  }
+
+  /// Removes the cache and its manifest.
+  @_spi(Testing) public func invalidate(fileSystem: FileSystem) {
+    try? fileSystem.removeFileTree(cachePath)
+    try? fileSystem.removeFileTree(manifestPath)
+  }
+
+  /// Removes the caches and manifests of other keys, next to the same build
+  /// record, whose manifests are older than the `maxCachedKeys - 1` newest.
+  private func pruneCachesOfOtherKeys(fileSystem: FileSystem) {
+    let directory = manifestPath.parentDirectory
+    let prefix = String(manifestPath.basename.dropLast(key.count + ".swiftmoduledeps.json".count))
+    guard let directoryPath = directory.absolutePath,
+          let contents = try? fileSystem.getDirectoryContents(directoryPath) else {
+      return
+    }
+    var otherManifests: [(path: VirtualPath, modTime: TimePoint)] = []
+    for name in contents where name.hasPrefix(prefix) && name.hasSuffix(".swiftmoduledeps.json") {
+      let otherKey = name.dropFirst(prefix.count).dropLast(".swiftmoduledeps.json".count)
+      guard otherKey.count == key.count, otherKey != key,
+            otherKey.allSatisfy({ $0.isHexDigit }) else {
+        continue
+      }
+      let path = directory.appending(component: name)
+      let modTime = (try? fileSystem.lastModificationTime(for: path)) ?? .distantPast
+      otherManifests.append((path, modTime))
+    }
+    guard otherManifests.count >= Self.maxCachedKeys else {
+      return
+    }
+    otherManifests.sort { $0.modTime > $1.modTime }
+    for (path, _) in otherManifests.dropFirst(Self.maxCachedKeys - 1) {
+      let cachePath = path.parentDirectory
+        .appending(component: String(path.basename.dropLast(".json".count)))
+      try? fileSystem.removeFileTree(cachePath)
+      try? fileSystem.removeFileTree(path)
+    }
+  }
+
+  private func readManifest(fileSystem: FileSystem) -> Manifest? {
+    guard let contents = try? fileSystem.readFileContents(manifestPath),
+          let manifest = try? JSONDecoder().decode(Manifest.self, from: contents.data),
+          manifest.version == Self.manifestVersion,
+          manifest.key == key else {
+      return nil
+    }
+    return manifest
+  }
+
+  private static func hash(of path: VirtualPath, fileSystem: FileSystem) -> String? {
+    guard let contents = try? fileSystem.readFileContents(path) else {
+      return nil
+    }
+    return SHA256().hash(contents).hexadecimalRepresentation
+  }
+}
+
+extension Driver {
+  /// The dependency scanner's cache is kept between invocations which are not
+  /// incremental with `-persist-dependency-scan-cache`. Incremental builds
+  /// with `-incremental-dependency-scan` keep their own.
+  var dependencyScannerState: DependencyScannerState? {
+    mutating get {
+      guard parsedOptions.contains(.persistDependencyScanCache),
+            let buildRecordInfo,
+            !(shouldAttemptIncrementalCompilation && parsedOptions.hasArgument(.incrementalDependencyScan)),
+            isFrontendArgSupported(.validatePriorDependencyScanCache),
+            let compilerPath = try? toolchain.resolvedTool(.swiftCompiler).path else {
+        return nil
+      }
+      return DependencyScannerState(buildRecordPath: buildRecordInfo.buildRecordPath,
+                                    compilerVersion: frontendTargetInfo.compilerVersion,
+                                    compilerPath: compilerPath.pathString,
+                                    sdkPath: frontendTargetInfo.sdkPath.map {
+                                      VirtualPath.lookup($0.path).name
+                                    },
+                                    contextHash: buildRecordInfo.currentArgsHash)
+    }
+  }
+}
@@ -478,15 +478,7 @@ public typealias ExternalTargetModuleDetailsMap = [ModuleDependencyId: ExternalT
   }
 
   public func getLinkLibraryLoadCommandFlags(_ commandLine: inout [Job.ArgTemplate]) throws {
-    var allLinkLibraries: [LinkLibraryInfo] = []
-    for (_, moduleInfo) in dependencyGraph.modules {
-      guard let moduleLinkLibraries = moduleInfo.linkLibraries else {
-        continue
-      }
-      for linkLibrary in moduleLinkLibraries {
-        allLinkLibraries.append(linkLibrary)
-      }
-    }
+    let allLinkLibraries = try dependencyGraph.allLinkLibraries()
     toolchain.addAutoLinkFlags(for: allLinkLibraries, to: &commandLine)
   }
 
@@ -671,7 +663,7 @@ public typealias ExternalTargetModuleDetailsMap = [ModuleDependencyId: ExternalT
 /// on the dependency graph's structure.
 @_spi(Testing) public extension InterModuleDependencyGraph {
   func moduleInfo(of moduleId: ModuleDependencyId) throws -> ModuleInfo {
-    guard let moduleInfo = modules[moduleId] else {
+    guard let moduleInfo = try lookUpModule(moduleId) else {
       throw Driver.Error.missingModuleDependency(moduleId.moduleName)
     }
     return moduleInfo
@@ -704,7 +696,7 @@ public typealias ExternalTargetModuleDetailsMap = [ModuleDependencyId: ExternalT
 
 internal extension ExplicitDependencyBuildPlanner {
   func findPath(from source: ModuleDependencyId, to destination: ModuleDependencyId) throws -> [ModuleDependencyId]? {
-    guard dependencyGraph.modules.contains(where: { $0.key == destination }) else { return nil }
+    guard dependencyGraph.containsModule(destination) else { return nil }
     var result: [ModuleDependencyId]? = nil
     var visited: Set<ModuleDependencyId> = []
     try dependencyGraph.findAPath(source: source,
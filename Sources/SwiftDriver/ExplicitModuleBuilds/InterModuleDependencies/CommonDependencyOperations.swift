@@ -18,7 +18,7 @@ import protocol TSCBasic.FileSystem
 extension InterModuleDependencyGraph {
   var topologicalSorting: [ModuleDependencyId] {
     get throws {
-      try topologicalSort(Array(modules.keys), successors: { try Array(moduleInfo(of: $0).allDependencies) })
+      try topologicalSort(moduleIds, successors: { try allDependencies(of: $0) })
     }
   }
 
@@ -41,7 +41,7 @@ extension InterModuleDependencyGraph {
       }
     // Traverse the set of modules in reverse topological order, assimilating transitive closures
     for moduleId in topologicalIdList.reversed() {
-      for dependencyId in try moduleInfo(of: moduleId).allDependencies {
+      for dependencyId in try allDependencies(of: moduleId) {
         transitiveClosureMap[moduleId]!.formUnion(transitiveClosureMap[dependencyId]!)
       }
     }
@@ -67,7 +67,7 @@ internal extension InterModuleDependencyGraph {
                                             forRebuild: Bool,
                                             reporter: IncrementalCompilationState.Reporter? = nil)
   throws -> Set<ModuleDependencyId> {
-    let mainModuleInfo = mainModule
+    let mainModuleInfo = try moduleInfo(of: .swift(mainModuleName))
     var modulesRequiringRebuild: Set<ModuleDependencyId> = []
     var visited: Set<ModuleDependencyId> = []
     // Scan from the main module's dependencies to avoid reporting
@@ -274,7 +274,7 @@ internal extension InterModuleDependencyGraph {
 
 internal extension InterModuleDependencyGraph {
   func explainDependency(_ dependencyModuleName: String, allPaths: Bool) throws -> [[ModuleDependencyId]]? {
-    guard modules.contains(where: { $0.key.moduleName == dependencyModuleName }) else { return nil }
+    guard moduleIds.contains(where: { $0.moduleName == dependencyModuleName }) else { return nil }
     var result: Set<[ModuleDependencyId]> = []
     if allPaths {
       try findAllPaths(source: .swift(mainModuleName),
@@ -315,29 +315,57 @@ extension ModuleInfo {
   }
 }
 
+extension ModuleInfo {
+  /// The file the module is built or loaded from: its interface, its
+  /// prebuilt binary module, or its module map.
+  var inputPath: TextualVirtualPath? {
+    switch details {
+    case .swift(let details):
+      return details.moduleInterfacePath
+    case .swiftPrebuiltExternal(let details):
+      return details.compiledModulePath
+    case .clang(let details):
+      return details.moduleMapPath
+    }
+  }
+}
+
 public extension ModuleInfo {
   // Directly-imported dependencies plus additional dependency
   // kinds for Swift modules:
   // - Swift overlay dependencies
   // - Bridging Header dependencies
   var allDependencies: [ModuleDependencyId] {
+    guard case .swift(let swiftModuleDetails) = details else {
+      return directDependencies ?? []
+    }
+    return Self.allDependencies(direct: directDependencies,
+                                swiftOverlay: swiftModuleDetails.swiftOverlayDependencies,
+                                bridgingHeader: swiftModuleDetails.bridgingHeaderDependencies)
+  }
+}
+
+extension ModuleInfo {
+  /// The dependencies of a Swift module, from each of its kinds of dependencies.
+  static func allDependencies(direct directDependencies: [ModuleDependencyId]?,
+                              swiftOverlay swiftOverlayDependencies: [ModuleDependencyId]?,
+                              bridgingHeader bridgingHeaderDependencies: [ModuleDependencyId]?)
+  -> [ModuleDependencyId] {
     var result: [ModuleDependencyId] = directDependencies ?? []
-    if case .swift(let swiftModuleDetails) = details {
-      // Ensure the dependnecies emitted are unique and follow a predictable ordering:
-      // 1. directDependencies in the order reported by the scanner
-      // 2. swift overlay dependencies
-      // 3. briding header dependencies
-      var addedSoFar: Set<ModuleDependencyId> = []
-      addedSoFar.formUnion(directDependencies ?? [])
-      for depId in swiftModuleDetails.swiftOverlayDependencies ?? [] {
-        if addedSoFar.insert(depId).inserted {
-          result.append(depId)
-        }
+    // Ensure the dependnecies emitted are unique and follow a predictable ordering:
+    // 1. directDependencies in the order reported by the scanner
+    // 2. swift overlay dependencies
+    // 3. briding header dependencies
+    var addedSoFar: Set<ModuleDependencyId> = []
+    addedSoFar.formUnion(directDependencies ?? [])
+    for depId in swiftOverlayDependencies ?? [] {
+      if addedSoFar.insert(depId).inserted {
+        result.append(depId)
       }
-      for depId in swiftModuleDetails.bridgingHeaderDependencies ?? [] {
-        if addedSoFar.insert(depId).inserted {
-          result.append(depId)
-        }
+    }
+    for depId in bridgingHeaderDependencies ?? [] {
+      if addedSoFar.insert(depId).inserted {
+        result.append(depId)
       }
     }
     return result
@@ -346,15 +374,150 @@ public extension ModuleInfo {
 
 /// Describes the complete set of dependencies for a Swift module, including
 /// all of the Swift and C modules and source files it depends on.
+///
+/// A graph produced by the dependency scanner keeps the scanner's results and
+/// decodes each module the first time it is looked up, so queries that only
+/// touch part of the graph, or only the dependencies of each module, don't pay
+/// for decoding every module's details.
 public struct InterModuleDependencyGraph: Codable {
   /// The name of the main module.
   public let mainModuleName: String
 
-  /// The complete set of modules discovered
-  public let modules: ModuleInfoMap
+  private enum Storage {
+    case decoded(ModuleInfoMap)
+    case scanned(ScannedModuleInfoMap)
+  }
+  private let storage: Storage
+
+  init(mainModuleName: String, modules: ModuleInfoMap) {
+    self.mainModuleName = mainModuleName
+    self.storage = .decoded(modules)
+  }
+
+  init(mainModuleName: String, scannedModules: ScannedModuleInfoMap) {
+    self.mainModuleName = mainModuleName
+    self.storage = .scanned(scannedModules)
+  }
+
+  /// The complete set of modules discovered.
+  ///
+  /// The first access decodes every module that hasn't been yet; later
+  /// accesses return the same map. A module the scanner reported malformed
+  /// is a fatal error here, so prefer `allModules()`, which throws instead,
+  /// or `moduleIds` and `moduleInfo(of:)` to look up single modules.
+  public var modules: ModuleInfoMap {
+    do {
+      return try allModules()
+    } catch {
+      fatalError("malformed module in the dependency graph: \(error)")
+    }
+  }
+
+  /// The complete set of modules discovered, decoding every module that
+  /// hasn't been yet and throwing if one of them is malformed.
+  public func allModules() throws -> ModuleInfoMap {
+    switch storage {
+    case .decoded(let modules):
+      return modules
+    case .scanned(let modules):
+      return try modules.allModules()
+    }
+  }
+
+  /// The identifiers of every module discovered.
+  public var moduleIds: [ModuleDependencyId] {
+    switch storage {
+    case .decoded(let modules):
+      return Array(modules.keys)
+    case .scanned(let modules):
+      return modules.moduleIds
+    }
+  }
+
+  public func containsModule(_ moduleId: ModuleDependencyId) -> Bool {
+    switch storage {
+    case .decoded(let modules):
+      return modules[moduleId] != nil
+    case .scanned(let modules):
+      return modules.contains(moduleId)
+    }
+  }
 
   /// Information about the main module.
-  public var mainModule: ModuleInfo { modules[.swift(mainModuleName)]! }
+  public var mainModule: ModuleInfo { try! moduleInfo(of: .swift(mainModuleName)) }
+
+  /// Looks up a module, decoding it if needed. Returns `nil` if there is no
+  /// such module.
+  func lookUpModule(_ moduleId: ModuleDependencyId) throws -> ModuleInfo? {
+    switch storage {
+    case .decoded(let modules):
+      return modules[moduleId]
+    case .scanned(let modules):
+      return try modules.moduleInfo(of: moduleId)
+    }
+  }
+
+  /// The `allDependencies` of a module, without decoding the rest of it.
+  func allDependencies(of moduleId: ModuleDependencyId) throws -> [ModuleDependencyId] {
+    let dependencies: [ModuleDependencyId]?
+    switch storage {
+    case .decoded(let modules):
+      dependencies = modules[moduleId]?.allDependencies
+    case .scanned(let modules):
+      dependencies = try modules.allDependencies(of: moduleId)
+    }
+    guard let dependencies else {
+      throw Driver.Error.missingModuleDependency(moduleId.moduleName)
+    }
+    return dependencies
+  }
+
+  /// The `inputPath` of a module, without decoding the rest of it.
+  func inputPath(of moduleId: ModuleDependencyId) throws -> TextualVirtualPath? {
+    let inputPath: TextualVirtualPath??
+    switch storage {
+    case .decoded(let modules):
+      inputPath = modules[moduleId].map { $0.inputPath }
+    case .scanned(let modules):
+      inputPath = try modules.inputPath(of: moduleId)
+    }
+    guard let inputPath else {
+      throw Driver.Error.missingModuleDependency(moduleId.moduleName)
+    }
+    return inputPath
+  }
+
+  /// The libraries every module links, without decoding the rest of them.
+  func allLinkLibraries() throws -> [LinkLibraryInfo] {
+    switch storage {
+    case .decoded(let modules):
+      return modules.values.flatMap { $0.linkLibraries ?? [] }
+    case .scanned(let modules):
+      return try modules.moduleIds.flatMap { try modules.linkLibraries(of: $0) ?? [] }
+    }
+  }
+
+  private enum CodingKeys: String, CodingKey {
+    case mainModuleName
+    case modules
+  }
+
+  public init(from decoder: Decoder) throws {
+    let container = try decoder.container(keyedBy: CodingKeys.self)
+    self.mainModuleName = try container.decode(String.self, forKey: .mainModuleName)
+    self.storage = .decoded(try container.decode(ModuleInfoMap.self, forKey: .modules))
+  }
+
+  public func encode(to encoder: Encoder) throws {
+    var container = encoder.container(keyedBy: CodingKeys.self)
+    try container.encode(mainModuleName, forKey: .mainModuleName)
+    switch storage {
+    case .decoded(let modules):
+      try container.encode(modules, forKey: .modules)
+    case .scanned(let modules):
+      try container.encode(modules.allModules(), forKey: .modules)
+    }
+  }
 }
 
 @_spi(Testing) public  extension InterModuleDependencyGraph {
@@ -15,6 +15,7 @@
 import protocol TSCBasic.FileSystem
 import struct TSCBasic.AbsolutePath
 import struct Foundation.Data
+import class Foundation.NSLock
 import var TSCBasic.localFileSystem
 
 import Dispatch
@@ -39,15 +40,57 @@ public class InterModuleDependencyOracle {
   @_spi(Testing) public func getDependencies(workingDirectory: AbsolutePath,
                                              moduleAliases: [String: String]? = nil,
                                              commandLine: [String],
+                                             decodingModulesLazily: Bool = true,
                                              diagnostics: inout [ScannerDiagnosticPayload])
   throws -> InterModuleDependencyGraph {
     precondition(hasScannerInstance)
     return try swiftScanLibInstance!.scanDependencies(workingDirectory: workingDirectory,
                                                       moduleAliases: moduleAliases,
                                                       invocationCommand: commandLine,
+                                                      decodingModulesLazily: decodingModulesLazily,
                                                       diagnostics: &diagnostics)
   }
 
+  /// Scans each of `invocations`, such as the same module for several target
+  /// triples or a module and its variant, concurrently with this oracle's
+  /// scanner, so that the modules they have in common are only discovered by
+  /// the first scan to reach them.
+  ///
+  /// Throws the error of the first invocation that failed, if any.
+  @_spi(Testing) public func getDependencies(forBatch invocations: [DependencyScanInvocation],
+                                             decodingModulesLazily: Bool = true)
+  throws -> BatchDependencyScanResult {
+    precondition(hasScannerInstance)
+    let swiftScan = swiftScanLibInstance!
+    var results = [Result<(InterModuleDependencyGraph, [ScannerDiagnosticPayload]), Error>?](
+      repeating: nil, count: invocations.count)
+    let resultsLock = NSLock()
+    DispatchQueue.concurrentPerform(iterations: invocations.count) { index in
+      let invocation = invocations[index]
+      var diagnostics: [ScannerDiagnosticPayload] = []
+      let result = Result {
+        (try swiftScan.scanDependencies(workingDirectory: invocation.workingDirectory,
+                                        moduleAliases: invocation.moduleAliases,
+                                        invocationCommand: invocation.commandLine,
+                                        decodingModulesLazily: decodingModulesLazily,
+                                        diagnostics: &diagnostics),
+         diagnostics)
+      }
+      resultsLock.lock()
+      results[index] = result
+      resultsLock.unlock()
+    }
+
+    var graphs: [InterModuleDependencyGraph] = []
+    var diagnostics: [[ScannerDiagnosticPayload]] = []
+    for result in results {
+      let (graph, scanDiagnostics) = try result!.get()
+      graphs.append(graph)
+      diagnostics.append(scanDiagnostics)
+    }
+    return BatchDependencyScanResult(graphs: graphs, diagnostics: diagnostics)
+  }
+
   @_spi(Testing) public func getImports(workingDirectory: AbsolutePath,
                                         moduleAliases: [String: String]? = nil,
                                         commandLine: [String],
@@ -206,3 +249,65 @@ public class InterModuleDependencyOracle {
   internal var createdCASMap: [CASConfig: SwiftScanCAS] = [:]
 }
 
+
+/// One dependency scan in a batch given to
+/// `InterModuleDependencyOracle.getDependencies(forBatch:)`.
+@_spi(Testing) public struct DependencyScanInvocation {
+  public let workingDirectory: AbsolutePath
+  public let moduleAliases: [String: String]?
+  /// The scanner's command line, without the tool or `-frontend`.
+  public let commandLine: [String]
+
+  public init(workingDirectory: AbsolutePath, moduleAliases: [String: String]? = nil,
+              commandLine: [String]) {
+    self.workingDirectory = workingDirectory
+    self.moduleAliases = moduleAliases
+    self.commandLine = commandLine
+  }
+}
+
+/// The results of a batch of dependency scans.
+@_spi(Testing) public struct BatchDependencyScanResult {
+  /// Identifies a module built in a particular context. Clang modules and
+  /// Swift modules built from an interface are only the same module across
+  /// scans when they have the same context hash, e.g. the same target triple.
+  public struct ModuleKey: Hashable {
+    public let id: ModuleDependencyId
+    public let contextHash: String?
+  }
+
+  /// The graph of each invocation, in the order they were given.
+  public let graphs: [InterModuleDependencyGraph]
+  /// The scanner's diagnostics for each invocation.
+  public let diagnostics: [[ScannerDiagnosticPayload]]
+
+  public init(graphs: [InterModuleDependencyGraph], diagnostics: [[ScannerDiagnosticPayload]]? = nil) {
+    self.graphs = graphs
+    self.diagnostics = diagnostics ?? graphs.map { _ in [] }
+  }
+
+  /// Every module the scans found other than their main modules, once for
+  /// each context it is built in.
+  public func uniqueModules() throws -> [ModuleKey: ModuleInfo] {
+    var modules: [ModuleKey: ModuleInfo] = [:]
+    for graph in graphs {
+      for moduleId in graph.moduleIds where moduleId != .swift(graph.mainModuleName) {
+        let moduleInfo = try graph.moduleInfo(of: moduleId)
+        let contextHash: String?
+        switch moduleInfo.details {
+        case .swift(let details):
+          contextHash = details.contextHash
+        case .clang(let details):
+          contextHash = details.contextHash
+        case .swiftPrebuiltExternal:
+          contextHash = nil
+        }
+        let key = ModuleKey(id: moduleId, contextHash: contextHash)
+        if modules[key] == nil {
+          modules[key] = moduleInfo
+        }
+      }
+    }
+    return modules
+  }
+}
@@ -53,9 +53,31 @@ extension Diagnostic.Message {
 @_spi(Testing) public extension Driver {
   /// Scan the current module's input source-files to compute its direct and transitive
   /// module dependencies.
-  mutating func scanModuleDependencies(forVariantModule: Bool = false)
+  ///
+  /// In an incremental build, `initialIncrementalState` lets the prior build's
+  /// scan be brought up to date instead, when that is enabled. A scan started
+  /// with `startDependencyScan()` is finished as `pendingScan` instead.
+  mutating func scanModuleDependencies(forVariantModule: Bool = false,
+                                       initialIncrementalState:
+                                       IncrementalCompilationState.InitialStateForPlanning? = nil,
+                                       pendingScan: PendingDependencyScan? = nil)
   throws -> InterModuleDependencyGraph {
-    let dependencyGraph = try performDependencyScan(forVariantModule: forVariantModule)
+    let dependencyGraph: InterModuleDependencyGraph
+    if forVariantModule, let variantDependencyGraph = batchScannedVariantDependencyGraph {
+      dependencyGraph = variantDependencyGraph
+      batchScannedVariantDependencyGraph = nil
+    } else if !forVariantModule, let pendingScan {
+      dependencyGraph = try finishDependencyScan(pendingScan)
+    } else if !forVariantModule, reusesPriorDependencyScan, let buildRecordInfo {
+      dependencyGraph = try performIncrementalDependencyScan(buildRecordInfo: buildRecordInfo,
+                                                             initialState: initialIncrementalState)
+    } else if !forVariantModule, scansVariantModuleInBatch {
+      let dependencyGraphs = try performDependencyScanOfModuleAndVariant()
+      dependencyGraph = dependencyGraphs.module
+      batchScannedVariantDependencyGraph = dependencyGraphs.variant
+    } else {
+      dependencyGraph = try performDependencyScan(forVariantModule: forVariantModule)
+    }
 
     if parsedOptions.hasArgument(.printPreprocessedExplicitDependencyGraph) {
       try stdoutStream.send(dependencyGraph.toJSONString())
@@ -88,8 +110,10 @@ public extension Driver {
   /// Precompute the dependencies for a given Swift compilation, producing a
   /// dependency graph including all Swift and C module files and
   /// source files.
-  mutating func dependencyScanningJob(forVariantModule: Bool = false) throws -> Job {
-    let (inputs, commandLine) = try dependencyScannerInvocationCommand(forVariantModule: forVariantModule)
+  mutating func dependencyScanningJob(forVariantModule: Bool = false,
+                                      importingSource: VirtualPath? = nil) throws -> Job {
+    let (inputs, commandLine) = try dependencyScannerInvocationCommand(forVariantModule: forVariantModule,
+                                                                        importingSource: importingSource)
 
     // Construct the scanning job.
     return Job(moduleName: moduleOutputInfo.name,
@@ -104,7 +128,11 @@ public extension Driver {
 
   /// Generate a full command-line invocation to be used for the dependency scanning action
   /// on the target module.
-  @_spi(Testing) mutating func dependencyScannerInvocationCommand(forVariantModule: Bool = false)
+  ///
+  /// With `importingSource`, the target module's sources are replaced with
+  /// that one, and the scan leaves no outputs behind.
+  @_spi(Testing) mutating func dependencyScannerInvocationCommand(forVariantModule: Bool = false,
+                                                                  importingSource: VirtualPath? = nil)
   throws -> ([TypedVirtualPath],[Job.ArgTemplate]) {
     // Aggregate the fast dependency scanner arguments
     var inputs: [TypedVirtualPath] = []
@@ -161,7 +189,8 @@ public extension Driver {
     }
 
     if shouldAttemptIncrementalCompilation &&
-       parsedOptions.contains(.incrementalDependencyScan) {
+       parsedOptions.contains(.incrementalDependencyScan) &&
+       importingSource == nil {
       if let serializationPath = buildRecordInfo?.dependencyScanSerializedResultPath {
         if isFrontendArgSupported(.validatePriorDependencyScanCache) {
           // Any compiler which supports "-validate-prior-dependency-scan-cache"
@@ -174,6 +203,15 @@ public extension Driver {
           commandLine.appendFlag(.serializeDependencyScanCache)
         }
       }
+    } else if !forVariantModule, importingSource == nil,
+              let scannerState = dependencyScannerState {
+      commandLine.appendFlag(.dependencyScanCachePath)
+      commandLine.appendPath(scannerState.cachePath)
+      if scannerState.canReuseCache(fileSystem: fileSystem) {
+        commandLine.appendFlag(.reuseDependencyScanCache)
+        commandLine.appendFlag(.validatePriorDependencyScanCache)
+      }
+      commandLine.appendFlag(.serializeDependencyScanCache)
     }
 
     if isFrontendArgSupported(.autoBridgingHeaderChaining) {
@@ -208,19 +246,25 @@ public extension Driver {
       commandLine.appendFlag(.resolvedPluginVerification)
     }
 
-    if let depScanSerializedDiagnosticsPath = dependencyScanSerializedDiagnosticsPath {
+    if let depScanSerializedDiagnosticsPath = dependencyScanSerializedDiagnosticsPath,
+       importingSource == nil {
       commandLine.appendFlag("-serialize-diagnostics-path")
       commandLine.appendPath(VirtualPath.lookup(depScanSerializedDiagnosticsPath))
     }
 
     // loadedModuleTrace file.
-    if loadedModuleTraceEmittedByScanner, let tracePath = loadedModuleTracePath {
+    if loadedModuleTraceEmittedByScanner, let tracePath = loadedModuleTracePath,
+       importingSource == nil {
       commandLine.appendFlag(.emitLoadedModuleTracePath)
       commandLine.appendPath(VirtualPath.lookup(tracePath))
     }
 
     // Pass on the input files
-    commandLine.append(contentsOf: inputFiles.filter { $0.type == .swift }.map { .path($0.file) })
+    if let importingSource {
+      commandLine.appendPath(importingSource)
+    } else {
+      commandLine.append(contentsOf: inputFiles.filter { $0.type == .swift }.map { .path($0.file) })
+    }
     return (inputs, commandLine)
   }
 
@@ -291,8 +335,13 @@ public extension Driver {
       }
   }
 
-  mutating func performDependencyScan(forVariantModule: Bool = false) throws -> InterModuleDependencyGraph {
-    let scannerJob = try dependencyScanningJob(forVariantModule: forVariantModule)
+  /// Scans the target module's dependencies, or with `importingSource`, the
+  /// dependencies of a module whose only source is that file.
+  mutating func performDependencyScan(forVariantModule: Bool = false,
+                                      importingSource: VirtualPath? = nil) throws -> InterModuleDependencyGraph {
+    let scanStartTime = TimePoint.now()
+    let scannerJob = try dependencyScanningJob(forVariantModule: forVariantModule,
+                                               importingSource: importingSource)
     let forceResponseFiles = parsedOptions.hasArgument(.driverForceResponseFiles)
     let dependencyGraph: InterModuleDependencyGraph
 
@@ -328,9 +377,110 @@ public extension Driver {
                                   forceResponseFiles: forceResponseFiles,
                                   recordedInputMetadata: recordedInputMetadata)
     }
+
+    if !forVariantModule, importingSource == nil {
+      recordDependencyScannerState(of: dependencyGraph, scannedSince: scanStartTime)
+    }
     return dependencyGraph
   }
 
+  /// Whether the target module's variant is scanned together with it.
+  private var scansVariantModuleInBatch: Bool {
+    parsedOptions.hasArgument(.experimentalEmitVariantModule) &&
+      variantModuleOutputInfo != nil &&
+      supportInProcessSwiftScanQueries
+  }
+
+  /// Scans the dependencies of the target module and of its variant
+  /// concurrently, with the same scanner, so that the modules they have in
+  /// common are only discovered once.
+  private mutating func performDependencyScanOfModuleAndVariant()
+  throws -> (module: InterModuleDependencyGraph, variant: InterModuleDependencyGraph) {
+    let scanStartTime = TimePoint.now()
+    let invocations = try dependencyScanInvocations(includingVariantModule: true)
+    let result = try interModuleDependencyOracle.getDependencies(forBatch: invocations)
+    for scanDiagnostics in result.diagnostics {
+      try emitScannerDiagnostics(scanDiagnostics)
+    }
+    recordDependencyScannerState(of: result.graphs[0], scannedSince: scanStartTime)
+    return (result.graphs[0], result.graphs[1])
+  }
+
+  /// Starts scanning the target module's dependencies, and its variant's if
+  /// they are scanned together, on a background queue. The scan is finished
+  /// by passing it to `scanModuleDependencies`.
+  ///
+  /// Returns nil if the scan has to run when the graph is needed instead:
+  /// without libSwiftScan, or when it starts from the prior build's scan,
+  /// which needs the incremental state.
+  @_spi(Testing) mutating func startDependencyScan() throws -> PendingDependencyScan? {
+    guard supportInProcessSwiftScanQueries, !reusesPriorDependencyScan else {
+      return nil
+    }
+    let scanStartTime = TimePoint.now()
+    let invocations = try dependencyScanInvocations(includingVariantModule: scansVariantModuleInBatch)
+    return PendingDependencyScan(oracle: interModuleDependencyOracle, invocations: invocations,
+                                 startTime: scanStartTime)
+  }
+
+  private mutating func finishDependencyScan(_ pendingScan: PendingDependencyScan)
+  throws -> InterModuleDependencyGraph {
+    let (result, timing) = try pendingScan.wait()
+    for scanDiagnostics in result.diagnostics {
+      try emitScannerDiagnostics(scanDiagnostics)
+    }
+    if parsedOptions.contains(.driverTimeCompilation) {
+      diagnosticEngine.emit(.remark_dependency_scan_overlap(timing))
+    }
+    recordDependencyScannerState(of: result.graphs[0], scannedSince: pendingScan.startTime)
+    if result.graphs.count > 1 {
+      batchScannedVariantDependencyGraph = result.graphs[1]
+    }
+    return result.graphs[0]
+  }
+
+  /// The libSwiftScan invocations which scan the target module, and its
+  /// variant after it.
+  private mutating func dependencyScanInvocations(includingVariantModule: Bool)
+  throws -> [DependencyScanInvocation] {
+    guard let cwd = workingDirectory ?? fileSystem.currentWorkingDirectory else {
+      throw DependencyScanningError.dependencyScanFailed("cannot determine working directory")
+    }
+    var invocations: [DependencyScanInvocation] = []
+    for forVariantModule in includingVariantModule ? [false, true] : [false] {
+      let scannerJob = try dependencyScanningJob(forVariantModule: forVariantModule)
+      if parsedOptions.contains(.v) {
+        let arguments: [String] = try executor.resolver.resolveArgumentList(for: scannerJob,
+                                                                            useResponseFiles: .disabled)
+        stdoutStream.send("\(arguments.map { $0.spm_shellEscaped() }.joined(separator: " "))\n")
+        stdoutStream.flush()
+      }
+      var command = try Self.itemizedJobCommand(of: scannerJob,
+                                                useResponseFiles: .disabled,
+                                                using: executor.resolver)
+      Self.sanitizeCommandForLibScanInvocation(&command)
+      invocations.append(DependencyScanInvocation(workingDirectory: cwd,
+                                                  moduleAliases: moduleOutputInfo.aliases,
+                                                  commandLine: command))
+    }
+    return invocations
+  }
+
+  private mutating func recordDependencyScannerState(of dependencyGraph: InterModuleDependencyGraph,
+                                                     scannedSince scanStartTime: TimePoint) {
+    guard let scannerState = dependencyScannerState else {
+      return
+    }
+    // Without a manifest, a later invocation can't tell whether the cache
+    // is still valid, so don't leave one behind.
+    do {
+      try scannerState.recordInputs(of: dependencyGraph, scannedSince: scanStartTime,
+                                    fileSystem: fileSystem)
+    } catch {
+      scannerState.invalidate(fileSystem: fileSystem)
+    }
+  }
+
   /// Precompute the set of module names as imported by the current module
   mutating private func importPreScanningJob() throws -> Job {
     // Aggregate the fast dependency scanner arguments
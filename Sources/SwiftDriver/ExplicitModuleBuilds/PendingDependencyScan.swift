@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import class Dispatch.DispatchGroup
+import class Dispatch.DispatchQueue
+import struct Dispatch.DispatchTime
+import class Foundation.NSLock
+
+/// A batch of dependency scans which runs on a background queue, so that the
+/// driver can do the planning which doesn't need the inter-module dependency
+/// graph, such as setting up incremental compilation, while the scanner runs.
+///
+/// libSwiftScan can't interrupt a scan in progress, so abandoning one which
+/// has already started lets it run to completion and discards its result.
+@_spi(Testing) public final class PendingDependencyScan {
+  /// How long the scan took, and how long the driver waited for it.
+  public struct Timing {
+    public let scanNanoseconds: UInt64
+    public let waitNanoseconds: UInt64
+
+    /// The wall time saved by planning while the scan ran.
+    public var overlapNanoseconds: UInt64 {
+      scanNanoseconds > waitNanoseconds ? scanNanoseconds - waitNanoseconds : 0
+    }
+  }
+
+  private let queue = DispatchQueue(label: "org.swift.swift-driver.pending-dependency-scan")
+  private let group = DispatchGroup()
+  private let lock = NSLock()
+  private var abandoned = false
+  private var result: Result<BatchDependencyScanResult, Swift.Error>? = nil
+  private var scanNanoseconds: UInt64 = 0
+  /// When the driver began preparing the scan, no later than the scanner
+  /// reads any of its inputs.
+  public let startTime: TimePoint
+
+  /// Starts scanning `invocations` with `oracle`'s scanner.
+  public init(oracle: InterModuleDependencyOracle, invocations: [DependencyScanInvocation],
+              startTime: TimePoint = .now()) {
+    self.startTime = startTime
+    queue.async(group: group) {
+      guard !self.isAbandoned else {
+        return
+      }
+      let startTime = DispatchTime.now()
+      let result = Result { try oracle.getDependencies(forBatch: invocations) }
+      let scanNanoseconds = DispatchTime.now().uptimeNanoseconds - startTime.uptimeNanoseconds
+      self.lock.lock()
+      self.result = result
+      self.scanNanoseconds = scanNanoseconds
+      self.lock.unlock()
+    }
+  }
+
+  public var isAbandoned: Bool {
+    lock.lock()
+    defer { lock.unlock() }
+    return abandoned
+  }
+
+  /// Gives up on the scan's result. A scan which hasn't started yet is
+  /// skipped, but one which has can't be interrupted: it keeps the scanner
+  /// busy until it finishes, and its result is then discarded.
+  public func abandon() {
+    lock.lock()
+    abandoned = true
+    lock.unlock()
+  }
+
+  /// Waits for the scan to finish, returning its result and how long the
+  /// caller was kept waiting. Throws the scan's error, or without waiting if
+  /// it was abandoned.
+  public func wait() throws -> (result: BatchDependencyScanResult, timing: Timing) {
+    guard !isAbandoned else {
+      throw DependencyScanningError.dependencyScanFailed("the scan was abandoned")
+    }
+    let startTime = DispatchTime.now()
+    group.wait()
+    let waitNanoseconds = DispatchTime.now().uptimeNanoseconds - startTime.uptimeNanoseconds
+
+    lock.lock()
+    defer { lock.unlock() }
+    guard !abandoned, let result = result else {
+      throw DependencyScanningError.dependencyScanFailed("the scan was abandoned")
+    }
+    return (try result.get(), Timing(scanNanoseconds: scanNanoseconds,
+                                     waitNanoseconds: waitNanoseconds))
+  }
+}
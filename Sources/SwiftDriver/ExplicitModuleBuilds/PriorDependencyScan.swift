@@ -0,0 +1,309 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import class Foundation.JSONDecoder
+import class Foundation.JSONEncoder
+import struct TSCBasic.ByteString
+
+/// The result of a prior build's dependency scan, saved next to the build
+/// record so that an incremental build can bring it up to date instead of
+/// scanning every module again.
+struct PriorDependencyScan: Codable {
+  /// Identifies everything besides the sources which the scan depends on:
+  /// the compiler, the SDK, the target, and the arguments which affect the
+  /// build, such as search paths and availability.
+  let key: String
+  /// The modification time of the scanner's own serialization of the scan
+  /// this record goes with, in nanoseconds, so that the record is only
+  /// reused alongside it.
+  let serializedScanModTime: UInt64?
+  /// The Swift source files of the main module, sorted.
+  let sourceFiles: [String]
+  /// The modules those source files import, as found by the import
+  /// pre-scan or reported by the scan itself, sorted.
+  let imports: [String]
+  let graph: InterModuleDependencyGraph
+}
+
+/// How an incremental build brings the prior dependency scan up to date.
+enum DependencyRescan: Equatable {
+  /// Nothing the scan depends on has changed, so it can be reused as-is.
+  case reusePrior
+  /// Source files have only added imports, so only the modules reachable
+  /// from those imports are scanned and added to the prior graph.
+  case scanAddedImports([String])
+  /// Everything is scanned again, for the given reason.
+  case scanAll(because: String)
+}
+
+extension Driver {
+  /// Reusing the prior build's dependency scan is opt-in with
+  /// `-reuse-prior-dependency-scan` while it is experimental, and needs
+  /// `-incremental-dependency-scan`.
+  var reusesPriorDependencyScan: Bool {
+    mutating get {
+      parsedOptions.contains(.reusePriorDependencyScan) &&
+        shouldAttemptIncrementalCompilation &&
+        parsedOptions.hasArgument(.incrementalDependencyScan)
+    }
+  }
+
+  /// The key of a dependency scan made with the current compiler, SDK,
+  /// target and arguments.
+  private func priorDependencyScanKey(buildRecordInfo: BuildRecordInfo) -> String {
+    var hasher = StableHasher()
+    hasher.combine(frontendTargetInfo.compilerVersion)
+    hasher.combine((try? toolchain.resolvedTool(.swiftCompiler).path.pathString) ?? "")
+    hasher.combine(frontendTargetInfo.sdkPath.map { VirtualPath.lookup($0.path).name } ?? "")
+    hasher.combine(frontendTargetInfo.target.triple.triple)
+    hasher.combine(frontendTargetInfo.targetVariant?.triple.triple ?? "")
+    hasher.combine(buildRecordInfo.currentArgsHash)
+    let hash = String(hasher.finalize(), radix: 16)
+    return String(repeating: "0", count: 16 - hash.count) + hash
+  }
+
+  private func serializedScanModTime(buildRecordInfo: BuildRecordInfo) -> UInt64? {
+    guard let modTime = try? fileSystem.lastModificationTime(
+            for: buildRecordInfo.dependencyScanSerializedResultPath) else {
+      return nil
+    }
+    return modTime.seconds &* 1_000_000_000 &+ UInt64(modTime.nanoseconds)
+  }
+
+  /// Scans the dependencies of the main module, starting from the prior
+  /// build's scan when there is one, and saves the result for the next build.
+  ///
+  /// libSwiftScan has no entry point to re-scan part of a graph, so the driver
+  /// works out what changed: the Swift inputs, their imports (from the import
+  /// pre-scan), and the inputs of the prior graph's modules. Modules which are
+  /// out-of-date, or whose importers changed, are scanned again in full, which
+  /// still lets the scanner reuse its own cache with `-incremental-dependency-scan`.
+  mutating func performIncrementalDependencyScan(
+    buildRecordInfo: BuildRecordInfo,
+    initialState: IncrementalCompilationState.InitialStateForPlanning?
+  ) throws -> InterModuleDependencyGraph {
+    var reporter: IncrementalCompilationState.Reporter? = nil
+    if let initialState, initialState.incrementalOptions.contains(.showIncremental) {
+      reporter = IncrementalCompilationState.Reporter(diagnosticEngine: diagnosticEngine,
+                                                      outputFileMap: outputFileMap)
+    }
+    let scanPath = buildRecordInfo.priorDependencyScanPath
+    let key = priorDependencyScanKey(buildRecordInfo: buildRecordInfo)
+    let sourceFiles = inputFiles.filter { $0.type == .swift }.map { $0.file.name }.sorted()
+
+    var prior: PriorDependencyScan? = nil
+    var imports: [String]? = nil
+    let rescan: DependencyRescan
+    if let initialState {
+      prior = try? JSONDecoder().decode(PriorDependencyScan.self,
+                                        from: fileSystem.readFileContents(scanPath).data)
+      if let prior {
+        let plan = try planDependencyRescan(from: prior, key: key, sourceFiles: sourceFiles,
+                                            initialState: initialState)
+        rescan = plan.rescan
+        imports = plan.imports
+      } else {
+        rescan = .scanAll(because: "no prior dependency scan")
+      }
+    } else {
+      rescan = .scanAll(because: "not an incremental build")
+    }
+
+    let dependencyGraph: InterModuleDependencyGraph
+    switch rescan {
+    case .reusePrior:
+      reporter?.reportReusingPriorDependencyScan()
+      return prior!.graph
+    case .scanAddedImports(let addedImports):
+      reporter?.reportScanningAddedImports(addedImports)
+      let importingSource = try writeAddedImportsScanSource(addedImports,
+                                                            buildRecordInfo: buildRecordInfo)
+      let scan = try performDependencyScan(importingSource: importingSource)
+      dependencyGraph = try prior!.graph.merging(scanOfAddedImports: scan)
+    case .scanAll(let reason):
+      reporter?.reportScanningAllDependencies(reason)
+      dependencyGraph = try performDependencyScan()
+    }
+
+    // The imports are only needed to compare against the next build's, so
+    // failing to save them just means that build scans everything.
+    do {
+      if imports == nil {
+        imports = try Self.sourceImports(ofMainModuleIn: dependencyGraph)
+      }
+      let scan = PriorDependencyScan(key: key,
+                                     serializedScanModTime: serializedScanModTime(buildRecordInfo: buildRecordInfo),
+                                     sourceFiles: sourceFiles, imports: imports!,
+                                     graph: dependencyGraph)
+      try fileSystem.writeFileContents(scanPath,
+                                       bytes: ByteString(JSONEncoder().encode(scan)),
+                                       atomically: true)
+    } catch {
+      reporter?.report("Unable to save the dependency scan: \(error)")
+      try? fileSystem.removeFileTree(scanPath)
+    }
+    return dependencyGraph
+  }
+
+  /// Decides how to bring `prior` up to date, returning the imports of the
+  /// current sources too if they had to be pre-scanned.
+  private mutating func planDependencyRescan(
+    from prior: PriorDependencyScan,
+    key: String,
+    sourceFiles: [String],
+    initialState: IncrementalCompilationState.InitialStateForPlanning
+  ) throws -> (rescan: DependencyRescan, imports: [String]?) {
+    guard prior.key == key else {
+      return (.scanAll(because: "the compiler, SDK, target or arguments changed"), nil)
+    }
+    // The scanner's serialization is what the prior scan is kept alongside,
+    // so a missing or different one means a build which didn't record it.
+    guard let priorModTime = prior.serializedScanModTime,
+          priorModTime == serializedScanModTime(buildRecordInfo: initialState.buildRecordInfo) else {
+      return (.scanAll(because: "the serialized dependency scan changed"), nil)
+    }
+    guard prior.sourceFiles == sourceFiles else {
+      return (.scanAll(because: "the set of source files changed"), nil)
+    }
+    guard let mainModuleDetails =
+            try? prior.graph.swiftModuleDetails(of: .swift(prior.graph.mainModuleName)) else {
+      return (.scanAll(because: "the prior dependency scan is malformed"), nil)
+    }
+    // The scanner writes out the chained bridging header, so it must run.
+    guard mainModuleDetails.chainedBridgingHeaderPath == nil else {
+      return (.scanAll(because: "the bridging header is chained"), nil)
+    }
+    let priorBuildStartTime = initialState.graph.buildRecord.buildStartTime
+    let bridgingInputs = (mainModuleDetails.bridgingHeaderPath.map { [$0] } ?? []) +
+                         (mainModuleDetails.bridgingSourceFiles ?? [])
+    for bridgingInput in bridgingInputs {
+      let path = VirtualPath.lookup(bridgingInput.path)
+      guard let modTime = try? fileSystem.lastModificationTime(for: path),
+            modTime < priorBuildStartTime else {
+        return (.scanAll(because: "bridging header input '\(path.name)' changed"), nil)
+      }
+    }
+    let staleModules = try prior.graph.computeInvalidatedModuleDependencies(fileSystem: fileSystem,
+                                                                            cas: cas,
+                                                                            forRebuild: false)
+    guard staleModules.isEmpty else {
+      let names = staleModules.map { $0.moduleNameForDiagnostic }.sorted()
+      return (.scanAll(because: "module dependencies changed: [\(names.joined(separator: ", "))]"), nil)
+    }
+
+    // Only a changed source file can change the imports.
+    let priorInputs = initialState.graph.buildRecord.inputInfos
+    let sourceFilesChanged = initialState.buildRecordInfo.compilationInputModificationDates.contains {
+      input, metadata in
+      guard input.type == .swift else { return false }
+      guard let priorInput = priorInputs[input.file] else { return true }
+      if let hash = metadata.hash, let priorHash = priorInput.hash {
+        return hash != priorHash
+      }
+      return metadata.mTime != priorInput.previousModTime
+    }
+    guard sourceFilesChanged else {
+      return (.reusePrior, prior.imports)
+    }
+
+    let imports = Self.uniqueSortedImports(try performImportPrescan())
+    let priorImports = Set(prior.imports)
+    // An import of a module the main module already depends on, such as an
+    // implicitly imported one, needs no scan.
+    let priorDependencies = Set(try prior.graph.allDependencies(of: .swift(prior.graph.mainModuleName))
+                                  .map { $0.moduleName })
+    let addedImports = imports.filter { !priorImports.contains($0) && !priorDependencies.contains($0) }
+    guard priorImports.isSubset(of: imports) else {
+      // Without knowing which modules only the removed imports needed,
+      // the graph must be scanned again to drop them.
+      return (.scanAll(because: addedImports.isEmpty ? "imports were removed"
+                                                     : "imports were added and removed"), imports)
+    }
+    return (addedImports.isEmpty ? .reusePrior : .scanAddedImports(addedImports), imports)
+  }
+
+  /// Writes the source file which only imports `addedImports`, unless it
+  /// already has those contents, and returns its path.
+  private func writeAddedImportsScanSource(_ addedImports: [String],
+                                           buildRecordInfo: BuildRecordInfo) throws -> VirtualPath {
+    let path = buildRecordInfo.addedImportsScanSourcePath
+    let contents = ByteString(encodingAsUTF8: addedImports.map { "import \($0)\n" }.joined())
+    if (try? fileSystem.readFileContents(path)) != contents {
+      try fileSystem.writeFileContents(path, bytes: contents, atomically: true)
+    }
+    return path
+  }
+
+  private static func uniqueSortedImports(_ imports: InterModuleDependencyImports) -> [String] {
+    Array(Set(imports.imports)).sorted()
+  }
+
+  /// The modules the sources of `graph`'s main module import, taken from the
+  /// scan rather than pre-scanning the sources again: the imports the scanner
+  /// found in the sources or, from a scanner which doesn't report imports,
+  /// every direct dependency of the main module. The latter includes the
+  /// implicit imports, so the next build which changes a source file will
+  /// find those removed and scan everything again.
+  private static func sourceImports(ofMainModuleIn graph: InterModuleDependencyGraph) throws -> [String] {
+    let mainModule = try graph.moduleInfo(of: .swift(graph.mainModuleName))
+    guard let importInfos = mainModule.importInfos else {
+      return Array(Set((mainModule.directDependencies ?? []).map { $0.moduleName })).sorted()
+    }
+    return Array(Set(importInfos.filter { !$0.sourceLocations.isEmpty }
+                                .map { $0.importIdentifier })).sorted()
+  }
+}
+
+@_spi(Testing) public extension InterModuleDependencyGraph {
+  /// Adds the modules found by scanning a main module which only imports the
+  /// imports that were added to this graph's main module.
+  ///
+  /// Modules already in this graph are kept as they are. The main module
+  /// gains the dependencies of the scanned main module, but keeps its own
+  /// details otherwise.
+  func merging(scanOfAddedImports scan: InterModuleDependencyGraph) throws -> InterModuleDependencyGraph {
+    let mainModuleId: ModuleDependencyId = .swift(mainModuleName)
+    var modules = try allModules()
+    for moduleId in scan.moduleIds where moduleId != .swift(scan.mainModuleName) {
+      if modules[moduleId] == nil {
+        modules[moduleId] = try scan.moduleInfo(of: moduleId)
+      }
+    }
+
+    func appendingNew(_ dependencies: [ModuleDependencyId]?,
+                      to existing: [ModuleDependencyId]?) -> [ModuleDependencyId]? {
+      guard let dependencies, !dependencies.isEmpty else { return existing }
+      var result = existing ?? []
+      var addedSoFar = Set(result)
+      for dependency in dependencies where addedSoFar.insert(dependency).inserted {
+        result.append(dependency)
+      }
+      return result
+    }
+    var mainModule = try moduleInfo(of: mainModuleId)
+    let scannedMainModule = try scan.moduleInfo(of: .swift(scan.mainModuleName))
+    mainModule.directDependencies = appendingNew(scannedMainModule.directDependencies,
+                                                 to: mainModule.directDependencies)
+    if case .swift(var details) = mainModule.details,
+       case .swift(let scannedDetails) = scannedMainModule.details {
+      details.swiftOverlayDependencies = appendingNew(scannedDetails.swiftOverlayDependencies,
+                                                      to: details.swiftOverlayDependencies)
+      details.sourceImportDependencies = appendingNew(scannedDetails.sourceImportDependencies,
+                                                      to: details.sourceImportDependencies)
+      mainModule.details = .swift(details)
+    }
+    modules[mainModuleId] = mainModule
+    return InterModuleDependencyGraph(mainModuleName: mainModuleName, modules: modules)
+  }
+}
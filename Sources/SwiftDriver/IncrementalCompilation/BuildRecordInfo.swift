@@ -128,14 +128,25 @@ import class Dispatch.DispatchQueue
     guard let ofm = outputFileMap else {
       return nil
     }
-    guard let partialBuildRecordPath =
-            try ofm.existingOutputForSingleInput(outputType: .swiftDeps)
+    guard let buildRecordPath = try Self.buildRecordPath(outputFileMap: ofm,
+                                                         workingDirectory: workingDirectory)
     else {
       if incremental {
         diagnosticEngine.emit(.warning_incremental_requires_build_record_entry)
       }
       return nil
     }
+    return buildRecordPath
+  }
+
+  /// The path of the build record in `outputFileMap`, if it has one.
+  static func buildRecordPath(outputFileMap: OutputFileMap,
+                              workingDirectory: AbsolutePath?) throws -> VirtualPath? {
+    guard let partialBuildRecordPath =
+            try outputFileMap.existingOutputForSingleInput(outputType: .swiftDeps)
+    else {
+      return nil
+    }
     return workingDirectory
       .map(VirtualPath.lookup(partialBuildRecordPath).resolvedRelativePath(base:))
       ?? VirtualPath.lookup(partialBuildRecordPath)
@@ -196,6 +207,36 @@ import class Dispatch.DispatchQueue
       .appending(component: filename + ".swiftmoduledeps")
   }
 
+  /// A build-record-relative path to the location of the driver's record of
+  /// the scan which the scanner serialized to `dependencyScanSerializedResultPath`,
+  /// with `-reuse-prior-dependency-scan`. The driver can't read the scanner's
+  /// serialization back, so this keeps what it needs to reuse that scan.
+  var priorDependencyScanPath: VirtualPath {
+    let filename = buildRecordPath.basenameWithoutExt
+    return buildRecordPath
+      .parentDirectory
+      .appending(component: filename + ".swiftmoduledeps.json")
+  }
+
+  /// A build-record-relative path to the location of the source file which
+  /// imports the modules that were added since the prior dependency scan, so
+  /// that only those are scanned.
+  var addedImportsScanSourcePath: VirtualPath {
+    let filename = buildRecordPath.basenameWithoutExt
+    return buildRecordPath
+      .parentDirectory
+      .appending(component: filename + "-added-imports.swift")
+  }
+
+  /// A build-record-relative path to the location of the hashes of the
+  /// inputs, with `-enable-incremental-file-hashing`.
+  static func inputHashCachePath(buildRecordPath: VirtualPath) -> VirtualPath {
+    let filename = buildRecordPath.basenameWithoutExt
+    return buildRecordPath
+      .parentDirectory
+      .appending(component: filename + ".inputhashes.json")
+  }
+
   /// Directory to emit dot files into
   var dotFileDirectory: VirtualPath {
     buildRecordPath.parentDirectory
@@ -203,13 +244,59 @@ import class Dispatch.DispatchQueue
 }
 
 public struct BuildRecordArguments {
+  /// How the options are hashed.
+  public enum HashMode {
+    /// A fast, non-cryptographic hash of the IDs and arguments of the options,
+    /// computed in a single pass.
+    case fast
+    /// The SHA-256 hash of the options as they would be printed, which is
+    /// what earlier versions of the driver recorded.
+    case compatible
+  }
+
   /// Compute a hash of the parsed options that affect incremental builds.
-  public static func computeHash(_ parsedOptionsArg: ParsedOptions) -> String {
-    var parsedOptions = parsedOptionsArg
-    let hashInput = parsedOptions
-      .filter { $0.option.affectsIncrementalBuild && $0.option.kind != .input}
-      .map { $0.description } // The description includes the spelling of the option itself and, if present, its argument(s).
-      .joined()
-    return SHA256().hash(hashInput).hexadecimalRepresentation
+  public static func computeHash(_ parsedOptions: ParsedOptions,
+                                 mode: HashMode = .fast) -> String {
+    switch mode {
+    case .fast:
+      // Option IDs are only meaningful for a particular set of options, so
+      // start from its fingerprint.
+      var hasher = StableHasher(seed: Option.builtinOptionsFingerprint)
+      parsedOptions.forEach { parsed in
+        guard parsed.option.affectsIncrementalBuild,
+              parsed.option.kind != .input else {
+          return
+        }
+        hasher.combine(Int(parsed.option.id))
+        switch parsed.argument {
+        case .none:
+          hasher.combine(0)
+        case .single(let argument):
+          hasher.combine(1)
+          hasher.combine(argument)
+        case .multiple(let arguments):
+          hasher.combine(2)
+          hasher.combine(arguments.count)
+          for argument in arguments {
+            hasher.combine(argument)
+          }
+        }
+      }
+      let hash = String(hasher.finalize(), radix: 16)
+      return String(repeating: "0", count: 16 - hash.count) + hash
+
+    case .compatible:
+      var hashInput: [UInt8] = []
+      parsedOptions.forEach { parsed in
+        guard parsed.option.affectsIncrementalBuild,
+              parsed.option.kind != .input else {
+          return
+        }
+        // The description includes the spelling of the option itself and, if
+        // present, its argument(s).
+        hashInput.append(contentsOf: parsed.description.utf8)
+      }
+      return SHA256().hash(ByteString(hashInput)).hexadecimalRepresentation
+    }
   }
 }
@@ -427,3 +427,37 @@ extension ExternalDependency {
     public var description: String { rawValue }
   }
 }
+
+// MARK: - Remapping interned strings
+extension ExternalDependency {
+  func remapped(by remapping: InternedStringRemapping) -> ExternalDependency {
+    ExternalDependency(fileName: remapping(fileName), remapping.destination)
+  }
+}
+
+extension DependencyKey {
+  func remapped(by remapping: InternedStringRemapping) -> DependencyKey {
+    DependencyKey(aspect: aspect, designator: designator.remapped(by: remapping))
+  }
+}
+
+extension DependencyKey.Designator {
+  func remapped(by remapping: InternedStringRemapping) -> Self {
+    switch self {
+    case let .topLevel(name: name):
+      return .topLevel(name: remapping(name))
+    case let .dynamicLookup(name: name):
+      return .dynamicLookup(name: remapping(name))
+    case let .externalDepend(externalDependency):
+      return .externalDepend(externalDependency.remapped(by: remapping))
+    case let .sourceFileProvide(name: name):
+      return .sourceFileProvide(name: remapping(name))
+    case let .nominal(context: context):
+      return .nominal(context: remapping(context))
+    case let .potentialMember(context: context):
+      return .potentialMember(context: remapping(context))
+    case let .member(context: context, name: name):
+      return .member(context: remapping(context), name: remapping(name))
+    }
+  }
+}
@@ -69,12 +69,16 @@ extension IncrementalCompilationState.ProtectedState: IncrementalCompilationSync
 
 // MARK: - 2nd wave
 extension IncrementalCompilationState.ProtectedState {
+  /// `decodedDependencies` are those of `finishedJob`'s primaries, decoded by
+  /// ``ModuleDependencyGraph/decodeDependencies(of:info:)``.
   mutating func collectBatchedJobsDiscoveredToBeNeededAfterFinishing(
-    job finishedJob: Job
+    job finishedJob: Job,
+    decodedDependencies: [ModuleDependencyGraph.DecodedDependencies]
   ) throws -> [Job]? {
     mutationSafetyPrecondition()
     // batch in here to protect the Driver from concurrent access
-    return try collectUnbatchedJobsDiscoveredToBeNeededAfterFinishing(job: finishedJob)
+    return try collectUnbatchedJobsDiscoveredToBeNeededAfterFinishing(
+      job: finishedJob, decodedDependencies: decodedDependencies)
       .map {try driver.formBatchedJobs($0,
                                        showJobLifecycle: driver.showJobLifecycle,
                                        jobCreatingPch: jobCreatingPch,
@@ -87,10 +91,11 @@ extension IncrementalCompilationState.ProtectedState {
   /// If no more compiles are needed, return nil.
   /// Careful: job may not be primary.
   fileprivate mutating func collectUnbatchedJobsDiscoveredToBeNeededAfterFinishing(
-    job finishedJob: Job) throws -> [Job]? {
+    job finishedJob: Job,
+    decodedDependencies: [ModuleDependencyGraph.DecodedDependencies]) throws -> [Job]? {
       mutationSafetyPrecondition()
       // Find and deal with inputs that now need to be compiled
-      let invalidatedInputs = collectInputsInvalidatedByRunning(finishedJob)
+      let invalidatedInputs = collectInputsInvalidatedByRunning(finishedJob, decodedDependencies)
       assert(invalidatedInputs.isDisjoint(with: finishedJob.primarySwiftSourceFiles),
              "Primaries should not overlap secondaries.")
 
@@ -104,29 +109,30 @@ extension IncrementalCompilationState.ProtectedState {
     }
 
   /// After `job` finished find out which inputs must compiled that were not known to need compilation before
-  fileprivate mutating func collectInputsInvalidatedByRunning(_ job: Job)-> Set<SwiftSourceFile> {
+  fileprivate mutating func collectInputsInvalidatedByRunning(
+    _ job: Job,
+    _ decodedDependencies: [ModuleDependencyGraph.DecodedDependencies]
+  ) -> Set<SwiftSourceFile> {
     mutationSafetyPrecondition()
     guard job.kind == .compile else {
       return Set<SwiftSourceFile>()
     }
-    return job.primaryInputs.reduce(into: Set()) { invalidatedInputs, primaryInput in
-      if let primary = SwiftSourceFile(ifSource: primaryInput) {
-        invalidatedInputs.formUnion(collectInputsInvalidated(byCompiling: primary))
-      }
+    return decodedDependencies.reduce(into: Set()) { invalidatedInputs, decoded in
+      invalidatedInputs.formUnion(collectInputsInvalidated(byCompiling: decoded))
     }
     .subtracting(job.primarySwiftSourceFiles) // have already compiled these
   }
 
   // "Mutating" because it mutates the graph, which may be a struct someday
   fileprivate mutating func collectInputsInvalidated(
-    byCompiling input: SwiftSourceFile
+    byCompiling decoded: ModuleDependencyGraph.DecodedDependencies
   ) -> TransitivelyInvalidatedSwiftSourceFileSet {
     mutationSafetyPrecondition()
-    if let found = moduleDependencyGraph.collectInputsRequiringCompilation(byCompiling: input) {
+    if let found = moduleDependencyGraph.collectInputsRequiringCompilation(byCompiling: decoded) {
       return found
     }
     self.reporter?.report(
-      "Failed to read some dependencies source; compiling everything", input)
+      "Failed to read some dependencies source; compiling everything", decoded.input)
     return TransitivelyInvalidatedSwiftSourceFileSet(skippedCompileJobs.keys.swiftSourceFiles)
   }
 
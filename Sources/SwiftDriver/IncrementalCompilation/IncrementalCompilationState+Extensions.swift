@@ -142,11 +142,18 @@ extension Diagnostic.Message {
 extension IncrementalCompilationState {
 
   /// Needed for API compatibility, `result` may be ignored
+  ///
+  /// The dependencies of the job's primaries are decoded concurrently before blocking access to the
+  /// protected state, which is only needed to integrate them.
   public func collectJobsDiscoveredToBeNeededAfterFinishing(
     job finishedJob: Job
   ) throws -> [Job]? {
-    try blockingConcurrentAccessOrMutationToProtectedState {
-      try $0.collectBatchedJobsDiscoveredToBeNeededAfterFinishing(job: finishedJob)
+    let decodedDependencies = finishedJob.kind == .compile
+      ? ModuleDependencyGraph.decodeDependencies(of: finishedJob.primarySwiftSourceFiles, info: info)
+      : []
+    return try blockingConcurrentAccessOrMutationToProtectedState {
+      try $0.collectBatchedJobsDiscoveredToBeNeededAfterFinishing(
+        job: finishedJob, decodedDependencies: decodedDependencies)
     }
   }
 
@@ -323,6 +330,18 @@ extension IncrementalCompilationState {
       report("Dependency module \(moduleName) is missing from CAS")
     }
 
+    func reportReusingPriorDependencyScan() {
+      report("Reusing prior dependency scan")
+    }
+
+    func reportScanningAddedImports(_ imports: [String]) {
+      report("Scanning dependencies of added imports: [\(imports.joined(separator: ", "))]")
+    }
+
+    func reportScanningAllDependencies(_ why: String) {
+      report("Scanning all dependencies: \(why)")
+    }
+
     // Emits a remark indicating incremental compilation has been disabled.
     func reportDisablingIncrementalBuild(_ why: String) {
       report("Disabling incremental build: \(why)")
@@ -339,14 +358,15 @@ extension IncrementalCompilationState {
     func reportInvalidated<Nodes: Sequence>(
       _ nodes: Nodes,
       by externalDependency: ExternalDependency,
-      _ why: ExternalDependency.InvalidationReason
+      _ why: ExternalDependency.InvalidationReason,
+      in holder: InternedStringTableHolder
     )
     where Nodes.Element == ModuleDependencyGraph.Node
     {
       let whyString = why.description.capitalized
       let depString = externalDependency.shortDescription
       for node in nodes {
-        report("\(whyString): \(depString) -> \(node)")
+        report("\(whyString): \(depString) -> \(node.description(in: holder))")
       }
     }
   }
@@ -78,11 +78,13 @@ public final class IncrementalCompilationState {
     // at the end of this build reflect up-to-date paths.
     if let planner = explicitModulePlanner {
       initialState.graph.blockingConcurrentAccessOrMutation {
+        let dependencyGraph = planner.dependencyGraph
         let map = Dictionary(uniqueKeysWithValues:
-          planner.dependencyGraph.modules.compactMap {
-            moduleId, moduleInfo -> (String, VirtualPath.Handle)? in
+          dependencyGraph.moduleIds.compactMap {
+            moduleId -> (String, VirtualPath.Handle)? in
+            // Only decode the prebuilt modules.
             guard case .swiftPrebuiltExternal = moduleId,
-                  case .swiftPrebuiltExternal(let details) = moduleInfo.details
+                  let details = try? dependencyGraph.swiftPrebuiltDetails(of: moduleId)
             else { return nil }
             let abstractPath = moduleId.moduleName + "." + FileType.swiftModule.rawValue
             return (abstractPath, details.compiledModulePath.path)
@@ -0,0 +1,220 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import SwiftOptions
+import protocol TSCBasic.FileSystem
+import class TSCBasic.DiagnosticsEngine
+import struct TSCBasic.ByteString
+import struct TSCBasic.SHA256
+import var TSCBasic.localFileSystem
+import class Dispatch.DispatchQueue
+import class Foundation.JSONDecoder
+import class Foundation.JSONEncoder
+import class Foundation.NSLock
+
+/// How the contents of input files are hashed with
+/// `-enable-incremental-file-hashing`, chosen with
+/// `-incremental-file-hash-function`.
+@_spi(Testing) public enum InputHashFunction: String, Codable, CaseIterable {
+  /// SHA-256, the default.
+  case sha256
+  /// `StableHasher`, which is much faster, but only detects accidental
+  /// changes.
+  case stable
+
+  public func hash(_ contents: ByteString) -> String {
+    switch self {
+    case .sha256:
+      return SHA256().hash(contents).hexadecimalRepresentation
+    case .stable:
+      var hasher = StableHasher()
+      contents.contents.withUnsafeBytes { hasher.combine(bytes: $0) }
+      let hash = String(hasher.finalize(), radix: 16)
+      return String(repeating: "0", count: 16 - hash.count) + hash
+    }
+  }
+}
+
+/// The hashes of the inputs of earlier builds, kept next to the build record
+/// so that a file which hasn't changed isn't read again to hash it.
+///
+/// Each hash is keyed by the file's device, inode, size and modification
+/// time, which writing to or replacing the file changes. A file modified
+/// within the granularity of its modification time could still be missed, so
+/// hashes of files modified shortly before the build started aren't kept.
+@_spi(Testing) public final class InputHashCache {
+  /// Incremented whenever the cache's format changes.
+  static let version = 1
+
+  /// Identifies the contents of a file, as long as it is only ever modified
+  /// through the file system.
+  struct FileIdentity: Hashable, Codable {
+    var device: UInt64
+    var inode: UInt64
+    var size: UInt64
+    var seconds: UInt64
+    var nanoseconds: UInt32
+  }
+
+  struct Entry: Codable {
+    var file: FileIdentity
+    var hash: String
+  }
+
+  struct Contents: Codable {
+    var version: Int
+    var hashFunction: InputHashFunction
+    var entries: [Entry]
+  }
+
+  @_spi(Testing) public let path: VirtualPath
+  @_spi(Testing) public let hashFunction: InputHashFunction
+  private let priorHashes: [FileIdentity: String]
+  /// Files modified after this are too recent to be cached.
+  private let cutoff: TimePoint
+
+  private let lock = NSLock()
+  /// The hashes of this build's inputs which can be kept.
+  private var hashes: [FileIdentity: String] = [:]
+  private var hits = 0
+
+  /// Loads the cache at `path`, if it was written with the same hash
+  /// function, or starts an empty one.
+  @_spi(Testing) public init(path: VirtualPath, hashFunction: InputHashFunction,
+                             fileSystem: FileSystem, now: TimePoint = .now()) {
+    self.path = path
+    self.hashFunction = hashFunction
+    self.cutoff = TimePoint(seconds: now.seconds > 2 ? now.seconds - 2 : 0, nanoseconds: 0)
+    if let contents = try? fileSystem.readFileContents(path),
+       let cache = try? JSONDecoder().decode(Contents.self, from: contents.data),
+       cache.version == Self.version, cache.hashFunction == hashFunction {
+      self.priorHashes = Dictionary(cache.entries.map { ($0.file, $0.hash) },
+                                    uniquingKeysWith: { first, _ in first })
+    } else {
+      self.priorHashes = [:]
+    }
+  }
+
+  /// How many files were hashed by an earlier build.
+  @_spi(Testing) public var hitCount: Int {
+    lock.lock()
+    defer { lock.unlock() }
+    return hits
+  }
+
+  /// Returns the hash of `file`, which was last modified at `modTime`, only
+  /// reading it if an earlier build didn't hash the same contents.
+  @_spi(Testing) public func hash(of file: VirtualPath, modTime: TimePoint,
+                                  fileSystem: FileSystem) -> String? {
+    guard let info = try? fileSystem.getFileInfo(file) else {
+      return (try? fileSystem.readFileContents(file)).map(hashFunction.hash)
+    }
+    let identity = FileIdentity(device: info.device, inode: info.inode, size: info.size,
+                                seconds: modTime.seconds, nanoseconds: modTime.nanoseconds)
+    lock.lock()
+    if let hash = priorHashes[identity] {
+      hashes[identity] = hash
+      hits += 1
+      lock.unlock()
+      return hash
+    }
+    lock.unlock()
+
+    guard let contents = try? fileSystem.readFileContents(file) else {
+      return nil
+    }
+    let hash = hashFunction.hash(contents)
+    if modTime < cutoff {
+      lock.lock()
+      hashes[identity] = hash
+      lock.unlock()
+    }
+    return hash
+  }
+
+  /// Writes the hashes of this build's inputs, dropping those of files which
+  /// are no longer inputs, unless they are the ones that were loaded.
+  @_spi(Testing) public func save(fileSystem: FileSystem) throws {
+    lock.lock()
+    let hashes = self.hashes
+    lock.unlock()
+    guard hashes != priorHashes else {
+      return
+    }
+    let entries = hashes.map { Entry(file: $0.key, hash: $0.value) }
+    let contents = Contents(version: Self.version, hashFunction: hashFunction, entries: entries)
+    try fileSystem.writeFileContents(path,
+                                     bytes: ByteString(JSONEncoder().encode(contents)),
+                                     atomically: true)
+  }
+}
+
+extension Driver {
+  /// Records the modification time of each input, and with a hash function
+  /// its hash too, using `hashCache` if there is one. Inputs on the local
+  /// file system are stat-ed and hashed concurrently; other file systems,
+  /// such as the in-memory ones of tests, aren't necessarily thread-safe.
+  @_spi(Testing) public static func recordInputMetadata(of inputFiles: [TypedVirtualPath],
+                                                        hashFunction: InputHashFunction?,
+                                                        hashCache: InputHashCache?,
+                                                        fileSystem: FileSystem)
+  -> [TypedVirtualPath: FileMetadata] {
+    let inputFiles = Array(Set(inputFiles))
+    func fileMetadata(of file: VirtualPath) -> FileMetadata? {
+      guard let modTime = try? fileSystem.lastModificationTime(for: file) else {
+        return nil
+      }
+      if let hashCache {
+        return hashCache.hash(of: file, modTime: modTime, fileSystem: fileSystem).map {
+          FileMetadata(mTime: modTime, hash: $0)
+        }
+      } else if let hashFunction {
+        return (try? fileSystem.readFileContents(file)).map {
+          FileMetadata(mTime: modTime, hash: hashFunction.hash($0))
+        }
+      } else {
+        return FileMetadata(mTime: modTime)
+      }
+    }
+    var metadata = [FileMetadata?](repeating: nil, count: inputFiles.count)
+    if fileSystem.isLocal {
+      metadata.withUnsafeMutableBufferPointer { buffer in
+        DispatchQueue.concurrentPerform(iterations: inputFiles.count) { index in
+          buffer[index] = fileMetadata(of: inputFiles[index].file)
+        }
+      }
+    } else {
+      metadata = inputFiles.map { fileMetadata(of: $0.file) }
+    }
+    return Dictionary(uniqueKeysWithValues: zip(inputFiles, metadata).compactMap { inputFile, metadata in
+      metadata.map { (inputFile, $0) }
+    })
+  }
+
+  /// Inputs are hashed with `-incremental-file-hash-function`, `sha256` by
+  /// default.
+  static func inputHashFunction(_ parsedOptions: inout ParsedOptions,
+                                diagnosticsEngine: DiagnosticsEngine) -> InputHashFunction {
+    guard let name = parsedOptions.getLastArgument(.incrementalFileHashFunction)?.asSingle else {
+      return .sha256
+    }
+    guard let hashFunction = InputHashFunction(rawValue: name) else {
+      diagnosticsEngine.emit(.error_invalid_arg_value_with_allowed(
+        arg: .incrementalFileHashFunction, value: name,
+        options: InputHashFunction.allCases.map { $0.rawValue }))
+      return .sha256
+    }
+    return hashFunction
+  }
+}
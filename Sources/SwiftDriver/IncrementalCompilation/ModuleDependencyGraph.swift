@@ -272,6 +272,67 @@ extension ModuleDependencyGraph {
   ) -> TransitivelyInvalidatedSwiftSourceFileSet? {
     return collectInputsRequiringCompilationAfterProcessing(input: input)
   }
+
+  /// Like ``collectInputsRequiringCompilation(byCompiling:)``, but integrates dependencies
+  /// already decoded by ``decodeDependencies(of:info:)``, so only the integration is done here.
+  @_spi(Testing) public func collectInputsRequiringCompilation(
+    byCompiling decoded: DecodedDependencies
+  ) -> TransitivelyInvalidatedSwiftSourceFileSet? {
+    accessSafetyPrecondition()
+    mutationSafetyPrecondition() // string table
+    let dependencySource = DependencySource(decoded.input, internedStringTable)
+    let sourceGraph: SourceFileDependencyGraph?
+    do {
+      sourceGraph = try dependencySource.reportReading(decoded.dependencies, info: info)?
+        .remapped(into: internedStringTable)
+    } catch {
+      // Treated like a file which could not be read.
+      info.reporter?.report("Could not integrate dependencies \(error.localizedDescription)", decoded.input)
+      sourceGraph = nil
+    }
+    return collectInputsRequiringCompilationAfterIntegrating(sourceGraph, from: dependencySource)
+  }
+}
+
+// MARK: - Decoding the dependencies of the 2nd wave
+extension ModuleDependencyGraph {
+  /// The dependencies of a compiled input, decoded into a string table of their own.
+  @_spi(Testing) public struct DecodedDependencies {
+    @_spi(Testing) public let input: SwiftSourceFile
+    fileprivate let dependencies: DependencySource.Decoded?
+  }
+
+  /// Decode the `swiftdeps` files of `inputs`, concurrently when they are on the local file system.
+  ///
+  /// Decoding does not touch the graph, so unlike integration it need not be done on the
+  /// incremental compilation queue: each file's strings are interned in a table of its own, and are
+  /// moved into the graph's table when integrated. Nothing is reported until then, so that the
+  /// reports stay in order.
+  @_spi(Testing) public static func decodeDependencies(
+    of inputs: [SwiftSourceFile],
+    info: IncrementalCompilationState.IncrementalDependencyAndInputSetup
+  ) -> [DecodedDependencies] {
+    func decode(_ input: SwiftSourceFile) -> DependencySource.Decoded? {
+      let table = InternedStringTable(
+        DispatchQueue(label: "org.swift.swift-driver.decoded-dependencies"))
+      return table.blockingConcurrentAccessOrMutation {
+        DependencySource(input, table).decode(info: info, internedStringTable: table)
+      }
+    }
+    var decoded = [DependencySource.Decoded?](repeating: nil, count: inputs.count)
+    if info.fileSystem.isLocal {
+      decoded.withUnsafeMutableBufferPointer { buffer in
+        DispatchQueue.concurrentPerform(iterations: inputs.count) { index in
+          buffer[index] = decode(inputs[index])
+        }
+      }
+    } else {
+      decoded = inputs.map(decode)
+    }
+    return zip(inputs, decoded).map {
+      DecodedDependencies(input: $0, dependencies: $1)
+    }
+  }
 }
 
 // MARK: - Scheduling either wave
@@ -319,18 +380,15 @@ extension ModuleDependencyGraph {
     let key = DependencyKey(
       aspect: .interface,
       designator: .externalDepend(externalDefs.externalDependency))
-    // DependencySource is OK as a nil placeholder because it's only used to find
+    // An unknown definition location is OK as a placeholder because it's only used to find
     // the corresponding implementation node and there won't be any for an
     // external dependency node.
-    let node = Node(key: key,
-                    fingerprint: externalDefs.fingerprint,
-                    definitionLocation: .unknown)
     accessSafetyPrecondition()
     let untracedUses = DirectlyInvalidatedNodeSet(
       nodeFinder
-        .uses(of: node)
+        .uses(of: key, definedAt: .unknown)
         .filter({ use in use.isUntraced }))
-    info.reporter?.reportInvalidated(untracedUses, by: externalDefs.externalDependency, why)
+    info.reporter?.reportInvalidated(untracedUses, by: externalDefs.externalDependency, why, in: self)
     return untracedUses
   }
 
@@ -344,9 +402,21 @@ extension ModuleDependencyGraph {
     accessSafetyPrecondition()
     mutationSafetyPrecondition() // string table
     let dependencySource = DependencySource(input, internedStringTable)
-    guard let sourceGraph = dependencySource.read(info: info,
-                                                  internedStringTable: internedStringTable)
-    else {
+    return collectInputsRequiringCompilationAfterIntegrating(
+      dependencySource.read(info: info, internedStringTable: internedStringTable),
+      from: dependencySource)
+  }
+
+  /// Integrate the dependencies read from `dependencySource`, and find all the inputs known to need
+  /// recompilation as a consequence.
+  ///
+  /// - Returns: `nil` if the dependencies could not be read, or the inputs discovered to be requiring compilation.
+  private func collectInputsRequiringCompilationAfterIntegrating(
+    _ sourceGraph: SourceFileDependencyGraph?,
+    from dependencySource: DependencySource
+  ) -> TransitivelyInvalidatedSwiftSourceFileSet? {
+    mutationSafetyPrecondition()
+    guard let sourceGraph = sourceGraph else {
       // to preserve legacy behavior cancel whole thing
       info.diagnosticEngine.emit(
         .remark_incremental_compilation_has_been_disabled(
@@ -563,7 +633,7 @@ extension ModuleDependencyGraph {
       from: unserializedDepGraph,
       dependencySource: source,
       into: self)
-    info.reporter?.reportInvalidated(invalidatedNodes, by: fed.externalDependency, why)
+    info.reporter?.reportInvalidated(invalidatedNodes, by: fed.externalDependency, why, in: self)
     return invalidatedNodes
   }
 
@@ -688,7 +758,20 @@ extension ModuleDependencyGraph {
   /// - Minor number 4: Absorb the data in the ``BuildRecord`` into the module dependency graph.
   /// - Minor number 5: SHA256 hashes for files in externalDepNode and inputInfo blobs.
   /// - Minor number 6: externalModulePathNode for resolving abstract module paths.
-  @_spi(Testing) public static let serializedGraphVersion = Version(1, 6, 0)
+  /// - Minor number 7: Nodes are grouped by definition location, each group led by a sourceFileNodesNode.
+  @_spi(Testing) public static let serializedGraphVersion = Version(1, 7, 0)
+
+  /// The oldest version of the serialized dependency graph which can still be read.
+  ///
+  /// Priors written by the previous release of the driver are read, rather than
+  /// discarded, so that upgrading it does not force a full rebuild. The next
+  /// build writes them in the current format.
+  @_spi(Testing) public static let oldestReadableSerializedGraphVersion = Version(1, 6, 0)
+
+  /// The versions of the serialized dependency graph which can be read.
+  fileprivate static var readableSerializedGraphVersions: ClosedRange<Version> {
+    oldestReadableSerializedGraphVersion...serializedGraphVersion
+  }
 
   /// The IDs of the records used by the module dependency graph.
   fileprivate enum RecordID: UInt64 {
@@ -701,6 +784,7 @@ extension ModuleDependencyGraph {
     case buildRecord             = 7
     case inputInfo               = 8
     case externalModulePathNode  = 9
+    case sourceFileNodesNode     = 10
 
     /// The human-readable name of this record.
     ///
@@ -727,6 +811,8 @@ extension ModuleDependencyGraph {
         return "INPUT_INFO"
       case .externalModulePathNode:
         return "EXTERNAL_MODULE_PATH_NODE"
+      case .sourceFileNodesNode:
+        return "SOURCE_FILE_NODES_NODE"
       }
     }
   }
@@ -741,6 +827,7 @@ extension ModuleDependencyGraph {
     case malformedFingerprintRecord
     case malformedIdentifierRecord
     case malformedModuleDepGraphNodeRecord
+    case malformedSourceFileNodesRecord
     case malformedDependsOnRecord
     case malforedUseIDRecord
     case malformedMapRecord
@@ -773,6 +860,8 @@ extension ModuleDependencyGraph {
         self = .malformedInputInfo
       case .externalModulePathNode:
         self = .malformedMapRecord
+      case .sourceFileNodesNode:
+        self = .malformedSourceFileNodesRecord
       }
     }
   }
@@ -815,8 +904,12 @@ extension ModuleDependencyGraph {
       var inputInfos: [VirtualPath: InputInfo] = [:]
       var expectedInputInfos: Int = 0
 
-      private var currentDefKey: DependencyKey? = nil
-      private var nodeUses: [(DependencyKey, Int)] = []
+      /// The version of the format being read, once the metadata has been read.
+      private var readVersion: Version? = nil
+      /// The location of the nodes being read, and whether it is in a source file that was removed.
+      private var currentDefinitionLocation: (DefinitionLocation, isForRemovedInput: Bool)? = nil
+      /// The uses read so far, by the key they depend upon.
+      private var nodeUses: [(def: DependencyKey, uses: [NodeID])] = []
       private var fingerprintedExternalDependencies = Set<FingerprintedExternalDependency>()
       private var externalDependencyFileHashes = Dictionary<ExternalDependency, String>()
       private var externalModulePathMap = Dictionary<String, VirtualPath.Handle>()
@@ -825,8 +918,8 @@ extension ModuleDependencyGraph {
       ///
       /// Since the def-use relationship is serialized according the index of the node in the priors file, this
       /// `Array` supports the deserialization of the def-use links by mapping index to node.
-      /// The optionality of the contents lets the ``ModuleDependencyGraph/isForRemovedInput`` check to be cached.
-      public private(set) var potentiallyUsedNodes: [Node?] = []
+      /// The nodes of removed source files are never built; their placeholders keep the indices of the rest.
+      public private(set) var potentiallyUsedNodes: [NodeID?] = []
 
       private var nodeFinder = NodeFinder()
 
@@ -858,15 +951,7 @@ extension ModuleDependencyGraph {
                                                           nodeFinder,
                                                           fingerprintedExternalDependencies,
                                                           externalDependencyFileHashes)
-        for (dependencyKey, useID) in self.nodeUses {
-          guard let use = self.potentiallyUsedNodes[useID] else {
-            // Don't record uses of defs of removed files.
-            continue
-          }
-          let isNewUse = graph.nodeFinder
-            .record(def: dependencyKey, use: use)
-          assert(isNewUse, "Duplicate use def-use arc in graph?")
-        }
+        graph.nodeFinder.loadUses(self.nodeUses)
         graph.setExternalModulePathMap(self.externalModulePathMap)
         return graph
       }
@@ -883,15 +968,14 @@ extension ModuleDependencyGraph {
 
       mutating func didExitBlock() throws {}
 
-      private mutating func finalize(node newNode: Node) {
+      private mutating func finalizeNode(key: DependencyKey,
+                                         fingerprint: InternedString?,
+                                         definitionLocation: DefinitionLocation) {
         mutationSafetyPrecondition()
-        if isForRemovedInput(newNode) {
-          // Preserve the mapping of Int to Node for reconstructing def-use links with a placeholder.
-          self.potentiallyUsedNodes.append(nil)
-          return
-        }
-        self.potentiallyUsedNodes.append(newNode)
-        let oldNode = self.nodeFinder.insert(newNode)
+        let (newNode, oldNode) = self.nodeFinder.insert(key: key,
+                                                        fingerprint: fingerprint,
+                                                        definitionLocation: definitionLocation)
+        self.potentiallyUsedNodes.append(newNode.id)
         assert(oldNode == nil,
                "Integrated the same node twice: \(oldNode!), \(newNode)")
       }
@@ -901,10 +985,10 @@ extension ModuleDependencyGraph {
       /// If the priors were read from an invocation containing a subsequently removed input,
       /// the nodes defining decls from that input must be culled.
       ///
-      /// - Parameter node: The (deserialized) node to test.
+      /// - Parameter definitionLocation: The location of the (deserialized) node to test.
       /// - Returns: true iff the node corresponds to a definition on a removed source file.
-      fileprivate func isForRemovedInput(_ node: Node) -> Bool {
-        guard case let .known(dependencySource) = node.definitionLocation,
+      fileprivate func isForRemovedInput(_ definitionLocation: DefinitionLocation) -> Bool {
+        guard case let .known(dependencySource) = definitionLocation,
            dependencySource.typedFile.type == .swift // e.g., could be a .swiftdeps file
         else {
           return false
@@ -950,6 +1034,19 @@ extension ModuleDependencyGraph {
             internedStringTable: internedStringTable, fileSystem: fileSystem)
           return DependencyKey(aspect: declAspect, designator: designator)
         }
+        func definitionLocation(field i: Int) throws -> DefinitionLocation {
+          guard let internedFile = try nonemptyInternedString(field: i) else {
+            return .unknown
+          }
+          let pathString = internedFile.lookup(in: internedStringTable)
+          let pathHandle = try VirtualPath.intern(path: pathString)
+          guard let source = DependencySource(ifAppropriateFor: pathHandle,
+                                              internedString: internedFile)
+          else {
+            throw ReadError.unknownDependencySourceExtension
+          }
+          return .known(source)
+        }
 
         switch kind {
         case .metadata:
@@ -966,6 +1063,13 @@ extension ModuleDependencyGraph {
 
           self.majorVersion = record.fields[0]
           self.minorVersion = record.fields[1]
+          // Don't try to read the rest in a format this driver doesn't know.
+          let readVersion = Version(Int(record.fields[0]), Int(record.fields[1]), 0)
+          guard ModuleDependencyGraph.readableSerializedGraphVersions.contains(readVersion) else {
+            throw ReadError.mismatchedSerializedGraphVersion(
+              expected: ModuleDependencyGraph.serializedGraphVersion, read: readVersion)
+          }
+          self.readVersion = readVersion
           let stringCount = record.fields[2]
           internedStringTable.reserveCapacity(Int(stringCount))
           self.compilerVersionString = String(decoding: compilerVersionBlob, as: UTF8.self)
@@ -1009,47 +1113,69 @@ extension ModuleDependencyGraph {
           self.inputInfos[VirtualPath.lookup(pathHandle)] = InputInfo(
             status: status,
             previousModTime: modTime, hash: hash)
-        case .moduleDepGraphNode:
-          guard record.fields.count == 6 else {
+        case .sourceFileNodesNode:
+          guard self.readVersion?.groupsNodesByDefinitionLocation == true,
+                record.fields.count == 1 else {
             throw malformedError
           }
+          let defLoc = try definitionLocation(field: 0)
+          self.currentDefinitionLocation = (defLoc, isForRemovedInput(defLoc))
+        case .moduleDepGraphNode:
+          let defLoc: DefinitionLocation
+          let isRemoved: Bool
+          let fingerprintField: Int
+          if let readVersion = self.readVersion,
+             !readVersion.groupsNodesByDefinitionLocation {
+            // Each node of the older format has its own definition location.
+            guard record.fields.count == 6 else {
+              throw malformedError
+            }
+            defLoc = try definitionLocation(field: 4)
+            isRemoved = isForRemovedInput(defLoc)
+            fingerprintField = 5
+          } else {
+            guard case let (groupDefLoc, groupIsRemoved)? = self.currentDefinitionLocation,
+                  record.fields.count == 5 else {
+              throw malformedError
+            }
+            (defLoc, isRemoved) = (groupDefLoc, groupIsRemoved)
+            fingerprintField = 4
+          }
+          guard !isRemoved else {
+            // Preserve the mapping of Int to Node for reconstructing def-use links with a placeholder.
+            self.potentiallyUsedNodes.append(nil)
+            break
+          }
           let key = try dependencyKey(kindCodeField: 0,
                                       declAspectField: 1,
                                       contextField: 2,
                                       identifierField: 3)
-          let depSourceFileOrNone = try nonemptyInternedString(field: 4)
-          let defLoc: DefinitionLocation = try depSourceFileOrNone.map {
-            internedFile -> DefinitionLocation in
-            let pathString = internedFile.lookup(in: internedStringTable)
-            let pathHandle = try VirtualPath.intern(path: pathString)
-            guard let source =  DependencySource(ifAppropriateFor: pathHandle,
-                             internedString: internedFile)
-            else {
-              throw ReadError.unknownDependencySourceExtension
-            }
-            return .known(source)
-          }
-          ?? .unknown
-          let fingerprint = try nonemptyInternedString(field: 5)
-          self.finalize(node: Node(key: key,
-                                   fingerprint: fingerprint,
-                                   definitionLocation: defLoc))
+          let fingerprint = try nonemptyInternedString(field: fingerprintField)
+          self.finalizeNode(key: key,
+                            fingerprint: fingerprint,
+                            definitionLocation: defLoc)
         case .dependsOnNode:
           guard record.fields.count == 4
           else {
             throw malformedError
           }
-          self.currentDefKey = try dependencyKey(
-            kindCodeField: 0,
-            declAspectField: 1,
-            contextField: 2,
-            identifierField: 3)
+          self.nodeUses.append((
+            def: try dependencyKey(
+              kindCodeField: 0,
+              declAspectField: 1,
+              contextField: 2,
+              identifierField: 3),
+            uses: []))
         case .useIDNode:
-          guard let key = self.currentDefKey,
-                  record.fields.count == 1 else {
+          guard !self.nodeUses.isEmpty,
+                record.fields.count == 1,
+                record.fields[0] < UInt64(self.potentiallyUsedNodes.count) else {
             throw malformedError
           }
-          self.nodeUses.append( (key, Int(record.fields[0])) )
+          // Don't record uses of defs of removed files.
+          if let use = self.potentiallyUsedNodes[Int(record.fields[0])] {
+            self.nodeUses[self.nodeUses.count - 1].uses.append(use)
+          }
         case .externalDepNode:
           guard record.fields.count == 2,
           case .blob(let hashBlob) = record.payload
@@ -1097,7 +1223,7 @@ extension ModuleDependencyGraph {
       throw ReadError.malformedMetadataRecord
     }
     let readVersion = Version(Int(major), Int(minor), 0)
-    guard readVersion == Self.serializedGraphVersion
+    guard Self.readableSerializedGraphVersions.contains(readVersion)
     else {
       throw ReadError.mismatchedSerializedGraphVersion(
         expected: Self.serializedGraphVersion, read: readVersion)
@@ -1221,6 +1347,9 @@ extension ModuleDependencyGraph {
         self.emitRecordID(.buildRecord)
         self.emitRecordID(.inputInfo)
         self.emitRecordID(.externalModulePathNode)
+        if serializedGraphVersion.groupsNodesByDefinitionLocation {
+          self.emitRecordID(.sourceFileNodesNode)
+        }
       }
     }
 
@@ -1270,8 +1399,10 @@ extension ModuleDependencyGraph {
     }
 
     private func populateCaches(from graph: ModuleDependencyGraph) {
-      graph.nodeFinder.forEachNode { node in
-        self.cacheNodeID(for: node)
+      graph.nodeFinder.forEachNodeByLocation { _, nodes in
+        for node in nodes {
+          self.cacheNodeID(for: node)
+        }
       }
 
       let sortedInputInfo = self.buildRecord.inputInfos.sorted {
@@ -1352,14 +1483,28 @@ extension ModuleDependencyGraph {
         // file hash
         .blob,
       ])
-      self.abbreviate(.moduleDepGraphNode,
-        [Bitstream.Abbreviation.Operand.literal(RecordID.moduleDepGraphNode.rawValue)] +
-        dependencyKeyOperands + [
-        // swiftdeps path / none if empty
-        .vbr(chunkBitWidth: 13),
-        // fingerprint
-        .vbr(chunkBitWidth: 13),
-      ])
+      if serializedGraphVersion.groupsNodesByDefinitionLocation {
+        self.abbreviate(.sourceFileNodesNode, [
+          .literal(RecordID.sourceFileNodesNode.rawValue),
+          // swiftdeps path / none if empty
+          .vbr(chunkBitWidth: 13),
+        ])
+        self.abbreviate(.moduleDepGraphNode,
+          [Bitstream.Abbreviation.Operand.literal(RecordID.moduleDepGraphNode.rawValue)] +
+          dependencyKeyOperands + [
+          // fingerprint
+          .vbr(chunkBitWidth: 13),
+        ])
+      } else {
+        self.abbreviate(.moduleDepGraphNode,
+          [Bitstream.Abbreviation.Operand.literal(RecordID.moduleDepGraphNode.rawValue)] +
+          dependencyKeyOperands + [
+          // swiftdeps path / none if empty
+          .vbr(chunkBitWidth: 13),
+          // fingerprint
+          .vbr(chunkBitWidth: 13),
+        ])
+      }
       self.abbreviate(.dependsOnNode,
         [.literal(RecordID.dependsOnNode.rawValue)] +
         dependencyKeyOperands)
@@ -1430,22 +1575,34 @@ extension ModuleDependencyGraph {
                       for: key.designator.name))
         }
 
-        graph.nodeFinder.forEachNode { node in
-          serializer.stream.writeRecord(serializer.abbreviations[.moduleDepGraphNode]!) {
-            $0.append(RecordID.moduleDepGraphNode)
-            write(key: node.key, to: &$0)
-            $0.append(serializer.lookupIdentifierCode(
-                        for: node.definitionLocation.internedFileNameIfAny))
-            $0.append(serializer.lookupIdentifierCode(for: node.fingerprint))
+        let groupsNodes = serializedGraphVersion.groupsNodesByDefinitionLocation
+        graph.nodeFinder.forEachNodeByLocation { definitionLocation, nodes in
+          let definitionLocationCode = serializer.lookupIdentifierCode(
+            for: definitionLocation.internedFileNameIfAny)
+          if groupsNodes {
+            serializer.stream.writeRecord(serializer.abbreviations[.sourceFileNodesNode]!) {
+              $0.append(RecordID.sourceFileNodesNode)
+              $0.append(definitionLocationCode)
+            }
+          }
+          for node in nodes {
+            serializer.stream.writeRecord(serializer.abbreviations[.moduleDepGraphNode]!) {
+              $0.append(RecordID.moduleDepGraphNode)
+              write(key: node.key, to: &$0)
+              if !groupsNodes {
+                $0.append(definitionLocationCode)
+              }
+              $0.append(serializer.lookupIdentifierCode(for: node.fingerprint))
+            }
           }
         }
 
-        for key in graph.nodeFinder.usesByDef.keys {
+        graph.nodeFinder.forEachDef { key, uses in
           serializer.stream.writeRecord(serializer.abbreviations[.dependsOnNode]!) {
             $0.append(RecordID.dependsOnNode)
             write(key: key, to: &$0)
           }
-          for use in graph.nodeFinder.usesByDef[key, default: []] {
+          for use in uses {
             guard let useID = serializer.nodeIDs[use] else {
               fatalError("Node ID was not registered! \(use)")
             }
@@ -1572,12 +1729,6 @@ extension ModuleDependencyGraph {
   }
 }
 
-extension Set where Element == ModuleDependencyGraph.Node {
-  fileprivate func matches(_ other: Self) -> Bool {
-    self == other
-  }
-}
-
 extension Set where Element == FingerprintedExternalDependency {
   fileprivate func matches(_ other: Self) -> Bool {
     self == other
@@ -1595,6 +1746,12 @@ fileprivate extension Version {
     assert(Int(r) == Int(minor))
     return r
   }
+
+  /// Whether the nodes of a serialized graph of this version are grouped by
+  /// definition location, rather than each recording its own.
+  var groupsNodesByDefinitionLocation: Bool {
+    self >= Version(1, 7, 0)
+  }
 }
 
 fileprivate extension BitstreamWriter.RecordBuffer {
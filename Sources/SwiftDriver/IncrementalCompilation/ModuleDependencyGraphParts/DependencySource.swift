@@ -72,17 +72,47 @@ extension DependencySource {
     info: IncrementalCompilationState.IncrementalDependencyAndInputSetup,
     internedStringTable: InternedStringTable
   ) -> SourceFileDependencyGraph? {
+    reportReading(decode(info: info, internedStringTable: internedStringTable),
+                  info: info)
+  }
+
+  /// The result of reading the dependencies, before it is reported.
+  struct Decoded {
+    let fileRead: TypedVirtualPath
+    let graph: Result<SourceFileDependencyGraph?, Error>
+  }
+
+  /// Like ``read(info:internedStringTable:)``, but without reporting anything,
+  /// so that the dependencies of several sources may be decoded concurrently,
+  /// each into a table of its own, and reported in order afterwards.
+  /// Returns nil if there is no file to read.
+  func decode(
+    info: IncrementalCompilationState.IncrementalDependencyAndInputSetup,
+    internedStringTable: InternedStringTable
+  ) -> Decoded? {
     guard let fileToRead = try? fileToRead(info: info) else {return nil}
-    do {
-      info.reporter?.report("Reading dependencies from \(description)")
-      return try SourceFileDependencyGraph.read(from: fileToRead,
-                                                on: info.fileSystem,
-                                                internedStringTable: internedStringTable,
-                                                pathReverser: info.pathReverser)
-    }
-    catch {
-      let msg = "Could not read \(fileToRead) \(error.localizedDescription)"
-      info.reporter?.report(msg, fileToRead)
+    return Decoded(fileRead: fileToRead, graph: Result {
+      try SourceFileDependencyGraph.read(from: fileToRead,
+                                         on: info.fileSystem,
+                                         internedStringTable: internedStringTable,
+                                         pathReverser: info.pathReverser)
+    })
+  }
+
+  /// Reports reading the dependencies ``decode(info:internedStringTable:)``
+  /// returned, and returns them if they could be read.
+  func reportReading(
+    _ decoded: Decoded?,
+    info: IncrementalCompilationState.IncrementalDependencyAndInputSetup
+  ) -> SourceFileDependencyGraph? {
+    guard let decoded = decoded else {return nil}
+    info.reporter?.report("Reading dependencies from \(description)")
+    switch decoded.graph {
+    case .success(let graph):
+      return graph
+    case .failure(let error):
+      let msg = "Could not read \(decoded.fileRead) \(error.localizedDescription)"
+      info.reporter?.report(msg, decoded.fileRead)
       return nil
     }
   }
@@ -123,12 +123,10 @@ extension ModuleDependencyGraph.Integrator {
       return
     }
 
-    let integratedNode = destination.nodeFinder.findNodes(for: integrand.key)
-      .flatMap {
-        integrateWithNodeDefinedHere(    integrand, $0) ??
-        integrateWithNodeDefinedNowhere( integrand, $0)
-      }
-    ?? integrateWithNewNode(integrand)
+    let integratedNode =
+      integrateWithNodeDefinedHere(    integrand) ??
+      integrateWithNodeDefinedNowhere( integrand) ??
+      integrateWithNewNode(integrand)
 
     recordDefsForThisUse(integrand, integratedNode)
   }
@@ -137,15 +135,13 @@ extension ModuleDependencyGraph.Integrator {
   ///
   /// - Parameters:
   ///   - integrand: the node to be integrated
-  ///   - nodesMatchingKey: all nodes in the destination graph with matching `DependencyKey`
   ///  - Returns: nil if a corresponding node did *not* already exist for the same source,
   ///  Otherwise, the integrated corresponding node.
   ///  If the integrated node was changed by the integration, it is added to ``invalidatedNodes``.
   private mutating func integrateWithNodeDefinedHere(
-    _ integrand: SourceFileDependencyGraph.Node,
-    _ nodesMatchingKey: [DefinitionLocation: Graph.Node]
+    _ integrand: SourceFileDependencyGraph.Node
   ) -> Graph.Node? {
-    guard let matchHere = nodesMatchingKey[.known(dependencySource)] else {
+    guard let matchHere = destination.nodeFinder.findNode((.known(dependencySource), integrand.key)) else {
       return nil
     }
     assert(matchHere.definitionLocation == .known(dependencySource))
@@ -190,17 +186,15 @@ extension ModuleDependencyGraph.Integrator {
   ///
   /// - Parameters:
   ///   - integrand: the node to be integrated
-  ///   - nodesMatchingKey: all nodes in the destination graph with matching `DependencyKey`
   /// - Returns: nil if a corresponding node *did* have a definition location, or the integrated corresponding node if it did not.
   ///  If the integrated node was changed by the integration, it is added to ``invalidatedNodes``.
   private mutating func integrateWithNodeDefinedNowhere(
-    _ integrand: SourceFileDependencyGraph.Node,
-    _ nodesMatchingKey: [DefinitionLocation: Graph.Node]
+    _ integrand: SourceFileDependencyGraph.Node
   ) -> Graph.Node? {
-    guard let nodeWithNoDefinitionLocation = nodesMatchingKey[.unknown] else {
+    guard let nodeWithNoDefinitionLocation = destination.nodeFinder.findNode((.unknown, integrand.key)) else {
       return nil
     }
-    assert(nodesMatchingKey.count == 1,
+    assert(destination.nodeFinder.findNodes(for: integrand.key)?.count == 1,
            "The graph never holds more than one node for a given key that has no definition location")
     let integratedNode = destination.nodeFinder
       .replace(nodeWithNoDefinitionLocation,
@@ -221,11 +215,10 @@ extension ModuleDependencyGraph.Integrator {
   ) -> Graph.Node {
     precondition(integrand.definitionVsUse == .definition,
                  "Dependencies are arcs in the module graph")
-    let newNode = Graph.Node(
+    let (newNode, oldNode) = destination.nodeFinder.insert(
       key: integrand.key,
       fingerprint: integrand.fingerprint,
       definitionLocation: .known(dependencySource))
-    let oldNode = destination.nodeFinder.insert(newNode)
     assert(oldNode == nil, "Should be new!")
     addNew(newNode)
     return newNode
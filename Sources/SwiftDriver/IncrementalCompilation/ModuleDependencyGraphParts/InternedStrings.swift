@@ -90,6 +90,25 @@ public class InternedStringTable: IncrementalCompilationSynchronizer {
   }
 }
 
+/// Maps the strings of a table filled off the incremental compilation queue,
+/// such as by decoding a `swiftdeps` file concurrently, to the same strings
+/// interned in `destination`.
+struct InternedStringRemapping {
+  let destination: InternedStringTable
+  private let remapped: [InternedString]
+
+  /// `source` must no longer be mutated.
+  init(from source: InternedStringTable, into destination: InternedStringTable) {
+    destination.mutationSafetyPrecondition()
+    self.destination = destination
+    self.remapped = source.strings.map { InternedString($0, destination) }
+  }
+
+  func callAsFunction(_ s: InternedString) -> InternedString {
+    remapped[s.index]
+  }
+}
+
 extension InternedStringTable: InternedStringTableHolder {
   public var internedStringTable: InternedStringTable {self}
 
@@ -2,7 +2,7 @@
 //
 // This source file is part of the Swift open source project
 //
-// Copyright (c) 2014 - 2025 Apple Inc. and the Swift project authors
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
 // Licensed under Apache License v2.0
 //
 // See LICENSE.txt for license information
@@ -19,84 +19,72 @@ extension ModuleDependencyGraph {
   /// Each node represents a `Decl` from the frontend.
   /// If a file references a `Decl` we haven't seen yet, the node's `dependencySource` will be nil,
   /// otherwise it will hold the name of the dependencySource file from which the node was read.
-  /// A dependency is represented by an arc, in the `usesByDefs` map.
+  /// A dependency is represented by an arc, in the ``NodeStorage``.
   /// (Cargo-culted and modified from the legacy driver.)
   ///
-  /// Use a class, not a struct because otherwise it would be duplicated for each thing it uses
+  /// The node's attributes live in the ``NodeStorage`` of its graph; a `Node` only identifies it there,
+  /// so it is cheap to copy, and changes made through any copy are seen by all of them.
   ///
   /// Neither the `fingerprint`, nor the `isTraced` value is part of the node's identity.
   /// Neither of these must be considered for equality testing or hashing because their
   /// value is subject to change during integration and tracing.
 
-  public final class Node {
+  public struct Node {
     public typealias DefinitionLocation = ModuleDependencyGraph.DefinitionLocation
 
     /*@_spi(Testing)*/ public typealias Graph = ModuleDependencyGraph
 
-    /// Hold these where an invariant can be checked.
-    /// Must be able to change the fingerprint
-    private(set) var keyAndFingerprint: KeyAndFingerprintHolder
+    @_spi(Testing) public let id: NodeID
+    let storage: NodeStorage
 
-    /*@_spi(Testing)*/ public var key: DependencyKey { keyAndFingerprint.key }
-    /*@_spi(Testing)*/ public var fingerprint: InternedString? { keyAndFingerprint.fingerprint }
+    init(_ id: NodeID, in storage: NodeStorage) {
+      self.id = id
+      self.storage = storage
+    }
+
+    /*@_spi(Testing)*/ public var key: DependencyKey { storage.key(of: id) }
+    /*@_spi(Testing)*/ public var fingerprint: InternedString? { storage.fingerprint(of: id) }
 
     /// When integrating a change, the driver finds untraced nodes so it can kick off jobs that have not been
     /// kicked off yet. (Within any one driver invocation, compiling a source file is idempotent.)
     /// When reading a serialized, prior graph, *don't* recover this state, since it will be a new driver
     /// invocation that has not kicked off any compiles yet.
-    @_spi(Testing) public private(set) var isTraced: Bool = false
-      
+    @_spi(Testing) public var isTraced: Bool { storage.isTraced(id) }
+
     /// Each Node corresponds to a declaration, somewhere. If the definition has been already found,
     /// the `definitionLocation` will point to it.
     /// If uses are encountered before the definition (in reading swiftdeps files), the `definitionLocation`
     /// will be set to `.unknown`.
     /// A node's definition location can move from file to file when the driver reads the result of a
     /// compilation.
-
-    @_spi(Testing) public let definitionLocation: DefinitionLocation
-
-    private let cachedHash: Int
-
-    /// This dependencySource is the file where the swiftDeps, etc. was read, not necessarily anything in the
-    /// SourceFileDependencyGraph or the DependencyKeys
-    init(key: DependencyKey, fingerprint: InternedString?,
-         definitionLocation: DefinitionLocation) {
-      self.keyAndFingerprint = try! KeyAndFingerprintHolder(key, fingerprint)
-      self.definitionLocation = definitionLocation
-      self.cachedHash = Self.computeHash(key, definitionLocation)
-    }
+    @_spi(Testing) public var definitionLocation: DefinitionLocation { storage.definitionLocation(of: id) }
   }
 }
 
 // MARK: - Setting fingerprint
 extension ModuleDependencyGraph.Node {
   func setFingerprint(_ newFP: InternedString?) {
-    keyAndFingerprint = try! KeyAndFingerprintHolder(key, newFP)
+    storage.setFingerprint(newFP, of: id)
   }
 }
 
 // MARK: - trace status
 extension ModuleDependencyGraph.Node {
   var isUntraced: Bool { !isTraced }
-  func setTraced() { isTraced = true }
-  @_spi(Testing) public func setUntraced() { isTraced = false }
+  func setTraced() { storage.setTraced(id, true) }
+  @_spi(Testing) public func setUntraced() { storage.setTraced(id, false) }
 }
 
 // MARK: - comparing, hashing
 extension ModuleDependencyGraph.Node: Equatable, Hashable {
+  /// Two nodes are the same if they have the same ID in the same storage. Nodes of different
+  /// graphs are never equal, even if they have the same key and definition location.
   public static func ==(lhs: ModuleDependencyGraph.Node, rhs: ModuleDependencyGraph.Node) -> Bool {
-    lhs.keyAndFingerprint.key == rhs.keyAndFingerprint.key &&
-    lhs.definitionLocation == rhs.definitionLocation
-  }
-  static private func computeHash(_ key: DependencyKey, _ definitionLocation: ModuleDependencyGraph.DefinitionLocation) -> Int {
-    var h = Hasher()
-    h.combine(key)
-    h.combine(definitionLocation)
-    return h.finalize()
+    lhs.id == rhs.id && lhs.storage === rhs.storage
   }
 
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(cachedHash)
+    hasher.combine(id)
   }
 }
 
@@ -2,7 +2,7 @@
 //
 // This source file is part of the Swift open source project
 //
-// Copyright (c) 2014 - 2025 Apple Inc. and the Swift project authors
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
 // Licensed under Apache License v2.0
 //
 // See LICENSE.txt for license information
@@ -18,25 +18,23 @@ extension ModuleDependencyGraph {
 
   /// The core information for the ModuleDependencyGraph
   /// Isolate in a sub-structure in order to facilitate invariant maintenance
-  public struct NodeFinder {
+  ///
+  /// A class, since the nodes it hands out refer to its ``NodeStorage``: a copy of a value would
+  /// still share the storage with the original, and see its changes.
+  public final class NodeFinder {
     @_spi(Testing) public typealias Graph = ModuleDependencyGraph
 
-    /// Maps definition locations and DependencyKeys to Nodes
-    fileprivate typealias NodeMap = TwoDMap<DefinitionLocation, DependencyKey, Node>
-    fileprivate var nodeMap = NodeMap()
-
+    /// Holds the nodes, and the def-use relationships by DependencyKey.
+    ///
     /// Since dependency keys use baseNames, they are coarser than individual
     /// decls. So two decls might map to the same key. Given a use, which is
     /// denoted by a node, the code needs to find the files to recompile. So, the
-    /// key indexes into the nodeMap, and that yields a submap of nodes keyed by
-    /// definition location. The set of keys in the submap are the files that must be recompiled
-    /// for the use.
+    /// key finds the nodes with that key, one per definition location. Those
+    /// locations are the files that must be recompiled for the use.
     /// (In a given file, only one node exists with a given key, but in the future
     /// that would need to change if/when we can recompile a smaller unit than a
     /// source file.)
-
-    /// Tracks def-use relationships by DependencyKey.
-    @_spi(Testing) public private(set) var usesByDef = Multidictionary<DependencyKey, Node>()
+    let storage = NodeStorage()
   }
 }
 // MARK: - finding
@@ -45,19 +43,22 @@ extension ModuleDependencyGraph.NodeFinder {
   public typealias DefinitionLocation = ModuleDependencyGraph.DefinitionLocation
 
   @_spi(Testing) public func findNode(_ mapKey: (DefinitionLocation, DependencyKey)) -> Graph.Node? {
-    nodeMap[mapKey]
+    storage.node(at: mapKey.0, withKey: mapKey.1).map(node)
   }
   func findCorrespondingImplementation(of n: Graph.Node) -> Graph.Node? {
-    n.key.correspondingImplementation
-      .flatMap {findNode((n.definitionLocation, $0))}
+    storage.correspondingImplementation(of: n.id).map(node)
   }
 
   @_spi(Testing) public func findNodes(for definitionLocation: DefinitionLocation)
   -> [DependencyKey: Graph.Node]? {
-    nodeMap[definitionLocation]
+    var nodes = [DependencyKey: Graph.Node]()
+    storage.forEachNode(at: definitionLocation) { nodes[storage.key(of: $0)] = node($0) }
+    return nodes.isEmpty ? nil : nodes
   }
   @_spi(Testing) public func findNodes(for key: DependencyKey) -> [DefinitionLocation: Graph.Node]? {
-    nodeMap[key]
+    var nodes = [DefinitionLocation: Graph.Node]()
+    storage.forEachNode(withKey: key) { nodes[storage.definitionLocation(of: $0)] = node($0) }
+    return nodes.isEmpty ? nil : nodes
   }
 
   /// Calls the given closure on each node in this dependency graph.
@@ -67,7 +68,31 @@ extension ModuleDependencyGraph.NodeFinder {
   ///
   /// - Parameter visit: The closure to call with each graph node.
   @_spi(Testing) public func forEachNode(_ visit: (Graph.Node) -> Void) {
-    nodeMap.forEach { visit($1) }
+    storage.forEachNode { visit(node($0)) }
+  }
+
+  /// Calls the given closure on each definition location in this dependency
+  /// graph, with the nodes defined there.
+  func forEachNodeByLocation(_ visit: (DefinitionLocation, [Graph.Node]) -> Void) {
+    storage.forEachLocation { location, nodes in visit(location, nodes.map(node)) }
+  }
+
+  /// The number of nodes in this dependency graph.
+  @_spi(Testing) public var nodeCount: Int {
+    storage.liveNodeCount
+  }
+
+  /// Calls the given closure on each use of a given node, without collecting them.
+  ///
+  /// - Warning: The order of uses is not defined, and a use may be visited twice.
+  ///
+  /// - Parameter def: The node to look up.
+  /// - Parameter visit: The closure to call with each node depending upon `def`.
+  func forEachUse(of def: Graph.Node, _ visit: (Graph.Node) -> Void) {
+    storage.forEachUse(ofKeyOf: def.id) { visit(node($0)) }
+    if let impl = storage.correspondingImplementation(of: def.id) {
+      visit(node(impl))
+    }
   }
 
   /// Retrieves the set of uses corresponding to a given node.
@@ -79,10 +104,8 @@ extension ModuleDependencyGraph.NodeFinder {
   /// - Returns: A set of nodes corresponding to the uses of the given
   ///            definition node.
   func uses(of def: Graph.Node) -> Set<Graph.Node> {
-    var uses = usesByDef[def.key, default: Set()]
-    if let impl = findCorrespondingImplementation(of: def) {
-      uses.insert(impl)
-    }
+    var uses = Set<Graph.Node>()
+    forEachUse(of: def) { uses.insert($0) }
     #if DEBUG
     for use in uses {
       assert(self.verifyOKTODependUponSomeKey(use))
@@ -91,23 +114,39 @@ extension ModuleDependencyGraph.NodeFinder {
     return uses
   }
 
-  func mappings(of n: Graph.Node) -> [(DefinitionLocation, DependencyKey)] {
-    nodeMap.compactMap { k, _ in
-      guard k.0 == n.definitionLocation && k.1 == n.key else {
-        return nil
+  /// Retrieves the set of uses of the node that would be defined with `key` at
+  /// `definitionLocation`, whether or not there is one.
+  func uses(of key: DependencyKey, definedAt definitionLocation: DefinitionLocation) -> Set<Graph.Node> {
+    var uses = Set<Graph.Node>()
+    storage.forEachUse(of: key) { uses.insert(node($0)) }
+    if let implKey = key.correspondingImplementation,
+       let impl = findNode((definitionLocation, implKey)) {
+      uses.insert(impl)
+    }
+    return uses
+  }
+
+  /// Tracks def-use relationships by DependencyKey.
+  ///
+  /// - Note: Builds the whole map, so only for testing.
+  @_spi(Testing) public var usesByDef: Multidictionary<DependencyKey, Graph.Node> {
+    var usesByDef = Multidictionary<DependencyKey, Graph.Node>()
+    forEachDef { def, uses in
+      for use in uses {
+        _ = usesByDef.insertValue(use, forKey: def)
       }
-      return k
     }
+    return usesByDef
   }
 
-  func defsUsing(_ n: Graph.Node) -> Set<DependencyKey> {
-    usesByDef.keysContainingValue(n)
+  /// Calls the given closure on each key that is depended upon, with the nodes
+  /// depending upon it.
+  func forEachDef(_ visit: (DependencyKey, [Graph.Node]) -> Void) {
+    storage.forEachDef { def, uses in visit(def, uses.map(node)) }
   }
-}
 
-fileprivate extension ModuleDependencyGraph.Node {
-  var mapKey: (DefinitionLocation, DependencyKey) {
-    return (definitionLocation, key)
+  private func node(_ id: Graph.NodeID) -> Graph.Node {
+    Graph.Node(id, in: storage)
   }
 }
 
@@ -115,36 +154,39 @@ fileprivate extension ModuleDependencyGraph.Node {
 
 extension ModuleDependencyGraph.NodeFinder {
 
-  /// Add `node` to the structure, return the old node if any at those coordinates.
+  /// Add a node to the structure, return it and the old node if any at those coordinates.
   @discardableResult
-  mutating func insert(_ n: Graph.Node) -> Graph.Node? {
-    nodeMap.updateValue(n, forKey: n.mapKey)
+  func insert(key: DependencyKey,
+              fingerprint: InternedString?,
+              definitionLocation: DefinitionLocation
+  ) -> (inserted: Graph.Node, replaced: Graph.Node?) {
+    let (inserted, replaced) = storage.insert(key: key,
+                                              fingerprint: fingerprint,
+                                              definitionLocation: definitionLocation)
+    return (node(inserted), replaced.map(node))
   }
 
   /// record def-use, return if is new use
-  mutating func record(def: DependencyKey, use: Graph.Node) -> Bool {
+  func record(def: DependencyKey, use: Graph.Node) -> Bool {
     assert(verifyOKTODependUponSomeKey(use))
-    return usesByDef.insertValue(use, forKey: def)
+    return storage.recordUse(use.id, of: def)
+  }
+
+  /// Record all the def-use arcs of a graph just read from the priors, which
+  /// holds no duplicates.
+  func loadUses(_ usesByDef: [(def: DependencyKey, uses: [Graph.NodeID])]) {
+    storage.loadUses(usesByDef)
   }
 }
 
 // MARK: - removing
 extension ModuleDependencyGraph.NodeFinder {
-  mutating func remove(_ nodeToErase: Graph.Node) {
-    // uses first preserves invariant that every used node is in nodeMap
-    removeUsings(of: nodeToErase)
-    removeMapping(of: nodeToErase)
-  }
-
-  private mutating func removeUsings(of nodeToNotUse: Graph.Node) {
-    usesByDef.removeOccurrences(of: nodeToNotUse)
-    assert(defsUsing(nodeToNotUse).isEmpty)
-  }
-
-  private mutating func removeMapping(of nodeToNotMap: Graph.Node) {
-    let old = nodeMap.removeValue(forKey: nodeToNotMap.mapKey)
-    assert(old == nodeToNotMap, "Should have been there")
-    assert(mappings(of: nodeToNotMap).isEmpty)
+  /// Removes the node and its uses. The node still has its key and definition location,
+  /// so that it can be traced afterwards. Its storage is not reclaimed until the graph is next
+  /// read from the priors.
+  func remove(_ nodeToErase: Graph.Node) {
+    storage.remove(nodeToErase.id)
+    assert(findNode((nodeToErase.definitionLocation, nodeToErase.key)) == nil)
   }
 }
 
@@ -156,50 +198,23 @@ extension ModuleDependencyGraph.NodeFinder {
   /// which file the name was found.) When the definition is found in a `SourceFileDepGraph`
   /// it is necessary to "move" the node to the proper collection.
   ///
-  /// Now that nodes are immutable, this function needs to replace the node
-  mutating func replace(_ original: Graph.Node,
-                        newDependencySource: DependencySource,
-                        newFingerprint: InternedString?
+  /// The node keeps its identity, and with it any uses of it, but is no longer traced.
+  func replace(_ original: Graph.Node,
+               newDependencySource: DependencySource,
+               newFingerprint: InternedString?
   ) -> Graph.Node {
-    let replacement = Graph.Node(key: original.key,
-                                 fingerprint: newFingerprint,
-                                 definitionLocation: .known(newDependencySource))
     assert(original.definitionLocation == .unknown,
-           "Would have to search every use in usesByDef if original could be a use.")
-    if usesByDef.removeValue(original, forKey: original.key) != nil {
-      usesByDef.insertValue(replacement, forKey: original.key)
-    }
-    nodeMap.removeValue(forKey: original.mapKey)
-    nodeMap.updateValue(replacement, forKey: replacement.mapKey)
-    return replacement
+           "Would have to search every use if original could be a use.")
+    storage.move(original.id, to: .known(newDependencySource), newFingerprint: newFingerprint)
+    return original
   }
 }
 
 // MARK: - asserting & verifying
 extension ModuleDependencyGraph.NodeFinder {
   func verify() -> Bool {
-    verifyNodeMap()
-    verifyUsesByDef()
-    return true
-  }
-
-  private func verifyNodeMap() {
-    var nodes = [Set<Graph.Node>(), Set<Graph.Node>()]
-    nodeMap.verify {
-      _, v, submapIndex in
-      if let prev = nodes[submapIndex].update(with: v) {
-        fatalError("\(v) is also in nodeMap at \(prev), submap: \(submapIndex)")
-      }
-      v.verify()
-    }
-  }
-
-  private func verifyUsesByDef() {
-    usesByDef.forEach { someKey, nodesDependingUponKey in
-      for nodeDependingUponKey in nodesDependingUponKey {
-        verifyOKTODependUponSomeKey(nodeDependingUponKey)
-      }
-    }
+    forEachNode { $0.verify() }
+    return storage.verify()
   }
 
   @discardableResult
@@ -210,7 +225,7 @@ extension ModuleDependencyGraph.NodeFinder {
   }
 
   private func verifyNodeCanBeFoundFromItsKey(_ n: Graph.Node) {
-    precondition(findNode(n.mapKey) == n)
+    precondition(findNode((n.definitionLocation, n.key)) == n)
   }
 
   @discardableResult
@@ -222,7 +237,27 @@ extension ModuleDependencyGraph.NodeFinder {
 
 // MARK: - Checking Serialization
 extension ModuleDependencyGraph.NodeFinder {
+  /// Nodes of different graphs are compared by what they stand for.
   func matches(_ other: Self) -> Bool {
-    nodeMap == other.nodeMap && usesByDef == other.usesByDef
+    struct Coordinates: Hashable {
+      let key: DependencyKey
+      let definitionLocation: DefinitionLocation
+    }
+    func coordinates(of node: Graph.Node) -> Coordinates {
+      Coordinates(key: node.key, definitionLocation: node.definitionLocation)
+    }
+    func nodes(of finder: Self) -> Set<Coordinates> {
+      var nodes = Set<Coordinates>()
+      finder.forEachNode { nodes.insert(coordinates(of: $0)) }
+      return nodes
+    }
+    func uses(of finder: Self) -> [DependencyKey: Set<Coordinates>] {
+      var uses = [DependencyKey: Set<Coordinates>]()
+      finder.forEachDef { def, users in uses[def] = Set(users.map(coordinates)) }
+      return uses
+    }
+    return nodeCount == other.nodeCount
+      && nodes(of: self) == nodes(of: other)
+      && uses(of: self) == uses(of: other)
   }
 }
@@ -0,0 +1,441 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+extension ModuleDependencyGraph {
+  /// Identifies a node in its graph's ``NodeStorage``.
+  @_spi(Testing) public typealias NodeID = UInt32
+
+  /// Holds the nodes of a ``ModuleDependencyGraph``, and the def-use arcs between them.
+  ///
+  /// Graphs of large modules have hundreds of thousands of nodes, so rather than an object per node
+  /// and a set of nodes per depended-upon key, each attribute of the nodes is kept in an array indexed
+  /// by ``NodeID``. The keys and definition locations the nodes share are interned, so each node only
+  /// costs a few bytes per attribute, and following an arc does not involve any hashing.
+  ///
+  /// The uses of each key are kept in compressed sparse rows: the uses of the key with ID `k` are
+  /// `useRows[useRowStarts[k] ..< useRowStarts[k + 1]]`, sorted. Uses recorded since the rows were
+  /// built are kept aside, and folded into the rows once there are as many of them as there are
+  /// uses in the rows, so that recording a use takes amortized constant time.
+  ///
+  /// IDs are never reused, so that a node removed from the graph still answers for its key and
+  /// definition location, as tracing from the nodes that disappeared from a source requires.
+  /// The storage of removed nodes is only reclaimed when the graph is next read from the priors.
+  final class NodeStorage {
+    typealias KeyID = UInt32
+    typealias LocationID = UInt32
+
+    /// Marks the end of a chain of nodes, or a missing node.
+    static let noNode = NodeID.max
+
+    /// ``DefinitionLocation/unknown`` is interned first.
+    private static let unknownLocationID: LocationID = 0
+
+    /// Don't bother building rows for fewer uses than this.
+    private static let minimumPendingUseCount = 4096
+
+    // MARK: Interned keys and locations
+
+    private var keys: [DependencyKey] = []
+    private var keyIDs: [DependencyKey: KeyID] = [:]
+    /// For each key with the interface aspect, the ID of the corresponding implementation key.
+    private var implementationKeyIDs: [KeyID] = []
+    /// For each key, the most recently inserted node with that key; the rest follow
+    /// ``nextNodeWithSameKey``.
+    private var lastNodeWithKey: [NodeID] = []
+
+    private var locations: [DefinitionLocation] = []
+    private var locationIDs: [DefinitionLocation: LocationID] = [:]
+    /// For each location, the nodes inserted at or moved to that location. Nodes since removed or
+    /// moved elsewhere are skipped.
+    private var nodesAtLocation: [[NodeID]] = []
+
+    // MARK: Node attributes
+
+    private var keyIDOfNode: [KeyID] = []
+    private var locationIDOfNode: [LocationID] = []
+    /// ``InternedString/empty`` for no fingerprint.
+    private var fingerprintOfNode: [InternedString] = []
+    private var nextNodeWithSameKey: [NodeID] = []
+    /// One bit per node, set once the node has been traced.
+    private var tracedBits: [UInt64] = []
+    private var nodeIsRemoved: [Bool] = []
+
+    /// Finds the node at a definition location with a key, see ``coordinates(_:_:)``.
+    private var nodeAtCoordinates: [UInt64: NodeID] = [:]
+
+    /// The number of nodes which have not been removed.
+    private(set) var liveNodeCount = 0
+
+    // MARK: Uses
+
+    private var useRowStarts: [UInt32] = [0]
+    private var useRows: [NodeID] = []
+    private var pendingUses: [KeyID: [NodeID]] = [:]
+    /// The pending uses, by ``coordinates(_:_:)`` of the key and use, to find duplicates.
+    private var pendingUseSet = Set<UInt64>()
+    private var pendingUseCount = 0
+
+    init() {
+      let unknownLocationID = intern(.unknown)
+      assert(unknownLocationID == Self.unknownLocationID)
+    }
+  }
+}
+
+// MARK: - interning
+extension ModuleDependencyGraph.NodeStorage {
+  typealias DefinitionLocation = ModuleDependencyGraph.DefinitionLocation
+  typealias NodeID = ModuleDependencyGraph.NodeID
+
+  private func intern(_ key: DependencyKey) -> KeyID {
+    if let keyID = keyIDs[key] {
+      return keyID
+    }
+    // Intern the corresponding implementation first, so that following it needs no lookup.
+    let implementationKeyID = key.correspondingImplementation.map(intern) ?? Self.noNode
+    let keyID = KeyID(keys.count)
+    keys.append(key)
+    keyIDs[key] = keyID
+    implementationKeyIDs.append(implementationKeyID)
+    lastNodeWithKey.append(Self.noNode)
+    return keyID
+  }
+
+  private func intern(_ location: DefinitionLocation) -> LocationID {
+    if let locationID = locationIDs[location] {
+      return locationID
+    }
+    let locationID = LocationID(locations.count)
+    locations.append(location)
+    locationIDs[location] = locationID
+    nodesAtLocation.append([])
+    return locationID
+  }
+
+  private static func coordinates(_ high: UInt32, _ low: UInt32) -> UInt64 {
+    UInt64(high) << 32 | UInt64(low)
+  }
+}
+
+// MARK: - node attributes
+extension ModuleDependencyGraph.NodeStorage {
+  func key(of node: NodeID) -> DependencyKey {
+    keys[Int(keyIDOfNode[Int(node)])]
+  }
+
+  func definitionLocation(of node: NodeID) -> DefinitionLocation {
+    locations[Int(locationIDOfNode[Int(node)])]
+  }
+
+  func fingerprint(of node: NodeID) -> InternedString? {
+    let fingerprint = fingerprintOfNode[Int(node)]
+    return fingerprint.isEmpty ? nil : fingerprint
+  }
+
+  func setFingerprint(_ fingerprint: InternedString?, of node: NodeID) {
+    assert((try? KeyAndFingerprintHolder(key(of: node), fingerprint)) != nil)
+    fingerprintOfNode[Int(node)] = fingerprint ?? .empty
+  }
+
+  func hasKnownDefinitionLocation(_ node: NodeID) -> Bool {
+    locationIDOfNode[Int(node)] != Self.unknownLocationID
+  }
+
+  func isTraced(_ node: NodeID) -> Bool {
+    tracedBits[Int(node) >> 6] & Self.tracedBit(node) != 0
+  }
+
+  func setTraced(_ node: NodeID, _ isTraced: Bool) {
+    if isTraced {
+      tracedBits[Int(node) >> 6] |= Self.tracedBit(node)
+    } else {
+      tracedBits[Int(node) >> 6] &= ~Self.tracedBit(node)
+    }
+  }
+
+  /// Mark `node` traced, returning whether it was not traced before.
+  func markTraced(_ node: NodeID) -> Bool {
+    let bit = Self.tracedBit(node)
+    let word = tracedBits[Int(node) >> 6]
+    tracedBits[Int(node) >> 6] = word | bit
+    return word & bit == 0
+  }
+
+  private static func tracedBit(_ node: NodeID) -> UInt64 {
+    1 << UInt64(node & 63)
+  }
+
+  func isRemoved(_ node: NodeID) -> Bool {
+    nodeIsRemoved[Int(node)]
+  }
+}
+
+// MARK: - finding nodes
+extension ModuleDependencyGraph.NodeStorage {
+  func node(at location: DefinitionLocation, withKey key: DependencyKey) -> NodeID? {
+    guard let locationID = locationIDs[location], let keyID = keyIDs[key] else {
+      return nil
+    }
+    return nodeAtCoordinates[Self.coordinates(locationID, keyID)]
+  }
+
+  /// The node defining the implementation of the declaration whose interface `node` defines, if any.
+  func correspondingImplementation(of node: NodeID) -> NodeID? {
+    let implementationKeyID = implementationKeyIDs[Int(keyIDOfNode[Int(node)])]
+    guard implementationKeyID != Self.noNode else {
+      return nil
+    }
+    return nodeAtCoordinates[Self.coordinates(locationIDOfNode[Int(node)], implementationKeyID)]
+  }
+
+  func forEachNode(withKey key: DependencyKey, _ visit: (NodeID) -> Void) {
+    guard let keyID = keyIDs[key] else {
+      return
+    }
+    var node = lastNodeWithKey[Int(keyID)]
+    while node != Self.noNode {
+      if !nodeIsRemoved[Int(node)] {
+        visit(node)
+      }
+      node = nextNodeWithSameKey[Int(node)]
+    }
+  }
+
+  func forEachNode(at location: DefinitionLocation, _ visit: (NodeID) -> Void) {
+    guard let locationID = locationIDs[location] else {
+      return
+    }
+    for node in nodesAtLocation[Int(locationID)]
+    where !nodeIsRemoved[Int(node)] && locationIDOfNode[Int(node)] == locationID {
+      visit(node)
+    }
+  }
+
+  /// Visits the nodes which have not been removed, in the order they were inserted.
+  func forEachNode(_ visit: (NodeID) -> Void) {
+    for node in nodeIsRemoved.indices where !nodeIsRemoved[node] {
+      visit(NodeID(node))
+    }
+  }
+
+  /// Visits each definition location which has nodes, with those nodes, in the order the
+  /// locations were first used.
+  func forEachLocation(_ visit: (DefinitionLocation, [NodeID]) -> Void) {
+    for locationID in locations.indices {
+      let nodes = nodesAtLocation[locationID].filter {
+        !nodeIsRemoved[Int($0)] && locationIDOfNode[Int($0)] == LocationID(locationID)
+      }
+      if !nodes.isEmpty {
+        visit(locations[locationID], nodes)
+      }
+    }
+  }
+}
+
+// MARK: - inserting, removing and moving nodes
+extension ModuleDependencyGraph.NodeStorage {
+  /// Add a node, returning it and the node it replaced at the same coordinates, if any.
+  func insert(key: DependencyKey,
+              fingerprint: InternedString?,
+              definitionLocation: DefinitionLocation) -> (inserted: NodeID, replaced: NodeID?) {
+    assert((try? KeyAndFingerprintHolder(key, fingerprint)) != nil)
+    precondition(keyIDOfNode.count < Int(Self.noNode), "Too many nodes in the dependency graph")
+    let keyID = intern(key)
+    let locationID = intern(definitionLocation)
+    let node = NodeID(keyIDOfNode.count)
+    keyIDOfNode.append(keyID)
+    locationIDOfNode.append(locationID)
+    fingerprintOfNode.append(fingerprint ?? .empty)
+    nextNodeWithSameKey.append(lastNodeWithKey[Int(keyID)])
+    if Int(node) >> 6 == tracedBits.count {
+      tracedBits.append(0)
+    }
+    nodeIsRemoved.append(false)
+    lastNodeWithKey[Int(keyID)] = node
+    nodesAtLocation[Int(locationID)].append(node)
+    liveNodeCount += 1
+
+    let replaced = nodeAtCoordinates.updateValue(node, forKey: Self.coordinates(locationID, keyID))
+    if let replaced = replaced {
+      markRemoved(replaced)
+    }
+    return (node, replaced)
+  }
+
+  /// Remove `node` from the graph, and all its uses with it.
+  func remove(_ node: NodeID) {
+    let coordinates = Self.coordinates(locationIDOfNode[Int(node)], keyIDOfNode[Int(node)])
+    let old = nodeAtCoordinates.removeValue(forKey: coordinates)
+    assert(old == node, "Should have been there")
+    markRemoved(node)
+  }
+
+  /// Removed nodes are left in the chains and lists that lead to them, to be skipped.
+  private func markRemoved(_ node: NodeID) {
+    assert(!nodeIsRemoved[Int(node)])
+    nodeIsRemoved[Int(node)] = true
+    liveNodeCount -= 1
+  }
+
+  /// Move `node`, which had no known definition location, to `newLocation`, keeping its uses.
+  /// Since it now stands for a definition that has not been traced yet, it is no longer traced.
+  func move(_ node: NodeID, to newLocation: DefinitionLocation, newFingerprint: InternedString?) {
+    let keyID = keyIDOfNode[Int(node)]
+    let oldLocationID = locationIDOfNode[Int(node)]
+    let newLocationID = intern(newLocation)
+    nodeAtCoordinates.removeValue(forKey: Self.coordinates(oldLocationID, keyID))
+    if let replaced = nodeAtCoordinates.updateValue(node, forKey: Self.coordinates(newLocationID, keyID)) {
+      markRemoved(replaced)
+    }
+    locationIDOfNode[Int(node)] = newLocationID
+    nodesAtLocation[Int(newLocationID)].append(node)
+    setFingerprint(newFingerprint, of: node)
+    setTraced(node, false)
+  }
+}
+
+// MARK: - uses
+extension ModuleDependencyGraph.NodeStorage {
+  /// Record that `use` depends upon `def`, returning whether that is new.
+  func recordUse(_ use: NodeID, of def: DependencyKey) -> Bool {
+    let keyID = intern(def)
+    guard !rowContains(use, keyID),
+          pendingUseSet.insert(Self.coordinates(keyID, use)).inserted
+    else {
+      return false
+    }
+    pendingUses[keyID, default: []].append(use)
+    pendingUseCount += 1
+    if pendingUseCount >= max(Self.minimumPendingUseCount, useRows.count) {
+      buildUseRows()
+    }
+    return true
+  }
+
+  /// Add all the uses of a graph just read at once, without checking each one for duplicates
+  /// as ``recordUse(_:of:)`` does.
+  func loadUses<UsesByDef: Sequence>(_ usesByDef: UsesByDef)
+  where UsesByDef.Element == (def: DependencyKey, uses: [NodeID])
+  {
+    for (def, uses) in usesByDef where !uses.isEmpty {
+      pendingUses[intern(def), default: []].append(contentsOf: uses)
+      pendingUseCount += uses.count
+    }
+    buildUseRows()
+  }
+
+  /// Visits the nodes that depend upon `def`, in no particular order.
+  func forEachUse(of def: DependencyKey, _ visit: (NodeID) -> Void) {
+    guard let keyID = keyIDs[def] else {
+      return
+    }
+    forEachUse(ofKeyWithID: keyID, visit)
+  }
+
+  /// Visits the nodes that depend upon the key of `def`, in no particular order.
+  func forEachUse(ofKeyOf def: NodeID, _ visit: (NodeID) -> Void) {
+    forEachUse(ofKeyWithID: keyIDOfNode[Int(def)], visit)
+  }
+
+  private func forEachUse(ofKeyWithID keyID: KeyID, _ visit: (NodeID) -> Void) {
+    for use in useRows[rowRange(keyID)] where !nodeIsRemoved[Int(use)] {
+      visit(use)
+    }
+    for use in pendingUses[keyID] ?? [] where !nodeIsRemoved[Int(use)] {
+      visit(use)
+    }
+  }
+
+  /// Visits each key which has uses, along with those uses.
+  func forEachDef(_ visit: (DependencyKey, [NodeID]) -> Void) {
+    for keyID in keys.indices {
+      var uses = [NodeID]()
+      forEachUse(ofKeyWithID: KeyID(keyID)) { uses.append($0) }
+      if !uses.isEmpty {
+        visit(keys[keyID], uses)
+      }
+    }
+  }
+
+  private func rowRange(_ keyID: KeyID) -> Range<Int> {
+    let row = Int(keyID)
+    guard row + 1 < useRowStarts.count else {
+      // Interned since the rows were built
+      return 0..<0
+    }
+    return Int(useRowStarts[row]) ..< Int(useRowStarts[row + 1])
+  }
+
+  private func rowContains(_ use: NodeID, _ keyID: KeyID) -> Bool {
+    var range = rowRange(keyID)
+    while !range.isEmpty {
+      let middle = range.lowerBound + range.count / 2
+      if useRows[middle] == use {
+        return true
+      }
+      range = useRows[middle] < use
+        ? middle + 1 ..< range.upperBound
+        : range.lowerBound ..< middle
+    }
+    return false
+  }
+
+  /// Fold the pending uses into the rows, dropping the uses by removed nodes.
+  func buildUseRows() {
+    var newRowStarts = [UInt32]()
+    newRowStarts.reserveCapacity(keys.count + 1)
+    var newRows = [NodeID]()
+    newRows.reserveCapacity(useRows.count + pendingUseCount)
+    newRowStarts.append(0)
+    for keyID in keys.indices {
+      let rowStart = newRows.count
+      for use in useRows[rowRange(KeyID(keyID))] where !nodeIsRemoved[Int(use)] {
+        newRows.append(use)
+      }
+      if let pending = pendingUses[KeyID(keyID)] {
+        for use in pending where !nodeIsRemoved[Int(use)] {
+          newRows.append(use)
+        }
+        newRows[rowStart...].sort()
+      }
+      newRowStarts.append(UInt32(newRows.count))
+    }
+    useRowStarts = newRowStarts
+    useRows = newRows
+    pendingUses = [:]
+    pendingUseSet = []
+    pendingUseCount = 0
+  }
+}
+
+// MARK: - verifying
+extension ModuleDependencyGraph.NodeStorage {
+  func verify() -> Bool {
+    var liveNodes = 0
+    forEachNode { node in
+      liveNodes += 1
+      precondition(self.node(at: definitionLocation(of: node), withKey: key(of: node)) == node,
+                   "Node must be found at its coordinates")
+    }
+    precondition(liveNodes == liveNodeCount)
+    precondition(nodeAtCoordinates.count == liveNodeCount)
+    for keyID in keys.indices {
+      forEachUse(ofKeyWithID: KeyID(keyID)) { use in
+        guard case .unknown = definitionLocation(of: use) else { return }
+        fatalError("This declaration is not defined anywhere and thus cannot depend upon anything.")
+      }
+    }
+    return true
+  }
+}
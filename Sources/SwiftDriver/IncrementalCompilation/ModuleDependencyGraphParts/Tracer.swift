@@ -17,6 +17,9 @@ import class TSCBasic.DiagnosticsEngine
 extension ModuleDependencyGraph {
 
 /// Trace dependencies through the graph
+  ///
+  /// Nodes are marked traced in the bitset kept by the graph's ``NodeStorage``, which doubles as the
+  /// set of nodes visited, both by this trace and by earlier ones in the same driver invocation.
   struct Tracer {
     typealias Graph = ModuleDependencyGraph
 
@@ -54,6 +57,9 @@ extension ModuleDependencyGraph.Tracer {
                       in: graph,
                       diagnosticEngine: diagnosticEngine)
     tracer.collectPreviouslyUntracedDependents()
+    if graph.info.verifyDependencyGraphAfterEveryImport {
+      tracer.verifyTracedUses()
+    }
     return tracer
   }
 
@@ -66,55 +72,81 @@ extension ModuleDependencyGraph.Tracer {
     self.diagnosticEngine = diagnosticEngine
   }
 
+  private var storage: ModuleDependencyGraph.NodeStorage {
+    graph.nodeFinder.storage
+  }
+
   private mutating func collectPreviouslyUntracedDependents() {
-    for n in startingPoints {
-      collectNextPreviouslyUntracedDependent(of: n)
+    if currentPathIfTracing != nil {
+      collectPreviouslyUntracedDependentsAlongPaths()
+    } else {
+      collectPreviouslyUntracedDependentsByLevel()
     }
   }
 
-  private mutating func collectNextPreviouslyUntracedDependent(
-    of definition: ModuleDependencyGraph.Node
-  ) {
-    guard definition.isUntraced else { return }
-    definition.setTraced()
-
-    tracedUses.append(definition)
+  /// Visits the nodes a level at a time: the frontier holds the nodes first reached at the previous
+  /// level, whose uses are yet to be followed.
+  private mutating func collectPreviouslyUntracedDependentsByLevel() {
+    let storage = self.storage
+    var frontier = [Graph.NodeID]()
+    var nextFrontier = [Graph.NodeID]()
+    for definition in startingPoints {
+      arrive(at: definition.id, adding: &frontier)
+    }
+    while !frontier.isEmpty {
+      for definition in frontier {
+        // If this use also provides something, follow it
+        storage.forEachUse(ofKeyOf: definition) { use in
+          arrive(at: use, adding: &nextFrontier)
+        }
+        if let implementation = storage.correspondingImplementation(of: definition) {
+          arrive(at: implementation, adding: &nextFrontier)
+        }
+      }
+      swap(&frontier, &nextFrontier)
+      nextFrontier.removeAll(keepingCapacity: true)
+    }
+  }
 
+  private mutating func arrive(at node: Graph.NodeID, adding frontier: inout [Graph.NodeID]) {
+    guard storage.markTraced(node) else { return }
+    tracedUses.append(Graph.Node(node, in: storage))
     // If this node is merely used, but not defined anywhere, nothing else
     // can possibly depend upon it
-    if case .unknown = definition.definitionLocation { return }
-
-    let pathLengthAfterArrival = traceArrival(at: definition);
-
-    // If this use also provides something, follow it
-    for use in graph.nodeFinder.uses(of: definition) {
-      collectNextPreviouslyUntracedDependent(of: use)
+    if storage.hasKnownDefinitionLocation(node) {
+      frontier.append(node)
     }
-    traceDeparture(pathLengthAfterArrival);
   }
 
-
-
-  private mutating func traceArrival(at visitedNode: ModuleDependencyGraph.Node
-  ) -> Int {
-    guard var currentPath = currentPathIfTracing else {
-      return 0
+  /// Visits the nodes depth-first, so that the path to each one can be reported on arrival.
+  /// The stack holds, for each node on the current path, the uses of it yet to be visited.
+  private mutating func collectPreviouslyUntracedDependentsAlongPaths() {
+    var stack = [(definition: Graph.NodeID, uses: [Graph.NodeID], nextUse: Int)]()
+    func arriveAlongPath(at node: Graph.NodeID) {
+      guard storage.markTraced(node) else { return }
+      tracedUses.append(Graph.Node(node, in: storage))
+      guard storage.hasKnownDefinitionLocation(node) else { return }
+      currentPathIfTracing?.append(Graph.Node(node, in: storage))
+      printPath(currentPathIfTracing!)
+      var uses = [Graph.NodeID]()
+      storage.forEachUse(ofKeyOf: node) { uses.append($0) }
+      storage.correspondingImplementation(of: node).map { uses.append($0) }
+      stack.append((node, uses, 0))
+    }
+    for definition in startingPoints {
+      arriveAlongPath(at: definition.id)
+      while let top = stack.last {
+        guard top.nextUse < top.uses.count else {
+          stack.removeLast()
+          currentPathIfTracing?.removeLast()
+          continue
+        }
+        stack[stack.count - 1].nextUse += 1
+        arriveAlongPath(at: top.uses[top.nextUse])
+      }
+      assert(currentPathIfTracing?.isEmpty ?? true,
+             "Path must be maintained throughout visits.")
     }
-    currentPath.append(visitedNode)
-    currentPathIfTracing = currentPath
-
-    printPath(currentPath)
-
-    return currentPath.count
-  }
-
-
-  private mutating func traceDeparture(_ pathLengthAfterArrival: Int) {
-    guard var currentPath = currentPathIfTracing else { return }
-    assert(pathLengthAfterArrival == currentPath.count,
-           "Path must be maintained throughout recursive visits.")
-    currentPath.removeLast()
-    currentPathIfTracing = currentPath
   }
 
   private func printPath(_ path: [Graph.Node]) {
@@ -138,3 +170,15 @@ extension ModuleDependencyGraph.Tracer {
     )
   }
 }
+
+// MARK: - verification
+extension ModuleDependencyGraph.Tracer {
+  /// Every use of a node traced here, that is defined somewhere, must have been traced too.
+  private func verifyTracedUses() {
+    for definition in tracedUses where storage.hasKnownDefinitionLocation(definition.id) {
+      graph.nodeFinder.forEachUse(of: definition) { use in
+        precondition(use.isTraced, "Did not trace \(use.description(in: graph))")
+      }
+    }
+  }
+}
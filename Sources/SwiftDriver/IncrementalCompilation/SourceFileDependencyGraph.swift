@@ -23,7 +23,7 @@ import struct TSCBasic.ByteString
   public var minorVersion: UInt64
   public var compilerVersionString: String
   private var allNodes: [Node]
-  let internedStringTable: InternedStringTable
+  private(set) var internedStringTable: InternedStringTable
 
   public var sourceFileNodePair: (interface: Node, implementation: Node) {
     (interface: allNodes[SourceFileDependencyGraph.sourceFileProvidesInterfaceSequenceNumber],
@@ -332,6 +332,28 @@ extension SourceFileDependencyGraph {
   }
 }
 
+// MARK: - Remapping interned strings
+extension SourceFileDependencyGraph {
+  /// Returns this graph with its strings interned in `destination` instead,
+  /// so that a graph decoded into a table of its own can be integrated.
+  func remapped(into destination: InternedStringTable) throws -> Self {
+    guard internedStringTable !== destination else {
+      return self
+    }
+    let remapping = InternedStringRemapping(from: internedStringTable, into: destination)
+    var remapped = self
+    remapped.allNodes = try allNodes.map { node in
+      try Node(key: node.key.remapped(by: remapping),
+               fingerprint: node.fingerprint.map { remapping($0) },
+               sequenceNumber: node.sequenceNumber,
+               defsIDependUpon: node.defsIDependUpon,
+               definitionVsUse: node.definitionVsUse)
+    }
+    remapped.internedStringTable = destination
+    return remapped
+  }
+}
+
 // MARK: - Creating DependencyKeys
 fileprivate extension DependencyKey.DeclAspect {
   init?(_ c: UInt64) {
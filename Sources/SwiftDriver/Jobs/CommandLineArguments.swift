@@ -69,7 +69,7 @@ extension Array where Element == Job.ArgTemplate {
 
   /// Append a single argument from the given option.
   private mutating func appendSingleArgument(option: Option, argument: String) throws {
-    if option.attributes.contains(.argumentIsPath) {
+    if option.hasAttributes(.argumentIsPath) {
       append(.path(try VirtualPath(path: argument)))
     } else {
       appendFlag(argument)
@@ -94,7 +94,7 @@ extension Array where Element == Job.ArgTemplate {
       try appendSingleArgument(option: option, argument: argument.asSingle)
 
     case .commaJoined:
-      assert(!option.attributes.contains(.argumentIsPath))
+      assert(!option.hasAttributes(.argumentIsPath))
       appendFlag(option.spelling + argument.asMultiple.joined(separator: ","))
 
     case .remaining, .multiArg:
@@ -104,7 +104,7 @@ extension Array where Element == Job.ArgTemplate {
       }
 
     case .joined:
-      if option.attributes.contains(.argumentIsPath) {
+      if option.hasAttributes(.argumentIsPath) {
         append(.joinedOptionAndPath(option.spelling, try VirtualPath(path: argument.asSingle)))
       } else {
         appendFlag(option.spelling + argument.asSingle)
@@ -155,9 +155,10 @@ extension Array where Element == Job.ArgTemplate {
 
   /// Append all parsed options from the given groups except from excludeList to this command line.
   mutating func appendAllExcept(includeList: [Option.Group], excludeList: [Option], from parsedOptions: inout ParsedOptions) throws {
+    let excluded = OptionBitSet(excludeList)
     for group in includeList{
       for optGroup in parsedOptions.arguments(in: group){
-        if !excludeList.contains(where: {$0 == optGroup.option}) {
+        if !excluded.contains(optGroup.option) {
           try append(optGroup)
         }
       }
@@ -458,26 +458,7 @@ extension Driver {
     } else {
       displayInputs = primaryInputs
     }
-    // The cache key for compilation is created one per input file, and each cache key contains all the output
-    // files for that specific input file. All the module level output files are attached to the cache key for
-    // the first input file. Only the input files that produce the output will have a cache key. This behavior
-    // needs to match the cache key creation logic in swift-frontend.
-    let cacheContributingInputs = inputs.enumerated().reduce(into: [(TypedVirtualPath, Int)]()) { result, input in
-      guard input.element.type == .swift else { return }
-      let singleInputKey = TypedVirtualPath(file: OutputFileMap.singleInputKey, type: .swift)
-      if inputOutputMap[singleInputKey] != nil {
-        // If singleInputKey exists, that means only the first swift file produces outputs.
-        if result.isEmpty {
-          result.append((input.element, input.offset))
-        }
-      } else if !inputOutputMap[input.element, default: []].isEmpty {
-        // Otherwise, add all the inputs that produce output.
-        result.append((input.element, input.offset))
-      }
-    }
-    let cacheKeys = try computeOutputCacheKeyForJob(commandLine: commandLine, inputs: cacheContributingInputs)
-
-    return Job(
+    var job = Job(
       moduleName: moduleOutputInfo.name,
       kind: .compile,
       tool: try toolchain.resolvedTool(.swiftCompiler),
@@ -486,9 +467,42 @@ extension Driver {
       inputs: inputs,
       primaryInputs: primaryInputs,
       outputs: outputs,
-      outputCacheKeys: cacheKeys,
       inputOutputMap: inputOutputMap
     )
+    if !defersCompileJobCacheKeys {
+      job.outputCacheKeys = try computeOutputCacheKeyForJob(commandLine: commandLine,
+                                                            inputs: job.cacheContributingInputs)
+    }
+    return job
+  }
+}
+
+extension Job {
+  /// The inputs of a compile job which have an output cache key, along with
+  /// their indices in `inputs`.
+  ///
+  /// The cache key for compilation is created one per input file, and each
+  /// cache key contains all the output files for that specific input file. All
+  /// the module level output files are attached to the cache key for the first
+  /// input file. Only the input files that produce the output will have a cache
+  /// key. This behavior needs to match the cache key creation logic in
+  /// swift-frontend.
+  var cacheContributingInputs: [(TypedVirtualPath, Int)] {
+    assert(kind == .compile)
+    let singleInputKey = TypedVirtualPath(file: OutputFileMap.singleInputKey, type: .swift)
+    let hasSingleInputKey = getCompileInputOutputs(for: singleInputKey) != nil
+    return inputs.enumerated().reduce(into: [(TypedVirtualPath, Int)]()) { result, input in
+      guard input.element.type == .swift else { return }
+      if hasSingleInputKey {
+        // If singleInputKey exists, that means only the first swift file produces outputs.
+        if result.isEmpty {
+          result.append((input.element, input.offset))
+        }
+      } else if !(getCompileInputOutputs(for: input.element) ?? []).isEmpty {
+        // Otherwise, add all the inputs that produce output.
+        result.append((input.element, input.offset))
+      }
+    }
   }
 }
 
@@ -15,6 +15,7 @@
 import SwiftOptions
 import struct Foundation.Data
 import class Foundation.JSONDecoder
+import struct TSCBasic.AbsolutePath
 import struct TSCBasic.Diagnostic
 import class TSCBasic.DiagnosticsEngine
 import protocol TSCBasic.FileSystem
@@ -68,6 +69,20 @@ extension Driver {
                                            fileSystem: FileSystem,
                                            executor: DriverExecutor)
   throws -> Set<String> {
+    // Prefer the binary option table shipped next to the frontend, which
+    // describes exactly the options it was built with. Like the other
+    // sources, report the options without their leading dashes.
+    if let optionTablePath = try? frontendOptionTablePath(of: toolchain),
+       fileSystem.exists(optionTablePath) {
+      do {
+        let table = try BinaryOptionTable(contentsOf: optionTablePath.pathString)
+        return Set(table.frontendSpellings.map { String($0.drop { $0 == "-" }) })
+      } catch {
+        diagnosticsEngine.emit(.remark_frontend_option_table_unreadable(optionTablePath.pathString,
+                                                                         String(describing: error)))
+      }
+    }
+
     if let libSwiftScanInstance = libSwiftScan,
        libSwiftScanInstance.canQuerySupportedArguments() {
       do {
@@ -92,6 +107,14 @@ extension Driver {
     return Set(decodedSupportedFlagList)
   }
 
+  /// The path of the binary option table written by `makeOptions --binary-table`
+  /// for the frontend of the given toolchain.
+  static func frontendOptionTablePath(of toolchain: Toolchain) throws -> AbsolutePath {
+    return try toolchain.getToolPath(.swiftCompiler)
+      .parentDirectory
+      .appending(component: "swift-frontend.options")
+  }
+
   static func computeSupportedCompilerFeatures(of toolchain: Toolchain,
                                                env: ProcessEnvironmentBlock) throws -> Set<String> {
     struct FeatureInfo: Codable {
@@ -14,6 +14,9 @@
 
 import SwiftOptions
 
+import class Dispatch.DispatchQueue
+import struct Dispatch.DispatchTime
+import class Foundation.ProcessInfo
 import class TSCBasic.LocalFileOutputByteStream
 import class TSCBasic.TerminalController
 import struct TSCBasic.RelativePath
@@ -1298,8 +1301,8 @@ extension Driver {
   }
 
   private mutating func needsPathRemapping(for option: Option, remap: Bool) -> Bool {
-    remap && isCachingEnabled && option.attributes.contains(.argumentIsPath) &&
-    !option.attributes.contains(.cacheInvariant)
+    remap && isCachingEnabled && option.hasAttributes(.argumentIsPath) &&
+    !option.hasAttributes(.cacheInvariant)
   }
 
   public mutating func addPathOption(option: Option, path: VirtualPath, to commandLine: inout [Job.ArgTemplate], remap: Bool = true) throws {
@@ -1388,6 +1391,165 @@ extension Driver {
     let arguments: [String] = try executor.resolver.resolveArgumentList(for: commandLine)
     return try cas.computeCacheKey(commandLine: arguments, index: index)
   }
+
+  /// Computes the output cache keys of all of the compile jobs in `jobs`, which
+  /// were planned with `defersCompileJobCacheKeys` set.
+  ///
+  /// Each command line is resolved once, and the keys of different jobs are
+  /// computed concurrently, with at most as many threads as the number of
+  /// parallel jobs.
+  mutating func computeCompileJobCacheKeysInBatch(_ jobs: [Job]) throws -> [Job] {
+    guard let cas = self.cas else {
+      return jobs
+    }
+    let startTime = DispatchTime.now()
+    let compileJobIndices = jobs.indices.filter { jobs[$0].kind == .compile }
+    let requests = try compileJobIndices.map { index in
+      (commandLine: try executor.resolver.resolveArgumentList(for: jobs[index].commandLine),
+       inputs: jobs[index].cacheContributingInputs)
+    }
+
+    let threadCount = max(1, min(numParallelJobs ?? ProcessInfo.processInfo.activeProcessorCount,
+                                 requests.count))
+    var results = [Result<[String], Swift.Error>?](repeating: nil, count: requests.count)
+    results.withUnsafeMutableBufferPointer { buffer in
+      DispatchQueue.concurrentPerform(iterations: threadCount) { thread in
+        for index in stride(from: thread, to: requests.count, by: threadCount) {
+          let request = requests[index]
+          buffer[index] = Result {
+            try cas.computeCacheKeys(commandLine: request.commandLine,
+                                     indices: request.inputs.map { $0.1 })
+          }
+        }
+      }
+    }
+
+    var result = jobs
+    var keyCount = 0
+    for (requestIndex, jobIndex) in compileJobIndices.enumerated() {
+      let keys = try results[requestIndex]!.get()
+      keyCount += keys.count
+      result[jobIndex].outputCacheKeys = Dictionary(
+        zip(requests[requestIndex].inputs.map { $0.0 }, keys), uniquingKeysWith: { $1 })
+    }
+
+    if showJobLifecycle {
+      let milliseconds = (DispatchTime.now().uptimeNanoseconds - startTime.uptimeNanoseconds) / 1_000_000
+      diagnosticEngine.emit(
+        .remark("Computed \(keyCount) cache key\(keyCount != 1 ? "s" : "") for \(requests.count) " +
+                "compile job\(requests.count != 1 ? "s" : "") on \(threadCount) thread" +
+                "\(threadCount != 1 ? "s" : "") in \(milliseconds)ms"))
+    }
+    return result
+  }
+
+  /// Queries the compilation cache for the output cache keys of all of `jobs`
+  /// at once, so that the executor can order the jobs by whether they only
+  /// need to replay cached outputs.
+  ///
+  /// Only the local cache is consulted, because an output that has to be
+  /// downloaded first does not make for a cheap replay.
+  ///
+  /// This runs before the executor starts any job, and blocks until every
+  /// query is answered, since the answers decide which jobs go first. The
+  /// queries overlap one another, and their latency, which is added to the
+  /// time before the first job starts, is reported by `-Rcache-compile-job`
+  /// and measured by `CachingPerformanceTests`.
+  @_spi(Testing) public func queryOutputCacheKeys(of jobs: [Job]) -> CacheQueryResults? {
+    guard let cas = self.cas else {
+      return nil
+    }
+    var keys: [String] = []
+    var seenKeys: Set<String> = []
+    for job in jobs {
+      for key in job.outputCacheKeys.values where seenKeys.insert(key).inserted {
+        keys.append(key)
+      }
+    }
+    guard !keys.isEmpty else {
+      return nil
+    }
+
+    let startTime = DispatchTime.now()
+    let answers = cas.queryCacheKeys(keys, globally: false)
+    let latency = DispatchTime.now().uptimeNanoseconds - startTime.uptimeNanoseconds
+
+    var hits: [String: Bool] = [:]
+    for (key, answer) in zip(keys, answers) {
+      if case .success(let compilation?) = answer {
+        hits[key] = compilation.allSatisfy { $0.isMaterialized }
+      } else {
+        hits[key] = false
+      }
+    }
+    return CacheQueryResults(keys: hits, latencyNanoseconds: latency)
+  }
+
+  /// The number of cache keys whose outputs may be fetched into the local CAS
+  /// at once, ahead of the jobs that need them.
+  ///
+  /// Prefetching only pays off when outputs may live in a remote cache, so it
+  /// is off unless a CAS plugin is in use. `-cache-prefetch-limit` overrides
+  /// the default, and 0 turns prefetching off.
+  mutating func cachedOutputPrefetchLimit() -> Int {
+    if let limit = Driver.parseIntOption(&parsedOptions, option: .cachePrefetchLimit,
+                                         diagnosticsEngine: diagnosticEngine) {
+      return max(0, limit)
+    }
+    guard parsedOptions.hasArgument(.casPluginPath) else {
+      return 0
+    }
+    return 2 * (numParallelJobs ?? 1)
+  }
+
+  /// Starts fetching the outputs that `results` found missing from the local
+  /// CAS, in the order of the jobs that need them.
+  mutating func startPrefetchingCachedOutputs(of jobs: [Job],
+                                              missingFrom results: CacheQueryResults) -> CachedOutputPrefetcher? {
+    let limit = cachedOutputPrefetchLimit()
+    guard let cas = self.cas, cas.supportsCancellableFetches, limit > 0 else {
+      return nil
+    }
+    var keys: [String] = []
+    var seenKeys: Set<String> = []
+    for job in jobs {
+      for key in job.outputCacheKeys.values where results.keys[key] == false && seenKeys.insert(key).inserted {
+        keys.append(key)
+      }
+    }
+    guard !keys.isEmpty else {
+      return nil
+    }
+    let prefetcher = CachedOutputPrefetcher(fetcher: cas, maxInFlight: limit)
+    prefetcher.prefetch(keys)
+    return prefetcher
+  }
+
+  /// Starts enforcing the CAS's size budget, in the background, if it has one.
+  func startManagingCASStorage() -> CASStorageManager? {
+    guard let cas = self.cas, let sizeLimit = casSizeLimit,
+          let manager = CASStorageManager(cas: cas, sizeLimit: sizeLimit) else {
+      return nil
+    }
+    manager.startEnforcingSizeLimit()
+    return manager
+  }
+
+  /// Waits for `manager` to have enforced the CAS's size budget and, with
+  /// `-cache-remarks`, reports what the CAS holds for `jobs`.
+  func finishManagingCASStorage(_ manager: CASStorageManager, jobs: [Job]) {
+    do {
+      if let result = try manager.wait(), parsedOptions.hasArgument(.cacheRemarks) {
+        diagnosticEngine.emit(.remark_cas_prune_summary(result))
+      }
+    } catch {
+      diagnosticEngine.emit(.warning("unable to enforce the CAS size limit: \(error)"))
+    }
+    if parsedOptions.hasArgument(.cacheRemarks),
+       let usage = try? manager.usage(ofCacheKeys: jobs.flatMap { $0.outputCacheKeys.values }) {
+      diagnosticEngine.emit(.remark_cas_usage_summary(usage))
+    }
+  }
 }
 
 // Generate reproducer.
@@ -66,6 +66,12 @@ extension Driver {
   -> ([Job], IncrementalCompilationState?, ExplicitDependencyBuildPlanner?) {
     precondition(compilerMode.isStandardCompilationForPlanning,
                  "compiler mode \(compilerMode) is handled elsewhere")
+    // For an explicit build, start scanning for the inter-module dependency
+    // graph, which planning only needs once the explicit module planner is
+    // configured.
+    let pendingDependencyScan = try needsInterModuleDependencyGraph ? startDependencyScan() : nil
+    defer { pendingDependencyScan?.abandon() }
+
     // Determine the initial state for incremental compilation that is required during
     // the planning process. This state contains the module dependency graph and
     // cross-module dependency information.
@@ -73,7 +79,14 @@ extension Driver {
       try IncrementalCompilationState.computeIncrementalStateForPlanning(driver: &self)
 
     // For an explicit build, compute the inter-module dependency graph
-    let explicitModulePlanner = try configureExplicitModulePlanner()
+    let explicitModulePlanner =
+      try configureExplicitModulePlanner(initialIncrementalState: initialIncrementalState,
+                                         pendingDependencyScan: pendingDependencyScan)
+
+    // Without incremental compilation, every compile job is known once they
+    // are batched, so compute their cache keys together afterwards.
+    defersCompileJobCacheKeys = cas != nil && initialIncrementalState == nil
+    defer { defersCompileJobCacheKeys = false }
 
     // Compute the set of all jobs required to build this module
     let jobsInPhases = try computeJobsForPhasedStandardBuild(explicitModulePlanner: explicitModulePlanner,
@@ -92,7 +105,7 @@ extension Driver {
       incrementalCompilationState = nil
     }
 
-    let batchedJobs: [Job]
+    var batchedJobs: [Job]
     // If the jobs are batched during the incremental build, reuse the computation rather than computing the batches again.
     if let incrementalState = incrementalCompilationState {
       // For compatibility reasons, all the jobs planned will be returned, even the incremental state suggests the job is not mandatory.
@@ -103,20 +116,36 @@ extension Driver {
                                         jobCreatingPch: jobsInPhases.beforeCompiles.first { $0.kind == .generatePCH },
                                         jobEmitModule: jobsInPhases.beforeCompiles.first { $0.kind == .emitModule },
                                         explicitModulePlanner: explicitModulePlanner)
+      if defersCompileJobCacheKeys {
+        batchedJobs = try computeCompileJobCacheKeysInBatch(batchedJobs)
+      }
     }
 
     return (batchedJobs, incrementalCompilationState, explicitModulePlanner)
   }
 
+  /// Whether planning this build needs the inter-module dependency graph.
+  private var needsInterModuleDependencyGraph: Bool {
+    mutating get {
+      (parsedOptions.contains(.driverExplicitModuleBuild) ||
+       parsedOptions.contains(.explainModuleDependency)) &&
+        inputFiles.contains(where: { $0.type.isPartOfSwiftCompilation })
+    }
+  }
+
   /// If performing an explicit module build, compute an inter-module dependency graph.
   /// If performing an incremental build, and the initial incremental state contains a valid
   /// graph already, it is safe to re-use without repeating the scan.
-  private mutating func configureExplicitModulePlanner(forVariantModule: Bool = false)
+  private mutating func configureExplicitModulePlanner(forVariantModule: Bool = false,
+                                                      initialIncrementalState:
+                                                      IncrementalCompilationState.InitialStateForPlanning? = nil,
+                                                      pendingDependencyScan: PendingDependencyScan? = nil)
   throws -> ExplicitDependencyBuildPlanner? {
-    if (parsedOptions.contains(.driverExplicitModuleBuild) ||
-        parsedOptions.contains(.explainModuleDependency)) &&
-       inputFiles.contains(where: { $0.type.isPartOfSwiftCompilation }) {
-      let interModuleDependencyGraph = try scanModuleDependencies(forVariantModule: forVariantModule)
+    if needsInterModuleDependencyGraph {
+      let interModuleDependencyGraph =
+        try scanModuleDependencies(forVariantModule: forVariantModule,
+                                   initialIncrementalState: initialIncrementalState,
+                                   pendingScan: pendingDependencyScan)
       return try ExplicitDependencyBuildPlanner(dependencyGraph: interModuleDependencyGraph,
                                                 toolchain: toolchain,
                                                 integratedDriver: integratedDriver,
@@ -630,6 +630,8 @@ extension InterModuleDependencyGraph {
         break
       }
     }
+    // Decode every module once, rather than on each lookup.
+    let modules = try allModules()
     try localFileSystem.writeFileContents(path) { Stream in
       Stream.send("digraph {\n")
       for key in modules.keys {
@@ -823,8 +825,7 @@ extension Driver {
     }
 
     func getSwiftDependencies(for module: String) -> [String] {
-      let info = dependencyGraph.modules[.swift(module)]!
-      let dependencies = info.allDependencies
+      let dependencies = try! dependencyGraph.allDependencies(of: .swift(module))
       guard !dependencies.isEmpty else {
         return []
       }
@@ -871,7 +872,8 @@ extension Driver {
     // Keep track of modules we haven't handled.
     var unhandledModules = Set<String>(inputMap.keys)
     // Start from those modules explicitly imported into the file under scanning
-    var openModules = collectUniqueSwiftModuleNames(dependencyGraph.mainModule.allDependencies)
+    var openModules = try collectUniqueSwiftModuleNames(
+      dependencyGraph.moduleInfo(of: .swift(dependencyGraph.mainModuleName)).allDependencies)
     var idx = 0
     while idx != openModules.count {
       let module = openModules[idx]
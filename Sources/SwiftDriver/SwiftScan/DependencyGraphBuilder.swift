@@ -14,6 +14,8 @@
 
 @_implementationOnly import CSwiftScan
 
+import class Foundation.NSLock
+
 internal extension SwiftScan {
   /// From a reference to a binary-format dependency graph returned by libSwiftScan,
   /// construct an instance of an `InterModuleDependencyGraph`.
@@ -29,6 +31,7 @@ internal extension SwiftScan {
       throw DependencyScanningError.missingField("dependency_graph.dependencies")
     }
 
+    let moduleIds = ModuleDependencyIdDecoder(moduleAliases: moduleAliases)
     var moduleInfoMap: ModuleInfoMap = [:]
     // Turn the `swiftscan_dependency_set_t` into an array of `swiftscan_dependency_info_t`
     // references we can iterate through in order to construct `ModuleInfo` objects.
@@ -38,13 +41,30 @@ internal extension SwiftScan {
       guard let moduleRef = moduleRefOrNull else {
         throw DependencyScanningError.missingField("dependency_set_t.modules[_]")
       }
-      let (moduleId, moduleInfo) = try constructModuleInfo(from: moduleRef, moduleAliases: moduleAliases)
+      let (moduleId, moduleInfo) = try constructModuleInfo(from: moduleRef, moduleIds: moduleIds)
       moduleInfoMap[moduleId] = moduleInfo
     }
 
     return InterModuleDependencyGraph(mainModuleName: mainModuleName, modules: moduleInfoMap)
   }
 
+  /// From a reference to a binary-format dependency graph returned by libSwiftScan,
+  /// construct an `InterModuleDependencyGraph` which keeps the scanner's graph
+  /// and only decodes each module when it is first looked up.
+  ///
+  /// The returned graph takes ownership of `scannerGraphRef`; if this throws,
+  /// the caller still owns it.
+  func constructLazyGraph(from scannerGraphRef: swiftscan_dependency_graph_t,
+                          moduleAliases: [String: String]?) throws
+  -> InterModuleDependencyGraph {
+    let mainModuleNameRef =
+      api.swiftscan_dependency_graph_get_main_module_name(scannerGraphRef)
+    let mainModuleName = try toSwiftString(mainModuleNameRef)
+    let modules = try ScannedModuleInfoMap(scanner: self, graphRef: scannerGraphRef,
+                                           moduleAliases: moduleAliases)
+    return InterModuleDependencyGraph(mainModuleName: mainModuleName, scannedModules: modules)
+  }
+
   /// From a reference to a binary-format set of module imports return by libSwiftScan pre-scan query,
   /// construct an instance of an `InterModuleDependencyImports` set
   func constructImportSet(from importSetRef: swiftscan_import_set_t,
@@ -61,12 +81,10 @@ private extension SwiftScan {
   /// From a reference to a binary-format module dependency module info returned by libSwiftScan,
   /// construct an instance of an `ModuleInfo` as used by the driver
   func constructModuleInfo(from moduleInfoRef: swiftscan_dependency_info_t,
-                           moduleAliases: [String: String]?)
+                           moduleIds: ModuleDependencyIdDecoder)
   throws -> (ModuleDependencyId, ModuleInfo) {
     // Decode the module name and module kind
-    let encodedModuleName =
-      try toSwiftString(api.swiftscan_module_info_get_module_name(moduleInfoRef))
-    let moduleId = try decodeModuleNameAndKind(from: encodedModuleName, moduleAliases: moduleAliases)
+    let moduleId = try constructModuleId(from: moduleInfoRef, moduleIds: moduleIds)
 
     // Decode module path and source file locations
     let modulePathStr = try toSwiftString(api.swiftscan_module_info_get_module_path(moduleInfoRef))
@@ -79,32 +97,8 @@ private extension SwiftScan {
     }
 
     // Decode all dependencies of this module
-    let directDependencies: [ModuleDependencyId]?
-    if let encodedDirectDepsRef = api.swiftscan_module_info_get_direct_dependencies(moduleInfoRef) {
-      let encodedDirectDependencies = try toSwiftStringArray(encodedDirectDepsRef.pointee)
-      directDependencies =
-      try encodedDirectDependencies.map { try decodeModuleNameAndKind(from: $0, moduleAliases: moduleAliases) }
-    } else {
-      directDependencies = nil
-    }
-
-    var linkLibraries: [LinkLibraryInfo] = []
-    if supportsLinkLibraries {
-      let linkLibrarySetRefOrNull = api.swiftscan_module_info_get_link_libraries(moduleInfoRef)
-      guard let linkLibrarySetRef = linkLibrarySetRefOrNull else {
-        throw DependencyScanningError.missingField("dependency_graph.link_libraries")
-      }
-      // Turn the `swiftscan_dependency_set_t` into an array of `swiftscan_dependency_info_t`
-      // references we can iterate through in order to construct `ModuleInfo` objects.
-      let linkLibraryRefArray = Array(UnsafeBufferPointer(start: linkLibrarySetRef.pointee.link_libraries,
-                                                          count: Int(linkLibrarySetRef.pointee.count)))
-      for linkLibraryRefOrNull in linkLibraryRefArray {
-        guard let linkLibraryRef = linkLibraryRefOrNull else {
-          throw DependencyScanningError.missingField("dependency_set_t.link_libraries[_]")
-        }
-        linkLibraries.append(try constructLinkLibrayInfo(from: linkLibraryRef))
-      }
-    }
+    let directDependencies = try constructDirectDependencies(from: moduleInfoRef, moduleIds: moduleIds)
+    let linkLibraries = try constructLinkLibraries(from: moduleInfoRef)
 
     var importInfos: [ImportInfo]? = nil
     if supportsImportInfos {
@@ -126,7 +120,7 @@ private extension SwiftScan {
       throw DependencyScanningError.missingField("modules[\(moduleId)].details")
     }
     let details = try constructModuleDetails(from: moduleDetailsRef,
-                                             moduleAliases: moduleAliases)
+                                             moduleIds: moduleIds)
 
     return (moduleId, ModuleInfo(modulePath: modulePath,
                                  libraryLevel: getLibraryLevel(from: moduleInfoRef),
@@ -137,6 +131,97 @@ private extension SwiftScan {
                                  details: details))
   }
 
+  func constructModuleId(from moduleInfoRef: swiftscan_dependency_info_t,
+                         moduleIds: ModuleDependencyIdDecoder) throws -> ModuleDependencyId {
+    let encodedModuleName =
+      try toSwiftString(api.swiftscan_module_info_get_module_name(moduleInfoRef))
+    return try moduleIds.decode(encodedModuleName)
+  }
+
+  func constructDirectDependencies(from moduleInfoRef: swiftscan_dependency_info_t,
+                                   moduleIds: ModuleDependencyIdDecoder) throws -> [ModuleDependencyId]? {
+    guard let encodedDirectDepsRef = api.swiftscan_module_info_get_direct_dependencies(moduleInfoRef) else {
+      return nil
+    }
+    return try toSwiftStringArray(encodedDirectDepsRef.pointee).map { try moduleIds.decode($0) }
+  }
+
+  /// Decode only the dependencies of a module, in the order `ModuleInfo.allDependencies`
+  /// reports them, without decoding the rest of its details.
+  func constructAllDependencies(from moduleInfoRef: swiftscan_dependency_info_t,
+                                moduleId: ModuleDependencyId,
+                                moduleIds: ModuleDependencyIdDecoder) throws -> [ModuleDependencyId] {
+    let directDependencies = try constructDirectDependencies(from: moduleInfoRef, moduleIds: moduleIds)
+    guard let moduleDetailsRef = api.swiftscan_module_info_get_details(moduleInfoRef) else {
+      throw DependencyScanningError.missingField("modules[\(moduleId)].details")
+    }
+    guard api.swiftscan_module_detail_get_kind(moduleDetailsRef) == SWIFTSCAN_DEPENDENCY_INFO_SWIFT_TEXTUAL else {
+      return directDependencies ?? []
+    }
+    let swiftOverlayDependencies =
+      try constructSwiftOverlayDependencies(from: moduleDetailsRef, moduleIds: moduleIds)
+    // Bridging header dependencies are only reported along with a bridging header.
+    let bridgingHeaderDependencies: [ModuleDependencyId]?
+    if try getOptionalStringDetail(from: moduleDetailsRef,
+                                   using: api.swiftscan_swift_textual_detail_get_bridging_header_path) != nil {
+      bridgingHeaderDependencies =
+        try getOptionalStringArrayDetail(from: moduleDetailsRef,
+                                         using: api.swiftscan_swift_textual_detail_get_bridging_module_dependencies)?
+          .map { .clang($0) } ?? []
+    } else {
+      bridgingHeaderDependencies = nil
+    }
+    return ModuleInfo.allDependencies(direct: directDependencies,
+                                      swiftOverlay: swiftOverlayDependencies,
+                                      bridgingHeader: bridgingHeaderDependencies)
+  }
+
+  /// Construct the `inputPath` of a module, without decoding the rest of its
+  /// details.
+  func constructInputPath(from moduleInfoRef: swiftscan_dependency_info_t,
+                          moduleId: ModuleDependencyId) throws -> TextualVirtualPath? {
+    guard let moduleDetailsRef = api.swiftscan_module_info_get_details(moduleInfoRef) else {
+      throw DependencyScanningError.missingField("modules[\(moduleId)].details")
+    }
+    let moduleKind = api.swiftscan_module_detail_get_kind(moduleDetailsRef)
+    switch moduleKind {
+      case SWIFTSCAN_DEPENDENCY_INFO_SWIFT_TEXTUAL:
+        return try getOptionalPathDetail(from: moduleDetailsRef,
+                                         using: api.swiftscan_swift_textual_detail_get_module_interface_path)
+      case SWIFTSCAN_DEPENDENCY_INFO_SWIFT_BINARY:
+        return try getPathDetail(from: moduleDetailsRef,
+                                 using: api.swiftscan_swift_binary_detail_get_compiled_module_path,
+                                 fieldName: "swift_binary_detail.compiledModulePath")
+      case SWIFTSCAN_DEPENDENCY_INFO_CLANG:
+        return try getPathDetail(from: moduleDetailsRef,
+                                 using: api.swiftscan_clang_detail_get_module_map_path,
+                                 fieldName: "clang_detail.moduleMapPath")
+      default:
+        throw DependencyScanningError.unsupportedDependencyDetailsKind(Int(moduleKind.rawValue))
+    }
+  }
+
+  func constructLinkLibraries(from moduleInfoRef: swiftscan_dependency_info_t) throws -> [LinkLibraryInfo] {
+    var linkLibraries: [LinkLibraryInfo] = []
+    if supportsLinkLibraries {
+      let linkLibrarySetRefOrNull = api.swiftscan_module_info_get_link_libraries(moduleInfoRef)
+      guard let linkLibrarySetRef = linkLibrarySetRefOrNull else {
+        throw DependencyScanningError.missingField("dependency_graph.link_libraries")
+      }
+      // Turn the `swiftscan_dependency_set_t` into an array of `swiftscan_dependency_info_t`
+      // references we can iterate through in order to construct `ModuleInfo` objects.
+      let linkLibraryRefArray = Array(UnsafeBufferPointer(start: linkLibrarySetRef.pointee.link_libraries,
+                                                          count: Int(linkLibrarySetRef.pointee.count)))
+      for linkLibraryRefOrNull in linkLibraryRefArray {
+        guard let linkLibraryRef = linkLibraryRefOrNull else {
+          throw DependencyScanningError.missingField("dependency_set_t.link_libraries[_]")
+        }
+        linkLibraries.append(try constructLinkLibrayInfo(from: linkLibraryRef))
+      }
+    }
+    return linkLibraries
+  }
+
   func constructLinkLibrayInfo(from linkLibraryInfoRef: swiftscan_link_library_info_t) throws -> LinkLibraryInfo {
     return LinkLibraryInfo(linkName: try toSwiftString(api.swiftscan_link_library_info_get_link_name(linkLibraryInfoRef)),
                              isFramework: api.swiftscan_link_library_info_get_is_framework(linkLibraryInfoRef),
@@ -182,13 +267,13 @@ private extension SwiftScan {
   /// construct an instance of an `ModuleInfo`.Details as used by the driver.
   /// The object returned by libSwiftScan is a union so ensure to execute dependency-specific queries.
   func constructModuleDetails(from moduleDetailsRef: swiftscan_module_details_t,
-                              moduleAliases: [String: String]?)
+                              moduleIds: ModuleDependencyIdDecoder)
   throws -> ModuleInfo.Details {
     let moduleKind = api.swiftscan_module_detail_get_kind(moduleDetailsRef)
     switch moduleKind {
       case SWIFTSCAN_DEPENDENCY_INFO_SWIFT_TEXTUAL:
         return .swift(try constructSwiftTextualModuleDetails(from: moduleDetailsRef,
-                                                             moduleAliases: moduleAliases))
+                                                             moduleIds: moduleIds))
       case SWIFTSCAN_DEPENDENCY_INFO_SWIFT_BINARY:
         return .swiftPrebuiltExternal(try constructSwiftBinaryModuleDetails(from: moduleDetailsRef))
       case SWIFTSCAN_DEPENDENCY_INFO_CLANG:
@@ -200,7 +285,7 @@ private extension SwiftScan {
 
   /// Construct a `SwiftModuleDetails` from a `swiftscan_module_details_t` reference
   func constructSwiftTextualModuleDetails(from moduleDetailsRef: swiftscan_module_details_t,
-                                          moduleAliases: [String: String]?)
+                                          moduleIds: ModuleDependencyIdDecoder)
   throws -> SwiftModuleDetails {
     let moduleInterfacePath =
       try getOptionalPathDetail(from: moduleDetailsRef,
@@ -244,22 +329,15 @@ private extension SwiftScan {
       try getOptionalStringDetail(from: moduleDetailsRef, using: api.swiftscan_swift_textual_detail_get_chained_bridging_header_content) : nil
 
     // Decode all dependencies of this module
-    let swiftOverlayDependencies: [ModuleDependencyId]?
-    if supportsSeparateSwiftOverlayDependencies,
-       let encodedOverlayDepsRef = api.swiftscan_swift_textual_detail_get_swift_overlay_dependencies(moduleDetailsRef) {
-      let encodedOverlayDependencies = try toSwiftStringArray(encodedOverlayDepsRef.pointee)
-      swiftOverlayDependencies =
-        try encodedOverlayDependencies.map { try decodeModuleNameAndKind(from: $0, moduleAliases: moduleAliases) }
-    } else {
-      swiftOverlayDependencies = nil
-    }
+    let swiftOverlayDependencies =
+      try constructSwiftOverlayDependencies(from: moduleDetailsRef, moduleIds: moduleIds)
 
     let sourceImportedDependencies: [ModuleDependencyId]?
     if supportsSeparateImportOnlyDependencies,
        let encodedImportedDepsRef = api.swiftscan_swift_textual_detail_get_swift_source_import_module_dependencies(moduleDetailsRef) {
       let encodedImportedDepsendencies = try toSwiftStringArray(encodedImportedDepsRef.pointee)
       sourceImportedDependencies =
-        try encodedImportedDepsendencies.map { try decodeModuleNameAndKind(from: $0, moduleAliases: moduleAliases) }
+        try encodedImportedDepsendencies.map { try moduleIds.decode($0) }
     } else {
       sourceImportedDependencies = nil
     }
@@ -278,6 +356,15 @@ private extension SwiftScan {
                               chainedBridgingHeaderContent: chainedBridgingHeaderContent)
   }
 
+  func constructSwiftOverlayDependencies(from moduleDetailsRef: swiftscan_module_details_t,
+                                         moduleIds: ModuleDependencyIdDecoder) throws -> [ModuleDependencyId]? {
+    guard supportsSeparateSwiftOverlayDependencies,
+          let encodedOverlayDepsRef = api.swiftscan_swift_textual_detail_get_swift_overlay_dependencies(moduleDetailsRef) else {
+      return nil
+    }
+    return try toSwiftStringArray(encodedOverlayDepsRef.pointee).map { try moduleIds.decode($0) }
+  }
+
   /// Construct a `SwiftPrebuiltExternalModuleDetails` from a `swiftscan_module_details_t` reference
   func constructSwiftBinaryModuleDetails(from moduleDetailsRef: swiftscan_module_details_t)
   throws -> SwiftPrebuiltExternalModuleDetails {
@@ -503,7 +590,173 @@ private extension SwiftScan {
   }
 }
 
-private extension SwiftScan {
+/// The modules of a dependency graph produced by libSwiftScan, left in the
+/// scanner's representation and decoded the first time each one is looked up.
+///
+/// Owns the `swiftscan_dependency_graph_t`, and disposes of it once the last
+/// `InterModuleDependencyGraph` referring to it is gone.
+final class ScannedModuleInfoMap {
+  private let scanner: SwiftScan
+  private let graphRef: swiftscan_dependency_graph_t
+  /// The scanner's reference to each module, in the order it reported them.
+  private let moduleRefs: [swiftscan_dependency_info_t]
+  private let indices: [ModuleDependencyId: Int]
+  /// The identifier of every module, decoded up front.
+  let moduleIds: [ModuleDependencyId]
+
+  /// Guards everything below, which is filled in as modules are looked up.
+  private let lock = NSLock()
+  private let moduleIdDecoder: ModuleDependencyIdDecoder
+  private var moduleInfos: [ModuleInfo?]
+  private var dependencies: [[ModuleDependencyId]?]
+  /// Every module, once `allModules()` has decoded them all.
+  private var materializedModules: ModuleInfoMap? = nil
+
+  /// Takes ownership of `graphRef` if, and only if, this doesn't throw.
+  init(scanner: SwiftScan,
+       graphRef: swiftscan_dependency_graph_t,
+       moduleAliases: [String: String]?) throws {
+    guard let dependencySetRef = scanner.api.swiftscan_dependency_graph_get_dependencies(graphRef) else {
+      throw DependencyScanningError.missingField("dependency_graph.dependencies")
+    }
+    let moduleIdDecoder = ModuleDependencyIdDecoder(moduleAliases: moduleAliases)
+    var moduleRefs: [swiftscan_dependency_info_t] = []
+    var indices: [ModuleDependencyId: Int] = [:]
+    var moduleIds: [ModuleDependencyId] = []
+    for moduleRefOrNull in UnsafeBufferPointer(start: dependencySetRef.pointee.modules,
+                                               count: Int(dependencySetRef.pointee.count)) {
+      guard let moduleRef = moduleRefOrNull else {
+        throw DependencyScanningError.missingField("dependency_set_t.modules[_]")
+      }
+      let moduleId = try scanner.constructModuleId(from: moduleRef, moduleIds: moduleIdDecoder)
+      // Like the eager decoding, the last module reported under a name wins.
+      if indices.updateValue(moduleRefs.count, forKey: moduleId) == nil {
+        moduleIds.append(moduleId)
+      }
+      moduleRefs.append(moduleRef)
+    }
+
+    self.scanner = scanner
+    self.graphRef = graphRef
+    self.moduleRefs = moduleRefs
+    self.indices = indices
+    self.moduleIds = moduleIds
+    self.moduleIdDecoder = moduleIdDecoder
+    self.moduleInfos = Array(repeating: nil, count: moduleRefs.count)
+    self.dependencies = Array(repeating: nil, count: moduleRefs.count)
+  }
+
+  deinit {
+    scanner.api.swiftscan_dependency_graph_dispose(graphRef)
+  }
+
+  func contains(_ moduleId: ModuleDependencyId) -> Bool {
+    indices[moduleId] != nil
+  }
+
+  /// Returns `nil` if there is no such module.
+  func moduleInfo(of moduleId: ModuleDependencyId) throws -> ModuleInfo? {
+    guard let index = indices[moduleId] else { return nil }
+    lock.lock()
+    defer { lock.unlock() }
+    return try moduleInfoLocked(at: index)
+  }
+
+  /// The dependencies of a module, without decoding the rest of it if it
+  /// hasn't been yet. Returns `nil` if there is no such module.
+  func allDependencies(of moduleId: ModuleDependencyId) throws -> [ModuleDependencyId]? {
+    guard let index = indices[moduleId] else { return nil }
+    lock.lock()
+    defer { lock.unlock() }
+    if let moduleInfo = moduleInfos[index] {
+      return moduleInfo.allDependencies
+    }
+    if let moduleDependencies = dependencies[index] {
+      return moduleDependencies
+    }
+    let moduleDependencies = try scanner.constructAllDependencies(from: moduleRefs[index],
+                                                                  moduleId: moduleId,
+                                                                  moduleIds: moduleIdDecoder)
+    dependencies[index] = moduleDependencies
+    return moduleDependencies
+  }
+
+  /// The libraries a module links, without decoding the rest of it if it
+  /// hasn't been yet. Returns `nil` if there is no such module.
+  func linkLibraries(of moduleId: ModuleDependencyId) throws -> [LinkLibraryInfo]? {
+    guard let index = indices[moduleId] else { return nil }
+    lock.lock()
+    defer { lock.unlock() }
+    if let moduleInfo = moduleInfos[index] {
+      return moduleInfo.linkLibraries ?? []
+    }
+    return try scanner.constructLinkLibraries(from: moduleRefs[index])
+  }
+
+  /// The `inputPath` of a module, without decoding the rest of it if it
+  /// hasn't been yet. Returns `nil` if there is no such module.
+  func inputPath(of moduleId: ModuleDependencyId) throws -> TextualVirtualPath?? {
+    guard let index = indices[moduleId] else { return nil }
+    lock.lock()
+    defer { lock.unlock() }
+    if let moduleInfo = moduleInfos[index] {
+      return .some(moduleInfo.inputPath)
+    }
+    return .some(try scanner.constructInputPath(from: moduleRefs[index], moduleId: moduleId))
+  }
+
+  /// Decodes every module that hasn't been decoded yet, throwing the error
+  /// of the first one that fails to decode. The map is built once, and
+  /// returned as-is from then on.
+  func allModules() throws -> ModuleInfoMap {
+    lock.lock()
+    defer { lock.unlock() }
+    if let materializedModules {
+      return materializedModules
+    }
+    var modules: ModuleInfoMap = [:]
+    modules.reserveCapacity(moduleIds.count)
+    for moduleId in moduleIds {
+      modules[moduleId] = try moduleInfoLocked(at: indices[moduleId]!)
+    }
+    materializedModules = modules
+    return modules
+  }
+
+  private func moduleInfoLocked(at index: Int) throws -> ModuleInfo {
+    if let moduleInfo = moduleInfos[index] {
+      return moduleInfo
+    }
+    let (_, moduleInfo) = try scanner.constructModuleInfo(from: moduleRefs[index],
+                                                          moduleIds: moduleIdDecoder)
+    moduleInfos[index] = moduleInfo
+    // The dependencies are part of the module info from now on.
+    dependencies[index] = nil
+    return moduleInfo
+  }
+}
+
+/// Decodes the module names reported by libSwiftScan into `ModuleDependencyId`s,
+/// sharing one `ModuleDependencyId` between every mention of the same module.
+///
+/// Not thread-safe.
+final class ModuleDependencyIdDecoder {
+  private let moduleAliases: [String: String]?
+  private var decodedModuleIds: [String: ModuleDependencyId] = [:]
+
+  init(moduleAliases: [String: String]?) {
+    self.moduleAliases = moduleAliases
+  }
+
+  func decode(_ encodedName: String) throws -> ModuleDependencyId {
+    if let moduleId = decodedModuleIds[encodedName] {
+      return moduleId
+    }
+    let moduleId = try decodeModuleNameAndKind(from: encodedName)
+    decodedModuleIds[encodedName] = moduleId
+    return moduleId
+  }
+
   /// Decode the module name returned by libSwiftScan into a `ModuleDependencyId`
   /// libSwiftScan encodes the module's name using the following scheme:
   /// `<module-kind>:<module-name>`
@@ -511,8 +764,7 @@ private extension SwiftScan {
   /// "swiftTextual"
   /// "swiftBinary"
   /// "clang""
-  func decodeModuleNameAndKind(from encodedName: String,
-                               moduleAliases: [String: String]?) throws -> ModuleDependencyId {
+  private func decodeModuleNameAndKind(from encodedName: String) throws -> ModuleDependencyId {
     switch encodedName {
       case _ where encodedName.starts(with: "swiftTextual:"):
       var namePart = String(encodedName.suffix(encodedName.count - "swiftTextual:".count))
@@ -197,9 +197,13 @@ private extension String {
     return try constructImportSet(from: importSetRef, with: moduleAliases)
   }
 
+  /// Scans the dependencies of a module. Unless `decodingModulesLazily` is
+  /// `false`, the returned graph keeps the scanner's results and decodes each
+  /// module the first time it is looked up.
   func scanDependencies(workingDirectory: AbsolutePath,
                         moduleAliases: [String: String]?,
                         invocationCommand: [String],
+                        decodingModulesLazily: Bool = true,
                         diagnostics: inout [ScannerDiagnosticPayload]) throws -> InterModuleDependencyGraph {
     // Create and configure the scanner invocation
     let invocation = api.swiftscan_scan_invocation_create()
@@ -218,7 +222,13 @@ private extension String {
     guard let graphRef = graphRefOrNull else {
       throw DependencyScanningError.dependencyScanFailed("Unable to produce dependency graph")
     }
-    defer { api.swiftscan_dependency_graph_dispose(graphRef) }
+    // A lazily-decoded graph takes over the scanner's graph.
+    var ownsGraphRef = true
+    defer {
+      if ownsGraphRef {
+        api.swiftscan_dependency_graph_dispose(graphRef)
+      }
+    }
 
     if canQueryPerScanDiagnostics {
       let diagnosticsSetRefOrNull = api.swiftscan_dependency_graph_get_diagnostics(graphRef)
@@ -228,7 +238,12 @@ private extension String {
       diagnostics = try mapToDriverDiagnosticPayload(diagnosticsSetRef)
     }
 
-    return try constructGraph(from: graphRef, moduleAliases: moduleAliases)
+    guard decodingModulesLazily else {
+      return try constructGraph(from: graphRef, moduleAliases: moduleAliases)
+    }
+    let graph = try constructLazyGraph(from: graphRef, moduleAliases: moduleAliases)
+    ownsGraphRef = false
+    return graph
   }
 
   @_spi(Testing) public var hasBinarySwiftModuleIsFramework : Bool {
@@ -282,6 +297,13 @@ private extension String {
            api.swiftscan_cas_prune_ondisk_data != nil
   }
 
+  @_spi(Testing) public var supportsCancellableCacheFetches : Bool {
+    return api.swiftscan_cache_query_async != nil &&
+           api.swiftscan_cached_output_load_async != nil &&
+           api.swiftscan_cache_action_cancel != nil &&
+           api.swiftscan_cache_cancellation_token_dispose != nil
+  }
+
   @_spi(Testing) public var supportsCASSandbox : Bool {
     return api.swiftscan_cas_fs_builder_create != nil
   }
@@ -14,6 +14,8 @@
 
 @_implementationOnly import CSwiftScan
 import struct Foundation.Data
+import class Dispatch.DispatchGroup
+import class Foundation.NSLock
 
 // Swift Package Manager is building with `-disable-implicit-concurrency-module-import`
 // to avoid warnings on old SDKs. Explicity importing concurrency if available
@@ -131,6 +133,25 @@ public final class CachedOutput {
   }
 }
 
+/// A handle to cancel an asynchronous cache operation that is in progress.
+public final class CacheCancellationToken {
+  let ptr: swiftscan_cache_cancellation_token_t
+  private let lib: SwiftScan
+
+  init(_ ptr: swiftscan_cache_cancellation_token_t, lib: SwiftScan) {
+    self.ptr = ptr
+    self.lib = lib
+  }
+
+  public func cancel() {
+    lib.api.swiftscan_cache_action_cancel(ptr)
+  }
+
+  deinit {
+    lib.api.swiftscan_cache_cancellation_token_dispose(ptr)
+  }
+}
+
 public final class CacheReplayInstance {
   let ptr: swiftscan_cache_replay_instance_t
   private let lib: SwiftScan
@@ -308,6 +329,33 @@ public final class SwiftScanCAS {
     return try scanner.toSwiftString(casid)
   }
 
+  /// Computes the cache keys of several inputs of the same command line,
+  /// converting the command line to C strings only once.
+  ///
+  /// This is safe to call concurrently.
+  public func computeCacheKeys(commandLine: [String], indices: [Int]) throws -> [String] {
+    let casids = withArrayOfCStrings(commandLine) { commandArray in
+      indices.map { index in
+        Result {
+          try scanner.handleCASError { err_msg in
+            scanner.api.swiftscan_cache_compute_key_from_input_index(cas,
+                                                                     Int32(commandLine.count),
+                                                                     commandArray,
+                                                                     UInt32(index),
+                                                                     &err_msg)
+          }
+        }
+      }
+    }
+    // Dispose of every key, even when another one fails to convert.
+    defer {
+      for case .success(let casid) in casids {
+        scanner.api.swiftscan_string_dispose(casid)
+      }
+    }
+    return try casids.map { try scanner.toSwiftString($0.get()) }
+  }
+
   public func createReplayInstance(commandLine: [String]) throws -> CacheReplayInstance {
     let instance = try scanner.handleCASError { err_msg in
       withArrayOfCStrings(commandLine) { commandArray in
@@ -330,6 +378,57 @@ public final class SwiftScanCAS {
     return convert(compilation: result)
   }
 
+  /// Queries the cache for all of `keys` at once and blocks until every query
+  /// has finished, returning the results in the same order as `keys`.
+  ///
+  /// The queries are issued asynchronously so that their latencies overlap,
+  /// which matters most when `globally` reaches a remote cache. If the
+  /// library has no asynchronous query entry point, the keys are queried one
+  /// at a time instead.
+  public func queryCacheKeys(_ keys: [String], globally: Bool) -> [Result<CachedCompilation?, Swift.Error>] {
+    guard scanner.api.swiftscan_cache_query_async != nil else {
+      return keys.map { key in Result { try queryCacheKey(key, globally: globally) } }
+    }
+
+    class CallbackContext {
+      func retain() -> UnsafeMutableRawPointer {
+        return Unmanaged.passRetained(self).toOpaque()
+      }
+
+      let cas: SwiftScanCAS
+      let group: DispatchGroup
+      var result: Result<CachedCompilation?, Swift.Error> = .success(nil)
+      init(cas: SwiftScanCAS, group: DispatchGroup) {
+        self.cas = cas
+        self.group = group
+      }
+    }
+
+    func callbackFunc(_ context: UnsafeMutableRawPointer?, _ comp: swiftscan_cached_compilation_t?, _ error: swiftscan_string_ref_t) {
+      let obj = Unmanaged<CallbackContext>.fromOpaque(context!).takeRetainedValue()
+      if error.length != 0 {
+        if let err = try? obj.cas.scanner.toSwiftString(error) {
+          obj.result = .failure(DependencyScanningError.casError(err))
+        } else {
+          obj.result = .failure(DependencyScanningError.casError("unknown cache querying error"))
+        }
+      } else {
+        obj.result = .success(obj.cas.convert(compilation: comp))
+      }
+      // Leaving the group publishes `result` to the waiting thread.
+      obj.group.leave()
+    }
+
+    let group = DispatchGroup()
+    let contexts = keys.map { _ in CallbackContext(cas: self, group: group) }
+    for (key, context) in zip(keys, contexts) {
+      group.enter()
+      scanner.api.swiftscan_cache_query_async(cas, key.cString(using: .utf8), globally, context.retain(), callbackFunc, nil)
+    }
+    group.wait()
+    return contexts.map { $0.result }
+  }
+
   public func replayCompilation(instance: CacheReplayInstance, compilation: CachedCompilation) throws -> CacheReplayResult {
     let result = try scanner.handleCASError { err_msg in
       scanner.api.swiftscan_cache_replay_compilation(instance.ptr, compilation.ptr, &err_msg)
@@ -341,6 +440,151 @@ public final class SwiftScanCAS {
   }
 }
 
+extension SwiftScanCAS: CachedOutputFetcher {
+  public var supportsCancellableFetches: Bool {
+    scanner.supportsCancellableCacheFetches
+  }
+
+  /// Queries `key` globally and loads each output of the cached compilation
+  /// that isn't materialized in the local CAS yet.
+  public func fetchOutputs(of key: String,
+                           cancellation: CachedOutputPrefetcher.Cancellation,
+                           completion: @escaping (Result<Bool, Swift.Error>) -> Void) {
+    class LoadContext {
+      func retain() -> UnsafeMutableRawPointer {
+        return Unmanaged.passRetained(self).toOpaque()
+      }
+
+      let cas: SwiftScanCAS
+      let compilation: CachedCompilation
+      let outputs: [CachedOutput]
+      let completion: (Result<Bool, Swift.Error>) -> Void
+      private let lock = NSLock()
+      private var remaining: Int
+      private var allLoaded = true
+      private var error: Swift.Error? = nil
+      init(cas: SwiftScanCAS, compilation: CachedCompilation, outputs: [CachedOutput],
+           completion: @escaping (Result<Bool, Swift.Error>) -> Void) {
+        self.cas = cas
+        self.compilation = compilation
+        self.outputs = outputs
+        self.completion = completion
+        self.remaining = outputs.count
+      }
+
+      /// Records the result of loading one output, and reports the result of
+      /// the whole fetch once the last one has finished.
+      func finish(loaded: Bool, error: Swift.Error?) {
+        lock.lock()
+        allLoaded = allLoaded && loaded
+        self.error = self.error ?? error
+        remaining -= 1
+        let isLast = remaining == 0
+        lock.unlock()
+        guard isLast else { return }
+        if let error = self.error {
+          completion(.failure(error))
+        } else {
+          completion(.success(allLoaded))
+        }
+      }
+    }
+
+    func loadCallbackFunc(_ context: UnsafeMutableRawPointer?, _ success: Bool, _ error: swiftscan_string_ref_t) {
+      let obj = Unmanaged<LoadContext>.fromOpaque(context!).takeRetainedValue()
+      if error.length != 0 {
+        let err = (try? obj.cas.scanner.toSwiftString(error)) ?? "unknown output loading error"
+        obj.finish(loaded: false, error: DependencyScanningError.casError(err))
+      } else {
+        obj.finish(loaded: success, error: nil)
+      }
+    }
+
+    class QueryContext {
+      func retain() -> UnsafeMutableRawPointer {
+        return Unmanaged.passRetained(self).toOpaque()
+      }
+
+      let cas: SwiftScanCAS
+      let cancellation: CachedOutputPrefetcher.Cancellation
+      let completion: (Result<Bool, Swift.Error>) -> Void
+      init(cas: SwiftScanCAS, cancellation: CachedOutputPrefetcher.Cancellation,
+           completion: @escaping (Result<Bool, Swift.Error>) -> Void) {
+        self.cas = cas
+        self.cancellation = cancellation
+        self.completion = completion
+      }
+    }
+
+    func queryCallbackFunc(_ context: UnsafeMutableRawPointer?, _ comp: swiftscan_cached_compilation_t?, _ error: swiftscan_string_ref_t) {
+      let obj = Unmanaged<QueryContext>.fromOpaque(context!).takeRetainedValue()
+      let cas = obj.cas
+      if error.length != 0 {
+        let err = (try? cas.scanner.toSwiftString(error)) ?? "unknown cache querying error"
+        return obj.completion(.failure(DependencyScanningError.casError(err)))
+      }
+      // Not cached anywhere, so the job will have to compile it.
+      guard let compilation = cas.convert(compilation: comp) else {
+        return obj.completion(.success(false))
+      }
+      let outputs = compilation.filter { !$0.isMaterialized }
+      guard !outputs.isEmpty, !obj.cancellation.isCancelled else {
+        return obj.completion(.success(outputs.isEmpty))
+      }
+      let loadContext = LoadContext(cas: cas, compilation: compilation, outputs: outputs,
+                                    completion: obj.completion)
+      for output in outputs {
+        let request = PendingRequest(lib: cas.scanner, cancellation: obj.cancellation)
+        var token: swiftscan_cache_cancellation_token_t? = nil
+        cas.scanner.api.swiftscan_cached_output_load_async(output.ptr, loadContext.retain(), loadCallbackFunc, &token)
+        request.started(token)
+      }
+    }
+
+    guard !cancellation.isCancelled else { return }
+    let request = PendingRequest(lib: scanner, cancellation: cancellation)
+    var token: swiftscan_cache_cancellation_token_t? = nil
+    let context = QueryContext(cas: self, cancellation: cancellation, completion: completion)
+    scanner.api.swiftscan_cache_query_async(cas, key.cString(using: .utf8), true, context.retain(), queryCallbackFunc, &token)
+    request.started(token)
+  }
+
+  /// An asynchronous request which is registered with the cancellation of its
+  /// fetch before it starts, so that a cancellation which arrives before its
+  /// token does is applied as soon as the token is known.
+  private final class PendingRequest {
+    private let lib: SwiftScan
+    private let lock = NSLock()
+    private var token: CacheCancellationToken? = nil
+    private var cancelled = false
+
+    init(lib: SwiftScan, cancellation: CachedOutputPrefetcher.Cancellation) {
+      self.lib = lib
+      cancellation.register { self.cancel() }
+    }
+
+    func started(_ token: swiftscan_cache_cancellation_token_t?) {
+      guard let token = token else { return }
+      let cancellationToken = CacheCancellationToken(token, lib: lib)
+      lock.lock()
+      self.token = cancellationToken
+      let cancelled = self.cancelled
+      lock.unlock()
+      if cancelled {
+        cancellationToken.cancel()
+      }
+    }
+
+    private func cancel() {
+      lock.lock()
+      cancelled = true
+      let token = self.token
+      lock.unlock()
+      token?.cancel()
+    }
+  }
+}
+
 extension SwiftScanCAS: Equatable {
   static public func == (lhs: SwiftScanCAS, rhs: SwiftScanCAS) -> Bool {
     return lhs.cas == rhs.cas
@@ -65,6 +65,47 @@ extension Diagnostic.Message {
     .remark("In-process supported-compiler-features query failed (\(error)). Using fallback mechanism.")
   }
 
+  static func remark_frontend_option_table_unreadable(_ path: String, _ error: String) -> Diagnostic.Message {
+    .remark("Unable to read frontend option table '\(path)' (\(error)). Using fallback mechanism.")
+  }
+
+  static func remark_cache_query_summary(_ results: CacheQueryResults) -> Diagnostic.Message {
+    let percentage = results.keys.isEmpty ? 0 : results.hitCount * 100 / results.keys.count
+    return .remark("Compilation cache queried for \(results.keys.count) key\(results.keys.count != 1 ? "s" : ""): " +
+                   "\(results.hitCount) hit\(results.hitCount != 1 ? "s" : "") (\(percentage)%), " +
+                   "\(results.missCount) miss\(results.missCount != 1 ? "es" : "") in " +
+                   "\(results.latencyNanoseconds / 1_000_000)ms")
+  }
+
+  static func remark_cache_prefetch_summary(_ statistics: CachedOutputPrefetcher.Statistics,
+                                            maxInFlight: Int) -> Diagnostic.Message {
+    .remark("Prefetched cached outputs for \(statistics.fetched) key\(statistics.fetched != 1 ? "s" : "") " +
+            "(\(statistics.unavailable) unavailable, \(statistics.failed) failed, \(statistics.skipped) skipped, " +
+            "\(statistics.abandoned) abandoned) " +
+            "with up to \(statistics.peakInFlight) of \(maxInFlight) fetches in flight")
+  }
+
+  static func remark_cas_prune_summary(_ result: CASStorageManager.PruneResult) -> Diagnostic.Message {
+    func megabytes(_ size: Int64?) -> String {
+      size.map { "\($0 >> 20)MB" } ?? "unknown"
+    }
+    return .remark("CAS size limited to \(megabytes(result.sizeLimit)): " +
+                   "pruned from \(megabytes(result.sizeBefore)) to \(megabytes(result.sizeAfter))")
+  }
+
+  static func remark_cas_usage_summary(_ usage: CASStorageManager.Usage) -> Diagnostic.Message {
+    let outputs = usage.outputs.keys.sorted().map { kind in
+      "\(kind): \(usage.materializedOutputs[kind] ?? 0)/\(usage.outputs[kind]!)"
+    }
+    return .remark("CAS outputs by kind (local/total): [\(outputs.joined(separator: ", "))], " +
+                   "\(usage.missingKeys) key\(usage.missingKeys != 1 ? "s" : "") not cached")
+  }
+
+  static func remark_dependency_scan_overlap(_ timing: PendingDependencyScan.Timing) -> Diagnostic.Message {
+    .remark("Dependency scan took \(timing.scanNanoseconds / 1_000_000)ms, " +
+            "\(timing.overlapNanoseconds / 1_000_000)ms of which overlapped with planning")
+  }
+
   static func error_argument_not_allowed_with(arg: String, other: String) -> Diagnostic.Message {
     .error("argument '\(arg)' is not allowed with '\(other)'")
   }
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+/// A fast, non-cryptographic, streaming hash function.
+///
+/// Unlike `Swift.Hasher`, the result is the same in every process and on
+/// every platform, so it can be persisted between builds to detect changes.
+/// It must not be used where an adversary could choose the hashed data.
+///
+/// Bytes are consumed eight at a time with the block mixing of
+/// MurmurHash3's 64-bit variant.
+struct StableHasher {
+  private var state: UInt64
+  /// The bytes which have been combined but not mixed into `state` yet,
+  /// starting from the low byte.
+  private var pending: UInt64 = 0
+  private var pendingCount = 0
+  private var length: UInt64 = 0
+
+  init(seed: UInt64 = 0) {
+    self.state = seed
+  }
+
+  /// Adds the bytes of the given integer, in little-endian order.
+  mutating func combine(_ value: UInt64) {
+    guard pendingCount == 0 else {
+      withUnsafeBytes(of: value.littleEndian) { combine(bytes: $0) }
+      return
+    }
+    length &+= 8
+    mix(value)
+  }
+
+  mutating func combine(_ value: Int) {
+    combine(UInt64(UInt(bitPattern: value)))
+  }
+
+  /// Adds the length and UTF-8 bytes of the given string, so that adjacent
+  /// strings can't be confused with different ones that have the same
+  /// concatenation.
+  mutating func combine(_ string: String) {
+    var string = string
+    string.withUTF8 {
+      combine($0.count)
+      combine(bytes: UnsafeRawBufferPointer($0))
+    }
+  }
+
+  /// Adds the given bytes.
+  mutating func combine(bytes: UnsafeRawBufferPointer) {
+    var index = 0
+    // Complete a partial word first.
+    while pendingCount != 0, index < bytes.count {
+      pending |= UInt64(bytes[index]) << UInt64(pendingCount * 8)
+      pendingCount += 1
+      index += 1
+      if pendingCount == 8 {
+        mix(pending)
+        pending = 0
+        pendingCount = 0
+      }
+    }
+    while index + 8 <= bytes.count {
+      mix(UInt64(littleEndian: bytes.loadUnaligned(fromByteOffset: index, as: UInt64.self)))
+      index += 8
+    }
+    while index < bytes.count {
+      pending |= UInt64(bytes[index]) << UInt64(pendingCount * 8)
+      pendingCount += 1
+      index += 1
+    }
+    length &+= UInt64(bytes.count)
+  }
+
+  /// Returns the hash of everything that has been combined.
+  func finalize() -> UInt64 {
+    var hash = state
+    if pendingCount != 0 {
+      hash ^= Self.scramble(pending)
+    }
+    hash ^= length
+    // The MurmurHash3 finalizer.
+    hash ^= hash >> 33
+    hash &*= 0xff51_afd7_ed55_8ccd
+    hash ^= hash >> 33
+    hash &*= 0xc4ce_b9fe_1a85_ec53
+    hash ^= hash >> 33
+    return hash
+  }
+
+  private mutating func mix(_ block: UInt64) {
+    state ^= Self.scramble(block)
+    state = state.rotatedLeft(by: 27) &* 5 &+ 0x52dc_e729
+  }
+
+  private static func scramble(_ block: UInt64) -> UInt64 {
+    (block &* 0x87c3_7b91_1142_53d5).rotatedLeft(by: 31) &* 0x4cf5_ad43_2745_937f
+  }
+}
+
+extension UInt64 {
+  fileprivate func rotatedLeft(by count: UInt64) -> UInt64 {
+    (self << count) | (self >> (64 - count))
+  }
+}
@@ -181,9 +181,3 @@ extension Unicode.Scalar {
     }
   }
 }
-
-extension Character {
-  var isShellQuote: Bool {
-    return self == "\"" || self == "'"
-  }
-}
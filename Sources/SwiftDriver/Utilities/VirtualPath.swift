@@ -777,6 +777,12 @@ extension TSCBasic.FileSystem {
     try resolvingVirtualPath(path, apply: exists)
   }
 
+  /// Whether this is the local file system, which, unlike in-memory file systems used in tests,
+  /// may be read from several threads at once and memory-mapped.
+  var isLocal: Bool {
+    type(of: self) == type(of: localFileSystem)
+  }
+
   /// Retrieves the last modification time of the file referenced at the given path.
   ///
   /// If the given file path references a symbolic link, the modification time for the *linked file*
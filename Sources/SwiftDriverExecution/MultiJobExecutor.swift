@@ -15,6 +15,8 @@
 import SwiftDriver
 
 import class Dispatch.DispatchQueue
+import class Foundation.BlockOperation
+import class Foundation.Operation
 import class Foundation.OperationQueue
 import class Foundation.FileHandle
 import var Foundation.EXIT_SUCCESS
@@ -106,6 +108,9 @@ public final class MultiJobExecutor {
     /// The value of the option
     let continueBuildingAfterErrors: Bool
 
+    /// Which jobs' outputs were found in the compilation cache before the build started.
+    let cacheQueryResults: CacheQueryResults?
+
 
     init(
       argsResolver: ArgsResolver,
@@ -141,6 +146,7 @@ public final class MultiJobExecutor {
       self.diagnosticsEngine = diagnosticsEngine
       self.processType = processType
       self.testInputHandle = inputHandleOverride
+      self.cacheQueryResults = workload.cacheQueryResults
     }
 
     private static func fillInJobsAndProducers(_ workload: DriverExecutorWorkload
@@ -238,6 +244,21 @@ public final class MultiJobExecutor {
       }
     }
 
+    /// Cache hits only replay their outputs and finish quickly, unblocking
+    /// their dependents, so they go first. Misses come right after them, ahead
+    /// of the jobs that couldn't be queried, since every miss is a real
+    /// compilation on the critical path.
+    fileprivate func queuePriority(of job: Job) -> Operation.QueuePriority {
+      switch cacheQueryResults?.status(of: job) {
+      case .hit:
+        return .veryHigh
+      case .miss:
+        return .high
+      case nil:
+        return .normal
+      }
+    }
+
     fileprivate func reportSkippedJobs() {
       for job in incrementalCompilationState?.blockingConcurrentMutationToProtectedState({ $0.skippedJobs }) ?? [] {
         executorDelegate.jobSkipped(job: job)
@@ -561,9 +582,11 @@ class ExecuteJobRule: LLBuildRule {
     // execute the job asynchronously without blocking the callback thread.
     // taskIsComplete can be safely called from another thread. The only restriction
     // is we should call it after inputsAvailable is called.
-    context.jobQueue.addOperation {
+    let operation = BlockOperation {
       self.executeJob(engine)
     }
+    operation.queuePriority = context.queuePriority(of: myJob)
+    context.jobQueue.addOperation(operation)
   }
 
   private var myJob: Job {
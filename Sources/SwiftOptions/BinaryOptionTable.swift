@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import struct Foundation.Data
+import struct Foundation.URL
+
+/// A table of options in the binary format written by
+/// `makeOptions --binary-table`, which toolchains can ship next to
+/// `swift-frontend` to describe exactly the options it was built with.
+///
+/// The table is memory-mapped and read in place. It consists of:
+///
+/// * A 32-byte header: the magic `SWIFTOPT`, the format version, the number
+///   of options, a fingerprint of the option set, the size of the string pool
+///   and four reserved bytes.
+/// * One 28-byte record per option, in the order of the option IDs: the
+///   offset and length of the spelling, the kind, a reserved byte, the
+///   attributes, the alias ID, the group index, the number of arguments, two
+///   reserved bytes and the offsets of the metavariable and the help text.
+/// * A pool of NUL-terminated UTF-8 strings, like `Option.builtinStrings`.
+///
+/// All integers are little-endian. The fingerprint is the one recorded in
+/// `Options.swift` when it's generated from the same `Options.inc`. The table
+/// only describes the options from `Options.inc`, and neither it nor the
+/// fingerprint covers the driver-only options of `DriverOptions.def`.
+public struct BinaryOptionTable {
+  public enum Error: Swift.Error, Equatable {
+    case invalidFormat
+    case unsupportedVersion(UInt32)
+  }
+
+  /// The version of the format that this reader understands, which must
+  /// match `binaryTableVersion` in `makeOptions.cpp`.
+  public static let formatVersion: UInt32 = 1
+
+  private static let magic: [UInt8] = Array("SWIFTOPT".utf8)
+  private static let headerSize = 32
+  private static let recordSize = 28
+
+  private let data: Data
+
+  /// The number of options in the table.
+  public let count: Int
+
+  /// The fingerprint of the option set described by the table.
+  public let fingerprint: UInt64
+
+  private let stringsOffset: Int
+
+  /// Maps the table at the given path into memory.
+  public init(contentsOf path: String) throws {
+    try self.init(data: Data(contentsOf: URL(fileURLWithPath: path),
+                             options: .alwaysMapped))
+  }
+
+  /// Reads a table from the given bytes, checking that they are well-formed.
+  public init(data: Data) throws {
+    self.data = data
+    guard data.count >= Self.headerSize,
+          data.prefix(Self.magic.count).elementsEqual(Self.magic) else {
+      throw Error.invalidFormat
+    }
+    let version = Self.load(UInt32.self, at: 8, in: data)
+    guard version == Self.formatVersion else {
+      throw Error.unsupportedVersion(version)
+    }
+    self.count = Int(Self.load(UInt32.self, at: 12, in: data))
+    self.fingerprint = Self.load(UInt64.self, at: 16, in: data)
+    self.stringsOffset = Self.headerSize + count * Self.recordSize
+    let stringsSize = Int(Self.load(UInt32.self, at: 24, in: data))
+    guard data.count == stringsOffset + stringsSize else {
+      throw Error.invalidFormat
+    }
+    for index in 0..<count {
+      let end = Int(field(UInt32.self, at: 0, of: index)) +
+                Int(field(UInt16.self, at: 4, of: index))
+      guard end <= stringsSize else { throw Error.invalidFormat }
+    }
+  }
+
+  /// Whether the table describes the same options as the ones compiled into
+  /// `Options.swift`.
+  public var matchesBuiltinOptions: Bool {
+    fingerprint == Option.builtinFingerprint
+  }
+
+  /// The spelling of the option at the given index.
+  public func spelling(at index: Int) -> String {
+    let offset = Int(field(UInt32.self, at: 0, of: index))
+    let length = Int(field(UInt16.self, at: 4, of: index))
+    let start = data.startIndex + stringsOffset + offset
+    return String(decoding: data[start..<start + length], as: UTF8.self)
+  }
+
+  /// The kind of the option at the given index, if it is a known one.
+  public func kind(at index: Int) -> Option.Kind? {
+    let kinds: [Option.Kind] = [
+      .input, .flag, .joined, .separate, .joinedOrSeparate, .remaining,
+      .commaJoined, .multiArg,
+    ]
+    let code = Int(field(UInt8.self, at: 6, of: index))
+    return code < kinds.count ? kinds[code] : nil
+  }
+
+  /// The attributes of the option at the given index.
+  public func attributes(at index: Int) -> OptionAttributes {
+    OptionAttributes(rawValue: UInt(field(UInt32.self, at: 8, of: index)))
+  }
+
+  /// The spellings of all of the options accepted by the frontend.
+  public var frontendSpellings: Set<String> {
+    var result = Set<String>()
+    for index in 0..<count where attributes(at: index).contains(.frontend) {
+      result.insert(spelling(at: index))
+    }
+    return result
+  }
+
+  /// Reads a field at the given offset in the record of an option.
+  private func field<T: FixedWidthInteger>(_ type: T.Type, at offset: Int,
+                                           of index: Int) -> T {
+    precondition(index >= 0 && index < count, "option index out of range")
+    return Self.load(type, at: Self.headerSize + index * Self.recordSize + offset,
+                     in: data)
+  }
+
+  private static func load<T: FixedWidthInteger>(_ type: T.Type, at offset: Int,
+                                                  in data: Data) -> T {
+    data.withUnsafeBytes {
+      T(littleEndian: $0.loadUnaligned(fromByteOffset: offset, as: T.self))
+    }
+  }
+}
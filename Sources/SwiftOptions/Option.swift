@@ -11,7 +11,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 //===----------------------------------------------------------------------===//
+
+import class Foundation.NSLock
+
 /// Attributes that describe where and how the option is used.
+///
+/// makeOptions emits these raw values into the generated option tables, so
+/// they must be kept in sync with `attributesMask` in `makeOptions.cpp`.
 public struct OptionAttributes: OptionSet, Hashable {
   public let rawValue: UInt
 
@@ -63,88 +69,224 @@ public struct Option {
     case multiArg
   }
 
-  /// The spelling of the option, including any leading dashes.
-  public let spelling: String
-
-  /// The kind of option, which determines how it is parsed.
-  public let kind: Kind
-
-  /// The option that this aliases, if any, as a closure that produces the
-  /// valid.
-  private let aliasFunction: (() -> Option)?
-
-  /// The attributes that describe where and how the attribute is used.
-  public let attributes: OptionAttributes
-
-  /// For options that have an argument, the name of the metavariable to
-  /// use in documentation.
-  public let metaVar: String?
-
-  /// Help text to display with this option.
-  public let helpText: String?
+  /// The dense identifier of this option. Identifiers below
+  /// `Option.builtinCount` index the option tables generated by makeOptions
+  /// in `Options.swift`; the rest refer to options created at runtime.
+  public let id: UInt16
 
-  /// The group in which this option occurs.
-  public let group: Group?
+  /// The identifier shared by all the options with this spelling: that of
+  /// the built-in option with the spelling if there is one, or else that of
+  /// the first option created at runtime with it. Options are compared,
+  /// hashed and looked up by this identifier, so that they behave as if they
+  /// were compared by spelling.
+  let spellingID: UInt16
 
-  /// The number of arguments for MultiArg options.
-  public let numArgs: UInt
+  /// Creates a handle for the built-in option with the given identifier.
+  init(id: UInt16) {
+    self.id = id
+    self.spellingID = id
+  }
 
+  /// Creates a new option at runtime. Options that are created with the same
+  /// properties share the same identifier, and options with the same spelling
+  /// compare equal, whether they are built in or not.
   public init(_ spelling: String, _ kind: Kind,
               alias: Option? = nil,
               attributes: OptionAttributes = [], metaVar: String? = nil,
               helpText: String? = nil,
               group: Group? = nil,
               numArgs: UInt = 0) {
-    self.spelling = spelling
-    self.kind = kind
-    self.aliasFunction = alias.map { aliasOption in { aliasOption }}
-    self.attributes = attributes
-    self.metaVar = metaVar
-    self.helpText = helpText
-    self.group = group
-    self.numArgs = numArgs
+    (self.id, self.spellingID) = Option.runtimeOptions.register(
+      RuntimeOptionRegistry.Entry(
+        spelling: spelling, kind: kind, alias: alias, attributes: attributes,
+        metaVar: metaVar, helpText: helpText, group: group, numArgs: numArgs))
   }
 }
 
 extension Option: Equatable {
   public static func ==(lhs: Option, rhs: Option) -> Bool {
-    return lhs.spelling == rhs.spelling
+    return lhs.spellingID == rhs.spellingID
   }
 }
 
 extension Option: Hashable {
   public func hash(into hasher: inout Hasher) {
-    hasher.combine(spelling)
+    hasher.combine(spellingID)
   }
 }
 
 extension Option {
-  /// Whether this option is an alias.
-  public var isAlias: Bool { aliasFunction != nil }
+  /// Whether this option was generated by makeOptions, as opposed to being
+  /// created at runtime.
+  var isBuiltin: Bool { Int(id) < Option.builtinCount }
+
+  /// The runtime entry for an option which isn't built in.
+  private var runtimeEntry: RuntimeOptionRegistry.Entry {
+    Option.runtimeOptions.entry(for: id)
+  }
+
+  /// The spelling of the option, including any leading dashes.
+  public var spelling: String {
+    isBuiltin ? Option.builtinSpellings[Int(id)] : runtimeEntry.spelling
+  }
+
+  /// The number of UTF-8 code units in the spelling of the option.
+  var spellingLength: Int {
+    guard isBuiltin else { return runtimeEntry.spelling.utf8.count }
+    return Int(Option.builtinSpellingLengths[Int(id)])
+  }
+
+  /// The UTF-8 code units of the spelling of a built-in option, which point
+  /// into `builtinStrings` and so remain valid for the lifetime of the
+  /// process.
+  var builtinSpellingUTF8: UnsafeBufferPointer<UInt8> {
+    UnsafeBufferPointer(
+      start: Option.builtinStrings.utf8Start
+        + Int(Option.builtinSpellingOffsets[Int(id)]),
+      count: Int(Option.builtinSpellingLengths[Int(id)]))
+  }
+
+  /// The kind of option, which determines how it is parsed.
+  public var kind: Kind {
+    isBuiltin ? Option.builtinKinds[Int(id)] : runtimeEntry.kind
+  }
+
+  /// The attributes that describe where and how the attribute is used.
+  public var attributes: OptionAttributes {
+    guard isBuiltin else { return runtimeEntry.attributes }
+    return OptionAttributes(rawValue: UInt(Option.builtinAttributes[Int(id)]))
+  }
+
+  /// For options that have an argument, the name of the metavariable to
+  /// use in documentation.
+  public var metaVar: String? {
+    guard isBuiltin else { return runtimeEntry.metaVar }
+    return Option.builtinString(at: Option.builtinMetaVarOffsets[Int(id)])
+  }
+
+  /// Help text to display with this option.
+  public var helpText: String? {
+    guard isBuiltin else { return runtimeEntry.helpText }
+    return Option.builtinString(at: Option.builtinHelpTextOffsets[Int(id)])
+  }
+
+  /// The group in which this option occurs.
+  public var group: Group? {
+    isBuiltin ? Option.builtinGroups[Int(id)] : runtimeEntry.group
+  }
+
+  /// The number of arguments for MultiArg options.
+  public var numArgs: UInt {
+    isBuiltin ? UInt(Option.builtinNumArgs[Int(id)]) : runtimeEntry.numArgs
+  }
 
   /// Retrieves the alias option, if there is one.
   public var alias: Option? {
-    aliasFunction.map { function in function() }
+    guard isBuiltin else { return runtimeEntry.alias }
+    let aliasID = Option.builtinAliases[Int(id)]
+    return aliasID == Option.noAliasID ? nil : Option(id: aliasID)
+  }
+
+  /// The value of `builtinAliases` for options that aren't aliases.
+  static let noAliasID = UInt16.max
+
+  /// The offset used in the generated string tables for absent strings.
+  static let noStringOffset = UInt32.max
+
+  /// Materializes the NUL-terminated string at the given offset in
+  /// `builtinStrings`, if there is one.
+  static func builtinString(at offset: UInt32) -> String? {
+    guard offset != noStringOffset else { return nil }
+    return String(cString: builtinStrings.utf8Start + Int(offset))
+  }
+
+  /// The spellings of the options generated by makeOptions, materialized
+  /// once so that `spelling` doesn't have to decode them on every access.
+  static let builtinSpellings: [String] = allOptions.map {
+    String(decoding: $0.builtinSpellingUTF8, as: UTF8.self)
+  }
+
+  /// The IDs of the options generated by makeOptions, by spelling.
+  static let builtinIDsBySpelling: [String: UInt16] = Dictionary(
+    uniqueKeysWithValues: builtinSpellings.enumerated().map { ($1, UInt16($0)) })
+
+  /// All of the options generated by makeOptions, in the order of their IDs.
+  public static let allOptions: [Option] = (0..<builtinCount).map {
+    Option(id: UInt16($0))
+  }
+
+  /// A fingerprint of the options makeOptions generated from `Options.inc`,
+  /// which changes whenever their IDs or definitions do. The driver-only
+  /// options, which follow them, don't contribute to it.
+  public static var builtinOptionsFingerprint: UInt64 { builtinFingerprint }
+}
+
+extension Option {
+  /// Whether this option is an alias.
+  public var isAlias: Bool { alias != nil }
+
+  /// Whether this option has all of the given attributes.
+  ///
+  /// The attributes of built-in options are looked up in the per-attribute
+  /// bitsets generated by makeOptions, one bit test per attribute.
+  public func hasAttributes(_ attributes: OptionAttributes) -> Bool {
+    guard isBuiltin else { return self.attributes.isSuperset(of: attributes) }
+    var remaining = attributes.rawValue
+    while remaining != 0 {
+      guard Option.builtinAttributeBitsets[remaining.trailingZeroBitCount].contains(self) else {
+        return false
+      }
+      remaining &= remaining - 1
+    }
+    return true
   }
 
   /// Whether this option's help is hidden under normal circumstances.
-  public var isHelpHidden: Bool { attributes.contains(.helpHidden) }
+  public var isHelpHidden: Bool { hasAttributes(.helpHidden) }
 
   /// Whether this option can affect an incremental build.
   public var affectsIncrementalBuild: Bool {
-    !attributes.contains(.doesNotAffectIncrementalBuild)
+    !hasAttributes(.doesNotAffectIncrementalBuild)
   }
 
   /// Retrieves the canonical option, to be used for comparisons.
   public var canonical: Option {
+    if isBuiltin {
+      return Option(id: Option.builtinCanonicalIDs[Int(id)])
+    }
     guard let alias = alias else { return self }
     return alias.canonical
   }
 }
 
+extension Option.Group {
+  /// The display name of the group.
+  public var name: String {
+    Option.builtinString(at: Option.builtinGroupNameOffsets[index])!
+  }
+
+  /// The help text for the group, if there is any.
+  public var helpText: String? {
+    Option.builtinString(at: Option.builtinGroupHelpTextOffsets[index])
+  }
+
+  /// The built-in options in this group, in the order of their IDs.
+  public var options: [Option] {
+    Option.builtinIDsByGroup[Option.builtinGroupRanges[index]].map {
+      Option(id: $0)
+    }
+  }
+
+  /// The number of option groups.
+  static var count: Int { Option.builtinGroupRanges.count }
+}
+
 extension Option {
   /// Whether this option is accepted by a driver of the given kind.
   public func isAccepted(by driverKind: DriverKind) -> Bool {
+    if isBuiltin {
+      return OptionBitSet.builtinOptions(acceptedBy: driverKind).contains(self)
+    }
     switch driverKind {
     case .batch:
       return attributes.isDisjoint(with: [.noDriver, .noBatch])
@@ -153,3 +295,57 @@ extension Option {
     }
   }
 }
+
+/// Storage for the options created at runtime through `Option.init`, which
+/// continue the dense identifiers of the built-in options.
+///
+/// Options created with the same properties share an entry, so the registry
+/// only grows with the number of distinct options a client creates.
+final class RuntimeOptionRegistry {
+  struct Entry: Hashable {
+    let spelling: String
+    let kind: Option.Kind
+    let alias: Option?
+    let attributes: OptionAttributes
+    let metaVar: String?
+    let helpText: String?
+    let group: Option.Group?
+    let numArgs: UInt
+  }
+
+  private let lock = NSLock()
+  private var entries: [Entry] = []
+  /// The identifiers of the entries.
+  private var idsByEntry: [Entry: UInt16] = [:]
+  /// The `Option.spellingID` of the spellings of the entries.
+  private var spellingIDsBySpelling: [String: UInt16] = [:]
+
+  /// Returns the identifier of the given option and that of its spelling,
+  /// registering it if needed.
+  func register(_ entry: Entry) -> (id: UInt16, spellingID: UInt16) {
+    lock.lock()
+    defer { lock.unlock() }
+    if let existing = idsByEntry[entry] {
+      return (existing, spellingIDsBySpelling[entry.spelling]!)
+    }
+    let id = Option.builtinCount + entries.count
+    precondition(id < Int(Option.noAliasID), "too many options")
+    let spellingID = Option.builtinIDsBySpelling[entry.spelling]
+      ?? spellingIDsBySpelling[entry.spelling]
+      ?? UInt16(id)
+    entries.append(entry)
+    idsByEntry[entry] = UInt16(id)
+    spellingIDsBySpelling[entry.spelling] = spellingID
+    return (UInt16(id), spellingID)
+  }
+
+  func entry(for id: UInt16) -> Entry {
+    lock.lock()
+    defer { lock.unlock() }
+    return entries[Int(id) - Option.builtinCount]
+  }
+}
+
+extension Option {
+  static let runtimeOptions = RuntimeOptionRegistry()
+}
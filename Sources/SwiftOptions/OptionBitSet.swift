@@ -0,0 +1,136 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+/// A set of options, stored as a packed bitset indexed by option ID.
+///
+/// makeOptions precomputes these for the built-in options accepted by each
+/// kind of driver and for the built-in options with each attribute, so that
+/// membership checks and filters over many options are word-wise bit
+/// operations.
+public struct OptionBitSet: Equatable {
+  /// The bits of the set, with the option with ID `n` stored in bit `n % 64`
+  /// of `words[n / 64]`. Missing trailing words are all zeroes.
+  private(set) var words: [UInt64]
+
+  /// Creates an empty set.
+  public init() {
+    self.words = []
+  }
+
+  init(words: [UInt64]) {
+    self.words = words
+  }
+
+  /// Creates a set containing the given options.
+  public init<S: Sequence>(_ options: S) where S.Element == Option {
+    self.init()
+    for option in options {
+      insert(option)
+    }
+  }
+
+  public static func ==(lhs: OptionBitSet, rhs: OptionBitSet) -> Bool {
+    let count = max(lhs.words.count, rhs.words.count)
+    return (0..<count).allSatisfy { lhs.word($0) == rhs.word($0) }
+  }
+
+  /// The word at the given index, or zero if it is past the stored words.
+  private func word(_ index: Int) -> UInt64 {
+    index < words.count ? words[index] : 0
+  }
+
+  /// Whether the set contains no options.
+  public var isEmpty: Bool {
+    words.allSatisfy { $0 == 0 }
+  }
+
+  /// Whether the set contains the given option.
+  public func contains(_ option: Option) -> Bool {
+    let (index, bit) = Int(option.spellingID).quotientAndRemainder(dividingBy: 64)
+    return word(index) & (1 << UInt64(bit)) != 0
+  }
+
+  /// Adds the given option to the set.
+  public mutating func insert(_ option: Option) {
+    let (index, bit) = Int(option.spellingID).quotientAndRemainder(dividingBy: 64)
+    if index >= words.count {
+      words.append(contentsOf: repeatElement(0, count: index - words.count + 1))
+    }
+    words[index] |= 1 << UInt64(bit)
+  }
+
+  /// Removes the given option from the set.
+  public mutating func remove(_ option: Option) {
+    let (index, bit) = Int(option.spellingID).quotientAndRemainder(dividingBy: 64)
+    guard index < words.count else { return }
+    words[index] &= ~(1 << UInt64(bit))
+  }
+
+  /// The options in either this set or the other one.
+  public func union(_ other: OptionBitSet) -> OptionBitSet {
+    OptionBitSet(words: (0..<max(words.count, other.words.count)).map {
+      word($0) | other.word($0)
+    })
+  }
+
+  /// The options in both this set and the other one.
+  public func intersection(_ other: OptionBitSet) -> OptionBitSet {
+    OptionBitSet(words: (0..<min(words.count, other.words.count)).map {
+      words[$0] & other.words[$0]
+    })
+  }
+
+  /// The options in this set but not in the other one.
+  public func subtracting(_ other: OptionBitSet) -> OptionBitSet {
+    OptionBitSet(words: words.indices.map { words[$0] & ~other.word($0) })
+  }
+
+  /// The options in the set, in the order of their IDs.
+  public var options: [Option] {
+    var result: [Option] = []
+    for (index, word) in words.enumerated() {
+      var remaining = word
+      while remaining != 0 {
+        let bit = remaining.trailingZeroBitCount
+        result.append(Option(id: UInt16(index * 64 + bit)))
+        remaining &= remaining - 1
+      }
+    }
+    return result
+  }
+}
+
+extension OptionBitSet {
+  /// The built-in options accepted by a driver of the given kind.
+  public static func builtinOptions(acceptedBy driverKind: DriverKind) -> OptionBitSet {
+    switch driverKind {
+    case .batch:
+      return Option.builtinBatchDriverOptions
+    case .interactive:
+      return Option.builtinInteractiveDriverOptions
+    }
+  }
+
+  /// The built-in options which have all of the given attributes.
+  public static func builtinOptions(with attributes: OptionAttributes) -> OptionBitSet {
+    var result: OptionBitSet? = nil
+    var remaining = attributes.rawValue
+    while remaining != 0 {
+      let bitset = Option.builtinAttributeBitsets[remaining.trailingZeroBitCount]
+      result = result.map { $0.intersection(bitset) } ?? bitset
+      remaining &= remaining - 1
+    }
+    return result ?? OptionBitSet(Option.allOptions)
+  }
+}
@@ -28,7 +28,7 @@ public enum OptionParseError : Error, Equatable, DiagnosticData {
     case let .unsupportedOption(index: _, argument: arg, option: option, currentDriverKind: driverKind):
       // TODO: This logic to choose the recommended kind is copied from the C++
       // driver and could be improved.
-      let recommendedDriverKind: DriverKind = option.attributes.contains(.noBatch) ? .interactive : .batch
+      let recommendedDriverKind: DriverKind = option.hasAttributes(.noBatch) ? .interactive : .batch
       return "option '\(arg)' is not supported by '\(driverKind.usage)'; did you mean to use '\(recommendedDriverKind.usage)'?"
     }
   }
@@ -40,10 +40,29 @@ extension OptionTable {
   /// Throws an error if the command line contains any errors.
   public func parse(_ arguments: [String],
                     for driverKind: DriverKind, delayThrows: Bool = false) throws -> ParsedOptions {
-    var trie = PrefixTrie<Option>()
-    // Add all options, ignoring the .noDriver ones
-    for opt in options where !opt.attributes.contains(.noDriver) {
-      trie[opt.spelling] = opt
+    // The built-in options are matched using a table generated ahead of time
+    // by makeOptions; only a customized set of options needs a trie.
+    var trie: PrefixTrie<Option>? = nil
+    if !usesBuiltinOptions {
+      var customTrie = PrefixTrie<Option>()
+      // Add all options, ignoring the .noDriver ones
+      for opt in options where !opt.hasAttributes(.noDriver) {
+        customTrie[opt.spelling] = opt
+      }
+      trie = customTrie
+    }
+    func match(_ argument: String) -> Option? {
+      if let trie = trie {
+        return trie[argument]
+      }
+      return Option.driverPrefixTable.longestPrefixMatch(argument)
+    }
+
+    // The matched option's spelling is a prefix of the argument, so only the
+    // spelling's length is needed to split off the rest of the argument.
+    func text(of argument: String, after option: Option) -> Substring {
+      argument[argument.utf8.index(argument.startIndex,
+                                   offsetBy: option.spellingLength)...]
     }
 
     var parsedOptions = ParsedOptions()
@@ -82,7 +101,7 @@ extension OptionTable {
       // match -- if the option is a `.flag`, we'll explicitly check to see if
       // there's an unmatched suffix at the end, and pop an error. Otherwise,
       // we'll treat the unmatched suffix as the argument to the option.
-      guard let option = trie[argument] else {
+      guard let option = match(argument) else {
         if delayThrows {
           parsedOptions.addUnknownFlag(index: index - 1, argument: argument)
           continue
@@ -112,14 +131,14 @@ extension OptionTable {
       case .commaJoined:
         // Comma-separated list of arguments follows the option spelling.
         try verifyOptionIsAcceptedByDriverKind()
-        let rest = argument.dropFirst(option.spelling.count)
+        let rest = text(of: argument, after: option)
         parsedOptions.addOption(
           option,
           argument: .multiple(rest.split(separator: ",").map { String($0) }))
 
       case .flag:
         // Make sure there was no extra text.
-        if argument != option.spelling {
+        if argument.utf8.count != option.spellingLength {
           throw OptionParseError.unknownOption(
             index: index - 1, argument: argument)
         }
@@ -131,12 +150,12 @@ extension OptionTable {
         try verifyOptionIsAcceptedByDriverKind()
         parsedOptions.addOption(
           option,
-          argument: .single(String(argument.dropFirst(option.spelling.count))))
+          argument: .single(String(text(of: argument, after: option))))
 
       case .joinedOrSeparate:
         // Argument text follows the option spelling.
         try verifyOptionIsAcceptedByDriverKind()
-        let arg = argument.dropFirst(option.spelling.count)
+        let arg = text(of: argument, after: option)
         if !arg.isEmpty {
           parsedOptions.addOption(option, argument: .single(String(arg)))
           break
@@ -151,7 +170,7 @@ extension OptionTable {
         index += 1
 
       case .remaining:
-        if argument != option.spelling {
+        if argument.utf8.count != option.spellingLength {
           throw OptionParseError.unknownOption(
             index: index - 1, argument: argument)
         }
@@ -160,7 +179,7 @@ extension OptionTable {
         index = arguments.endIndex
 
       case .separate:
-        if argument != option.spelling {
+        if argument.utf8.count != option.spellingLength {
           throw OptionParseError.unknownOption(
             index: index - 1, argument: argument)
         }
@@ -175,7 +194,7 @@ extension OptionTable {
         index += 1
 
       case .multiArg:
-        if argument != option.spelling {
+        if argument.utf8.count != option.spellingLength {
           throw OptionParseError.unknownOption(
             index: index - 1, argument: argument)
         }
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+/// A flattened, array-backed alternative to a `PrefixTrie<Option>` for the
+/// built-in options. `makeOptions` generates one of these in `Options.swift`,
+/// so matching an argument against the option spellings doesn't need to build
+/// a trie first.
+///
+/// The spellings themselves live in `Option.builtinStrings`, where they are
+/// stored first and in sorted order, so lookups only touch the start of the
+/// string pool.
+///
+/// The spellings are sorted by their UTF-8 code units. For a given argument,
+/// the last spelling ordered at or before it is either the longest spelling
+/// that prefixes the argument, or it shares some common prefix with the
+/// argument. In the latter case, the longest matching spelling (if any) is
+/// the closest of its own prefixes that fits within that common prefix, which
+/// is found by following the `parents` links.
+///
+/// Lookup is O(log(n) * m + p) with `n` representing the number of spellings,
+/// `m` the length of the argument and `p` the length of the chain of
+/// spellings that prefix one another.
+struct OptionPrefixTable {
+  /// The IDs of the options, sorted by the UTF-8 code units of their
+  /// spellings.
+  let optionIDs: [UInt16]
+
+  /// For each entry in `optionIDs`, the index of the entry whose spelling is
+  /// its longest proper prefix, or -1 if there is none.
+  let parents: [Int16]
+
+  /// The UTF-8 code units of the spelling of the entry at the given index.
+  private func spelling(at index: Int) -> UnsafeBufferPointer<UInt8> {
+    Option(id: optionIDs[index]).builtinSpellingUTF8
+  }
+
+  /// Retrieves the option whose spelling is the longest prefix of the given
+  /// argument, if there is one.
+  func longestPrefixMatch(_ argument: String) -> Option? {
+    var argument = argument
+    return argument.withUTF8 { (argumentBytes: UnsafeBufferPointer<UInt8>) -> Option? in
+      // Find the last spelling ordered at or before the argument.
+      var low = 0
+      var high = optionIDs.count
+      while low < high {
+        let mid = (low + high) / 2
+        if Self.compare(spelling(at: mid), argumentBytes) <= 0 {
+          low = mid + 1
+        } else {
+          high = mid
+        }
+      }
+
+      var index = low - 1
+      guard index >= 0 else { return nil }
+
+      // Walk up that spelling's chain of prefixes until reaching one which
+      // also prefixes the argument.
+      let commonLength = Self.commonPrefixLength(spelling(at: index), argumentBytes)
+      while index >= 0 && spelling(at: index).count > commonLength {
+        index = Int(parents[index])
+      }
+      return index >= 0 ? Option(id: optionIDs[index]) : nil
+    }
+  }
+
+  /// Compares the UTF-8 code units of a spelling with those of an argument,
+  /// returning a negative value, zero or a positive value if the spelling is
+  /// ordered before, the same as or after the argument.
+  private static func compare(_ spelling: UnsafeBufferPointer<UInt8>,
+                              _ argument: UnsafeBufferPointer<UInt8>) -> Int {
+    for (lhs, rhs) in zip(spelling, argument) where lhs != rhs {
+      return lhs < rhs ? -1 : 1
+    }
+    return spelling.count - argument.count
+  }
+
+  /// The number of leading UTF-8 code units shared by a spelling and an
+  /// argument.
+  private static func commonPrefixLength(
+    _ spelling: UnsafeBufferPointer<UInt8>, _ argument: UnsafeBufferPointer<UInt8>
+  ) -> Int {
+    let maxLength = min(spelling.count, argument.count)
+    var length = 0
+    while length < maxLength && spelling[length] == argument[length] {
+      length += 1
+    }
+    return length
+  }
+}
@@ -15,7 +15,14 @@ public struct OptionTable {
   public init() { }
 
   /// Retrieve the options.
-  public var options: [Option] = Option.allOptions
+  public var options: [Option] = Option.allOptions {
+    didSet { usesBuiltinOptions = false }
+  }
+
+  /// Whether `options` are still the built-in options, which can be matched
+  /// using the generated `Option.driverPrefixTable`.
+  var usesBuiltinOptions = true
+
   public lazy var groupMap: [Option.Group: [Option]] = {
     var map = [Option.Group: [Option]]()
     for opt in options {
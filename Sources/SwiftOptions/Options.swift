@@ -14,2107 +14,12855 @@
 //
 // NOTE: Generated file, do not edit!
 //
-// This file is generated from 'apple/swift:include/swift/Option/Options.td'.
+// This file is generated from 'apple/swift:include/swift/Option/Options.td'
+// and 'Sources/makeOptions/DriverOptions.def'.
 // Please see README.md#rebuilding-optionsswift for details
 //
 //===----------------------------------------------------------------------===//
 
 extension Option {
-  public static let INPUT: Option = Option("<input>", .input, attributes: [.argumentIsPath])
-  public static let HASHHASHHASH: Option = Option("-###", .flag, alias: Option.driverPrintJobs)
-  public static let abi: Option = Option("-abi", .flag, attributes: [.noDriver], helpText: "Dumping ABI interface")
-  public static let abi_: Option = Option("--abi", .flag, alias: Option.abi, attributes: [.noDriver], helpText: "Dumping ABI interface")
-  public static let abortOnModuleFail: Option = Option("-abort-on-module-fail", .flag, attributes: [.noDriver], helpText: "Abort if a module failed to load")
-  public static let abortOnModuleFail_: Option = Option("--abort-on-module-fail", .flag, alias: Option.abortOnModuleFail, attributes: [.noDriver], helpText: "Abort if a module failed to load")
-  public static let accessNotesPathEQ: Option = Option("-access-notes-path=", .joined, alias: Option.accessNotesPath, attributes: [.frontend, .argumentIsPath])
-  public static let accessNotesPath: Option = Option("-access-notes-path", .separate, attributes: [.frontend, .argumentIsPath], helpText: "Specify YAML file to override attributes on Swift declarations in this module")
-  public static let activePlatformAvailabilityOnly: Option = Option("-active-platform-availability-only", .flag, attributes: [], helpText: "Only emit availability metadata for platforms that are active according to the target")
-  public static let aliasModuleNamesInModuleInterface: Option = Option("-alias-module-names-in-module-interface", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "When emitting a module interface, disambiguate modules using distinct alias names")
-  public static let allowAvailabilityPlatforms: Option = Option("-allow-availability-platforms", .separate, attributes: [], metaVar: "<platforms>", helpText: "Restrict availability metadata to the given platforms, e.g. 'macOS,Swift'")
-  public static let allowNonResilientAccess: Option = Option("-allow-non-resilient-access", .flag, attributes: [.frontend], helpText: "Ensures all contents are generated besides exportable decls in the binary module, so non-resilient access can be allowed")
-  public static let allowableClient: Option = Option("-allowable-client", .separate, attributes: [.frontend, .moduleInterface], metaVar: "<vers>", helpText: "Module names that are allowed to import this module")
-  public static let alwaysCompileOutputFiles: Option = Option("-always-compile-output-files", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Always compile output files even it might not change the results")
-  public static let alwaysRebuildModuleDependencies: Option = Option("-always-rebuild-module-dependencies", .flag, attributes: [.helpHidden], helpText: "Always rebuild module dependencies")
-  public static let analyzeRequestEvaluator: Option = Option("-analyze-request-evaluator", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print out request evaluator cache statistics at the end of the compilation job")
-  public static let analyzeRequirementMachine: Option = Option("-analyze-requirement-machine", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print out requirement machine statistics at the end of the compilation job")
-  public static let apiDiffDataDir: Option = Option("-api-diff-data-dir", .separate, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>", helpText: "Load platform and version specific API migration data files from <path>. Ignored if -api-diff-data-file is specified.")
-  public static let apiDiffDataFile: Option = Option("-api-diff-data-file", .separate, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>", helpText: "API migration data is from <path>")
-  public static let enableAppExtensionLibrary: Option = Option("-application-extension-library", .flag, attributes: [.frontend, .noInteractive], helpText: "Restrict code to those available for App Extension Libraries")
-  public static let enableAppExtension: Option = Option("-application-extension", .flag, attributes: [.frontend, .noInteractive], helpText: "Restrict code to those available for App Extensions")
-  public static let AssertConfig: Option = Option("-assert-config", .separate, attributes: [.frontend, .moduleInterface], helpText: "Specify the assert_configuration replacement. Possible values are Debug, Release, Unchecked, DisableReplacement.")
-  public static let AssumeSingleThreaded: Option = Option("-assume-single-threaded", .flag, attributes: [.helpHidden, .frontend], helpText: "Assume that code will be executed in a single-threaded environment")
-  public static let autoBridgingHeaderChaining: Option = Option("-auto-bridging-header-chaining", .flag, attributes: [.helpHidden, .frontend], helpText: "Automatically chaining all the bridging headers")
-  public static let autolinkForceLoad: Option = Option("-autolink-force-load", .flag, attributes: [.helpHidden, .frontend, .moduleInterface], helpText: "Force ld to link against this module even if no symbols are used")
-  public static let autolinkLibrary: Option = Option("-autolink-library", .separate, attributes: [.frontend, .noDriver], helpText: "Add dependent library")
-  public static let avoidEmitModuleSourceInfo: Option = Option("-avoid-emit-module-source-info", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "don't emit Swift source info file")
-  public static let avoidLocation: Option = Option("-avoid-location", .flag, attributes: [.noDriver], helpText: "Avoid serializing the file paths of SDK nodes.")
-  public static let avoidLocation_: Option = Option("--avoid-location", .flag, alias: Option.avoidLocation, attributes: [.noDriver], helpText: "Avoid serializing the file paths of SDK nodes.")
-  public static let avoidToolArgs: Option = Option("-avoid-tool-args", .flag, attributes: [.noDriver], helpText: "Avoid serializing the arguments for invoking the tool.")
-  public static let avoidToolArgs_: Option = Option("--avoid-tool-args", .flag, alias: Option.avoidToolArgs, attributes: [.noDriver], helpText: "Avoid serializing the arguments for invoking the tool.")
-  public static let backupModuleInterfacePathEQ: Option = Option("-backup-module-interface-path=", .joined, alias: Option.backupModuleInterfacePath, attributes: [.frontend, .noDriver, .cacheInvariant])
-  public static let backupModuleInterfacePath: Option = Option("-backup-module-interface-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "Directory of module interfaces as backups to those from SDKs")
-  public static let badFileDescriptorRetryCount: Option = Option("-bad-file-descriptor-retry-count", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Number of retrying opening a file if previous open returns a bad file descriptor error.")
-  public static let baselineDir: Option = Option("-baseline-dir", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "The path to a directory containing baseline files: macos.json, iphoneos.json, appletvos.json, watchos.json, and iosmac.json")
-  public static let baselinePath: Option = Option("-baseline-path", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "The path to the Json file that we should use as the baseline")
-  public static let BFEQ: Option = Option("-BF=", .joined, alias: Option.BF, attributes: [.noDriver])
-  public static let BF: Option = Option("-BF", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "add a directory to the baseline framework search path")
-  public static let BIEQ: Option = Option("-BI=", .joined, alias: Option.BI, attributes: [.noDriver])
-  public static let BI: Option = Option("-BI", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "add a module for baseline input")
-  public static let blockAvailabilityPlatforms: Option = Option("-block-availability-platforms", .separate, attributes: [], metaVar: "<platforms>", helpText: "Remove the given platforms from symbol graph availability metadata, e.g. 'macOS,Swift'")
-  public static let blockListFile: Option = Option("-blocklist-file", .separate, attributes: [.frontend, .noDriver, .argumentIsPath], metaVar: "<path>", helpText: "The path to a blocklist configuration file")
-  public static let breakageAllowlistPath: Option = Option("-breakage-allowlist-path", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "An allowlist of breakages to not complain about")
-  public static let bridgingHeaderDirectoryForPrint: Option = Option("-bridging-header-directory-for-print", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<path>", helpText: "Directory for bridging header to be printed in compatibility header")
-  public static let bridgingHeaderPchKey: Option = Option("-bridging-header-pch-key", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Cache Key for bridging header pch")
-  public static let bsdk: Option = Option("-bsdk", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "path to the baseline SDK to import frameworks")
-  public static let buildIdEQ: Option = Option("-build-id=", .joined, alias: Option.buildId, attributes: [])
-  public static let buildId: Option = Option("-build-id", .joinedOrSeparate, attributes: [], metaVar: "<build-id>", helpText: "Specify the build ID argument passed to the linker")
-  public static let buildModuleFromParseableInterface: Option = Option("-build-module-from-parseable-interface", .flag, alias: Option.compileModuleFromInterface, attributes: [.helpHidden, .frontend, .noDriver], group: .modes)
-  public static let bypassBatchModeChecks: Option = Option("-bypass-batch-mode-checks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Bypass checks for batch-mode errors.")
-  public static let bypassResilience: Option = Option("-bypass-resilience-checks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Ignore all checks for module resilience.")
-  public static let cacheCompileJob: Option = Option("-cache-compile-job", .flag, attributes: [.frontend], helpText: "Enable compiler caching")
-  public static let cacheDisableReplay: Option = Option("-cache-disable-replay", .flag, attributes: [.frontend, .cacheInvariant], helpText: "Skip loading the compilation result from cache")
-  public static let cacheReplayPrefixMap: Option = Option("-cache-replay-prefix-map", .multiArg, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<prefix> <replacement>", helpText: "Remap paths when replaying outputs from cache", numArgs: 2)
-  public static let candidateModuleFile: Option = Option("-candidate-module-file", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<path>", helpText: "Specify Swift module may be ready to use for an interface")
-  public static let casBackendMode: Option = Option("-cas-backend-mode=", .joined, attributes: [.frontend, .noDriver], metaVar: "native|casid|verify", helpText: "CASBackendMode for output kind")
-  public static let casBackend: Option = Option("-cas-backend", .flag, attributes: [.frontend, .noDriver], helpText: "Enable using CASBackend for object file output")
-  public static let casEmitCasidFile: Option = Option("-cas-emit-casid-file", .flag, attributes: [.frontend, .noDriver], helpText: "Emit .casid file next to object file when CAS Backend is enabled")
-  public static let casFsEscape: Option = Option("-cas-fs-escape", .separate, attributes: [.frontend, .cacheInvariant], metaVar: "<path>", helpText: "Path for using the underlying file system instead of CASFS")
-  public static let casPath: Option = Option("-cas-path", .separate, attributes: [.frontend, .cacheInvariant], metaVar: "<path>", helpText: "Path to CAS")
-  public static let casPluginOption: Option = Option("-cas-plugin-option", .separate, attributes: [.frontend, .cacheInvariant], metaVar: "<name>=<option>", helpText: "Option pass to CAS Plugin")
-  public static let casPluginPath: Option = Option("-cas-plugin-path", .separate, attributes: [.frontend, .cacheInvariant], metaVar: "<path>", helpText: "Path to CAS Plugin")
-  public static let checkApiAvailabilityOnly: Option = Option("-check-api-availability-only", .flag, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "Deprecated, has no effect")
-  public static let checkOnoneCompleteness: Option = Option("-check-onone-completeness", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print errors if the compile OnoneSupport module is missing symbols")
-  public static let checkedAsyncObjcBridging: Option = Option("-checked-async-objc-bridging=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Control whether checked continuations are used when bridging async calls from Swift to ObjC: 'on', 'off' ")
-  public static let clangBuildSessionFile: Option = Option("-clang-build-session-file", .separate, attributes: [.frontend, .argumentIsPath, .cacheInvariant], helpText: "Use the last modification time of <file> as the underlying Clang build session timestamp")
-  public static let clangHeaderExposeDecls: Option = Option("-clang-header-expose-decls=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "all-public|has-expose-attr", helpText: "Which declarations should be exposed in the generated clang header.")
-  public static let clangHeaderExposeModule: Option = Option("-clang-header-expose-module", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<imported-module-name>=<generated-header-name>", helpText: "Allow the compiler to assume that APIs from the specified module are exposed to C/C++/Objective-C in another generated header, so that APIs in the current module that depend on declarations from the specified module can be exposed in the generated header.")
-  public static let clangIncludeTreeFilelist: Option = Option("-clang-include-tree-filelist", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<cas-id>", helpText: "Clang Include Tree FileList CASID")
-  public static let clangIncludeTreeRoot: Option = Option("-clang-include-tree-root", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<cas-id>", helpText: "Clang Include Tree CASID")
-  public static let clangScannerModuleCachePath: Option = Option("-clang-scanner-module-cache-path", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath, .cacheInvariant], helpText: "Specifies the Clang dependency scanner module cache path")
-  public static let clangTargetVariant: Option = Option("-clang-target-variant", .separate, attributes: [.frontend, .synthesizeInterface], helpText: "Separately set the target we should use for internal Clang instance for the 'zippered' code for macCatalyst")
-  public static let clangTarget: Option = Option("-clang-target", .separate, attributes: [.frontend, .synthesizeInterface], helpText: "Separately set the target we should use for internal Clang instance")
-  public static let codeCompleteCallPatternHeuristics: Option = Option("-code-complete-call-pattern-heuristics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use heuristics to guess whether we want call pattern completions")
-  public static let codeCompleteInitsInPostfixExpr: Option = Option("-code-complete-inits-in-postfix-expr", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Include initializers when completing a postfix expression")
-  public static let colorDiagnostics: Option = Option("-color-diagnostics", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Print diagnostics in color")
-  public static let compareToBaselinePath: Option = Option("-compare-to-baseline-path", .separate, attributes: [.noInteractive, .argumentIsPath], metaVar: "<path>", helpText: "Compare the built module to the baseline at <path> and diagnose breaking changes using the API digester")
-  public static let compileModuleFromInterface: Option = Option("-compile-module-from-interface", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Treat the (single) input as a swiftinterface and produce a module", group: .modes)
-  public static let compilerAssertions: Option = Option("-compiler-assertions", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild, .cacheInvariant], helpText: "Enable internal self-checks while compiling", group: .internalDebug)
-  public static let compilerStyleDiags: Option = Option("-compiler-style-diags", .flag, attributes: [.noDriver], helpText: "Print compiler style diagnostics to stderr.")
-  public static let compilerStyleDiags_: Option = Option("--compiler-style-diags", .flag, alias: Option.compilerStyleDiags, attributes: [.noDriver], helpText: "Print compiler style diagnostics to stderr.")
-  public static let concurrencyModelEQ: Option = Option("-concurrency-model=", .joined, alias: Option.concurrencyModel, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let concurrencyModel: Option = Option("-concurrency-model", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "standard|task-to-thread", helpText: "Which concurrency model is used.  Defaults to standard.")
-  public static let conditionalRuntimeRecords: Option = Option("-conditional-runtime-records", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allow removal of runtime metadata records (public types, protocol conformances) based on whether they're used or unused")
-  public static let constGatherProtocolsFile: Option = Option("-const-gather-protocols-file", .separate, attributes: [.frontend, .noDriver, .argumentIsPath], metaVar: "<path>", helpText: "Specify a list of protocols for extraction of conformances 'const values'")
-  public static let constGatherProtocolsList: Option = Option("-const-gather-protocols-list", .separate, attributes: [.frontend, .argumentIsPath], metaVar: "<path>", helpText: "Specify a list of protocols for extraction of conformances 'const values'")
-  public static let continueBuildingAfterErrors: Option = Option("-continue-building-after-errors", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Continue building, even after errors are encountered")
-  public static let coveragePrefixMap: Option = Option("-coverage-prefix-map", .separate, attributes: [.frontend], metaVar: "<prefix=replacement>", helpText: "Remap source paths in coverage info")
-  public static let CrossModuleOptimization: Option = Option("-cross-module-optimization", .flag, attributes: [.helpHidden, .frontend], helpText: "Perform cross-module optimization")
-  public static let crosscheckUnqualifiedLookup: Option = Option("-crosscheck-unqualified-lookup", .flag, attributes: [.frontend, .noDriver], helpText: "Compare legacy DeclContext- to ASTScope-based unqualified name lookup (for debugging)")
-  public static let csProfileGenerateEQ: Option = Option("-cs-profile-generate=", .joined, attributes: [.frontend, .noInteractive], metaVar: "<directory>", helpText: "Generate instrumented code to collect context sensitive execution counts into <directory>/default.profraw (overridden by LLVM_PROFILE_FILE env var)")
-  public static let csProfileGenerate: Option = Option("-cs-profile-generate", .flag, attributes: [.frontend, .noInteractive], helpText: "Generate instrumented code to collect context sensitive execution counts into default.profraw (overridden by LLVM_PROFILE_FILE env var)")
-  public static let cxxInteropGettersSettersAsProperties: Option = Option("-cxx-interop-getters-setters-as-properties", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Import getters and setters as computed properties in Swift")
-  public static let cxxInteropUseOpaquePointerForMoveonly: Option = Option("-cxx-interop-use-opaque-pointer-for-moveonly", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Testing flag that will be eliminated soon. Do not use.")
-  public static let cxxInteroperabilityMode: Option = Option("-cxx-interoperability-mode=", .joined, attributes: [.frontend, .synthesizeInterface], helpText: "Enables C++ interoperability; pass 'default' to enable or 'off' to disable")
-  public static let c: Option = Option("-c", .flag, alias: Option.emitObject, attributes: [.frontend, .noInteractive], group: .modes)
-  public static let debugAssertAfterParse: Option = Option("-debug-assert-after-parse", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Force an assertion failure after parsing", group: .debugCrash)
-  public static let debugAssertImmediately: Option = Option("-debug-assert-immediately", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Force an assertion failure immediately", group: .debugCrash)
-  public static let debugCallsiteInfo: Option = Option("-debug-callsite-info", .flag, attributes: [.frontend, .noDriver], helpText: "Generate callsite information in debug info")
-  public static let debugConstraintsAttempt: Option = Option("-debug-constraints-attempt", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Debug the constraint solver at a given attempt")
-  public static let debugConstraintsOnLineEQ: Option = Option("-debug-constraints-on-line=", .joined, alias: Option.debugConstraintsOnLine, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let debugConstraintsOnLine: Option = Option("-debug-constraints-on-line", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<line>", helpText: "Debug the constraint solver for expressions on <line>")
-  public static let debugConstraints: Option = Option("-debug-constraints", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Debug the constraint-based type checker")
-  public static let debugCrashAfterParse: Option = Option("-debug-crash-after-parse", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Force a crash after parsing", group: .debugCrash)
-  public static let debugCrashImmediately: Option = Option("-debug-crash-immediately", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Force a crash immediately", group: .debugCrash)
-  public static let debugCycles: Option = Option("-debug-cycles", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print out debug dumps when cycles are detected in evaluation")
-  public static let debugDiagnosticNames: Option = Option("-debug-diagnostic-names", .flag, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Include diagnostic names when printing")
-  public static let debugEmitInvalidSwiftinterfaceSyntax: Option = Option("-debug-emit-invalid-swiftinterface-syntax", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Write an invalid declaration into swiftinterface files")
-  public static let debugForbidTypecheckPrefix: Option = Option("-debug-forbid-typecheck-prefix", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Triggers llvm fatal_error if typechecker tries to typecheck a decl with the provided prefix name")
-  public static let debugGenericSignatures: Option = Option("-debug-generic-signatures", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Debug generic signatures")
-  public static let debugInfoForProfiling: Option = Option("-debug-info-for-profiling", .flag, attributes: [.frontend, .noInteractive], helpText: "Emit extra debug info (DWARF discriminators) to make sampling-based profiling more accurate")
-  public static let debugInfoFormat: Option = Option("-debug-info-format=", .joined, attributes: [.frontend], helpText: "Specify the debug info format type to either 'dwarf' or 'codeview'")
-  public static let debugInfoStoreInvocation: Option = Option("-debug-info-store-invocation", .flag, attributes: [.frontend], helpText: "Emit the compiler invocation in the debug info.")
-  public static let debugInverseRequirements: Option = Option("-debug-inverse-requirements", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print real requirements in -debug-generic-signatures output")
-  public static let debugMapping: Option = Option("-debug-mapping", .flag, attributes: [.noDriver], helpText: "Dumping information for debug purposes")
-  public static let debugMapping_: Option = Option("--debug-mapping", .flag, alias: Option.debugMapping, attributes: [.noDriver], helpText: "Dumping information for debug purposes")
-  public static let debugModulePathEQ: Option = Option("-debug-module-path=", .joined, alias: Option.debugModulePath, attributes: [.frontend, .argumentIsPath])
-  public static let debugModulePath: Option = Option("-debug-module-path", .separate, attributes: [.frontend, .argumentIsPath], helpText: "Path or cache key to this module's binary swiftmodule artifact (required by debug info)")
-  public static let debugModuleSelfKey: Option = Option("-debug-module-self-key", .flag, attributes: [.frontend], helpText: "Embeded the key of current job in debug info generation (required by debug info)")
-  public static let debugPrefixMap: Option = Option("-debug-prefix-map", .separate, attributes: [.frontend], metaVar: "<prefix=replacement>", helpText: "Remap source paths in debug info")
-  public static let debugRequirementMachine: Option = Option("-debug-requirement-machine=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Fine-grained debug output from the generics implementation")
-  public static let debugTimeExpressionTypeChecking: Option = Option("-debug-time-expression-type-checking", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dumps the time it takes to type-check each expression")
-  public static let debugTimeFunctionBodies: Option = Option("-debug-time-function-bodies", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dumps the time it takes to type-check each function body")
-  public static let debuggerSupport: Option = Option("-debugger-support", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Process swift code as if running in the debugger")
-  public static let debuggerTestingTransform: Option = Option("-debugger-testing-transform", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Instrument the code with calls to an intrinsic that record the expected values of local variables so they can be compared against the results from the debugger.")
-  public static let defaultIsolationEQ: Option = Option("-default-isolation=", .joined, alias: Option.defaultIsolation, attributes: [.frontend])
-  public static let defaultIsolation: Option = Option("-default-isolation", .separate, attributes: [.frontend], metaVar: "MainActor|nonisolated", helpText: "Specify the default actor isolation: MainActor or nonisolated. Defaults to nonisolated.")
-  public static let defineAlwaysEnabledAvailabilityDomain: Option = Option("-define-always-enabled-availability-domain", .separate, attributes: [.helpHidden, .frontend, .noInteractive], metaVar: "<domain>", helpText: "Defines a custom availability domain that is available for all deployments")
-  public static let defineAvailability: Option = Option("-define-availability", .separate, attributes: [.frontend, .noInteractive], metaVar: "<macro>", helpText: "Define an availability macro in the format 'macroName : iOS 13.0, macOS 10.15'")
-  public static let defineDisabledAvailabilityDomain: Option = Option("-define-disabled-availability-domain", .separate, attributes: [.helpHidden, .frontend, .noInteractive], metaVar: "<domain>", helpText: "Defines a custom availability domain that is unavailable at compile time")
-  public static let defineDynamicAvailabilityDomain: Option = Option("-define-dynamic-availability-domain", .separate, attributes: [.helpHidden, .frontend, .noInteractive], metaVar: "<domain>", helpText: "Defines a custom availability domain that can be enabled or disabled at runtime")
-  public static let defineEnabledAvailabilityDomain: Option = Option("-define-enabled-availability-domain", .separate, attributes: [.helpHidden, .frontend, .noInteractive], metaVar: "<domain>", helpText: "Defines a custom availability domain that is available at compile time")
-  public static let dependencyOnlyImport: Option = Option("-dependency-only-import", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Import the module as a dependency only")
-  public static let dependencyScanCachePath: Option = Option("-dependency-scan-cache-path", .separate, attributes: [.frontend, .noDriver], helpText: "The path to output the dependency scanner's internal state.")
-  public static let dependencyScanSerializeDiagnosticsPath: Option = Option("-dependency-scan-serialize-diagnostics-path", .separate, attributes: [.argumentIsPath, .supplementaryOutput], metaVar: "<path>", helpText: "Emit a serialized diagnostics file for the dependency scanning task to <path>")
-  public static let deprecatedIntegratedRepl: Option = Option("-deprecated-integrated-repl", .flag, attributes: [.frontend, .noBatch], group: .modes)
-  public static let deserializeDiff: Option = Option("-deserialize-diff", .flag, attributes: [.noDriver], helpText: "Deserialize diff items in a JSON file")
-  public static let deserializeDiff_: Option = Option("--deserialize-diff", .flag, alias: Option.deserializeDiff, attributes: [.noDriver], helpText: "Deserialize diff items in a JSON file")
-  public static let deserializeSdk: Option = Option("-deserialize-sdk", .flag, attributes: [.noDriver], helpText: "Deserialize sdk digester in a JSON file")
-  public static let deserializeSdk_: Option = Option("--deserialize-sdk", .flag, alias: Option.deserializeSdk, attributes: [.noDriver], helpText: "Deserialize sdk digester in a JSON file")
-  public static let diagnoseSdk: Option = Option("-diagnose-sdk", .flag, attributes: [.noDriver], helpText: "Diagnose SDK content in JSON file")
-  public static let diagnoseSdk_: Option = Option("--diagnose-sdk", .flag, alias: Option.diagnoseSdk, attributes: [.noDriver], helpText: "Diagnose SDK content in JSON file")
-  public static let diagnosticDocumentationPath: Option = Option("-diagnostic-documentation-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Path to diagnostic documentation resources")
-  public static let diagnosticStyleEQ: Option = Option("-diagnostic-style=", .joined, alias: Option.diagnosticStyle, attributes: [.frontend, .doesNotAffectIncrementalBuild], metaVar: "<style>")
-  public static let diagnosticStyle: Option = Option("-diagnostic-style", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild], metaVar: "<style>", helpText: "The formatting style used when printing diagnostics ('swift' or 'llvm')")
-  public static let swiftDiagnosticsAssertOnError: Option = Option("-diagnostics-assert-on-error", .flag, attributes: [.frontend, .noDriver], helpText: "Trap when an error diagnostic is emitted. For compiler developers only.")
-  public static let swiftDiagnosticsAssertOnGroup: Option = Option("-diagnostics-assert-on-group", .separate, attributes: [.frontend, .noDriver], metaVar: "<diagnostic_group>", helpText: "Trap when any diagnostic in the given group is emitted. For compiler developers only.")
-  public static let swiftDiagnosticsAssertOnWarning: Option = Option("-diagnostics-assert-on-warning", .flag, attributes: [.frontend, .noDriver], helpText: "Trap when a warning diagnostic is emitted. For compiler developers only.")
-  public static let diagnosticsEditorMode: Option = Option("-diagnostics-editor-mode", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Diagnostics will be used in editor")
-  public static let digesterBreakageAllowlistPath: Option = Option("-digester-breakage-allowlist-path", .separate, attributes: [.noInteractive, .argumentIsPath], metaVar: "<path>", helpText: "The path to a list of permitted breaking changes the API digester should ignore")
-  public static let digesterMode: Option = Option("-digester-mode", .separate, attributes: [.noInteractive], metaVar: "<api|abi>", helpText: "Whether the API digester should run in API or ABI mode (defaults to API checking)")
-  public static let directClangCc1ModuleBuild: Option = Option("-direct-clang-cc1-module-build", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use the specified -Xcc options to build a PCM by using Clang frontend directly, bypassing the Clang driver")
-  public static let disableAccessControl: Option = Option("-disable-access-control", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't respect access control restrictions")
-  public static let disableActorDataRaceChecks: Option = Option("-disable-actor-data-race-checks", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Disable runtime checks for actor data races")
-  public static let disableAddressDependencies: Option = Option("-disable-address-dependencies", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable enforcement of lifetime dependencies on addressable values.")
-  public static let disableAggressiveReg2mem: Option = Option("-disable-aggressive-reg2mem", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable a more aggressive reg2mem heuristic")
-  public static let disableAliasModuleNamesInModuleInterface: Option = Option("-disable-alias-module-names-in-module-interface", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "When emitting a module interface, disable disambiguating modules using distinct alias names")
-  public static let disableAllAutolinking: Option = Option("-disable-all-autolinking", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable all Swift autolink directives")
-  public static let disableArcOpts: Option = Option("-disable-arc-opts", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run SIL ARC optimization passes.")
-  public static let disableArm64Corocc: Option = Option("-disable-arm64-corocc", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't use swiftcorocc for yield_once_2 routines on arm64 variants.")
-  public static let disableAssemblyVisionAll: Option = Option("-disable-assembly-vision-all", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable assembly vision for all functions")
-  public static let disableAstVerifier: Option = Option("-disable-ast-verifier", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not run the AST verifier during compilation. NOTE: This lets the user override the default behavior on whether or not the ASTVerifier is run. The default behavior is to run the verifier when asserts are enabled and not run it when asserts are disabled. NOTE: Can not be used if enable-ast-verifier is used as well")
-  public static let disableAsyncFramePointerAll: Option = Option("-disable-async-frame-pointer-all", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable always emit async frame stack frames")
-  public static let disableAsyncFramePushPopMetadata: Option = Option("-disable-async-frame-push-pop-metadata", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable async frame push pop metadata")
-  public static let disableAutolinkFrameworks: Option = Option("-disable-autolink-frameworks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable autolinking against all frameworks")
-  public static let disableAutolinkFramework: Option = Option("-disable-autolink-framework", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable autolinking against the provided framework")
-  public static let disableAutolinkLibrary: Option = Option("-disable-autolink-library", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable autolinking against the provided library")
-  public static let disableAutolinkingRuntimeCompatibilityConcurrency: Option = Option("-disable-autolinking-runtime-compatibility-concurrency", .flag, attributes: [.frontend], helpText: "Do not use autolinking for the concurrency runtime compatibility library")
-  public static let disableAutolinkingRuntimeCompatibilityDynamicReplacements: Option = Option("-disable-autolinking-runtime-compatibility-dynamic-replacements", .flag, attributes: [.frontend], helpText: "Do not use autolinking for the dynamic replacement runtime compatibility library")
-  public static let disableAutolinkingRuntimeCompatibility: Option = Option("-disable-autolinking-runtime-compatibility", .flag, attributes: [.frontend], helpText: "Do not use autolinking for runtime compatibility libraries")
-  public static let disableAvailabilityChecking: Option = Option("-disable-availability-checking", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable checking for potentially unavailable APIs")
-  public static let disableBatchMode: Option = Option("-disable-batch-mode", .flag, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "Disable combining frontend jobs into batches")
-  public static let disableBridgingPch: Option = Option("-disable-bridging-pch", .flag, attributes: [.helpHidden], helpText: "Disable automatic generation of bridging PCH files")
-  public static let disableBuildingInterface: Option = Option("-disable-building-interface", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disallow building binary module from textual interface")
-  public static let disableCalleeAllocatedCoroAbi: Option = Option("-disable-callee-allocated-coro-abi", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Override per-platform settings and don't use yield_once_2.")
-  public static let disableClangSpi: Option = Option("-disable-clang-spi", .flag, attributes: [.frontend, .noDriver], helpText: "Don't import Clang SPIs as Swift SPIs")
-  public static let disableClangTarget: Option = Option("-disable-clang-target", .flag, attributes: [], helpText: "Disable a separately specified target triple for Clang instance to use")
-  public static let disableClangimporterSourceImport: Option = Option("-disable-clangimporter-source-import", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable ClangImporter and forward all requests straight the DWARF importer.")
-  public static let disableCrossModuleOptimization: Option = Option("-disable-cmo", .flag, attributes: [.helpHidden, .frontend], helpText: "Disable cross-module optimization")
-  public static let disableCollocateMetadataFunctions: Option = Option("-disable-collocate-metadata-functions", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable collocate metadata functions")
-  public static let disableColocateTypeDescriptors: Option = Option("-disable-colocate-type-descriptors", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable colocate type descriptors")
-  public static let disableConcreteTypeMetadataMangledNameAccessors: Option = Option("-disable-concrete-type-metadata-mangled-name-accessors", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable concrete type metadata access by mangled name")
-  public static let disableCondFailMessageAnnotation: Option = Option("-disable-cond-fail-message-annotation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable cond_fail message annotation.")
-  public static let disableConstValueImporting: Option = Option("-disable-const-value-importing", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable constant value importing in ClangImporter.")
-  public static let disableCrossImportOverlaySearch: Option = Option("-disable-cross-import-overlay-search", .flag, attributes: [.frontend, .noDriver], helpText: "Disable searching for cross import overlay file")
-  public static let disableCrossImportOverlays: Option = Option("-disable-cross-import-overlays", .flag, attributes: [.frontend, .noDriver], helpText: "Do not automatically import declared cross-import overlays.")
-  public static let cxxInteropDisableRequirementAtImport: Option = Option("-disable-cxx-interop-requirement-at-import", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not require C++ interoperability to be enabled when importing a Swift module that enables C++ interoperability")
-  public static let disableDebuggerShadowCopies: Option = Option("-disable-debugger-shadow-copies", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable debugger shadow copies of local variables.This option is only useful for testing the compiler.")
-  public static let disableDeserializationRecovery: Option = Option("-disable-deserialization-recovery", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't attempt to recover from missing xrefs (etc) in swiftmodules")
-  public static let disableDeserializationSafety: Option = Option("-disable-deserialization-safety", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't avoid reading potentially unsafe decls in swiftmodules")
-  public static let disableDiagnosticPasses: Option = Option("-disable-diagnostic-passes", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run diagnostic passes")
-  public static let disableDirectRetainRelease: Option = Option("-disable-direct-retain-release", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable use of swift_retain/releaseDirect functions")
-  public static let disableDynamicActorIsolation: Option = Option("-disable-dynamic-actor-isolation", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Disable dynamic actor isolation checks")
-  public static let disableEmitGenericClassRoTList: Option = Option("-disable-emit-generic-class-ro_t-list", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable emission of a section with references to class_ro_t of generic class patterns")
-  public static let disableEmitTypeMallocForCoroFrame: Option = Option("-disable-emit-type-malloc-for-coro-frame", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable emitting typed malloc for coroutine frame allocation")
-  public static let disableExperimentalClangImporterDiagnostics: Option = Option("-disable-experimental-clang-importer-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Disable experimental diagnostics when importing C, C++, and Objective-C libraries")
-  public static let disableExperimentalFeature: Option = Option("-disable-experimental-feature", .separate, attributes: [.frontend, .synthesizeInterface, .moduleInterface], helpText: "Disable an experimental feature")
-  public static let disableExperimentalLifetimeDependenceInference: Option = Option("-disable-experimental-lifetime-dependence-inference", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental lifetime dependence inference")
-  public static let disableExperimentalOpenedExistentialTypes: Option = Option("-disable-experimental-opened-existential-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental support for implicitly opened existentials")
-  public static let disableExperimentalParserRoundTrip: Option = Option("-disable-experimental-parser-round-trip", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable round trip through the new swift parser")
-  public static let disableExperimentalStringProcessing: Option = Option("-disable-experimental-string-processing", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental string processing")
-  public static let disableFailOnError: Option = Option("-disable-fail-on-error", .flag, attributes: [.noDriver], helpText: "Don't exit with a nonzero status if errors are emitted")
-  public static let disableFailOnError_: Option = Option("--disable-fail-on-error", .flag, alias: Option.disableFailOnError, attributes: [.noDriver], helpText: "Don't exit with a nonzero status if errors are emitted")
-  public static let disableFineModuleTracing: Option = Option("-disable-fine-module-tracing", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Skip the emission of fine grained module tracing file.")
-  public static let disableForceLoadSymbols: Option = Option("-disable-force-load-symbols", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable generation of all Swift _FORCE_LOAD symbols")
-  public static let disableFragileResilientProtocolWitnesses: Option = Option("-disable-fragile-relative-protocol-tables", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable relative protocol witness tables")
-  public static let disableGenericMetadataPrespecialization: Option = Option("-disable-generic-metadata-prespecialization", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not statically specialize metadata for generic types at types that are known to be used in source.")
-  public static let disableImplicitConcurrencyModuleImport: Option = Option("-disable-implicit-concurrency-module-import", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the implicit import of the _Concurrency module.")
-  public static let disableImplicitCxxModuleImport: Option = Option("-disable-implicit-cxx-module-import", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the implicit import of the C++ Standard Library module.")
-  public static let disableImplicitStringProcessingModuleImport: Option = Option("-disable-implicit-string-processing-module-import", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the implicit import of the _StringProcessing module.")
-  public static let disableImplicitSwiftModules: Option = Option("-disable-implicit-swift-modules", .flag, attributes: [.frontend, .noDriver], helpText: "Disable building Swift modules implicitly by the compiler")
-  public static let disableImportPtrauthFieldFunctionPointers: Option = Option("-disable-import-ptrauth-field-function-pointers", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable import of custom ptrauth qualified field function pointers")
-  public static let disableIncrementalFileHashing: Option = Option("-disable-incremental-file-hashing", .flag, attributes: [], helpText: "Disable hashing of input and dependency file data that can prevent unnecessary invalidation")
-  public static let disableIncrementalImports: Option = Option("-disable-incremental-imports", .flag, attributes: [.frontend], helpText: "Disable cross-module incremental build metadata and driver scheduling for Swift modules")
-  public static let disableIncrementalLlvmCodegeneration: Option = Option("-disable-incremental-llvm-codegen", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable incremental llvm code generation.")
-  public static let disableInferPublicConcurrentValue: Option = Option("-disable-infer-public-sendable", .flag, attributes: [.frontend, .noDriver], helpText: "Disable inference of Sendable conformances for public structs and enums")
-  public static let disableInterfaceLockfile: Option = Option("-disable-interface-lock", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't lock interface file when building module")
-  public static let disableInvalidEphemeralnessAsError: Option = Option("-disable-invalid-ephemeralness-as-error", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Diagnose invalid ephemeral to non-ephemeral conversions as warnings")
-  public static let disableLargeLoadableTypesReg2mem: Option = Option("-disable-large-loadable-types-reg2mem", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable large loadable types register to memory pass")
-  public static let disableLayoutStringValueWitnessesInstantiation: Option = Option("-disable-layout-string-value-witnesses-instantiation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable runtime instantiation of layout string value witnesses for generic types")
-  public static let disableLayoutStringValueWitnesses: Option = Option("-disable-layout-string-value-witnesses", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable layout string based value witnesses")
-  public static let disableLegacyTypeInfo: Option = Option("-disable-legacy-type-info", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Completely disable legacy type layout")
-  public static let disableLifetimeDependenceDiagnostics: Option = Option("-disable-lifetime-dependence-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable lifetime dependence diagnostics for Nonescapable types.")
-  public static let disableLlvmMergeFunctionsPass: Option = Option("-disable-llvm-merge-functions-pass", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the MergeFunctionPass LLVM IR pass")
-  public static let disableLlvmOptzns: Option = Option("-disable-llvm-optzns", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run LLVM optimization passes")
-  public static let disableLlvmValueNames: Option = Option("-disable-llvm-value-names", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't add names to local values in LLVM IR")
-  public static let disableLlvmVerifyEach: Option = Option("-disable-llvm-verify-each", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run the LLVM IR verifier after every pass.")
-  public static let disableLlvmVerify: Option = Option("-disable-llvm-verify", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run the LLVM IR verifier.")
-  public static let disableMigratorFixits: Option = Option("-disable-migrator-fixits", .flag, attributes: [.frontend, .noInteractive], helpText: "Disable the Migrator phase which automatically applies fix-its")
-  public static let disableModuleSelectorsInModuleInterface: Option = Option("-disable-module-selectors-in-module-interface", .flag, attributes: [.frontend, .noInteractive], helpText: "When emitting module interface files, do not use module selectors to avoid name collisions")
-  public static let disableModulesValidateSystemHeaders: Option = Option("-disable-modules-validate-system-headers", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable validating system headers in the Clang importer")
-  public static let disableNamedLazyImportAsMemberLoading: Option = Option("-disable-named-lazy-import-as-member-loading", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Import all of a type's import-as-member globals together, as Swift 5.10 and earlier did; temporary workaround for modules that are sensitive to this change")
-  public static let disableNewLlvmPassManager: Option = Option("-disable-new-llvm-pass-manager", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the new llvm pass manager")
-  public static let disableNewOperatorLookup: Option = Option("-disable-new-operator-lookup", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the new operator decl and precedencegroup lookup behavior")
-  public static let disableNonfrozenEnumExhaustivityDiagnostics: Option = Option("-disable-nonfrozen-enum-exhaustivity-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allow switches over non-frozen enums without catch-all cases")
-  public static let disableNoreturnPrediction: Option = Option("-disable-noreturn-prediction", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disables optimization assumption that calls to no-return functions are cold.")
-  public static let disableNskeyedarchiverDiagnostics: Option = Option("-disable-nskeyedarchiver-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allow classes with unstable mangled names to adopt NSCoding")
-  public static let disableObjcAttrRequiresFoundationModule: Option = Option("-disable-objc-attr-requires-foundation-module", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Disable requiring uses of @objc to require importing the Foundation module")
-  public static let disableObjcInterop: Option = Option("-disable-objc-interop", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Disable Objective-C interop code generation and config directives")
-  public static let disableObjectiveCProtocolSymbolicReferences: Option = Option("-disable-objective-c-protocol-symbolic-references", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable objective-c protocol symbolic references")
-  public static let disableOnlyOneDependencyFile: Option = Option("-disable-only-one-dependency-file", .flag, attributes: [.doesNotAffectIncrementalBuild], helpText: "Disables incremental build optimization that only produces one dependencies file")
-  public static let disableOsChecks: Option = Option("-disable-os-checks", .flag, attributes: [.noDriver], helpText: "Skip OS related diagnostics")
-  public static let disableOsChecks_: Option = Option("--disable-os-checks", .flag, alias: Option.disableOsChecks, attributes: [.noDriver], helpText: "Skip OS related diagnostics")
-  public static let disableOssaOpts: Option = Option("-disable-ossa-opts", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run SIL OSSA optimization passes.")
-  public static let disablePlaygroundTransform: Option = Option("-disable-playground-transform", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable playground transformation")
-  public static let disablePreallocatedInstantiationCaches: Option = Option("-disable-preallocated-instantiation-caches", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Avoid preallocating metadata instantiation caches in globals")
-  public static let disablePreviousImplementationCallsInDynamicReplacements: Option = Option("-disable-previous-implementation-calls-in-dynamic-replacements", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable calling the previous implementation in dynamic replacements")
-  public static let disablePrintMissingImportsInModuleInterface: Option = Option("-disable-print-missing-imports-in-module-interface", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable adding to the module interface imports used from API and missing from the sources")
-  public static let disableProfilingMarkerThunks: Option = Option("-disable-profiling-marker-thunks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable profiling marker thunks")
-  public static let disableReadonlyStaticObjects: Option = Option("-disable-readonly-static-objects", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Avoid allocating static objects in a read-only data section")
-  public static let disableReflectionMetadata: Option = Option("-disable-reflection-metadata", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable emission of reflection metadata for nominal types")
-  public static let disableReflectionNames: Option = Option("-disable-reflection-names", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable emission of names of stored properties and enum cases inreflection metadata")
-  public static let disableRelativeProtocolWitnessTables: Option = Option("-disable-relative-protocol-witness-tables", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable relative protocol witness tables")
-  public static let disableRemoveDeprecatedCheck: Option = Option("-disable-remove-deprecated-check", .flag, attributes: [.noDriver], helpText: "Skip diagnosing removal of deprecated symbols")
-  public static let disableRemoveDeprecatedCheck_: Option = Option("--disable-remove-deprecated-check", .flag, alias: Option.disableRemoveDeprecatedCheck, attributes: [.noDriver], helpText: "Skip diagnosing removal of deprecated symbols")
-  public static let disableRequirementMachineConcreteContraction: Option = Option("-disable-requirement-machine-concrete-contraction", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable preprocessing pass to eliminate conformance requirements on generic parameters which are made concrete")
-  public static let disableRequirementMachineLoopNormalization: Option = Option("-disable-requirement-machine-loop-normalization", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable stronger minimization algorithm, for debugging only")
-  public static let disableRequirementMachineReuse: Option = Option("-disable-requirement-machine-reuse", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable re-use of requirement machines for minimization, for debugging only")
-  public static let disableRoundTripDebugTypes: Option = Option("-disable-round-trip-debug-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disables verification of debug info mangling")
-  public static let disableSafeInteropWrappers: Option = Option("-disable-safe-interop-wrappers", .flag, attributes: [.helpHidden, .frontend, .synthesizeInterface], helpText: "Disable safe interop wrapper generation and bounds attribute parsing")
-  public static let disableSandbox: Option = Option("-disable-sandbox", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Disable using the sandbox when executing subprocesses")
-  public static let disableSendingArgsAndResultsWithRegionIsolation: Option = Option("-disable-sending-args-and-results-with-region-based-isolation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable sending args and results when region-based isolation is enabled. Only enabled with asserts")
-  public static let disableSilOpaqueValues: Option = Option("-disable-sil-opaque-values", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable SIL Opaque Values")
-  public static let disableSilOwnershipVerifier: Option = Option("-disable-sil-ownership-verifier", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not verify ownership invariants during SIL Verification ")
-  public static let disableSilPartialApply: Option = Option("-disable-sil-partial-apply", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable use of partial_apply in SIL generation")
-  public static let disableSilPerfOptzns: Option = Option("-disable-sil-perf-optzns", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run SIL performance optimization passes")
-  public static let disableSplitColdCode: Option = Option("-disable-split-cold-code", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable splitting of cold code when optimizing")
-  public static let disableStackProtector: Option = Option("-disable-stack-protector", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the stack-protector")
-  public static let disableStandardSubstitutionsInReflectionMangling: Option = Option("-disable-standard-substitutions-in-reflection-mangling", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable referencing stdlib symbols via mangled names in reflection mangling")
-  public static let disableSubstSilFunctionTypes: Option = Option("-disable-subst-sil-function-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable substituted function types for SIL type lowering of function values")
-  public static let disableSwiftBridgeAttr: Option = Option("-disable-swift-bridge-attr", .flag, attributes: [.helpHidden, .frontend], helpText: "Disable using the swift bridge attribute")
-  public static let disableSwiftSpecificLlvmOptzns: Option = Option("-disable-swift-specific-llvm-optzns", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't run Swift specific LLVM optimization passes.")
-  public static let disableSwift3ObjcInference: Option = Option("-disable-swift3-objc-inference", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Deprecated, has no effect")
-  public static let disableTargetOsChecking: Option = Option("-disable-target-os-checking", .flag, attributes: [.frontend, .noDriver], helpText: "Disable checking the target OS of serialized modules")
-  public static let disableTestableAttrRequiresTestableModule: Option = Option("-disable-testable-attr-requires-testable-module", .flag, attributes: [.frontend, .noDriver], helpText: "Disable checking of @testable")
-  public static let disableThrowsPrediction: Option = Option("-disable-throws-prediction", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disables optimization assumption that functions rarely throw errors.")
-  public static let disableTypeLayouts: Option = Option("-disable-type-layout", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable type layout based lowering")
-  public static let disableTypoCorrection: Option = Option("-disable-typo-correction", .flag, attributes: [.frontend, .noDriver], helpText: "Disable typo correction")
-  public static let disableUpcomingFeature: Option = Option("-disable-upcoming-feature", .separate, attributes: [.frontend, .synthesizeInterface, .moduleInterface], helpText: "Disable a feature that will be introduced in an upcoming language version")
-  public static let disableVerifyExclusivity: Option = Option("-disable-verify-exclusivity", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable verification of access markers used to enforce exclusivity.")
-  public static let disableWorkaroundBrokenModules: Option = Option("-disable-workaround-broken-modules", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable recovery for imported modules with broken modularization")
-  public static let disableX8664Corocc: Option = Option("-disable-x86_64-corocc", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't use swiftcorocc for yield_once_2 routines on x86_64.")
-  public static let disallowForwardingDriver: Option = Option("-disallow-use-new-driver", .flag, helpText: "Disable using new swift-driver")
-  public static let downgradeTypecheckInterfaceError: Option = Option("-downgrade-typecheck-interface-error", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Downgrade error to warning when typechecking emitted module interfaces")
-  public static let driverAlwaysRebuildDependents: Option = Option("-driver-always-rebuild-dependents", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Always rebuild dependents of files that have been modified", group: .internalDebug)
-  public static let driverBatchCount: Option = Option("-driver-batch-count", .separate, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Use the given number of batch-mode partitions, rather than partitioning dynamically", group: .internalDebug)
-  public static let driverBatchSeed: Option = Option("-driver-batch-seed", .separate, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Use the given seed value to randomize batch-mode partitions", group: .internalDebug)
-  public static let driverBatchSizeLimit: Option = Option("-driver-batch-size-limit", .separate, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Use the given number as the upper limit on dynamic batch-mode partition size", group: .internalDebug)
-  public static let driverEmitFineGrainedDependencyDotFileAfterEveryImport: Option = Option("-driver-emit-fine-grained-dependency-dot-file-after-every-import", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Emit dot files every time driver imports an fine-grained swiftdeps file.", group: .internalDebug)
-  public static let driverFilelistThresholdEQ: Option = Option("-driver-filelist-threshold=", .joined, alias: Option.driverFilelistThreshold)
-  public static let driverFilelistThreshold: Option = Option("-driver-filelist-threshold", .separate, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], metaVar: "<n>", helpText: "Pass input or output file names as filelists if there are more than <n>", group: .internalDebug)
-  public static let driverForceResponseFiles: Option = Option("-driver-force-response-files", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Force the use of response files for testing", group: .internalDebug)
-  public static let driverMode: Option = Option("--driver-mode=", .joined, attributes: [.helpHidden], helpText: "Set the driver mode to either 'swift' or 'swiftc'")
-  public static let driverPrintActions: Option = Option("-driver-print-actions", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Dump list of actions to perform", group: .internalDebug)
-  public static let driverPrintBindings: Option = Option("-driver-print-bindings", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Dump list of job inputs and outputs", group: .internalDebug)
-  public static let driverPrintDerivedOutputFileMap: Option = Option("-driver-print-derived-output-file-map", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Dump the contents of the derived output file map", group: .internalDebug)
-  public static let driverPrintGraphviz: Option = Option("-driver-print-graphviz", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Write the job graph as a graphviz file")
-  public static let driverPrintJobs: Option = Option("-driver-print-jobs", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Dump list of jobs to execute", group: .internalDebug)
-  public static let driverPrintOutputFileMap: Option = Option("-driver-print-output-file-map", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Dump the contents of the output file map", group: .internalDebug)
-  public static let driverShowIncremental: Option = Option("-driver-show-incremental", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "With -v, dump information about why files are being rebuilt", group: .internalDebug)
-  public static let driverShowJobLifecycle: Option = Option("-driver-show-job-lifecycle", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Show every step in the lifecycle of driver jobs", group: .internalDebug)
-  public static let driverSkipExecution: Option = Option("-driver-skip-execution", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Skip execution of subtasks when performing compilation", group: .internalDebug)
-  public static let driverTimeCompilation: Option = Option("-driver-time-compilation", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Prints the total time it took to execute all compilation tasks")
-  public static let driverUseFilelists: Option = Option("-driver-use-filelists", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Pass input files as filelists whenever possible", group: .internalDebug)
-  public static let driverUseFrontendPath: Option = Option("-driver-use-frontend-path", .separate, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Use the given executable to perform compilations. Arguments can be passed as a ';' separated list", group: .internalDebug)
-  public static let driverVerifyFineGrainedDependencyGraphAfterEveryImport: Option = Option("-driver-verify-fine-grained-dependency-graph-after-every-import", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Debug DriverGraph by verifying it after every import", group: .internalDebug)
-  public static let driverWarnUnusedOptions: Option = Option("-driver-warn-unused-options", .flag, attributes: [.helpHidden], helpText: "Emit warnings for any provided options which are unused by the driver")
-  public static let dumpAbstractLayout: Option = Option("-dump-abstract-layout", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dump abstract layout information for Clang-backed types")
-  public static let dumpApiPath: Option = Option("-dump-api-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "The path to output swift interface files for the compiled source files")
-  public static let dumpAstFormat: Option = Option("-dump-ast-format", .separate, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], metaVar: "<format>", helpText: "Desired format for -dump-ast output ('default', 'json', or 'json-zlib'); no format is guaranteed stable across different compiler versions")
-  public static let dumpAst: Option = Option("-dump-ast", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse and type-check input file(s) and dump AST(s)", group: .modes)
-  public static let dumpAvailabilityScopes: Option = Option("-dump-availability-scopes", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dump availability scopes to stderr")
-  public static let dumpClangDiagnostics: Option = Option("-dump-clang-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dump Clang diagnostics to stderr")
-  public static let dumpClangLookupTables: Option = Option("-dump-clang-lookup-tables", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dump the importer's Swift-name-to-Clang-name lookup tables to stderr")
-  public static let dumpHiddenTypeLayouts: Option = Option("-dump-hidden-type-layouts", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dump every hidden-type layout known to this compilation, including those deserialized from imported swiftmodules")
-  public static let dumpInterfaceHash: Option = Option("-dump-interface-hash", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Parse input file(s) and dump interface token hash(es)", group: .modes)
-  public static let dumpJit: Option = Option("-dump-jit", .joinedOrSeparate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dump JIT contents")
-  public static let dumpMacroExpansions: Option = Option("-dump-macro-expansions", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dumps the results of each macro expansion")
-  public static let dumpMigrationStatesDir: Option = Option("-dump-migration-states-dir", .separate, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>", helpText: "Dump the input text, output text, and states for migration to <path>")
-  public static let dumpParse: Option = Option("-dump-parse", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse input file(s) and dump AST(s)", group: .modes)
-  public static let dumpPcm: Option = Option("-dump-pcm", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Dump debugging information about a precompiled Clang module", group: .modes)
-  public static let dumpRequirementMachine: Option = Option("-dump-requirement-machine", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enables dumping rewrite systems from the generics implementation")
-  public static let dumpScopeMaps: Option = Option("-dump-scope-maps", .separate, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], metaVar: "<expanded-or-list-of-line:column>", helpText: "Parse and type-check input file(s) and dump the scope map(s)", group: .modes)
-  public static let dumpSdk: Option = Option("-dump-sdk", .flag, attributes: [.noDriver], helpText: "Dump SDK content to JSON file")
-  public static let dumpSdk_: Option = Option("--dump-sdk", .flag, alias: Option.dumpSdk, attributes: [.noDriver], helpText: "Dump SDK content to JSON file")
-  public static let dumpSourceFileImports: Option = Option("-dump-source-file-imports", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Dumps the list of imports for each source file")
-  public static let dumpTypeInfo: Option = Option("-dump-type-info", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Output YAML dump of fixed-size types from all imported modules", group: .modes)
-  public static let dumpTypeWitnessSystems: Option = Option("-dump-type-witness-systems", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enables dumping type witness systems from associated type inference")
-  public static let dumpUsr: Option = Option("-dump-usr", .flag, attributes: [.frontend, .noInteractive], helpText: "Dump USR for each declaration reference")
-  public static let dwarfVersion: Option = Option("-dwarf-version=", .joined, attributes: [.frontend], metaVar: "<version>", helpText: "DWARF debug info version to produce if requested")
-  public static let dynamicMemberLookupDepthLimitEQ: Option = Option("-dynamic-member-lookup-depth-limit=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "The maximum number of dynamic member lookups that can be chained to resolve a member reference")
-  public static let D: Option = Option("-D", .joinedOrSeparate, attributes: [.frontend], helpText: "Marks a conditional compilation flag as true")
-  public static let eagerMacroChecking: Option = Option("-eager-macro-checking", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable eager type-checking of declarations in macro expansions")
-  public static let embedBitcodeMarker: Option = Option("-embed-bitcode-marker", .flag, attributes: [.frontend, .noInteractive], helpText: "Embed placeholder LLVM IR data as a marker")
-  public static let embedBitcode: Option = Option("-embed-bitcode", .flag, attributes: [.frontend, .noInteractive], helpText: "Embed LLVM IR bitcode as data")
-  public static let embedTbdForModule: Option = Option("-embed-tbd-for-module", .separate, attributes: [.frontend], helpText: "Embed symbols from the module in the emitted tbd file")
-  public static let emitAbiDescriptorPath: Option = Option("-emit-abi-descriptor-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output the ABI descriptor of current module to <path>")
-  public static let emitApiDescriptorPath: Option = Option("-emit-api-descriptor-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output a JSON file describing the module's API to <path>")
-  public static let emitApiDescriptor: Option = Option("-emit-api-descriptor", .flag, attributes: [.noInteractive, .supplementaryOutput, .cacheInvariant], helpText: "Output a JSON file describing the module's API")
-  public static let emitAssembly: Option = Option("-emit-assembly", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit assembly file(s) (-S)", group: .modes)
-  public static let emitAst: Option = Option("-emit-ast", .flag, alias: Option.dumpAst, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild])
-  public static let emitBc: Option = Option("-emit-bc", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit LLVM BC file(s)", group: .modes)
-  public static let emitClangHeaderMinAccess: Option = Option("-emit-clang-header-min-access", .separate, attributes: [.frontend, .noInteractive, .cacheInvariant], metaVar: "<access-level>", helpText: "The minimum access level of declarations to include in the emitted header")
-  public static let emitClangHeaderNonmodularIncludes: Option = Option("-emit-clang-header-nonmodular-includes", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput], helpText: "Augment emitted Objective-C header with textual imports for every included modular import")
-  public static let emitClangHeaderPath: Option = Option("-emit-clang-header-path", .separate, alias: Option.emitObjcHeaderPath, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], helpText: "Emit an Objective-C and C++ header file to <path>")
-  public static let emitConstValuesPath: Option = Option("-emit-const-values-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit the extracted compile-time known values to <path>")
-  public static let emitConstValues: Option = Option("-emit-const-values", .flag, attributes: [.noInteractive, .supplementaryOutput])
-  public static let emitDependenciesPath: Option = Option("-emit-dependencies-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output basic Make-compatible dependencies file to <path>")
-  public static let emitDependencies: Option = Option("-emit-dependencies", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput], helpText: "Emit basic Make-compatible dependencies files")
-  public static let emitDigesterBaselinePath: Option = Option("-emit-digester-baseline-path", .separate, attributes: [.noInteractive, .argumentIsPath, .supplementaryOutput], metaVar: "<path>", helpText: "Emit a baseline file for the module to <path> using the API digester")
-  public static let emitDigesterBaseline: Option = Option("-emit-digester-baseline", .flag, attributes: [.noInteractive, .supplementaryOutput], helpText: "Emit a baseline file for the module using the API digester")
-  public static let emitEmptyObjectFile: Option = Option("-emit-empty-object-file", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Produce a valid but dummy object file when building a library module")
-  public static let emitExecutable: Option = Option("-emit-executable", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit a linked executable", group: .modes)
-  public static let emitExtensionBlockSymbols: Option = Option("-emit-extension-block-symbols", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Emit 'swift.extension' symbols for extensions to external types instead of directly associating members and conformances with the extended nominal when generating symbol graphs")
-  public static let emitFineGrainedDependencySourcefileDotFiles: Option = Option("-emit-fine-grained-dependency-sourcefile-dot-files", .flag, attributes: [.helpHidden, .frontend], helpText: "Emit dot files for every source file.")
-  public static let emitFixitsPath: Option = Option("-emit-fixits-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output compiler fixits as source edits to <path>")
-  public static let emitImportedModules: Option = Option("-emit-imported-modules", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit a list of the imported modules", group: .modes)
-  public static let emitIrgen: Option = Option("-emit-irgen", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit LLVM IR file(s) before LLVM optimizations", group: .modes)
-  public static let emitIr: Option = Option("-emit-ir", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit LLVM IR file(s) after LLVM optimizations", group: .modes)
-  public static let emitLibrary: Option = Option("-emit-library", .flag, attributes: [.noInteractive], helpText: "Emit a linked library", group: .modes)
-  public static let emitLoadedModuleTracePathEQ: Option = Option("-emit-loaded-module-trace-path=", .joined, alias: Option.emitLoadedModuleTracePath, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant])
-  public static let emitLoadedModuleTracePath: Option = Option("-emit-loaded-module-trace-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit the loaded module trace JSON to <path>")
-  public static let emitLoadedModuleTrace: Option = Option("-emit-loaded-module-trace", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput], helpText: "Emit a JSON file containing information about what modules were loaded")
-  public static let emitLoweredSil: Option = Option("-emit-lowered-sil", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit lowered SIL file(s)", group: .modes)
-  public static let emitMacroExpansionFiles: Option = Option("-emit-macro-expansion-files", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Specify when to emit macro expansion file: 'none', 'debug', or 'diagnostics'")
-  public static let emitMigratedFilePath: Option = Option("-emit-migrated-file-path", .separate, attributes: [.frontend, .noDriver, .noInteractive, .doesNotAffectIncrementalBuild], metaVar: "<path>", helpText: "Emit the migrated source file to <path>")
-  public static let emitModuleDependenciesPath: Option = Option("-emit-module-dependencies-path", .separate, attributes: [.argumentIsPath, .supplementaryOutput], metaVar: "<path>", helpText: "Emit a discovered dependencies file for the emit-module task to <path>")
-  public static let emitModuleDocPath: Option = Option("-emit-module-doc-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output module documentation file <path>")
-  public static let emitModuleDoc: Option = Option("-emit-module-doc", .flag, attributes: [.frontend, .noDriver], helpText: "Emit a module documentation file based on documentation comments")
-  public static let emitModuleInterfacePath: Option = Option("-emit-module-interface-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output module interface file to <path>")
-  public static let emitModuleInterface: Option = Option("-emit-module-interface", .flag, attributes: [.noInteractive, .supplementaryOutput], helpText: "Output module interface file")
-  public static let emitModulePathEQ: Option = Option("-emit-module-path=", .joined, alias: Option.emitModulePath, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant])
-  public static let emitModulePath: Option = Option("-emit-module-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit an importable module to <path>")
-  public static let emitModuleSemanticInfoPath: Option = Option("-emit-module-semantic-info-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output semantic info of current module to <path>")
-  public static let emitModuleSeparatelyWMO: Option = Option("-emit-module-separately-wmo", .flag, attributes: [.helpHidden], helpText: "Emit module files as a distinct job in wmo builds")
-  public static let emitModuleSerializeDiagnosticsPath: Option = Option("-emit-module-serialize-diagnostics-path", .separate, attributes: [.argumentIsPath, .supplementaryOutput], metaVar: "<path>", helpText: "Emit a serialized diagnostics file for the emit-module task to <path>")
-  public static let emitModuleSourceInfoPath: Option = Option("-emit-module-source-info-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output module source info file to <path>")
-  public static let emitModuleSourceInfo: Option = Option("-emit-module-source-info", .flag, attributes: [.frontend, .noDriver], helpText: "Output module source info file")
-  public static let emitModuleSummaryPath: Option = Option("-emit-module-summary-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output module summary file to <path>")
-  public static let emitModuleSummary: Option = Option("-emit-module-summary", .flag, attributes: [.noInteractive, .supplementaryOutput], helpText: "Output module summary file")
-  public static let emitModule: Option = Option("-emit-module", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput], helpText: "Emit an importable module")
-  public static let emitObjcHeaderPath: Option = Option("-emit-objc-header-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit an Objective-C header file to <path>")
-  public static let emitObjcHeader: Option = Option("-emit-objc-header", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput], helpText: "Emit an Objective-C header file")
-  public static let emitObject: Option = Option("-emit-object", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit object file(s) (-c)", group: .modes)
-  public static let emitPackageModuleInterfacePath: Option = Option("-emit-package-module-interface-path", .separate, attributes: [.helpHidden, .frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output package module interface file to <path>")
-  public static let emitParseableModuleInterfacePath: Option = Option("-emit-parseable-module-interface-path", .separate, alias: Option.emitModuleInterfacePath, attributes: [.helpHidden, .frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant])
-  public static let emitParseableModuleInterface: Option = Option("-emit-parseable-module-interface", .flag, alias: Option.emitModuleInterface, attributes: [.helpHidden, .noInteractive, .supplementaryOutput])
-  public static let emitParse: Option = Option("-emit-parse", .flag, alias: Option.dumpParse, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild])
-  public static let emitPch: Option = Option("-emit-pch", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit PCH for imported Objective-C header file", group: .modes)
-  public static let emitPcm: Option = Option("-emit-pcm", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit a precompiled Clang module from a module map", group: .modes)
-  public static let emitPolyglotAst: Option = Option("-emit-polyglot-ast", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse the Objective-C input file and emit polyglot AST as JSON", group: .modes)
-  public static let emitPrivateModuleInterfacePath: Option = Option("-emit-private-module-interface-path", .separate, attributes: [.helpHidden, .frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output private module interface file to <path>")
-  public static let emitReferenceDependenciesPath: Option = Option("-emit-reference-dependencies-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output Swift-style dependencies file to <path>")
-  public static let emitReferenceDependencies: Option = Option("-emit-reference-dependencies", .flag, attributes: [.frontend, .noDriver], helpText: "Emit a Swift-style dependencies file")
-  public static let emitRemapFilePath: Option = Option("-emit-remap-file-path", .separate, attributes: [.frontend, .noDriver, .noInteractive, .doesNotAffectIncrementalBuild], metaVar: "<path>", helpText: "Emit the replacement map describing Swift Migrator changes to <path>")
-  public static let emitSibgen: Option = Option("-emit-sibgen", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit serialized AST + raw SIL file(s)", group: .modes)
-  public static let emitSib: Option = Option("-emit-sib", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit serialized AST + canonical SIL file(s)", group: .modes)
-  public static let emitSilgen: Option = Option("-emit-silgen", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit raw SIL file(s)", group: .modes)
-  public static let emitSil: Option = Option("-emit-sil", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit canonical SIL file(s)", group: .modes)
-  public static let emitSingletonMetadataPointer: Option = Option("-emit-singleton-metadata-pointer", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit a pointer to the corresponding type metadata into non-public non-generic type descriptors.")
-  public static let emitSortedSil: Option = Option("-emit-sorted-sil", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "When printing SIL, print out all sil entities sorted by name to ease diffing")
-  public static let stackPromotionChecks: Option = Option("-emit-stack-promotion-checks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit runtime checks for correct stack promotion of objects.")
-  public static let emitSupportedArguments: Option = Option("-emit-supported-arguments", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit a JSON file including all supported compiler arguments", group: .modes)
-  public static let emitSupportedFeatures: Option = Option("-emit-supported-features", .flag, alias: Option.emitSupportedArguments, attributes: [.helpHidden, .frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "This is a compatibility alias for '-emit-supported-arguments'", group: .modes)
-  public static let emitSymbolGraphDir: Option = Option("-emit-symbol-graph-dir", .separate, attributes: [.helpHidden, .frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<dir>", helpText: "Emit a symbol graph to directory <dir>")
-  public static let emitSymbolGraph: Option = Option("-emit-symbol-graph", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Emit a symbol graph")
-  public static let emitTbdPathEQ: Option = Option("-emit-tbd-path=", .joined, alias: Option.emitTbdPath, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant])
-  public static let emitTbdPath: Option = Option("-emit-tbd-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit the TBD file to <path>")
-  public static let emitTbd: Option = Option("-emit-tbd", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput], helpText: "Emit a TBD file")
-  public static let emitVariantAbiDescriptorPath: Option = Option("-emit-variant-abi-descriptor-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output the ABI descriptor of current target variant module to <path>")
-  public static let emitVariantApiDescriptorPath: Option = Option("-emit-variant-api-descriptor-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output a JSON file describing the target variant module's API to <path>")
-  public static let emitVariantModuleDocPath: Option = Option("-emit-variant-module-doc-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output module documentation file for the target variant to <path>")
-  public static let emitVariantModuleInterfacePath: Option = Option("-emit-variant-module-interface-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output module interface file for the target variant to <path>")
-  public static let emitVariantModulePath: Option = Option("-emit-variant-module-path", .separate, attributes: [.noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit an importable module for the target variant at the specified path")
-  public static let emitVariantModuleSourceInfoPath: Option = Option("-emit-variant-module-source-info-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output module source info file for the target variant to <path>")
-  public static let emitVariantPackageModuleInterfacePath: Option = Option("-emit-variant-package-module-interface-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output package module interface file for the target variant to <path>")
-  public static let emitVariantPrivateModuleInterfacePath: Option = Option("-emit-variant-private-module-interface-path", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Output private module interface file for the target variant to <path>")
-  public static let emitVerboseSil: Option = Option("-emit-verbose-sil", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit locations during SIL emission")
-  public static let emptyAbiDescriptor: Option = Option("-empty-abi-descriptor", .flag, attributes: [.frontend, .noDriver], helpText: "Avoid printing actual module content into ABI descriptor file")
-  public static let emptyBaseline: Option = Option("-empty-baseline", .flag, attributes: [.noDriver], helpText: "Use empty baseline for diagnostics")
-  public static let emptyBaseline_: Option = Option("--empty-baseline", .flag, alias: Option.emptyBaseline, attributes: [.noDriver], helpText: "Use empty baseline for diagnostics")
-  public static let enableAccessControl: Option = Option("-enable-access-control", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Respect access control restrictions")
-  public static let enableActorDataRaceChecks: Option = Option("-enable-actor-data-race-checks", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit runtime checks for actor data races")
-  public static let enableAddressDependencies: Option = Option("-enable-address-dependencies", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable enforcement of lifetime dependencies on addressable values.")
-  public static let enableAggressiveReg2mem: Option = Option("-enable-aggressive-reg2mem", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable a more aggressive reg2mem heuristic")
-  public static let enableAnonymousContextMangledNames: Option = Option("-enable-anonymous-context-mangled-names", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable emission of mangled names in anonymous context descriptors")
-  public static let enableArm64Corocc: Option = Option("-enable-arm64-corocc", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use swiftcorocc for yield_once_2 routines on arm64 variants.")
-  public static let enableAssemblyVisionAll: Option = Option("-enable-assembly-vision-all", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable assembly vision for all functions")
-  public static let enableAstVerifier: Option = Option("-enable-ast-verifier", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Run the AST verifier during compilation. NOTE: This lets the user override the default behavior on whether or not the ASTVerifier is run. The default behavior is to run the verifier when asserts are enabled and not run it when asserts are disabled. NOTE: Can not be used if disable-ast-verifier is used as well")
-  public static let enableAsyncFramePointerAll: Option = Option("-enable-async-frame-pointer-all", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Always emit async frame stack frames (frame-pointer=all)")
-  public static let enableAsyncFramePushPopMetadata: Option = Option("-enable-async-frame-push-pop-metadata", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable async frame push pop metadata")
-  public static let enableAutolinkingRuntimeCompatibilityBytecodeLayouts: Option = Option("-enable-autolinking-runtime-compatibility-bytecode-layouts", .flag, attributes: [.frontend], helpText: "Enable autolinking for the bytecode layouts runtime compatibility library")
-  public static let enableBareSlashRegex: Option = Option("-enable-bare-slash-regex", .flag, attributes: [.frontend, .moduleInterface], helpText: "Enable the use of forward slash regular-expression literal syntax")
-  public static let enableBatchMode: Option = Option("-enable-batch-mode", .flag, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "Enable combining frontend jobs into batches")
-  public static let enableBridgingPch: Option = Option("-enable-bridging-pch", .flag, attributes: [.helpHidden], helpText: "Enable automatic generation of bridging PCH files")
-  public static let enableBuiltinModule: Option = Option("-enable-builtin-module", .flag, attributes: [.frontend, .moduleInterface], helpText: "Enables the explicit import of the Builtin module")
-  public static let enableCalleeAllocatedCoroAbi: Option = Option("-enable-callee-allocated-coro-abi", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Override per-platform settings and use yield_once_2.")
-  public static let EnableCMOEverything: Option = Option("-enable-cmo-everything", .flag, attributes: [.helpHidden, .frontend], helpText: "Perform cross-module optimization on everything (all APIs). This is the same level of serialization as Embedded Swift.")
-  public static let enableCollocateMetadataFunctions: Option = Option("-enable-collocate-metadata-functions", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable collocate metadata functions")
-  public static let enableColocateTypeDescriptors: Option = Option("-enable-colocate-type-descriptors", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable colocate type descriptors")
-  public static let enableCondFailMessageAnnotation: Option = Option("-enable-cond-fail-message-annotation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable cond_fail message annotation. Will serialize a .o.yaml file per .o file.")
-  public static let copyPropagationStateEQ: Option = Option("-enable-copy-propagation=", .joined, attributes: [.frontend, .noDriver], metaVar: "always|optimizing|requested-passes-only|false", helpText: "Whether to enable copy propagation")
-  public static let enableCopyPropagation: Option = Option("-enable-copy-propagation", .flag, attributes: [.frontend, .noDriver], helpText: "Always run SIL copy propagation with lexical lifetimes to shorten object lifetimes while preserving variable lifetimes.")
-  public static let enableCrossImportOverlays: Option = Option("-enable-cross-import-overlays", .flag, attributes: [.frontend, .noDriver], helpText: "Automatically import declared cross-import overlays.")
-  public static let EnableDefaultCMO: Option = Option("-enable-default-cmo", .flag, attributes: [.helpHidden, .frontend], helpText: "Perform conservative cross-module optimization")
-  public static let enableDeserializationRecovery: Option = Option("-enable-deserialization-recovery", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Attempt to recover from missing xrefs (etc) in swiftmodules")
-  public static let enableDeserializationSafety: Option = Option("-enable-deserialization-safety", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Avoid reading potentially unsafe decls in swiftmodules")
-  public static let enableDestroyHoisting: Option = Option("-enable-destroy-hoisting=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "true|false", helpText: "Whether to enable destroy hoisting")
-  public static let enableDeterministicCheck: Option = Option("-enable-deterministic-check", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild, .cacheInvariant], helpText: "Check compiler output determinism by running it twice")
-  public static let enableDirectRetainRelease: Option = Option("-enable-direct-retain-release", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable use of swift_retain/releaseDirect functions")
-  public static let enableDynamicReplacementChaining: Option = Option("-enable-dynamic-replacement-chaining", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable chaining of dynamic replacements")
-  public static let enableEmitGenericClassRoTList: Option = Option("-enable-emit-generic-class-ro_t-list", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable emission of a section with references to class_ro_t of generic class patterns")
-  public static let enableEmitTypeMallocForCoroFrame: Option = Option("-enable-emit-type-malloc-for-coro-frame", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable emitting typed malloc for coroutine frame allocation")
-  public static let enableExperimentalAdditiveArithmeticDerivation: Option = Option("-enable-experimental-additive-arithmetic-derivation", .flag, attributes: [.frontend], helpText: "Enable experimental 'AdditiveArithmetic' derived conformances")
-  public static let enableAsyncDemotion: Option = Option("-enable-experimental-async-demotion", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enables an optimization pass to demote async functions.")
-  public static let enableExperimentalAsyncTopLevel: Option = Option("-enable-experimental-async-top-level", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable experimental concurrency in top-level code")
-  public static let enableExperimentalConcisePoundFile: Option = Option("-enable-experimental-concise-pound-file", .flag, attributes: [.frontend, .moduleInterface], helpText: "Enable experimental concise '#file' identifier")
-  public static let enableExperimentalConcurrency: Option = Option("-enable-experimental-concurrency", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable experimental concurrency model")
-  public static let enableExperimentalCxxInterop: Option = Option("-enable-experimental-cxx-interop", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental C++ interop code generation and config directives")
-  public static let enableExperimentalDistributed: Option = Option("-enable-experimental-distributed", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable experimental 'distributed' actors and functions")
-  public static let enableExperimentalEagerClangModuleDiagnostics: Option = Option("-enable-experimental-eager-clang-module-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable experimental eager diagnostics reporting on the importability of all referenced C, C++, and Objective-C libraries")
-  public static let enableExperimentalFeature: Option = Option("-enable-experimental-feature", .separate, attributes: [.frontend, .synthesizeInterface, .moduleInterface], helpText: "Enable an experimental feature")
-  public static let enableExperimentalFlowSensitiveConcurrentCaptures: Option = Option("-enable-experimental-flow-sensitive-concurrent-captures", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable flow-sensitive concurrent captures")
-  public static let enableExperimentalForwardModeDifferentiation: Option = Option("-enable-experimental-forward-mode-differentiation", .flag, attributes: [.frontend], helpText: "Enable experimental forward mode differentiation")
-  public static let enableExperimentalLifetimeDependenceInference: Option = Option("-enable-experimental-lifetime-dependence-inference", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental lifetime dependence inference")
-  public static let enableExperimentalMoveOnly: Option = Option("-enable-experimental-move-only", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable experimental move only")
-  public static let enableExperimentalNamedOpaqueTypes: Option = Option("-enable-experimental-named-opaque-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental support for named opaque result types")
-  public static let enableExperimentalOpaqueTypeErasure: Option = Option("-enable-experimental-opaque-type-erasure", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Type-erases opaque types that conform to @_typeEraser protocols")
-  public static let enableExperimentalOpenedExistentialTypes: Option = Option("-enable-experimental-opened-existential-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental support for implicitly opened existentials")
-  public static let enableExperimentalPairwiseBuildBlock: Option = Option("-enable-experimental-pairwise-build-block", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable experimental pairwise 'buildBlock' for result builders")
-  public static let enableExperimentalStaticAssert: Option = Option("-enable-experimental-static-assert", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental #assert")
-  public static let enableExperimentalStringProcessing: Option = Option("-enable-experimental-string-processing", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental string processing")
-  public static let enableExplicitExistentialTypes: Option = Option("-enable-explicit-existential-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental support for explicit existential types")
-  public static let enableFragileResilientProtocolWitnesses: Option = Option("-enable-fragile-relative-protocol-tables", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable relative protocol witness tables")
-  public static let enableImplicitDynamic: Option = Option("-enable-implicit-dynamic", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Add 'dynamic' to all declarations")
-  public static let enableImportPtrauthFieldFunctionPointers: Option = Option("-enable-import-ptrauth-field-function-pointers", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable import of custom ptrauth qualified field function pointers. This is on by default.")
-  public static let enableIncrementalFileHashing: Option = Option("-enable-incremental-file-hashing", .flag, attributes: [], helpText: "Enable hashing of input and dependency file data that can prevent unnecessary invalidation")
-  public static let enableIncrementalImports: Option = Option("-enable-incremental-imports", .flag, attributes: [.frontend], helpText: "Enable cross-module incremental build metadata and driver scheduling for Swift modules")
-  public static let enableInvalidEphemeralnessAsError: Option = Option("-enable-invalid-ephemeralness-as-error", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Diagnose invalid ephemeral to non-ephemeral conversions as errors")
-  public static let enableLargeLoadableTypesReg2mem: Option = Option("-enable-large-loadable-types-reg2mem", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable large loadable types register to memory pass")
-  public static let enableLayoutStringValueWitnessesInstantiation: Option = Option("-enable-layout-string-value-witnesses-instantiation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable runtime instantiation of layout string value witnesses for generic types")
-  public static let enableLayoutStringValueWitnesses: Option = Option("-enable-layout-string-value-witnesses", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable layout string based value witnesses")
-  public static let enableLexicalLifetimes: Option = Option("-enable-lexical-lifetimes=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "true|false", helpText: "Whether to enable lexical lifetimes")
-  public static let enableLexicalLifetimesNoArg: Option = Option("-enable-lexical-lifetimes", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable lexical lifetimes")
-  public static let enableLibraryEvolution: Option = Option("-enable-library-evolution", .flag, attributes: [.frontend, .moduleInterface], helpText: "Build the module to allow binary-compatible library evolution")
-  public static let enableLifetimeDependenceDiagnostics: Option = Option("-enable-lifetime-dependence-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable lifetime dependence diagnostics for Nonescapable types.")
-  public static let enableLlvmValueNames: Option = Option("-enable-llvm-value-names", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Add names to local values in LLVM IR")
-  public static let enableLlvmVerifyEach: Option = Option("-enable-llvm-verify-each", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Run the LLVM IR verifier after every pass.")
-  public static let enableLlvmVfe: Option = Option("-enable-llvm-vfe", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use LLVM IR Virtual Function Elimination on Swift class virtual tables")
-  public static let enableLlvmWme: Option = Option("-enable-llvm-wme", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use LLVM IR Witness Method Elimination on Swift protocol witness tables")
-  public static let enableModuleSelectorsInModuleInterface: Option = Option("-enable-module-selectors-in-module-interface", .flag, attributes: [.frontend, .noInteractive], helpText: "When emitting module interface files, use module selectors to avoid name collisions")
-  public static let enableMoveInoutStackProtector: Option = Option("-enable-move-inout-stack-protector", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable the stack protector by moving values to temporaries")
-  public static let enableNewLlvmPassManager: Option = Option("-enable-new-llvm-pass-manager", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable the new llvm pass manager")
-  public static let enableNewOperatorLookup: Option = Option("-enable-new-operator-lookup", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable the new operator decl and precedencegroup lookup behavior")
-  public static let enableNonfrozenEnumExhaustivityDiagnostics: Option = Option("-enable-nonfrozen-enum-exhaustivity-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Diagnose switches over non-frozen enums without catch-all cases")
-  public static let enableNoreturnPrediction: Option = Option("-enable-noreturn-prediction", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enables optimization assumption that calls to no-return functions are cold.")
-  public static let enableNskeyedarchiverDiagnostics: Option = Option("-enable-nskeyedarchiver-diagnostics", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Diagnose classes with unstable mangled names adopting NSCoding")
-  public static let enableObjcAttrRequiresFoundationModule: Option = Option("-enable-objc-attr-requires-foundation-module", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable requiring uses of @objc to require importing the Foundation module")
-  public static let enableObjcInterop: Option = Option("-enable-objc-interop", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Enable Objective-C interop code generation and config directives")
-  public static let enableObjectiveCProtocolSymbolicReferences: Option = Option("-enable-objective-c-protocol-symbolic-references", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable objective-c protocol symbolic references")
-  public static let enableOnlyOneDependencyFile: Option = Option("-enable-only-one-dependency-file", .flag, attributes: [.doesNotAffectIncrementalBuild], helpText: "Enables incremental build optimization that only produces one dependencies file")
-  public static let enableOssaModules: Option = Option("-enable-ossa-modules", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Obsolete. This option is ignored")
-  public static let enablePackMetadataStackPromotion: Option = Option("-enable-pack-metadata-stack-promotion=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "true|false", helpText: "Whether to skip heapifying stack metadata packs when possible.")
-  public static let enablePackMetadataStackPromotionNoArg: Option = Option("-enable-pack-metadata-stack-promotion", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Skip heapifying stack metadata packs when possible.")
-  public static let enablePrivateImports: Option = Option("-enable-private-imports", .flag, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "Allows this module's internal and private API to be accessed")
-  public static let enableProfilingMarkerThunks: Option = Option("-enable-profiling-marker-thunks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable profiling marker thunks")
-  public static let enableRecompilationToOssaModule: Option = Option("-enable-recompilation-to-ossa-module", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allow recompilation of a non-OSSA module to an OSSA module when imported from another OSSA module")
-  public static let enableRelativeProtocolWitnessTables: Option = Option("-enable-relative-protocol-witness-tables", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable relative protocol witness tables")
-  public static let enableRemoveDeprecatedCheck: Option = Option("-enable-remove-deprecated-check", .flag, attributes: [.noDriver], helpText: "Diagnosing removal of deprecated symbols")
-  public static let enableRemoveDeprecatedCheck_: Option = Option("--enable-remove-deprecated-check", .flag, alias: Option.enableRemoveDeprecatedCheck, attributes: [.noDriver], helpText: "Diagnosing removal of deprecated symbols")
-  public static let enableRequirementMachineOpaqueArchetypes: Option = Option("-enable-requirement-machine-opaque-archetypes", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable more correct opaque archetype support, which is off by default because it might fail to produce a convergent rewrite system")
-  public static let enableResilience: Option = Option("-enable-resilience", .flag, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Deprecated, use -enable-library-evolution instead")
-  public static let enableRoundTripDebugTypes: Option = Option("-enable-round-trip-debug-types", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enables verification of debug info mangling")
-  public static let enableSilOpaqueValues: Option = Option("-enable-sil-opaque-values", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable SIL Opaque Values")
-  public static let enableSingleModuleLlvmEmission: Option = Option("-enable-single-module-llvm-emission", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit LLVM IR into a single LLVM module in multithreaded mode.")
-  public static let enableSourceImport: Option = Option("-enable-source-import", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable importing of Swift source files")
-  public static let enableSpecDevirt: Option = Option("-enable-spec-devirt", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Deprecated, has no effect")
-  public static let enableSplitColdCode: Option = Option("-enable-split-cold-code", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable splitting of cold code when optimizing")
-  public static let enableStackProtector: Option = Option("-enable-stack-protector", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable the stack protector")
-  public static let enableSwift3ObjcInference: Option = Option("-enable-swift3-objc-inference", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Deprecated, has no effect")
-  public static let enableTargetOsChecking: Option = Option("-enable-target-os-checking", .flag, attributes: [.frontend, .noDriver], helpText: "Enable checking the target OS of serialized modules")
-  public static let enableTestableAttrRequiresTestableModule: Option = Option("-enable-testable-attr-requires-testable-module", .flag, attributes: [.frontend, .noDriver], helpText: "Enable checking of @testable")
-  public static let enableTesting: Option = Option("-enable-testing", .flag, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "Allows this module's internal API to be accessed for testing")
-  public static let enableThrowWithoutTry: Option = Option("-enable-throw-without-try", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allow throwing function calls without 'try'")
-  public static let enableThrowsPrediction: Option = Option("-enable-throws-prediction", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enables optimization assumption that functions rarely throw errors.")
-  public static let enableTypeLayouts: Option = Option("-enable-type-layout", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable type layout based lowering")
-  public static let enableUpcomingFeature: Option = Option("-enable-upcoming-feature", .separate, attributes: [.frontend, .synthesizeInterface, .moduleInterface], helpText: "Enable a feature that will be introduced in an upcoming language version")
-  public static let enableVerifyExclusivity: Option = Option("-enable-verify-exclusivity", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable verification of access markers used to enforce exclusivity.")
-  public static let enableVolatileModules: Option = Option("-enable-volatile-modules", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Load Swift modules in memory")
-  public static let enableX8664Corocc: Option = Option("-enable-x86_64-corocc", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use swiftcorocc for yield_once_2 routines on x86_64.")
-  public static let enforceExclusivityEQ: Option = Option("-enforce-exclusivity=", .joined, attributes: [.frontend, .moduleInterface], metaVar: "<enforcement>", helpText: "Enforce law of exclusivity")
-  public static let entryPointFunctionName: Option = Option("-entry-point-function-name", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<string>", helpText: "Name of the entry point function")
-  public static let errorOnAbiBreakage: Option = Option("-error-on-abi-breakage", .flag, attributes: [.noDriver], helpText: "Always treat ABI checker issues as errors")
-  public static let errorOnAbiBreakage_: Option = Option("--error-on-abi-breakage", .flag, alias: Option.errorOnAbiBreakage, attributes: [.noDriver], helpText: "Always treat ABI checker issues as errors")
-  public static let experimentalAllowModuleWithCompilerErrors: Option = Option("-experimental-allow-module-with-compiler-errors", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Attempt to output .swiftmodule, regardless of compilation errors")
-  public static let experimentalAllowNonResilientAccess: Option = Option("-experimental-allow-non-resilient-access", .flag, attributes: [.frontend], helpText: "Deprecated; use -allow-non-resilient-access instead")
-  public static let experimentalAllowedReexportedModules: Option = Option("-experimental-allowed-reexported-modules=", .commaJoined, attributes: [.noDriver], helpText: "Allow reexporting symbols from the provided modules if they are themselves exported from the main module. This is a comma separated list of module names.")
-  public static let experimentalCForeignReferenceTypes: Option = Option("-experimental-c-foreign-reference-types", .flag, attributes: [.helpHidden, .frontend, .moduleInterface], helpText: "Enable experimental C foreign references types. Deprecated, has no effect.")
-  public static let experimentalClangImporterDirectCc1Scan: Option = Option("-experimental-clang-importer-direct-cc1-scan", .flag, attributes: [.helpHidden, .frontend], helpText: "Enables swift driver to construct swift-frontend invocations using -direct-clang-cc1-module-build")
-  public static let emitModuleSeparately: Option = Option("-experimental-emit-module-separately", .flag, attributes: [.helpHidden], helpText: "Emit module files as a distinct job")
-  public static let experimentalEmitVariantModule: Option = Option("-experimental-emit-variant-module", .flag, attributes: [], helpText: "When a target variant triple is specified, the same driver invocation will emit two Swift modules, one for the primary target and one for the variant.")
-  public static let driverExperimentalExplicitModuleBuild: Option = Option("-experimental-explicit-module-build", .flag, alias: Option.driverExplicitModuleBuild, attributes: [.helpHidden], helpText: "Prebuild module dependencies to make them explicit")
-  public static let experimentalHermeticSealAtLink: Option = Option("-experimental-hermetic-seal-at-link", .flag, attributes: [.helpHidden, .frontend], helpText: "Library code can assume that all clients are visible at linktime, and aggressively strip unused code")
-  public static let experimentalLazyTypecheck: Option = Option("-experimental-lazy-typecheck", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Type-check lazily as needed to produce requested outputs")
-  public static let experimentalPackageBypassResilience: Option = Option("-experimental-package-bypass-resilience", .flag, attributes: [.frontend], helpText: "Deprecated; has no effect")
-  public static let ExperimentalPackageCMOAbortOnDeserializationFail: Option = Option("-experimental-package-cmo-abort-on-deserialization-fail", .flag, attributes: [.frontend], helpText: "Abort if a deserialization error is found while package optimization is enabled")
-  public static let ExperimentalPackageCMO: Option = Option("-experimental-package-cmo", .flag, attributes: [.frontend], helpText: "Deprecated; use -package-cmo instead")
-  public static let experimentalPackageInterfaceLoad: Option = Option("-experimental-package-interface-load", .flag, attributes: [.helpHidden, .frontend], helpText: "Enables loading a package interface if in the same package specified with package-name")
-  public static let ExperimentalPerformanceAnnotations: Option = Option("-experimental-performance-annotations", .flag, attributes: [.helpHidden, .frontend], helpText: "Deprecated, has no effect")
-  public static let platformCCallingConventionEQ: Option = Option("-experimental-platform-c-calling-convention=", .joined, alias: Option.platformCCallingConvention, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let platformCCallingConvention: Option = Option("-experimental-platform-c-calling-convention", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Which calling convention is used to perform non-swift calls. Defaults to llvm's standard C calling convention.")
-  public static let experimentalPrintFullConvention: Option = Option("-experimental-print-full-convention", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "When emitting a module interface or SIL, emit additional @convention arguments, regardless of whether they were written in the source. Also requires -use-clang-function-types to be enabled.")
-  public static let experimentalSerializeDebugInfo: Option = Option("-experimental-serialize-debug-info", .flag, attributes: [.helpHidden, .frontend], helpText: "Enables serialization/deserialization of debug scopes")
-  public static let experimentalSkipAllFunctionBodies: Option = Option("-experimental-skip-all-function-bodies", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Skip type-checking function bodies and all SIL generation")
-  public static let experimentalSkipNonExportableDecls: Option = Option("-experimental-skip-non-exportable-decls", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Skip decls that are not exported to clients")
-  public static let experimentalSkipNonInlinableFunctionBodiesWithoutTypes: Option = Option("-experimental-skip-non-inlinable-function-bodies-without-types", .flag, attributes: [.helpHidden, .frontend], helpText: "Skip work on non-inlinable function bodies that do not declare nested types")
-  public static let experimentalSkipNonInlinableFunctionBodies: Option = Option("-experimental-skip-non-inlinable-function-bodies", .flag, attributes: [.helpHidden, .frontend], helpText: "Skip type-checking and SIL generation for non-inlinable function bodies")
-  public static let experimentalSpiImports: Option = Option("-experimental-spi-imports", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental support for SPI imports")
-  public static let experimentalSpiOnlyImports: Option = Option("-experimental-spi-only-imports", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable use of @_spiOnly imports")
-  public static let explainModuleDependencyDetailed: Option = Option("-explain-module-dependency-detailed", .separate, attributes: [], helpText: "Emit remarks describing every possible dependency path that explains why compilation may depend on a module with a given name.")
-  public static let explainModuleDependency: Option = Option("-explain-module-dependency", .separate, attributes: [], helpText: "Emit remark describing why compilation may depend on a module with a given name.")
-  public static let explicitAutoLinking: Option = Option("-explicit-auto-linking", .flag, attributes: [], helpText: "Instead of linker-load directives, have the driver specify all link dependencies on the linker invocation. Requires '-explicit-module-build'.")
-  public static let explicitDependencyGraphFormat: Option = Option("-explicit-dependency-graph-format=", .joined, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Specify the explicit dependency graph output format to either 'json' or 'dot'")
-  public static let explicitInterfaceModuleBuild: Option = Option("-explicit-interface-module-build", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use the specified command-line to build the module from interface, instead of flags specified in the interface")
-  public static let driverExplicitModuleBuild: Option = Option("-explicit-module-build", .flag, attributes: [], helpText: "Prebuild module dependencies to make them explicit")
-  public static let explicitSwiftModuleMap: Option = Option("-explicit-swift-module-map-file", .separate, attributes: [.frontend, .noDriver], metaVar: "<path>", helpText: "Specify a JSON file containing information of explicit Swift modules")
-  public static let exportAs: Option = Option("-export-as", .separate, attributes: [.frontend, .moduleInterface], helpText: "Module name to use when referenced in clients module interfaces")
-  public static let externalPassPipelineFilename: Option = Option("-external-pass-pipeline-filename", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<pass_pipeline_file>", helpText: "Use the pass pipeline defined by <pass_pipeline_file>")
-  public static let externalPluginPath: Option = Option("-external-plugin-path", .separate, attributes: [.frontend, .argumentIsPath], metaVar: "<path>#<plugin-server-path>", helpText: "Add directory to the plugin search path with a plugin server executable", group: .pluginSearch)
-  public static let e: Option = Option("-e", .separate, attributes: [], helpText: "Executes a line of code provided on the command line")
-  public static let FEQ: Option = Option("-F=", .joined, alias: Option.F, attributes: [.frontend, .argumentIsPath])
-  public static let fileCompilationDir: Option = Option("-file-compilation-dir", .separate, attributes: [.frontend], metaVar: "<path>", helpText: "The compilation directory to embed in the debug info. Coverage mapping is not supported yet.")
-  public static let filePrefixMap: Option = Option("-file-prefix-map", .separate, attributes: [.frontend], metaVar: "<prefix=replacement>", helpText: "Remap source paths in debug, coverage, and index info")
-  public static let filelist: Option = Option("-filelist", .separate, attributes: [.frontend, .noDriver, .argumentIsFileList], helpText: "Specify source inputs in a file rather than on the command line")
-  public static let findUsr: Option = Option("-find-usr", .flag, attributes: [.noDriver], helpText: "Find USR for decls by given condition")
-  public static let findUsr_: Option = Option("--find-usr", .flag, alias: Option.findUsr, attributes: [.noDriver], helpText: "Find USR for decls by given condition")
-  public static let fineGrainedTimers: Option = Option("-fine-grained-timers", .flag, attributes: [.helpHidden, .frontend], helpText: "Enable per-request timers")
-  public static let fixitAll: Option = Option("-fixit-all", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Apply all fixits from diagnostics without any filtering")
-  public static let forcePublicLinkage: Option = Option("-force-public-linkage", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Force public linkage for private symbols. Used by LLDB.")
-  public static let forceSingleFrontendInvocation: Option = Option("-force-single-frontend-invocation", .flag, alias: Option.wholeModuleOptimization, attributes: [.helpHidden, .frontend, .noInteractive])
-  public static let forceStructTypeLayouts: Option = Option("-force-struct-type-layouts", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Force type layout based lowering for structs")
-  public static let formalCxxInteroperabilityMode: Option = Option("-formal-cxx-interoperability-mode=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<cxx-interop-version>|off", helpText: "What version of C++ interoperability a textual interface was originally generated with")
-  public static let framework: Option = Option("-framework", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Specifies a framework which should be linked against", group: .linkerOption)
-  public static let frontendParseableOutput: Option = Option("-frontend-parseable-output", .flag, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "Emit textual output in a parseable format")
-  public static let Fsystem: Option = Option("-Fsystem", .separate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], helpText: "Add directory to system framework search path")
-  public static let functionSections: Option = Option("-function-sections", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit functions to separate sections.")
-  public static let F: Option = Option("-F", .joinedOrSeparate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], helpText: "Add directory to framework search path")
-  public static let gccToolchain: Option = Option("-gcc-toolchain", .separate, attributes: [.helpHidden, .argumentIsPath], metaVar: "<path>", helpText: "Specify a directory where the clang importer and clang linker can find headers and libraries")
-  public static let gdwarfTypes: Option = Option("-gdwarf-types", .flag, attributes: [.frontend], helpText: "Emit full DWARF type info.", group: .g)
-  public static let genReproducerDir: Option = Option("-gen-reproducer-dir", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Path to directory where reproducers write to.")
-  public static let genReproducer: Option = Option("-gen-reproducer", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Generate a reproducer for current compilation.")
-  public static let generateEmptyBaseline: Option = Option("-generate-empty-baseline", .flag, attributes: [.noDriver], helpText: "Generate an empty baseline")
-  public static let generateEmptyBaseline_: Option = Option("--generate-empty-baseline", .flag, alias: Option.generateEmptyBaseline, attributes: [.noDriver], helpText: "Generate an empty baseline")
-  public static let generateMigrationScript: Option = Option("-generate-migration-script", .flag, attributes: [.noDriver], helpText: "Compare SDK content in JSON file and generate migration script")
-  public static let generateMigrationScript_: Option = Option("--generate-migration-script", .flag, alias: Option.generateMigrationScript, attributes: [.noDriver], helpText: "Compare SDK content in JSON file and generate migration script")
-  public static let generateNameCorrection: Option = Option("-generate-name-correction", .flag, attributes: [.noDriver], helpText: "Generate name correction template")
-  public static let generateNameCorrection_: Option = Option("--generate-name-correction", .flag, alias: Option.generateNameCorrection, attributes: [.noDriver], helpText: "Generate name correction template")
-  public static let glineTablesOnly: Option = Option("-gline-tables-only", .flag, attributes: [.frontend], helpText: "Emit minimal debug info for backtraces only", group: .g)
-  public static let gnone: Option = Option("-gnone", .flag, attributes: [.frontend], helpText: "Don't emit debug info", group: .g)
-  public static let groupInfoPath: Option = Option("-group-info-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "The path to collect the group information of the compiled module")
-  public static let legacyGsil: Option = Option("-gsil", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Deprecated, use '-sil-based-debuginfo' instead")
-  public static let g: Option = Option("-g", .flag, attributes: [.frontend], helpText: "Emit debug info. This is the preferred setting for debugging with LLDB.", group: .g)
-  public static let helpHidden: Option = Option("-help-hidden", .flag, attributes: [.helpHidden, .frontend], helpText: "Display available options, including hidden options")
-  public static let helpHidden_: Option = Option("--help-hidden", .flag, alias: Option.helpHidden, attributes: [.helpHidden, .frontend], helpText: "Display available options, including hidden options")
-  public static let help: Option = Option("-help", .flag, attributes: [.frontend, .autolinkExtract, .moduleWrap, .synthesizeInterface], helpText: "Display available options")
-  public static let help_: Option = Option("--help", .flag, alias: Option.help, attributes: [.frontend, .autolinkExtract, .moduleWrap, .synthesizeInterface], helpText: "Display available options")
-  public static let h: Option = Option("-h", .flag, alias: Option.help)
-  public static let IEQ: Option = Option("-I=", .joined, alias: Option.I, attributes: [.frontend, .argumentIsPath])
-  public static let ignoreAlwaysInline: Option = Option("-ignore-always-inline", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Ignore @inline(__always) attributes.")
-  public static let ignoreModuleSourceInfo: Option = Option("-ignore-module-source-info", .flag, attributes: [.frontend, .noDriver], helpText: "Avoid getting source location from .swiftsourceinfo files")
-  public static let ignoreSpiGroupsNewApi: Option = Option("-ignore-spi-group-new-api", .separate, attributes: [.noDriver], helpText: "Suppress “new API without '@available’ diagnostic for given SPI group name")
-  public static let ignoreSpiGroupsNewApi_: Option = Option("--ignore-spi-group-new-api", .separate, alias: Option.ignoreSpiGroupsNewApi, attributes: [.noDriver], helpText: "Suppress “new API without '@available’ diagnostic for given SPI group name")
-  public static let ignoreSpiGroups: Option = Option("-ignore-spi-group", .separate, attributes: [.noDriver], helpText: "SPI group name to not diagnose about")
-  public static let ignoreSpiGroups_: Option = Option("--ignore-spi-group", .separate, alias: Option.ignoreSpiGroups, attributes: [.noDriver], helpText: "SPI group name to not diagnose about")
-  public static let ignoredUsrs: Option = Option("-ignored-usrs", .separate, attributes: [.noDriver, .argumentIsPath], metaVar: "<path>", helpText: "the file containing USRs of removed decls that the digester should ignore")
-  public static let ignoredUsrs_: Option = Option("--ignored-usrs", .separate, alias: Option.ignoredUsrs, attributes: [.noDriver, .argumentIsPath], metaVar: "<path>", helpText: "the file containing USRs of removed decls that the digester should ignore")
-  public static let importBridgingHeader: Option = Option("-import-bridging-header", .separate, attributes: [.frontend, .argumentIsPath], helpText: "Implicitly imports a C header file")
-  public static let importCfTypes: Option = Option("-import-cf-types", .flag, attributes: [.helpHidden, .frontend], helpText: "Recognize and import CF types as class types")
-  public static let importModule: Option = Option("-import-module", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Implicitly import the specified module")
-  public static let importObjcHeader: Option = Option("-import-objc-header", .separate, alias: Option.importBridgingHeader, attributes: [.helpHidden, .frontend, .argumentIsPath])
-  public static let importPch: Option = Option("-import-pch", .separate, attributes: [.helpHidden, .frontend, .argumentIsPath], helpText: "Import bridging header PCH file")
-  public static let importPrescan: Option = Option("-import-prescan", .flag, attributes: [.frontend, .noDriver], helpText: "When performing a dependency scan, only identify all imports of the main Swift module sources")
-  public static let importUnderlyingModule: Option = Option("-import-underlying-module", .flag, attributes: [.frontend, .noInteractive], helpText: "Implicitly imports the Objective-C half of a module")
-  public static let inPlace: Option = Option("-in-place", .flag, attributes: [.noInteractive, .noBatch], helpText: "Overwrite input file with formatted file.", group: .codeFormatting)
-  public static let inProcessPluginServerPath: Option = Option("-in-process-plugin-server-path", .separate, attributes: [.frontend, .argumentIsPath], helpText: "Path to dynamic library plugin server")
-  public static let includeSpiSymbols: Option = Option("-include-spi-symbols", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Add symbols with SPI information to the symbol graph")
-  public static let includeSubmodules: Option = Option("-include-submodules", .flag, attributes: [.noDriver, .synthesizeInterface], helpText: "Also print the declarations synthesized for any Clang submodules")
-  public static let incrementalDependencyScan: Option = Option("-incremental-dependency-scan", .flag, attributes: [.helpHidden], helpText: "Re-use/validate prior build dependency scan artifacts")
-  public static let incremental: Option = Option("-incremental", .flag, attributes: [.helpHidden, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Perform an incremental build if possible")
-  public static let indentSwitchCase: Option = Option("-indent-switch-case", .flag, attributes: [.noInteractive, .noBatch], helpText: "Indent cases in switch statements.", group: .codeFormatting)
-  public static let indentWidth: Option = Option("-indent-width", .separate, attributes: [.noInteractive, .noBatch], metaVar: "<n>", helpText: "Number of characters to indent.", group: .codeFormatting)
-  public static let indexFilePath: Option = Option("-index-file-path", .separate, attributes: [.noInteractive, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>", helpText: "Produce index data for file <path>")
-  public static let indexFile: Option = Option("-index-file", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Produce index data for a source file", group: .modes)
-  public static let indexIgnoreClangModules: Option = Option("-index-ignore-clang-modules", .flag, attributes: [.frontend], helpText: "Avoid indexing clang modules (pcms)")
-  public static let indexIgnoreStdlib: Option = Option("-index-ignore-stdlib", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Avoid emitting index data for the standard library.")
-  public static let indexIgnoreSystemModules: Option = Option("-index-ignore-system-modules", .flag, attributes: [.noInteractive], helpText: "Avoid indexing system modules")
-  public static let indexIncludeLocals: Option = Option("-index-include-locals", .flag, attributes: [.frontend], helpText: "Include local definitions/references in the produced index data.")
-  public static let indexStoreCompress: Option = Option("-index-store-compress", .flag, attributes: [.frontend], helpText: "Compress the unit and record files in the index store")
-  public static let indexStorePath: Option = Option("-index-store-path", .separate, attributes: [.frontend, .argumentIsPath, .cacheInvariant], metaVar: "<path>", helpText: "Store indexing data to <path>")
-  public static let indexSystemModules: Option = Option("-index-system-modules", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit index data for imported serialized swift system modules")
-  public static let indexUnitOutputPathFilelist: Option = Option("-index-unit-output-path-filelist", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "Specify index unit output paths in a file rather than on the command line")
-  public static let indexUnitOutputPath: Option = Option("-index-unit-output-path", .separate, attributes: [.frontend, .argumentIsPath, .cacheInvariant], metaVar: "<path>", helpText: "Use <path> as the output path in the produced index data.")
-  public static let inputFileKey: Option = Option("-input-file-key", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Cache Key for input file")
-  public static let inputPaths: Option = Option("-input-paths", .separate, attributes: [.noDriver, .argumentIsPath], metaVar: "<path>", helpText: "The SDK contents under comparison")
-  public static let inputPaths_: Option = Option("--input-paths", .separate, alias: Option.inputPaths, attributes: [.noDriver, .argumentIsPath], metaVar: "<path>", helpText: "The SDK contents under comparison")
-  public static let swiftinterfaceCompilerVersion: Option = Option("-interface-compiler-version", .separate, attributes: [.helpHidden, .frontend], metaVar: "<intcvers>", helpText: "The version of the Swift compiler used to generate a .swiftinterface file")
-  public static let internalImportBridgingHeader: Option = Option("-internal-import-bridging-header", .separate, attributes: [.frontend, .argumentIsPath], helpText: "Implicitly imports a C header file as an internal import")
-  public static let internalImportPch: Option = Option("-internal-import-pch", .separate, attributes: [.helpHidden, .frontend, .argumentIsPath], helpText: "Import bridging header PCH file as internal")
-  public static let internalizeAtLink: Option = Option("-internalize-at-link", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allow internalizing public symbols and vtables at link time (assume all client code of public types is part of the same link unit, or that external symbols are explicitly requested via -exported_symbols_list)")
-  public static let interpret: Option = Option("-interpret", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Immediate mode", group: .modes)
-  public static let ipiClangModule: Option = Option("-ipi-clang-module", .separate, attributes: [.helpHidden, .frontend], metaVar: "<name>", helpText: "Mark a Clang module by name as project-internal (IPI). Public imports of the named module will be diagnosed.")
-  public static let irOutputDir: Option = Option("-ir-output-dir", .separate, attributes: [.argumentIsPath, .supplementaryOutput], metaVar: "<dir>", helpText: "Output LLVM IR files to directory <dir> as additional output during compilation")
-  public static let irOutputPath: Option = Option("-ir-output-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output LLVM IR to <path> as additional output during compilation")
-  public static let irProfileGenerateEQ: Option = Option("-ir-profile-generate=", .joined, attributes: [.frontend, .noInteractive], metaVar: "<directory>", helpText: "Generate instrumented code to collect execution counts into <directory>/default.profraw (overridden by LLVM_PROFILE_FILE env var)")
-  public static let irProfileGenerate: Option = Option("-ir-profile-generate", .flag, attributes: [.frontend, .noInteractive], helpText: "Generate instrumented code to collect execution counts into default.profraw (overridden by LLVM_PROFILE_FILE env var)")
-  public static let irProfileUse: Option = Option("-ir-profile-use=", .commaJoined, attributes: [.frontend, .noInteractive, .argumentIsPath], metaVar: "<profdata>", helpText: "Supply an IR-level PGO profdata file to enable profile-guided optimization")
-  public static let Isystem: Option = Option("-Isystem", .separate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], helpText: "Add directory to the system import search path")
-  public static let I: Option = Option("-I", .joinedOrSeparate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], helpText: "Add directory to the import search path")
-  public static let i: Option = Option("-i", .flag, group: .modes)
-  public static let json: Option = Option("-json", .flag, attributes: [.noDriver], helpText: "Print output in JSON format.")
-  public static let json_: Option = Option("--json", .flag, alias: Option.json, attributes: [.noDriver], helpText: "Print output in JSON format.")
-  public static let j: Option = Option("-j", .joinedOrSeparate, attributes: [.doesNotAffectIncrementalBuild], metaVar: "<n>", helpText: "Number of commands to execute in parallel")
-  public static let LEQ: Option = Option("-L=", .joined, alias: Option.L, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath], group: .linkerOption)
-  public static let languageMode: Option = Option("-language-mode", .separate, attributes: [.frontend, .synthesizeInterface, .moduleInterface], metaVar: "<mode>", helpText: "Interpret input according to a specific Swift language mode")
-  public static let ldPath: Option = Option("-ld-path=", .joined, attributes: [.helpHidden, .doesNotAffectIncrementalBuild, .argumentIsPath], helpText: "Specifies the path to the linker to be used")
-  public static let libc: Option = Option("-libc", .separate, attributes: [], helpText: "libc runtime library to use")
-  public static let libraryLevelEQ: Option = Option("-library-level=", .joined, alias: Option.libraryLevel, attributes: [.helpHidden, .frontend, .moduleInterface], metaVar: "<level>")
-  public static let libraryLevel: Option = Option("-library-level", .separate, attributes: [.helpHidden, .frontend, .moduleInterface], metaVar: "<level>", helpText: "Library distribution level 'api', 'spi' or 'other' (the default)")
-  public static let lineRange: Option = Option("-line-range", .separate, attributes: [.noInteractive, .noBatch], metaVar: "<n:n>", helpText: "<start line>:<end line>. Formats a range of lines (1-based). Can only be used with one input file.", group: .codeFormatting)
-  public static let linkObjcRuntime: Option = Option("-link-objc-runtime", .flag, attributes: [.doesNotAffectIncrementalBuild], helpText: "Deprecated")
-  public static let lldbRepl: Option = Option("-lldb-repl", .flag, attributes: [.helpHidden, .noBatch], helpText: "LLDB-enhanced REPL mode", group: .modes)
-  public static let reuseDependencyScanCache: Option = Option("-load-dependency-scan-cache", .flag, attributes: [.frontend, .noDriver], helpText: "For performing a dependency scan, deserialize the scanner's internal state from a prior scan.")
-  public static let loadPassPluginEQ: Option = Option("-load-pass-plugin=", .joined, attributes: [.frontend, .argumentIsPath], metaVar: "<path>", helpText: "Load LLVM pass plugin from a dynamic shared object file.")
-  public static let loadPluginExecutable: Option = Option("-load-plugin-executable", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>#<module-names>", helpText: "Path to a compiler plugin executable and a comma-separated list of module names where the macro types are declared", group: .pluginSearch)
-  public static let loadPluginLibrary: Option = Option("-load-plugin-library", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>", helpText: "Path to a dynamic library containing compiler plugins such as macros", group: .pluginSearch)
-  public static let loadResolvedPlugin: Option = Option("-load-resolved-plugin", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<library-path>#<executable-path>#<module-names>", helpText: "Path to resolved plugin configuration and a comma-separated list of module names where the macro types are declared. Library path and executable path can be empty if not used", group: .pluginSearch)
-  public static let locale: Option = Option("-locale", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild], metaVar: "<locale-code>", helpText: "Choose a language for diagnostic messages")
-  public static let localizationPath: Option = Option("-localization-path", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<path>", helpText: "Path to localized diagnostic messages directory")
-  public static let location: Option = Option("-location", .separate, attributes: [.noDriver], metaVar: "<location>", helpText: "Filter nodes with the given location.")
-  public static let location_: Option = Option("--location", .separate, alias: Option.location, attributes: [.noDriver], metaVar: "<location>", helpText: "Filter nodes with the given location.")
-  public static let ltoLibrary: Option = Option("-lto-library", .separate, attributes: [.frontend, .noInteractive, .argumentIsPath], metaVar: "<lto-library>", helpText: "Perform LTO with <lto-library>")
-  public static let lto: Option = Option("-lto=", .joined, attributes: [.frontend, .noInteractive], helpText: "Specify the LTO type to either 'llvm-thin' or 'llvm-full'")
-  public static let L: Option = Option("-L", .joinedOrSeparate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath], helpText: "Add directory to library link search path", group: .linkerOption)
-  public static let l: Option = Option("-l", .joinedOrSeparate, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Specifies a library which should be linked against", group: .linkerOption)
-  public static let maxSubstitutionCount: Option = Option("-max-substitution-count=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum step count for type substitution operations")
-  public static let maxSubstitutionDepth: Option = Option("-max-substitution-depth=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum nesting depth for type substitution operations")
-  public static let mergeModules: Option = Option("-merge-modules", .flag, attributes: [.frontend, .noDriver], helpText: "Merge the input modules without otherwise processing them", group: .modes)
-  public static let mergeableSymbols: Option = Option("-mergeable-symbols", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit symbol definitions as mergeable (linkonce_odr)")
-  public static let mergeableTraps: Option = Option("-mergeable-traps", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit mergeable traps even in optimized builds")
-  public static let migrateKeepObjcVisibility: Option = Option("-migrate-keep-objc-visibility", .flag, attributes: [.frontend, .noInteractive], helpText: "When migrating, add '@objc' to declarations that would've been implicitly visible in Swift 3")
-  public static let migratorUpdateSdk: Option = Option("-migrator-update-sdk", .flag, attributes: [.frontend, .noInteractive], helpText: "Does nothing. Temporary compatibility flag for Xcode.")
-  public static let migratorUpdateSwift: Option = Option("-migrator-update-swift", .flag, attributes: [.frontend, .noInteractive], helpText: "Does nothing. Temporary compatibility flag for Xcode.")
-  public static let migrator: Option = Option("-migrator", .flag, attributes: [.noDriver], helpText: "Dump Json suitable for generating migration script")
-  public static let migrator_: Option = Option("--migrator", .flag, alias: Option.migrator, attributes: [.noDriver], helpText: "Dump Json suitable for generating migration script")
-  public static let minRuntimeVersion: Option = Option("-min-runtime-version", .separate, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "Specify the minimum runtime version to build force on non-Darwin systems")
-  public static let minSwiftRuntimeVersion: Option = Option("-min-swift-runtime-version", .separate, attributes: [.frontend], metaVar: "<vers>", helpText: "The minimum Swift runtime version that will be available at runtime")
-  public static let minValidPointerValue: Option = Option("-min-valid-pointer-value=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<value>", helpText: "Overrides the target's least valid pointer value.'")
-  public static let minimumAccessLevel: Option = Option("-minimum-access-level", .separate, attributes: [.noDriver, .synthesizeInterface], metaVar: "<level>", helpText: "Include symbols with this access level or more")
-  public static let moduleAbiName: Option = Option("-module-abi-name", .separate, attributes: [.frontend, .moduleInterface], helpText: "ABI name to use for the contents of this module")
-  public static let moduleAlias: Option = Option("-module-alias", .separate, attributes: [.frontend, .moduleInterface], metaVar: "<alias_name=real_name>", helpText: "If a source file imports or references module <alias_name>, the <real_name> is used for the contents of the file")
-  public static let moduleCachePath: Option = Option("-module-cache-path", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .synthesizeInterface, .argumentIsPath, .cacheInvariant], helpText: "Specifies the module cache path")
-  public static let moduleCanImportVersion: Option = Option("-module-can-import-version", .multiArg, attributes: [.frontend, .noDriver], metaVar: "<moduleName> <version> <underlyingVersion>", helpText: "Specify canImport module and versions", numArgs: 3)
-  public static let moduleCanImport: Option = Option("-module-can-import", .separate, attributes: [.frontend, .noDriver], metaVar: "<moduleName>", helpText: "Specify canImport module name")
-  public static let moduleImportFromCas: Option = Option("-module-import-from-cas", .flag, attributes: [.frontend, .noDriver], helpText: "Import modules from CAS instead of file system")
-  public static let moduleInterfacePreserveTypesAsWritten: Option = Option("-module-interface-preserve-types-as-written", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "When emitting a module interface, preserve types as they were written in the source")
-  public static let moduleLinkNameEQ: Option = Option("-module-link-name=", .joined, alias: Option.moduleLinkName, attributes: [.frontend])
-  public static let moduleLinkName: Option = Option("-module-link-name", .separate, attributes: [.frontend, .moduleInterface], helpText: "Library to link against when using this module")
-  public static let moduleListFile: Option = Option("-module-list-file", .joinedOrSeparate, attributes: [.noDriver, .argumentIsPath], helpText: "File containing a new-line separated list of modules")
-  public static let moduleLoadMode: Option = Option("-module-load-mode", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "only-interface|prefer-interface|prefer-serialized|only-serialized", helpText: "Module loading mode")
-  public static let moduleNameEQ: Option = Option("-module-name=", .joined, alias: Option.moduleName, attributes: [.frontend])
-  public static let moduleName: Option = Option("-module-name", .separate, attributes: [.frontend, .synthesizeInterface, .moduleInterface], helpText: "Name of the module to build")
-  public static let module: Option = Option("-module", .separate, attributes: [.noDriver], metaVar: "<name>", helpText: "Names of modules")
-  public static let module_: Option = Option("--module", .separate, alias: Option.module, attributes: [.noDriver], metaVar: "<name>", helpText: "Names of modules")
-  public static let newDriverPath: Option = Option("-new-driver-path", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<path>", helpText: "Path of the new driver to be used")
-  public static let noAllocations: Option = Option("-no-allocations", .flag, attributes: [.helpHidden, .frontend], helpText: "Diagnose any code that needs to heap allocate (classes, closures, etc.)")
-  public static let noAutoBridgingHeaderChaining: Option = Option("-no-auto-bridging-header-chaining", .flag, attributes: [.helpHidden, .frontend], helpText: "Do not automatically chaining all the bridging headers")
-  public static let noCacheCompileJob: Option = Option("-no-cache-compile-job", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable compiler caching")
-  public static let noClangIncludeTree: Option = Option("-no-clang-include-tree", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not use clang include tree, fallback to use CAS filesystem to build clang modules")
-  public static let noClangModuleBreadcrumbs: Option = Option("-no-clang-module-breadcrumbs", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Don't emit DWARF skeleton CUs for imported Clang modules. Use this when building a redistributable static archive.")
-  public static let noClangCompilerInstanceSharing: Option = Option("-no-clang-scanner-instance-sharing", .flag, attributes: [.frontend, .noDriver], helpText: "Disable sharing of the Clang compiler instance across dependency scans.")
-  public static let noColorDiagnostics: Option = Option("-no-color-diagnostics", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Do not print diagnostics in color")
-  public static let noEmitModuleSeparatelyWMO: Option = Option("-no-emit-module-separately-wmo", .flag, attributes: [.helpHidden], helpText: "Force emitting the swiftmodule in the same job in wmo builds")
-  public static let noEmitModuleSeparately: Option = Option("-no-emit-module-separately", .flag, attributes: [.helpHidden], helpText: "Force using merge-module as the incremental build mode")
-  public static let driverNoExplicitModuleBuild: Option = Option("-no-explicit-module-build", .flag, attributes: [], helpText: "Opt out of the default explicit-module-build behavior for swiftc")
-  public static let noLinkObjcRuntime: Option = Option("-no-link-objc-runtime", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Deprecated")
-  public static let noParallelScan: Option = Option("-no-parallel-scan", .flag, attributes: [.frontend, .noDriver], helpText: "Perform dependency scanning in a single-threaded fashion.")
-  public static let noScannerModuleValidation: Option = Option("-no-scanner-module-validation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not validate binary modules in scanner and delegate the validation to swift-frontend")
-  public static let noSerializeDebuggingOptions: Option = Option("-no-serialize-debugging-options", .flag, attributes: [.frontend, .noDriver], helpText: "Never serialize options for debugging (default: only for apps)")
-  public static let noStaticExecutable: Option = Option("-no-static-executable", .flag, attributes: [.helpHidden], helpText: "Don't statically link the executable")
-  public static let noStaticStdlib: Option = Option("-no-static-stdlib", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Don't statically link the Swift standard library")
-  public static let noStdlibRpath: Option = Option("-no-stdlib-rpath", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Don't add any rpath entries.")
-  public static let noStrictImplicitModuleContext: Option = Option("-no-strict-implicit-module-context", .flag, attributes: [.helpHidden, .frontend], helpText: "Disable the strict forwarding of compilation context to downstream implicit module dependencies")
-  public static let noToolchainStdlibRpath: Option = Option("-no-toolchain-stdlib-rpath", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Do not add an rpath entry for the toolchain's standard library (default)")
-  public static let noVerboseAsm: Option = Option("-no-verbose-asm", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable verbose assembly output (default is enabled)")
-  public static let noVerifyEmittedModuleInterface: Option = Option("-no-verify-emitted-module-interface", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Don't check that module interfaces emitted during compilation typecheck")
-  public static let noWarningsAsErrors: Option = Option("-no-warnings-as-errors", .flag, attributes: [.frontend], helpText: "Treat warnings as warnings", group: .warningTreating)
-  public static let noWholeModuleOptimization: Option = Option("-no-whole-module-optimization", .flag, attributes: [.frontend, .noInteractive], helpText: "Disable optimizing input files together instead of individually")
-  public static let driverScanDependenciesNonLib: Option = Option("-nonlib-dependency-scanner", .flag, attributes: [.helpHidden], helpText: "Use calls to `swift-frontend -scan-dependencies` instead of dedicated dependency scanning library")
-  public static let nostartfiles: Option = Option("-nostartfiles", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Do not link in the Swift language startup routines")
-  public static let nostdimport: Option = Option("-nostdimport", .flag, attributes: [.frontend], helpText: "Don't search the standard library or toolchain import paths for modules")
-  public static let nostdlibimport: Option = Option("-nostdlibimport", .flag, attributes: [.frontend], helpText: "Don't search the standard library import path for modules")
-  public static let numThreads: Option = Option("-num-threads", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .cacheInvariant], metaVar: "<n>", helpText: "Enable multi-threading and specify number of threads")
-  public static let omitExtensionBlockSymbols: Option = Option("-omit-extension-block-symbols", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Directly associate members and conformances with the extended nominal when generating symbol graphs instead of emitting 'swift.extension' symbols for extensions to external types")
-  public static let Onone: Option = Option("-Onone", .flag, attributes: [.frontend, .moduleInterface], helpText: "Compile without any optimization", group: .O)
-  public static let Oplayground: Option = Option("-Oplayground", .flag, attributes: [.helpHidden, .frontend, .moduleInterface], helpText: "Compile with optimizations appropriate for a playground", group: .O)
-  public static let Osize: Option = Option("-Osize", .flag, attributes: [.frontend, .moduleInterface], helpText: "Compile with optimizations and target small code size", group: .O)
-  public static let Ounchecked: Option = Option("-Ounchecked", .flag, attributes: [.frontend, .moduleInterface], helpText: "Compile with optimizations and remove runtime safety checks", group: .O)
-  public static let outputDir: Option = Option("-output-dir", .separate, attributes: [.noDriver, .argumentIsPath], metaVar: "<dir>", helpText: "Output directory")
-  public static let outputFileMapEQ: Option = Option("-output-file-map=", .joined, alias: Option.outputFileMap, attributes: [.noInteractive, .argumentIsPath])
-  public static let outputFileMap: Option = Option("-output-file-map", .separate, attributes: [.noInteractive, .argumentIsPath], metaVar: "<path>", helpText: "A file which specifies the location of outputs")
-  public static let outputFilelist: Option = Option("-output-filelist", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "Specify outputs in a file rather than on the command line")
-  public static let O: Option = Option("-O", .flag, attributes: [.frontend, .moduleInterface], helpText: "Compile with optimizations", group: .O)
-  public static let o: Option = Option("-o", .joinedOrSeparate, attributes: [.frontend, .noInteractive, .autolinkExtract, .moduleWrap, .synthesizeInterface, .argumentIsPath, .cacheInvariant], metaVar: "<file>", helpText: "Write output to <file>")
-  public static let PackageCMO: Option = Option("-package-cmo", .flag, attributes: [.frontend], helpText: "Enable optimization to perform default CMO within a package boundary")
-  public static let packageDescriptionVersion: Option = Option("-package-description-version", .separate, attributes: [.helpHidden, .frontend, .moduleInterface], metaVar: "<vers>", helpText: "The version number to be applied on the input for the PackageDescription availability kind")
-  public static let packageName: Option = Option("-package-name", .separate, attributes: [.frontend, .moduleInterface], helpText: "Name of the package the module belongs to")
-  public static let parallelScan: Option = Option("-parallel-scan", .flag, attributes: [.frontend, .noDriver], helpText: "Perform dependency scanning in-parallel.")
-  public static let parseAsLibrary: Option = Option("-parse-as-library", .flag, attributes: [.frontend, .noInteractive], helpText: "Parse the input file(s) as libraries, not scripts")
-  public static let parseSil: Option = Option("-parse-sil", .flag, attributes: [.frontend, .noInteractive], helpText: "Parse the input file as SIL code, not Swift source")
-  public static let parseStdlib: Option = Option("-parse-stdlib", .flag, attributes: [.helpHidden, .frontend, .moduleInterface], helpText: "Parse the input file(s) as the Swift standard library")
-  public static let parseableOutput: Option = Option("-parseable-output", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Emit textual output in a parseable format")
-  public static let parse: Option = Option("-parse", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse input file(s)", group: .modes)
-  public static let pcMacro: Option = Option("-pc-macro", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Apply the 'program counter simulation' macro")
-  public static let pchDisableValidation: Option = Option("-pch-disable-validation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable validating the persistent PCH")
-  public static let pchOutputDir: Option = Option("-pch-output-dir", .separate, attributes: [.helpHidden, .frontend, .argumentIsPath], helpText: "Directory to persist automatically created precompiled bridging headers")
-  public static let playgroundHighPerformance: Option = Option("-playground-high-performance", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Omit instrumentation that has a high runtime performance impact")
-  public static let playgroundOption: Option = Option("-playground-option", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Provide an option to the playground transform (if enabled)")
-  public static let playground: Option = Option("-playground", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Apply the playground semantics and transformation")
-  public static let pluginPath: Option = Option("-plugin-path", .separate, attributes: [.frontend, .argumentIsPath], helpText: "Add directory to the plugin search path", group: .pluginSearch)
-  public static let prebuiltModuleCachePathEQ: Option = Option("-prebuilt-module-cache-path=", .joined, alias: Option.prebuiltModuleCachePath, attributes: [.frontend, .noDriver, .cacheInvariant])
-  public static let prebuiltModuleCachePath: Option = Option("-prebuilt-module-cache-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "Directory of prebuilt modules for loading module interfaces")
-  public static let prefixSerializedDebuggingOptions: Option = Option("-prefix-serialized-debugging-options", .flag, attributes: [.frontend], helpText: "Apply debug prefix mappings to serialized debug info in Swiftmodule files")
-  public static let prespecializeGenericMetadata: Option = Option("-prespecialize-generic-metadata", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Statically specialize metadata for generic types at types that are known to be used in source.")
-  public static let prettyPrint: Option = Option("-pretty-print", .flag, attributes: [], helpText: "Pretty-print the output JSON")
-  public static let previousModuleInstallnameMapFile: Option = Option("-previous-module-installname-map-file", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<path>", helpText: "Path to a Json file indicating module name to installname map for @_originallyDefinedIn")
-  public static let primaryFilelist: Option = Option("-primary-filelist", .separate, attributes: [.frontend, .noDriver, .argumentIsFileList], helpText: "Specify primary inputs in a file rather than on the command line")
-  public static let primaryFile: Option = Option("-primary-file", .separate, attributes: [.frontend, .noDriver, .argumentIsPath], helpText: "Produce output for this file, not the whole module")
-  public static let printAstDecl: Option = Option("-print-ast-decl", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse and type-check input file(s) and pretty print declarations from AST(s)", group: .modes)
-  public static let printAst: Option = Option("-print-ast", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse and type-check input file(s) and pretty print AST(s)", group: .modes)
-  public static let printClangStats: Option = Option("-print-clang-stats", .flag, attributes: [.frontend, .noDriver], helpText: "Print Clang importer statistics")
-  public static let printDiagnosticGroups: Option = Option("-print-diagnostic-groups", .flag, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Include diagnostic groups in printed diagnostic output, if available")
-  public static let printEducationalNotes: Option = Option("-print-educational-notes", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Include educational notes in printed diagnostic output, if available")
-  public static let printExplicitDependencyGraph: Option = Option("-print-explicit-dependency-graph", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Print the result of module dependency scanning after external module resolution to output")
-  public static let printFullyQualifiedTypes: Option = Option("-print-fully-qualified-types", .flag, attributes: [.noDriver, .synthesizeInterface], helpText: "Always print fully qualified type names")
-  public static let printInstCounts: Option = Option("-print-inst-counts", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Before IRGen, count all the various SIL instructions. Must be used in conjunction with -print-stats.")
-  public static let printLlvmInlineTree: Option = Option("-print-llvm-inline-tree", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print the LLVM inline tree.")
-  public static let printModule: Option = Option("-print-module", .flag, attributes: [.noDriver], helpText: "Print module names in diagnostics")
-  public static let printModule_: Option = Option("--print-module", .flag, alias: Option.printModule, attributes: [.noDriver], helpText: "Print module names in diagnostics")
-  public static let printPreprocessedExplicitDependencyGraph: Option = Option("-print-preprocessed-explicit-dependency-graph", .flag, attributes: [.helpHidden], helpText: "Print the result of module dependency scanning to output")
-  public static let printStaticBuildConfig: Option = Option("-print-static-build-config", .flag, attributes: [.frontend], helpText: "Print static build configuration that can be used to evaluate #ifs in Swift source code")
-  public static let printStats: Option = Option("-print-stats", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Print various statistics")
-  public static let printSupportedFeatures: Option = Option("-print-supported-features", .flag, attributes: [.frontend], helpText: "Print information about features supported by the compiler")
-  public static let printTargetInfo: Option = Option("-print-target-info", .flag, attributes: [.frontend], metaVar: "<triple>", helpText: "Print target information for the given target <triple>, such as x86_64-apple-macos10.9")
-  public static let printZeroStats: Option = Option("-print-zero-stats", .flag, attributes: [.helpHidden, .frontend], helpText: "Prints all stats even if they are zero")
-  public static let profileCoverageMapping: Option = Option("-profile-coverage-mapping", .flag, attributes: [.frontend, .noInteractive], helpText: "Generate coverage data for use with profiled execution counts")
-  public static let profileGenerate: Option = Option("-profile-generate", .flag, attributes: [.frontend, .noInteractive], helpText: "Generate instrumented code to collect execution counts")
-  public static let profileSampleUse: Option = Option("-profile-sample-use=", .joined, attributes: [.frontend, .noInteractive, .argumentIsPath], metaVar: "<profile data>", helpText: "Supply sampling-based profiling data from llvm-profdata to enable profile-guided optimization")
-  public static let profileStatsEntities: Option = Option("-profile-stats-entities", .flag, attributes: [.helpHidden, .frontend], helpText: "Profile changes to stats in -stats-output-dir, subdivided by source entity")
-  public static let profileStatsEvents: Option = Option("-profile-stats-events", .flag, attributes: [.helpHidden, .frontend], helpText: "Profile changes to stats in -stats-output-dir")
-  public static let profileUse: Option = Option("-profile-use=", .commaJoined, attributes: [.frontend, .noInteractive, .argumentIsPath], metaVar: "<profdata>", helpText: "Supply a profdata file to enable profile-guided optimization")
-  public static let projectName: Option = Option("-project-name", .separate, attributes: [.frontend, .synthesizeInterface], helpText: "Name of the project this module to build belongs to")
-  public static let protocolRequirementAllowList: Option = Option("-protocol-requirement-allow-list", .separate, attributes: [.noDriver, .argumentIsPath], metaVar: "<path>", helpText: "File containing a new-line separated list of protocol names")
-  public static let protocolRequirementAllowList_: Option = Option("--protocol-requirement-allow-list", .separate, alias: Option.protocolRequirementAllowList, attributes: [.noDriver, .argumentIsPath], metaVar: "<path>", helpText: "File containing a new-line separated list of protocol names")
-  public static let publicAutolinkLibrary: Option = Option("-public-autolink-library", .separate, attributes: [.helpHidden, .frontend, .noDriver, .moduleInterface], helpText: "Add public dependent library")
-  public static let publicModuleName: Option = Option("-public-module-name", .separate, attributes: [.frontend], helpText: "Public facing module name to use in diagnostics and documentation")
-  public static let RaccessNoteEQ: Option = Option("-Raccess-note=", .joined, alias: Option.RaccessNote, attributes: [.frontend, .noDriver])
-  public static let RaccessNote: Option = Option("-Raccess-note", .separate, attributes: [.frontend, .noDriver], metaVar: "none|failures|all|all-validate", helpText: "Control access note remarks (default: all)")
-  public static let cacheRemarks: Option = Option("-Rcache-compile-job", .flag, attributes: [.frontend, .cacheInvariant], helpText: "Show remarks for compiler caching")
-  public static let emitCrossImportRemarks: Option = Option("-Rcross-import", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit a remark if a cross-import of a module is triggered.")
-  public static let dependencyScanCacheRemarks: Option = Option("-Rdependency-scan-cache", .flag, attributes: [.frontend, .noDriver], helpText: "Emit remarks indicating use of the serialized module dependency scanning cache.")
-  public static let dependencyScanRemarks: Option = Option("-Rdependency-scan", .flag, attributes: [.frontend, .noDriver], helpText: "Emit remarks for various steps taken by the dependency scanner.")
-  public static let readLegacyTypeInfoPathEQ: Option = Option("-read-legacy-type-info-path=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Read legacy type layout from the given path instead of default path")
-  public static let reflectionMetadataForDebuggerOnly: Option = Option("-reflection-metadata-for-debugger-only", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emit reflection metadata for debugger only, don't make them available at runtime")
-  public static let registerModuleDependency: Option = Option("-register-module-dependency", .separate, attributes: [], helpText: "Register module for dependency scan without importing in the frontend")
-  public static let RemoveRuntimeAsserts: Option = Option("-remove-runtime-asserts", .flag, attributes: [.frontend], helpText: "Remove runtime safety checks.")
-  public static let repl: Option = Option("-repl", .flag, attributes: [.helpHidden, .frontend, .noBatch], helpText: "REPL mode (the default if there is no input file)", group: .modes)
-  public static let reportErrorsToDebugger: Option = Option("-report-errors-to-debugger", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Deprecated, will be removed in future versions.")
-  public static let requireExplicitAvailabilityTarget: Option = Option("-require-explicit-availability-target", .separate, attributes: [.frontend, .noInteractive], metaVar: "<target>", helpText: "Suggest fix-its adding @available(<target>, *) to public declarations without availability")
-  public static let requireExplicitAvailabilityEQ: Option = Option("-require-explicit-availability=", .joined, attributes: [.frontend, .noInteractive], metaVar: "<error,warn,ignore>", helpText: "Set diagnostic level to report public declarations without an availability attribute")
-  public static let requireExplicitAvailability: Option = Option("-require-explicit-availability", .flag, attributes: [.frontend, .noInteractive], helpText: "Warn on public declarations without an availability attribute")
-  public static let requireExplicitSendable: Option = Option("-require-explicit-sendable", .flag, attributes: [.frontend, .noInteractive], helpText: "Require explicit Sendable annotations on public declarations")
-  public static let requirementMachineMaxConcreteNesting: Option = Option("-requirement-machine-max-concrete-nesting=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum concrete type nesting depth before giving up")
-  public static let requirementMachineMaxConcreteSize: Option = Option("-requirement-machine-max-concrete-size=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum concrete type total size before giving up")
-  public static let requirementMachineMaxRuleCount: Option = Option("-requirement-machine-max-rule-count=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum number of rules before giving up")
-  public static let requirementMachineMaxRuleLength: Option = Option("-requirement-machine-max-rule-length=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum rule length before giving up")
-  public static let requirementMachineMaxSplitConcreteEquivClassAttempts: Option = Option("-requirement-machine-max-split-concrete-equiv-class-attempts=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum concrete number of attempts at splitting concrete equivalence classes before giving up. There should never be a reason to change this")
-  public static let requirementMachineMaxTypeDifferences: Option = Option("-requirement-machine-max-type-differences=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the maximum number of type difference structures allocated before giving up")
-  public static let resolveImports: Option = Option("-resolve-imports", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse and resolve imports in input file(s)", group: .modes)
-  public static let resolvedPluginVerification: Option = Option("-resolved-plugin-verification", .flag, attributes: [.frontend, .noDriver], helpText: "verify resolved plugins")
-  public static let resourceDir: Option = Option("-resource-dir", .separate, attributes: [.helpHidden, .frontend, .synthesizeInterface, .argumentIsPath], metaVar: "</usr/lib/swift>", helpText: "The directory that holds the compiler resource files")
-  public static let remarkIndexingSystemModule: Option = Option("-Rindexing-system-module", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit a remark when indexing a system module")
-  public static let expansionRemarks: Option = Option("-Rmacro-expansions", .flag, attributes: [.frontend, .noDriver], helpText: "Show remarks for each line in macro expansions")
-  public static let remarkMacroLoading: Option = Option("-Rmacro-loading", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit remarks about loaded macro implementations")
-  public static let remarkModuleApiImport: Option = Option("-Rmodule-api-import", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit remarks about the import bridging in each element composing the API")
-  public static let RmoduleInterfaceRebuild: Option = Option("-Rmodule-interface-rebuild", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Emits a remark if an imported module needs to be re-compiled from its module interface")
-  public static let remarkLoadingModule: Option = Option("-Rmodule-loading", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit remarks about loaded module")
-  public static let remarkModuleRecovery: Option = Option("-Rmodule-recovery", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit remarks about contextual inconsistencies in loaded modules")
-  public static let remarkModuleSerialization: Option = Option("-Rmodule-serialization", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit remarks about module serialization")
-  public static let RpassMissedEQ: Option = Option("-Rpass-missed=", .joined, attributes: [.frontend], helpText: "Report missed transformations by optimization passes whose name matches the given POSIX regular expression")
-  public static let RpassEQ: Option = Option("-Rpass=", .joined, attributes: [.frontend], helpText: "Report performed transformations by optimization passes whose name matches the given POSIX regular expression")
-  public static let remarkSkipExplicitInterfaceBuild: Option = Option("-Rskip-explicit-interface-build", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Emit a remark if an explicit module interface invocation has an early exit because the expected output is up-to-date")
-  public static let runtimeCompatibilityVersion: Option = Option("-runtime-compatibility-version", .separate, attributes: [.frontend], helpText: "Link compatibility library for Swift runtime version, or 'none'")
-  public static let sanitizeAddressUseOdrIndicator: Option = Option("-sanitize-address-use-odr-indicator", .flag, attributes: [.helpHidden, .frontend, .noInteractive], helpText: "When using AddressSanitizer enable ODR indicator globals to avoid false ODR violation reports in partially sanitized programs at the cost of an increase in binary size")
-  public static let sanitizeCoverageEQ: Option = Option("-sanitize-coverage=", .commaJoined, attributes: [.frontend, .noInteractive], metaVar: "<type>", helpText: "Specify the type of coverage instrumentation for Sanitizers and additional options separated by commas")
-  public static let sanitizeRecoverEQ: Option = Option("-sanitize-recover=", .commaJoined, attributes: [.frontend, .noInteractive], metaVar: "<check>", helpText: "Specify which sanitizer runtime checks (see -sanitize=) will generate instrumentation that allows error recovery. Listed checks should be comma separated. Default behavior is to not allow error recovery.")
-  public static let sanitizeStableAbiEQ: Option = Option("-sanitize-stable-abi", .flag, attributes: [.frontend, .noInteractive], helpText: "Link against the Sanitizers stable ABI.")
-  public static let sanitizeEQ: Option = Option("-sanitize=", .commaJoined, attributes: [.frontend, .noInteractive], metaVar: "<check>", helpText: "Turn on runtime checks for erroneous behavior.")
-  public static let saveOptimizationRecordPasses: Option = Option("-save-optimization-record-passes", .separate, attributes: [.frontend], metaVar: "<regex>", helpText: "Only include passes which match a specified regular expression in the generated optimization record (by default, include all passes)")
-  public static let saveOptimizationRecordPath: Option = Option("-save-optimization-record-path", .separate, attributes: [.frontend, .argumentIsPath, .cacheInvariant], helpText: "Specify the file name of any generated optimization record")
-  public static let saveOptimizationRecordEQ: Option = Option("-save-optimization-record=", .joined, attributes: [.frontend], metaVar: "<format>", helpText: "Generate an optimization record file in a specific format (default: YAML)")
-  public static let saveOptimizationRecord: Option = Option("-save-optimization-record", .flag, attributes: [.frontend], helpText: "Generate a YAML optimization record file")
-  public static let saveTemps: Option = Option("-save-temps", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Save intermediate compilation results")
-  public static let scanDependencies: Option = Option("-scan-dependencies", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Scan dependencies of the given Swift sources", group: .modes)
-  public static let scannerCasFs: Option = Option("-scanner-cas-fs", .separate, attributes: [.frontend, .cacheInvariant], helpText: "Configure the filesystem to read from the provided CAS tree during dep-scanning")
-  public static let scannerDebugWriteOutput: Option = Option("-scanner-debug-write-output", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Write generated output from scanner for debugging purpose")
-  public static let scannerModuleValidation: Option = Option("-scanner-module-validation", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Validate binary modules in the dependency scanner")
-  public static let scannerOutputDir: Option = Option("-scanner-output-dir", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Directory for generated files from swift dependency scanner")
-  public static let scannerPrefixMapPaths: Option = Option("-scanner-prefix-map-paths", .multiArg, attributes: [.frontend], metaVar: "<prefix> <replacement>", helpText: "Remap paths reported by dependency scanner", numArgs: 2)
-  public static let scannerPrefixMapSdk: Option = Option("-scanner-prefix-map-sdk", .separate, attributes: [], metaVar: "<path>", helpText: "Remap paths within SDK reported by dependency scanner")
-  public static let scannerPrefixMapToolchain: Option = Option("-scanner-prefix-map-toolchain", .separate, attributes: [], metaVar: "<path>", helpText: "Remap paths within toolchain directory reported by dependency scanner")
-  public static let scannerPrefixMap: Option = Option("-scanner-prefix-map", .separate, attributes: [.frontend], metaVar: "<prefix=replacement>", helpText: "Remap paths reported by dependency scanner")
-  public static let sdkModuleCachePath: Option = Option("-sdk-module-cache-path", .separate, attributes: [.frontend, .doesNotAffectIncrementalBuild, .argumentIsPath, .cacheInvariant], helpText: "Specifies the module cache path for explicitly-built SDK modules")
-  public static let sdk: Option = Option("-sdk", .separate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], metaVar: "<sdk>", helpText: "Compile against <sdk>")
-  public static let serializeBreakingChangesPath: Option = Option("-serialize-breaking-changes-path", .separate, attributes: [.noInteractive, .argumentIsPath], metaVar: "<path>", helpText: "Serialize breaking changes found by the API digester to <path>")
-  public static let serializeDebuggingOptions: Option = Option("-serialize-debugging-options", .flag, attributes: [.frontend, .noDriver], helpText: "Always serialize options for debugging (default: only for apps)")
-  public static let serializeDependencyScanCache: Option = Option("-serialize-dependency-scan-cache", .flag, attributes: [.frontend, .noDriver], helpText: "After performing a dependency scan, serialize the scanner's internal state.")
-  public static let serializeDiagnosticsPathEQ: Option = Option("-serialize-diagnostics-path=", .joined, alias: Option.serializeDiagnosticsPath, attributes: [.frontend, .noBatch, .argumentIsPath, .supplementaryOutput, .cacheInvariant])
-  public static let serializeDiagnosticsPath: Option = Option("-serialize-diagnostics-path", .separate, attributes: [.frontend, .noBatch, .argumentIsPath, .supplementaryOutput, .cacheInvariant], metaVar: "<path>", helpText: "Emit a serialized diagnostics file to <path>")
-  public static let serializeDiagnostics: Option = Option("-serialize-diagnostics", .flag, attributes: [.frontend, .noInteractive, .supplementaryOutput, .cacheInvariant], helpText: "Serialize diagnostics in a binary format")
-  public static let serializeModuleInterfaceDependencyHashes: Option = Option("-serialize-module-interface-dependency-hashes", .flag, attributes: [.frontend, .noDriver])
-  public static let serializeParseableModuleInterfaceDependencyHashes: Option = Option("-serialize-parseable-module-interface-dependency-hashes", .flag, alias: Option.serializeModuleInterfaceDependencyHashes, attributes: [.frontend, .noDriver])
-  public static let serializedPathObfuscate: Option = Option("-serialized-path-obfuscate", .separate, attributes: [.frontend, .noDriver], metaVar: "<prefix=replacement>", helpText: "Remap source paths in debug info")
-  public static let showDiagnosticsAfterFatal: Option = Option("-show-diagnostics-after-fatal", .flag, attributes: [.frontend, .noDriver], helpText: "Keep emitting subsequent diagnostics after a fatal error")
-  public static let debugOnSil: Option = Option("-sil-based-debuginfo", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Write the SIL into a file and generate debug-info to debug on SIL  level.")
-  public static let silDebugSerialization: Option = Option("-sil-debug-serialization", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Do not eliminate functions in Mandatory Inlining/SILCombine dead functions. (for debugging only)")
-  public static let silInlineCallerBenefitReductionFactor: Option = Option("-sil-inline-caller-benefit-reduction-factor", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<2>", helpText: "Controls the aggressiveness of performance inlining in -Osize mode by reducing the base benefits of a caller (lower value permits more inlining!)")
-  public static let silInlineThreshold: Option = Option("-sil-inline-threshold", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<50>", helpText: "Controls the aggressiveness of performance inlining")
-  public static let silOutputDir: Option = Option("-sil-output-dir", .separate, attributes: [.argumentIsPath, .supplementaryOutput], metaVar: "<dir>", helpText: "Output SIL files to directory <dir> as additional output during compilation")
-  public static let silOutputPath: Option = Option("-sil-output-path", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], metaVar: "<path>", helpText: "Output SIL to <path> as additional output during compilation")
-  public static let silOwnershipVerifyAll: Option = Option("-sil-ownership-verify-all", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Verify ownership after each transform")
-  public static let silRegionIsolationAssertOnUnknownPattern: Option = Option("-sil-region-isolation-assert-on-unknown-pattern", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Abort if SIL region isolation detects an unknown pattern. For compiler developers only.")
-  public static let silStopOptznsBeforeLoweringOwnership: Option = Option("-sil-stop-optzns-before-lowering-ownership", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Stop optimizing at SIL time before we lower ownership from SIL. Intended only for SIL ossa tests")
-  public static let silUnrollThreshold: Option = Option("-sil-unroll-threshold", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<250>", helpText: "Controls the aggressiveness of loop unrolling")
-  public static let silVerifyAll: Option = Option("-sil-verify-all", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Verify SIL after each transform")
-  public static let silVerifyNone: Option = Option("-sil-verify-none", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Completely disable SIL verification")
-  public static let skipInheritedDocs: Option = Option("-skip-inherited-docs", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Skip emitting doc comments for members inherited through classes or default implementations")
-  public static let skipProtocolImplementations: Option = Option("-skip-protocol-implementations", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Skip emitting symbols that are implementations of protocol requirements or inherited from protocol extensions")
-  public static let skipSynthesizedMembers: Option = Option("-skip-synthesized-members", .flag, attributes: [.noDriver], helpText: "Skip members inherited through classes or default implementations")
-  public static let solverDisableBindingOptimizations: Option = Option("-solver-disable-binding-optimizations", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental optimizations to speed up type variable binding")
-  public static let solverDisableCrashOnValidSalvage: Option = Option("-solver-disable-crash-on-valid-salvage", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Accept valid solutions in diagnostic mode")
-  public static let solverDisableOptimizeOperatorDefaults: Option = Option("-solver-disable-optimize-operator-defaults", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental optimization to sometimes skip operators in protocol extensions")
-  public static let solverDisablePerformanceHacks: Option = Option("-solver-disable-performance-hacks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable various constraint solver performance optimizations that have been subsumed by subsequent improvements")
-  public static let solverDisablePreparedOverloads: Option = Option("-solver-disable-prepared-overloads", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental prepared overloads optimization")
-  public static let solverDisablePruneDisjunctions: Option = Option("-solver-disable-prune-disjunctions", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable experimental disjunction pruning algorithm for lookahead in the solver")
-  public static let solverDisableSplitter: Option = Option("-solver-disable-splitter", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable the component splitter phase of expression type checking")
-  public static let solverDisableTransitiveConformance: Option = Option("-solver-disable-transitive-conformance", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Disable transitive conformance constraint optimization")
-  public static let solverEnableBindingOptimizations: Option = Option("-solver-enable-binding-optimizations", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental optimizations to speed up type variable binding")
-  public static let solverEnableCrashOnValidSalvage: Option = Option("-solver-enable-crash-on-valid-salvage", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Reject valid solutions in diagnostic mode")
-  public static let solverEnableOptimizeOperatorDefaults: Option = Option("-solver-enable-optimize-operator-defaults", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental optimization to sometimes skip operators in protocol extensions")
-  public static let solverEnablePerformanceHacks: Option = Option("-solver-enable-performance-hacks", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enble various constraint solver performance optimizations that have been subsumed by subsequent improvements")
-  public static let solverEnablePreparedOverloads: Option = Option("-solver-enable-prepared-overloads", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental prepared overloads optimization")
-  public static let solverEnablePruneDisjunctions: Option = Option("-solver-enable-prune-disjunctions", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable experimental disjunction pruning algorithm for lookahead in the solver")
-  public static let solverEnableTransitiveConformance: Option = Option("-solver-enable-transitive-conformance", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Enable transitive conformance constraint optimization")
-  public static let solverExpressionTimeThresholdEQ: Option = Option("-solver-expression-time-threshold=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Expression type checking timeout, in seconds")
-  public static let solverMemoryThresholdEQ: Option = Option("-solver-memory-threshold=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Set the upper bound for memory consumption, in bytes, by the constraint solver")
-  public static let solverScopeThresholdEQ: Option = Option("-solver-scope-threshold=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Expression type checking scope limit")
-  public static let solverShrinkUnsolvedThreshold: Option = Option("-solver-shrink-unsolved-threshold", .separate, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Set The upper bound to number of sub-expressions unsolved before termination of the shrink phrase")
-  public static let solverShuffleChoicesEQ: Option = Option("-solver-shuffle-choices=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Random seed for shuffling disjunction choices. For debugging solver performance")
-  public static let solverShuffleDisjunctionsEQ: Option = Option("-solver-shuffle-disjunctions=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Random seed for shuffling disjunctions. For debugging solver performance")
-  public static let solverTrailThresholdEQ: Option = Option("-solver-trail-threshold=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Expression type checking trail change limit")
-  public static let stackPromotionLimit: Option = Option("-stack-promotion-limit", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Limit the size of stack promoted objects to the provided number of bytes.")
-  public static let staticExecutable: Option = Option("-static-executable", .flag, helpText: "Statically link the executable")
-  public static let staticStdlib: Option = Option("-static-stdlib", .flag, attributes: [.doesNotAffectIncrementalBuild], helpText: "Statically link the Swift standard library")
-  public static let `static`: Option = Option("-static", .flag, attributes: [.frontend, .noInteractive, .moduleInterface], helpText: "Make this module statically linkable and make the output of -emit-library a static library.")
-  public static let statsOutputDir: Option = Option("-stats-output-dir", .separate, attributes: [.helpHidden, .frontend, .argumentIsPath], helpText: "Directory to write unified compilation-statistics files to")
-  public static let strictConcurrency: Option = Option("-strict-concurrency=", .joined, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Specify the how strict concurrency checking will be. The value may be 'minimal' (most 'Sendable' checking is disabled), 'targeted' ('Sendable' checking is enabled in code that uses the concurrency model, or 'complete' ('Sendable' and other checking is enabled for all code in the module)")
-  public static let strictImplicitModuleContext: Option = Option("-strict-implicit-module-context", .flag, attributes: [.helpHidden, .frontend], helpText: "Enable the strict forwarding of compilation context to downstream implicit module dependencies")
-  public static let strictMemorySafetyMigrate: Option = Option("-strict-memory-safety:migrate", .flag, attributes: [.frontend, .synthesizeInterface], helpText: "Enable migration to strict memory safety checking")
-  public static let strictMemorySafety: Option = Option("-strict-memory-safety", .flag, attributes: [.frontend, .synthesizeInterface], helpText: "Enable strict memory safety checking")
-  public static let supplementaryOutputFileMap: Option = Option("-supplementary-output-file-map", .separate, attributes: [.frontend, .noDriver, .cacheInvariant], helpText: "Specify supplementary outputs in a file rather than on the command line")
-  public static let suppressNotes: Option = Option("-suppress-notes", .flag, attributes: [.frontend], helpText: "Suppress all notes")
-  public static let suppressRemarks: Option = Option("-suppress-remarks", .flag, attributes: [.frontend], helpText: "Suppress all remarks")
-  public static let suppressStaticExclusivitySwap: Option = Option("-suppress-static-exclusivity-swap", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Suppress static violations of exclusive access with swap()")
-  public static let suppressWarnings: Option = Option("-suppress-warnings", .flag, attributes: [.frontend], helpText: "Suppress all warnings")
-  public static let swiftAsyncFramePointerEQ: Option = Option("-swift-async-frame-pointer=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "One of 'auto', 'always' or 'never'")
-  public static let swiftModuleCrossImport: Option = Option("-swift-module-cross-import", .multiArg, attributes: [.frontend, .noDriver], metaVar: "<moduleName> <crossImport.swiftoverlay>", helpText: "Specify the cross import module", numArgs: 2)
-  public static let swiftModuleFile: Option = Option("-swift-module-file=", .joined, attributes: [.frontend, .noDriver], metaVar: "<name>=<path>", helpText: "Specify Swift module input explicitly built from textual interface")
-  public static let swiftOnly: Option = Option("-swift-only", .flag, attributes: [.noDriver], helpText: "Only include APIs defined from Swift source")
-  public static let swiftOnly_: Option = Option("--swift-only", .flag, alias: Option.swiftOnly, attributes: [.noDriver], helpText: "Only include APIs defined from Swift source")
-  public static let swiftVersion: Option = Option("-swift-version", .separate, alias: Option.languageMode, attributes: [.helpHidden, .frontend, .synthesizeInterface, .moduleInterface], metaVar: "<vers>", helpText: "Interpret input according to a specific Swift language version number")
-  public static let switchCheckingInvocationThresholdEQ: Option = Option("-switch-checking-invocation-threshold=", .joined, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let symbolGraphAllowAvailabilityPlatforms: Option = Option("-symbol-graph-allow-availability-platforms", .separate, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], metaVar: "<platforms>", helpText: "Restrict availability metadata to the given platforms, e.g. 'macOS,Swift'")
-  public static let symbolGraphBlockAvailabilityPlatforms: Option = Option("-symbol-graph-block-availability-platforms", .separate, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], metaVar: "<platforms>", helpText: "Remove the given platforms from symbol graph availability metadata, e.g. 'macOS,Swift'")
-  public static let symbolGraphMinimumAccessLevel: Option = Option("-symbol-graph-minimum-access-level", .separate, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], metaVar: "<level>", helpText: "Include symbols with this access level or more when emitting a symbol graph")
-  public static let symbolGraphPrettyPrint: Option = Option("-symbol-graph-pretty-print", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Pretty-print the output symbol graph JSON")
-  public static let symbolGraphShortenOutputNames: Option = Option("-symbol-graph-shorten-output-names", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Shorten the symbol graph output file names by hashing the module name; outputs an additional JSON file with the map of hash to original name")
-  public static let symbolGraphSkipInheritedDocs: Option = Option("-symbol-graph-skip-inherited-docs", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Skip emitting doc comments for members inherited through classes or default implementations")
-  public static let symbolGraphSkipSynthesizedMembers: Option = Option("-symbol-graph-skip-synthesized-members", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .supplementaryOutput], helpText: "Skip members inherited through classes or default implementations")
-  public static let synthesizeInterfaceShow: Option = Option("-synthesize-interface-show=", .joined, attributes: [.noDriver, .synthesizeInterface], metaVar: "<options>", helpText: "Comma-separated options controlling what gets printed. Options: 'unavailable', 'implicit-attrs', 'qualified-types'. Shorthands: 'all' (every option enabled), 'minimal' (default).")
-  public static let sysroot: Option = Option("-sysroot", .separate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], metaVar: "<sysroot>", helpText: "Native Platform sysroot")
-  public static let S: Option = Option("-S", .flag, alias: Option.emitAssembly, attributes: [.frontend, .noInteractive], group: .modes)
-  public static let tabWidth: Option = Option("-tab-width", .separate, attributes: [.noInteractive, .noBatch], metaVar: "<n>", helpText: "Width of tab character.", group: .codeFormatting)
-  public static let targetArchVariant: Option = Option("-target-arch-variant", .separate, attributes: [.frontend, .noInteractive, .moduleWrap, .synthesizeInterface, .moduleInterface], metaVar: "<arch-variant>", helpText: "Generate code for an additional arch/slice variant of the target architectureinto fat mach-o binaries")
-  public static let targetCpu: Option = Option("-target-cpu", .separate, attributes: [.frontend, .moduleInterface], helpText: "Generate code for a particular CPU variant")
-  public static let minInliningTargetVersion: Option = Option("-target-min-inlining-version", .separate, attributes: [.frontend, .moduleInterface], helpText: "Require inlinable code with no '@available' attribute to back-deploy to this version of the '-target' OS")
-  public static let targetSdkName: Option = Option("-target-sdk-name", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Canonical name of the target SDK used for compilation")
-  public static let targetSdkVersion: Option = Option("-target-sdk-version", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "The version of target SDK used for compilation")
-  public static let targetVariantSdkVersion: Option = Option("-target-variant-sdk-version", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "The version of target variant SDK used for compilation")
-  public static let targetVariant: Option = Option("-target-variant", .separate, attributes: [.frontend, .moduleInterface], helpText: "Generate 'zippered' code for macCatalyst that can run on the specified variant target triple in addition to the main -target triple")
-  public static let targetLegacySpelling: Option = Option("--target=", .joined, alias: Option.target, attributes: [.frontend])
-  public static let target: Option = Option("-target", .separate, attributes: [.frontend, .moduleWrap, .synthesizeInterface, .moduleInterface], metaVar: "<triple>", helpText: "Generate code for the given target <triple>, such as x86_64-apple-macos10.9")
-  public static let tbdCompatibilityVersionEQ: Option = Option("-tbd-compatibility-version=", .joined, alias: Option.tbdCompatibilityVersion, attributes: [.frontend, .noDriver])
-  public static let tbdCompatibilityVersion: Option = Option("-tbd-compatibility-version", .separate, attributes: [.frontend, .noDriver], metaVar: "<version>", helpText: "The compatibility_version to use in an emitted TBD file")
-  public static let tbdCurrentVersionEQ: Option = Option("-tbd-current-version=", .joined, alias: Option.tbdCurrentVersion, attributes: [.frontend, .noDriver])
-  public static let tbdCurrentVersion: Option = Option("-tbd-current-version", .separate, attributes: [.frontend, .noDriver], metaVar: "<version>", helpText: "The current_version to use in an emitted TBD file")
-  public static let tbdInstallNameEQ: Option = Option("-tbd-install_name=", .joined, alias: Option.tbdInstallName, attributes: [.frontend, .noDriver])
-  public static let tbdInstallName: Option = Option("-tbd-install_name", .separate, attributes: [.frontend, .noDriver], metaVar: "<path>", helpText: "The install_name to use in an emitted TBD file")
-  public static let tbdIsInstallapi: Option = Option("-tbd-is-installapi", .flag, attributes: [.frontend, .noDriver], helpText: "If the TBD file should indicate it's being generated during InstallAPI")
-  public static let debugTestDependencyScanCacheSerialization: Option = Option("-test-dependency-scan-cache-serialization", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "After performing a dependency scan, serialize and then deserialize the scanner's internal state.")
-  public static let testableImportModule: Option = Option("-testable-import-module", .separate, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Implicitly import the specified module with @testable")
-  public static let throwsAsTraps: Option = Option("-throws-as-traps", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Turn all throw sites into immediate traps")
-  public static let toolchainStdlibRpath: Option = Option("-toolchain-stdlib-rpath", .flag, attributes: [.helpHidden, .doesNotAffectIncrementalBuild], helpText: "Add an rpath entry for the toolchain's standard library, rather than the OS's")
-  public static let toolsDirectory: Option = Option("-tools-directory", .separate, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild, .argumentIsPath], metaVar: "<directory>", helpText: "Look for external executables (ld, clang, binutils) in <directory>")
-  public static let traceStatsEvents: Option = Option("-trace-stats-events", .flag, attributes: [.helpHidden, .frontend], helpText: "Trace changes to stats in -stats-output-dir")
-  public static let trackSystemDependencies: Option = Option("-track-system-dependencies", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Track system dependencies while emitting Make-style dependencies")
-  public static let trapFunction: Option = Option("-trap-function", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<name>", helpText: "Lower traps to calls to this function instead of trap instructions")
-  public static let triple: Option = Option("-triple", .separate, alias: Option.target, attributes: [.frontend, .noDriver])
-  public static let typeInfoDumpFilterEQ: Option = Option("-type-info-dump-filter=", .joined, attributes: [.helpHidden, .frontend, .noDriver], helpText: "One of 'all', 'resilient' or 'fragile'")
-  public static let typecheckModuleFromInterface: Option = Option("-typecheck-module-from-interface", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Treat the (single) input as a swiftinterface and typecheck it", group: .modes)
-  public static let typecheck: Option = Option("-typecheck", .flag, attributes: [.frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Parse and type-check input file(s)", group: .modes)
-  public static let typoCorrectionLimit: Option = Option("-typo-correction-limit", .separate, attributes: [.helpHidden, .frontend], metaVar: "<n>", helpText: "Limit the number of times the compiler will attempt typo correction to <n>")
-  public static let unavailableDeclOptimizationEQ: Option = Option("-unavailable-decl-optimization=", .joined, attributes: [.frontend, .noInteractive], metaVar: "<complete,none>", helpText: "Specify the optimization mode for unavailable declarations. The value may be 'none' (no optimization) or 'complete' (code is not generated at all unavailable declarations)")
-  public static let updateCode: Option = Option("-update-code", .flag, attributes: [.helpHidden, .frontend, .noInteractive, .doesNotAffectIncrementalBuild], helpText: "Update Swift code")
-  public static let useClangFunctionTypes: Option = Option("-use-clang-function-types", .flag, attributes: [.frontend, .noDriver], helpText: "Use stored Clang function types for computing canonical types.")
-  public static let useFrontendParseableOutput: Option = Option("-use-frontend-parseable-output", .flag, attributes: [.helpHidden, .cacheInvariant], helpText: "Emit parseable-output from swift-frontend jobs instead of from the driver")
-  public static let useInterfaceForModule: Option = Option("-use-interface-for-module", .separate, attributes: [.noDriver], metaVar: "<name>", helpText: "Prefer loading these modules via interface")
-  public static let useInterfaceForModule_: Option = Option("--use-interface-for-module", .separate, alias: Option.useInterfaceForModule, attributes: [.noDriver], metaVar: "<name>", helpText: "Prefer loading these modules via interface")
-  public static let useJit: Option = Option("-use-jit", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Register Objective-C classes as if the JIT were in use")
-  public static let useLd: Option = Option("-use-ld=", .joined, attributes: [.doesNotAffectIncrementalBuild], helpText: "Specifies the flavor of the linker to be used")
-  public static let useMalloc: Option = Option("-use-malloc", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Allocate internal data structures using malloc (for memory debugging)")
-  public static let useStaticResourceDir: Option = Option("-use-static-resource-dir", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Use resources in the static resource directory")
-  public static let useTabs: Option = Option("-use-tabs", .flag, attributes: [.noInteractive, .noBatch], helpText: "Use tabs for indentation.", group: .codeFormatting)
-  public static let userModuleVersion: Option = Option("-user-module-version", .separate, attributes: [.frontend, .moduleInterface], metaVar: "<vers>", helpText: "Module version specified from Swift module authors")
-  public static let validateClangModulesOnce: Option = Option("-validate-clang-modules-once", .flag, attributes: [.frontend], helpText: "Don't verify input files for Clang modules if the module has been successfully validated or loaded during this build session")
-  public static let validatePriorDependencyScanCache: Option = Option("-validate-prior-dependency-scan-cache", .flag, attributes: [.frontend, .noDriver], helpText: "For performing a dependency scan with a prior scanner state, validate module dependencies.")
-  public static let validateTbdAgainstIrEQ: Option = Option("-validate-tbd-against-ir=", .joined, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<level>", helpText: "Compare the symbols in the IR against the TBD file that would be generated.")
-  public static let valueRecursionThreshold: Option = Option("-value-recursion-threshold", .separate, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Set the maximum depth for direct recursion in value types")
-  public static let verboseAsm: Option = Option("-verbose-asm", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Generate verbose assembly output with comments")
-  public static let verifyAdditionalFile: Option = Option("-verify-additional-file", .separate, attributes: [.frontend, .noDriver], helpText: "Verify diagnostics in this file in addition to source files")
-  public static let verifyAdditionalPrefix: Option = Option("-verify-additional-prefix", .separate, attributes: [.frontend, .noDriver], helpText: "Check for diagnostics with the prefix expected-<PREFIX> as well as expected-")
-  public static let verifyAllSubstitutionMaps: Option = Option("-verify-all-substitution-maps", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Verify all SubstitutionMaps on construction")
-  public static let verifyApplyFixes: Option = Option("-verify-apply-fixes", .flag, attributes: [.frontend, .noDriver], helpText: "Like -verify, but updates the original source file")
-  public static let verifyChildNotes: Option = Option("-verify-child-notes", .flag, attributes: [.frontend, .noDriver], helpText: "Verify child notes in child diagnostics blocks")
-  public static let verifyDebugInfo: Option = Option("-verify-debug-info", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Verify the binary representation of debug output.")
-  public static let verifyEmittedModuleInterface: Option = Option("-verify-emitted-module-interface", .flag, attributes: [.noInteractive, .doesNotAffectIncrementalBuild], helpText: "Check that module interfaces emitted during compilation typecheck")
-  public static let verifyGenericSignatures: Option = Option("-verify-generic-signatures", .separate, attributes: [.frontend, .noDriver], metaVar: "<module-name>", helpText: "Verify the generic signatures in the given module")
-  public static let verifyIgnoreMacroNote: Option = Option("-verify-ignore-macro-note", .flag, attributes: [.frontend, .noDriver], helpText: "Skip verifying notes about macro location")
-  public static let verifyIgnoreUnknown: Option = Option("-verify-ignore-unknown", .flag, attributes: [.frontend, .noDriver], helpText: "Allow diagnostics for '<unknown>' location in verify mode")
-  public static let verifyIgnoreUnrelated: Option = Option("-verify-ignore-unrelated", .flag, attributes: [.frontend, .noDriver], helpText: "Allow diagnostics in files outside those with expected diagnostics in verify mode")
-  public static let verifyIncrementalDependencies: Option = Option("-verify-incremental-dependencies", .flag, attributes: [.helpHidden, .frontend], helpText: "Enable the dependency verifier for each frontend job")
-  public static let verifyTypeLayout: Option = Option("-verify-type-layout", .joinedOrSeparate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<type>", helpText: "Verify compile-time and runtime type layout information for type")
-  public static let verify: Option = Option("-verify", .flag, attributes: [.frontend, .noDriver], helpText: "Verify diagnostics against expected-{error|warning|note} annotations")
-  public static let versionIndependentApinotes: Option = Option("-version-independent-apinotes", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Input clang modules carry all versioned APINotes")
-  public static let version: Option = Option("-version", .flag, attributes: [.frontend], helpText: "Print version information and exit")
-  public static let version_: Option = Option("--version", .flag, alias: Option.version, attributes: [.frontend], helpText: "Print version information and exit")
-  public static let vfsoverlayEQ: Option = Option("-vfsoverlay=", .joined, alias: Option.vfsoverlay)
-  public static let vfsoverlay: Option = Option("-vfsoverlay", .joinedOrSeparate, attributes: [.frontend, .argumentIsPath], helpText: "Add directory to VFS overlay file")
-  public static let visualcToolsRoot: Option = Option("-visualc-tools-root", .separate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], metaVar: "<root>", helpText: "VisualC++ Tools Root")
-  public static let visualcToolsVersion: Option = Option("-visualc-tools-version", .separate, attributes: [.frontend, .synthesizeInterface], metaVar: "<version>", helpText: "VisualC++ ToolSet Version")
-  public static let v: Option = Option("-v", .flag, attributes: [.doesNotAffectIncrementalBuild, .synthesizeInterface], helpText: "Show commands to run and use verbose output")
-  public static let warnConcurrency: Option = Option("-warn-concurrency", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Warn about code that is unsafe according to the Swift Concurrency model and will become ill-formed in a future language version")
-  public static let warnImplicitOverrides: Option = Option("-warn-implicit-overrides", .flag, attributes: [.frontend, .doesNotAffectIncrementalBuild], helpText: "Warn about implicit overrides of protocol members")
-  public static let warnLongExpressionTypeCheckingScopesEQ: Option = Option("-warn-long-expression-type-checking-scopes=", .joined, alias: Option.warnLongExpressionTypeCheckingScopes, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let warnLongExpressionTypeCheckingScopes: Option = Option("-warn-long-expression-type-checking-scopes", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<n>", helpText: "Warns when type-checking an expression uses more than <n> solver scopes")
-  public static let warnLongExpressionTypeCheckingTrailEQ: Option = Option("-warn-long-expression-type-checking-trail=", .joined, alias: Option.warnLongExpressionTypeCheckingTrail, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let warnLongExpressionTypeCheckingTrail: Option = Option("-warn-long-expression-type-checking-trail", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<n>", helpText: "Warns when type-checking an expression uses more than <n> solver trail steps")
-  public static let warnLongExpressionTypeCheckingEQ: Option = Option("-warn-long-expression-type-checking=", .joined, alias: Option.warnLongExpressionTypeChecking, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let warnLongExpressionTypeChecking: Option = Option("-warn-long-expression-type-checking", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<n>", helpText: "Warns when type-checking an expression takes longer than <n> ms")
-  public static let warnLongFunctionBodiesEQ: Option = Option("-warn-long-function-bodies=", .joined, alias: Option.warnLongFunctionBodies, attributes: [.helpHidden, .frontend, .noDriver])
-  public static let warnLongFunctionBodies: Option = Option("-warn-long-function-bodies", .separate, attributes: [.helpHidden, .frontend, .noDriver], metaVar: "<n>", helpText: "Warns when type-checking a function takes longer than <n> ms")
-  public static let warnOnEditorPlaceholder: Option = Option("-warn-on-editor-placeholder", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Downgrade the editor placeholder error to a warning")
-  public static let warnOnPotentiallyUnavailableEnumCase: Option = Option("-warn-on-potentially-unavailable-enum-case", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Deprecated, will be removed in future versions")
-  public static let warnSoftDeprecated: Option = Option("-warn-soft-deprecated", .flag, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Warn when soft-deprecated declarations are referenced")
-  public static let warnSwift3ObjcInferenceComplete: Option = Option("-warn-swift3-objc-inference-complete", .flag, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Deprecated, has no effect")
-  public static let warnSwift3ObjcInferenceMinimal: Option = Option("-warn-swift3-objc-inference-minimal", .flag, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild], helpText: "Deprecated, has no effect")
-  public static let warnSwift3ObjcInference: Option = Option("-warn-swift3-objc-inference", .flag, alias: Option.warnSwift3ObjcInferenceComplete, attributes: [.helpHidden, .frontend, .doesNotAffectIncrementalBuild])
-  public static let warningsAsErrors: Option = Option("-warnings-as-errors", .flag, attributes: [.frontend], helpText: "Treat warnings as errors", group: .warningTreating)
-  public static let weakLinkAtTarget: Option = Option("-weak-link-at-target", .flag, attributes: [.helpHidden, .frontend, .noDriver], helpText: "Weakly link symbols for declarations that were introduced at the deployment target. Symbols introduced before the deployment target are still strongly linked.")
-  public static let Werror: Option = Option("-Werror", .separate, attributes: [.helpHidden, .frontend], metaVar: "<diagnostic_group>", helpText: "Treat this warning group as error", group: .warningTreating)
-  public static let wholeModuleOptimization: Option = Option("-whole-module-optimization", .flag, attributes: [.frontend, .noInteractive], helpText: "Optimize input files together instead of individually")
-  public static let windowsSdkRoot: Option = Option("-windows-sdk-root", .separate, attributes: [.frontend, .synthesizeInterface, .argumentIsPath], metaVar: "<root>", helpText: "Windows SDK Root")
-  public static let windowsSdkVersion: Option = Option("-windows-sdk-version", .separate, attributes: [.frontend, .synthesizeInterface], metaVar: "<version>", helpText: "Windows SDK Version")
-  public static let wmo: Option = Option("-wmo", .flag, alias: Option.wholeModuleOptimization, attributes: [.helpHidden, .frontend, .noInteractive])
-  public static let workingDirectoryEQ: Option = Option("-working-directory=", .joined, alias: Option.workingDirectory)
-  public static let workingDirectory: Option = Option("-working-directory", .separate, metaVar: "<path>", helpText: "Resolve file paths relative to the specified directory")
-  public static let writeOutputHashXattr: Option = Option("-write-output-hash-xattr", .flag, attributes: [.frontend, .cacheInvariant], helpText: "When caching, write the output file's hash (as determined by the CAS hashing schema) as a file extended attribute.")
-  public static let Wwarning: Option = Option("-Wwarning", .separate, attributes: [.helpHidden, .frontend], metaVar: "<diagnostic_group>", helpText: "Treat this warning group as warning", group: .warningTreating)
-  public static let Xcc: Option = Option("-Xcc", .separate, attributes: [.frontend, .synthesizeInterface], metaVar: "<arg>", helpText: "Pass <arg> to the C/C++/Objective-C compiler")
-  public static let XclangLinker: Option = Option("-Xclang-linker", .separate, attributes: [.helpHidden], metaVar: "<arg>", helpText: "Pass <arg> to Clang when it is used for linking.")
-  public static let Xfrontend: Option = Option("-Xfrontend", .separate, attributes: [.helpHidden], metaVar: "<arg>", helpText: "Pass <arg> to the Swift frontend")
-  public static let XlinkerDriver: Option = Option("-Xlinker-driver", .separate, attributes: [.helpHidden], metaVar: "<arg>", helpText: "Pass <arg> to the linker driver (clang, emcc, etc.) regardless of which one is in use.")
-  public static let Xlinker: Option = Option("-Xlinker", .separate, attributes: [.doesNotAffectIncrementalBuild], helpText: "Specifies an option which should be passed to the linker")
-  public static let Xllvm: Option = Option("-Xllvm", .separate, attributes: [.helpHidden, .frontend], metaVar: "<arg>", helpText: "Pass <arg> to LLVM.")
-  public static let DASHDASH: Option = Option("--", .remaining, attributes: [.frontend, .doesNotAffectIncrementalBuild])
+  public static var INPUT: Option { Option(id: 0) }
+  public static var HASHHASHHASH: Option { Option(id: 1) }
+  public static var abi: Option { Option(id: 2) }
+  public static var abi_: Option { Option(id: 3) }
+  public static var abortOnModuleFail: Option { Option(id: 4) }
+  public static var abortOnModuleFail_: Option { Option(id: 5) }
+  public static var accessNotesPathEQ: Option { Option(id: 6) }
+  public static var accessNotesPath: Option { Option(id: 7) }
+  public static var activePlatformAvailabilityOnly: Option { Option(id: 8) }
+  public static var aliasModuleNamesInModuleInterface: Option { Option(id: 9) }
+  public static var allowAvailabilityPlatforms: Option { Option(id: 10) }
+  public static var allowNonResilientAccess: Option { Option(id: 11) }
+  public static var allowableClient: Option { Option(id: 12) }
+  public static var alwaysCompileOutputFiles: Option { Option(id: 13) }
+  public static var alwaysRebuildModuleDependencies: Option { Option(id: 14) }
+  public static var analyzeRequestEvaluator: Option { Option(id: 15) }
+  public static var analyzeRequirementMachine: Option { Option(id: 16) }
+  public static var apiDiffDataDir: Option { Option(id: 17) }
+  public static var apiDiffDataFile: Option { Option(id: 18) }
+  public static var enableAppExtensionLibrary: Option { Option(id: 19) }
+  public static var enableAppExtension: Option { Option(id: 20) }
+  public static var AssertConfig: Option { Option(id: 21) }
+  public static var AssumeSingleThreaded: Option { Option(id: 22) }
+  public static var autoBridgingHeaderChaining: Option { Option(id: 23) }
+  public static var autolinkForceLoad: Option { Option(id: 24) }
+  public static var autolinkLibrary: Option { Option(id: 25) }
+  public static var avoidEmitModuleSourceInfo: Option { Option(id: 26) }
+  public static var avoidLocation: Option { Option(id: 27) }
+  public static var avoidLocation_: Option { Option(id: 28) }
+  public static var avoidToolArgs: Option { Option(id: 29) }
+  public static var avoidToolArgs_: Option { Option(id: 30) }
+  public static var backupModuleInterfacePathEQ: Option { Option(id: 31) }
+  public static var backupModuleInterfacePath: Option { Option(id: 32) }
+  public static var badFileDescriptorRetryCount: Option { Option(id: 33) }
+  public static var baselineDir: Option { Option(id: 34) }
+  public static var baselinePath: Option { Option(id: 35) }
+  public static var BFEQ: Option { Option(id: 36) }
+  public static var BF: Option { Option(id: 37) }
+  public static var BIEQ: Option { Option(id: 38) }
+  public static var BI: Option { Option(id: 39) }
+  public static var blockAvailabilityPlatforms: Option { Option(id: 40) }
+  public static var blockListFile: Option { Option(id: 41) }
+  public static var breakageAllowlistPath: Option { Option(id: 42) }
+  public static var bridgingHeaderDirectoryForPrint: Option { Option(id: 43) }
+  public static var bridgingHeaderPchKey: Option { Option(id: 44) }
+  public static var bsdk: Option { Option(id: 45) }
+  public static var buildIdEQ: Option { Option(id: 46) }
+  public static var buildId: Option { Option(id: 47) }
+  public static var buildModuleFromParseableInterface: Option { Option(id: 48) }
+  public static var bypassBatchModeChecks: Option { Option(id: 49) }
+  public static var bypassResilience: Option { Option(id: 50) }
+  public static var cacheCompileJob: Option { Option(id: 51) }
+  public static var cacheDisableReplay: Option { Option(id: 52) }
+  public static var cacheReplayPrefixMap: Option { Option(id: 53) }
+  public static var candidateModuleFile: Option { Option(id: 54) }
+  public static var casBackendMode: Option { Option(id: 55) }
+  public static var casBackend: Option { Option(id: 56) }
+  public static var casEmitCasidFile: Option { Option(id: 57) }
+  public static var casFsEscape: Option { Option(id: 58) }
+  public static var casPath: Option { Option(id: 59) }
+  public static var casPluginOption: Option { Option(id: 60) }
+  public static var casPluginPath: Option { Option(id: 61) }
+  public static var checkApiAvailabilityOnly: Option { Option(id: 62) }
+  public static var checkOnoneCompleteness: Option { Option(id: 63) }
+  public static var checkedAsyncObjcBridging: Option { Option(id: 64) }
+  public static var clangBuildSessionFile: Option { Option(id: 65) }
+  public static var clangHeaderExposeDecls: Option { Option(id: 66) }
+  public static var clangHeaderExposeModule: Option { Option(id: 67) }
+  public static var clangIncludeTreeFilelist: Option { Option(id: 68) }
+  public static var clangIncludeTreeRoot: Option { Option(id: 69) }
+  public static var clangScannerModuleCachePath: Option { Option(id: 70) }
+  public static var clangTargetVariant: Option { Option(id: 71) }
+  public static var clangTarget: Option { Option(id: 72) }
+  public static var codeCompleteCallPatternHeuristics: Option { Option(id: 73) }
+  public static var codeCompleteInitsInPostfixExpr: Option { Option(id: 74) }
+  public static var colorDiagnostics: Option { Option(id: 75) }
+  public static var compareToBaselinePath: Option { Option(id: 76) }
+  public static var compileModuleFromInterface: Option { Option(id: 77) }
+  public static var compilerAssertions: Option { Option(id: 78) }
+  public static var compilerStyleDiags: Option { Option(id: 79) }
+  public static var compilerStyleDiags_: Option { Option(id: 80) }
+  public static var concurrencyModelEQ: Option { Option(id: 81) }
+  public static var concurrencyModel: Option { Option(id: 82) }
+  public static var conditionalRuntimeRecords: Option { Option(id: 83) }
+  public static var constGatherProtocolsFile: Option { Option(id: 84) }
+  public static var constGatherProtocolsList: Option { Option(id: 85) }
+  public static var continueBuildingAfterErrors: Option { Option(id: 86) }
+  public static var coveragePrefixMap: Option { Option(id: 87) }
+  public static var CrossModuleOptimization: Option { Option(id: 88) }
+  public static var crosscheckUnqualifiedLookup: Option { Option(id: 89) }
+  public static var csProfileGenerateEQ: Option { Option(id: 90) }
+  public static var csProfileGenerate: Option { Option(id: 91) }
+  public static var cxxInteropGettersSettersAsProperties: Option { Option(id: 92) }
+  public static var cxxInteropUseOpaquePointerForMoveonly: Option { Option(id: 93) }
+  public static var cxxInteroperabilityMode: Option { Option(id: 94) }
+  public static var c: Option { Option(id: 95) }
+  public static var debugAssertAfterParse: Option { Option(id: 96) }
+  public static var debugAssertImmediately: Option { Option(id: 97) }
+  public static var debugCallsiteInfo: Option { Option(id: 98) }
+  public static var debugConstraintsAttempt: Option { Option(id: 99) }
+  public static var debugConstraintsOnLineEQ: Option { Option(id: 100) }
+  public static var debugConstraintsOnLine: Option { Option(id: 101) }
+  public static var debugConstraints: Option { Option(id: 102) }
+  public static var debugCrashAfterParse: Option { Option(id: 103) }
+  public static var debugCrashImmediately: Option { Option(id: 104) }
+  public static var debugCycles: Option { Option(id: 105) }
+  public static var debugDiagnosticNames: Option { Option(id: 106) }
+  public static var debugEmitInvalidSwiftinterfaceSyntax: Option { Option(id: 107) }
+  public static var debugForbidTypecheckPrefix: Option { Option(id: 108) }
+  public static var debugGenericSignatures: Option { Option(id: 109) }
+  public static var debugInfoForProfiling: Option { Option(id: 110) }
+  public static var debugInfoFormat: Option { Option(id: 111) }
+  public static var debugInfoStoreInvocation: Option { Option(id: 112) }
+  public static var debugInverseRequirements: Option { Option(id: 113) }
+  public static var debugMapping: Option { Option(id: 114) }
+  public static var debugMapping_: Option { Option(id: 115) }
+  public static var debugModulePathEQ: Option { Option(id: 116) }
+  public static var debugModulePath: Option { Option(id: 117) }
+  public static var debugModuleSelfKey: Option { Option(id: 118) }
+  public static var debugPrefixMap: Option { Option(id: 119) }
+  public static var debugRequirementMachine: Option { Option(id: 120) }
+  public static var debugTimeExpressionTypeChecking: Option { Option(id: 121) }
+  public static var debugTimeFunctionBodies: Option { Option(id: 122) }
+  public static var debuggerSupport: Option { Option(id: 123) }
+  public static var debuggerTestingTransform: Option { Option(id: 124) }
+  public static var defaultIsolationEQ: Option { Option(id: 125) }
+  public static var defaultIsolation: Option { Option(id: 126) }
+  public static var defineAlwaysEnabledAvailabilityDomain: Option { Option(id: 127) }
+  public static var defineAvailability: Option { Option(id: 128) }
+  public static var defineDisabledAvailabilityDomain: Option { Option(id: 129) }
+  public static var defineDynamicAvailabilityDomain: Option { Option(id: 130) }
+  public static var defineEnabledAvailabilityDomain: Option { Option(id: 131) }
+  public static var dependencyOnlyImport: Option { Option(id: 132) }
+  public static var dependencyScanCachePath: Option { Option(id: 133) }
+  public static var dependencyScanSerializeDiagnosticsPath: Option { Option(id: 134) }
+  public static var deprecatedIntegratedRepl: Option { Option(id: 135) }
+  public static var deserializeDiff: Option { Option(id: 136) }
+  public static var deserializeDiff_: Option { Option(id: 137) }
+  public static var deserializeSdk: Option { Option(id: 138) }
+  public static var deserializeSdk_: Option { Option(id: 139) }
+  public static var diagnoseSdk: Option { Option(id: 140) }
+  public static var diagnoseSdk_: Option { Option(id: 141) }
+  public static var diagnosticDocumentationPath: Option { Option(id: 142) }
+  public static var diagnosticStyleEQ: Option { Option(id: 143) }
+  public static var diagnosticStyle: Option { Option(id: 144) }
+  public static var swiftDiagnosticsAssertOnError: Option { Option(id: 145) }
+  public static var swiftDiagnosticsAssertOnGroup: Option { Option(id: 146) }
+  public static var swiftDiagnosticsAssertOnWarning: Option { Option(id: 147) }
+  public static var diagnosticsEditorMode: Option { Option(id: 148) }
+  public static var digesterBreakageAllowlistPath: Option { Option(id: 149) }
+  public static var digesterMode: Option { Option(id: 150) }
+  public static var directClangCc1ModuleBuild: Option { Option(id: 151) }
+  public static var disableAccessControl: Option { Option(id: 152) }
+  public static var disableActorDataRaceChecks: Option { Option(id: 153) }
+  public static var disableAddressDependencies: Option { Option(id: 154) }
+  public static var disableAggressiveReg2mem: Option { Option(id: 155) }
+  public static var disableAliasModuleNamesInModuleInterface: Option { Option(id: 156) }
+  public static var disableAllAutolinking: Option { Option(id: 157) }
+  public static var disableArcOpts: Option { Option(id: 158) }
+  public static var disableArm64Corocc: Option { Option(id: 159) }
+  public static var disableAssemblyVisionAll: Option { Option(id: 160) }
+  public static var disableAstVerifier: Option { Option(id: 161) }
+  public static var disableAsyncFramePointerAll: Option { Option(id: 162) }
+  public static var disableAsyncFramePushPopMetadata: Option { Option(id: 163) }
+  public static var disableAutolinkFrameworks: Option { Option(id: 164) }
+  public static var disableAutolinkFramework: Option { Option(id: 165) }
+  public static var disableAutolinkLibrary: Option { Option(id: 166) }
+  public static var disableAutolinkingRuntimeCompatibilityConcurrency: Option { Option(id: 167) }
+  public static var disableAutolinkingRuntimeCompatibilityDynamicReplacements: Option { Option(id: 168) }
+  public static var disableAutolinkingRuntimeCompatibility: Option { Option(id: 169) }
+  public static var disableAvailabilityChecking: Option { Option(id: 170) }
+  public static var disableBatchMode: Option { Option(id: 171) }
+  public static var disableBridgingPch: Option { Option(id: 172) }
+  public static var disableBuildingInterface: Option { Option(id: 173) }
+  public static var disableCalleeAllocatedCoroAbi: Option { Option(id: 174) }
+  public static var disableClangSpi: Option { Option(id: 175) }
+  public static var disableClangTarget: Option { Option(id: 176) }
+  public static var disableClangimporterSourceImport: Option { Option(id: 177) }
+  public static var disableCrossModuleOptimization: Option { Option(id: 178) }
+  public static var disableCollocateMetadataFunctions: Option { Option(id: 179) }
+  public static var disableColocateTypeDescriptors: Option { Option(id: 180) }
+  public static var disableConcreteTypeMetadataMangledNameAccessors: Option { Option(id: 181) }
+  public static var disableCondFailMessageAnnotation: Option { Option(id: 182) }
+  public static var disableConstValueImporting: Option { Option(id: 183) }
+  public static var disableCrossImportOverlaySearch: Option { Option(id: 184) }
+  public static var disableCrossImportOverlays: Option { Option(id: 185) }
+  public static var cxxInteropDisableRequirementAtImport: Option { Option(id: 186) }
+  public static var disableDebuggerShadowCopies: Option { Option(id: 187) }
+  public static var disableDeserializationRecovery: Option { Option(id: 188) }
+  public static var disableDeserializationSafety: Option { Option(id: 189) }
+  public static var disableDiagnosticPasses: Option { Option(id: 190) }
+  public static var disableDirectRetainRelease: Option { Option(id: 191) }
+  public static var disableDynamicActorIsolation: Option { Option(id: 192) }
+  public static var disableEmitGenericClassRoTList: Option { Option(id: 193) }
+  public static var disableEmitTypeMallocForCoroFrame: Option { Option(id: 194) }
+  public static var disableExperimentalClangImporterDiagnostics: Option { Option(id: 195) }
+  public static var disableExperimentalFeature: Option { Option(id: 196) }
+  public static var disableExperimentalLifetimeDependenceInference: Option { Option(id: 197) }
+  public static var disableExperimentalOpenedExistentialTypes: Option { Option(id: 198) }
+  public static var disableExperimentalParserRoundTrip: Option { Option(id: 199) }
+  public static var disableExperimentalStringProcessing: Option { Option(id: 200) }
+  public static var disableFailOnError: Option { Option(id: 201) }
+  public static var disableFailOnError_: Option { Option(id: 202) }
+  public static var disableFineModuleTracing: Option { Option(id: 203) }
+  public static var disableForceLoadSymbols: Option { Option(id: 204) }
+  public static var disableFragileResilientProtocolWitnesses: Option { Option(id: 205) }
+  public static var disableGenericMetadataPrespecialization: Option { Option(id: 206) }
+  public static var disableImplicitConcurrencyModuleImport: Option { Option(id: 207) }
+  public static var disableImplicitCxxModuleImport: Option { Option(id: 208) }
+  public static var disableImplicitStringProcessingModuleImport: Option { Option(id: 209) }
+  public static var disableImplicitSwiftModules: Option { Option(id: 210) }
+  public static var disableImportPtrauthFieldFunctionPointers: Option { Option(id: 211) }
+  public static var disableIncrementalFileHashing: Option { Option(id: 212) }
+  public static var disableIncrementalImports: Option { Option(id: 213) }
+  public static var disableIncrementalLlvmCodegeneration: Option { Option(id: 214) }
+  public static var disableInferPublicConcurrentValue: Option { Option(id: 215) }
+  public static var disableInterfaceLockfile: Option { Option(id: 216) }
+  public static var disableInvalidEphemeralnessAsError: Option { Option(id: 217) }
+  public static var disableLargeLoadableTypesReg2mem: Option { Option(id: 218) }
+  public static var disableLayoutStringValueWitnessesInstantiation: Option { Option(id: 219) }
+  public static var disableLayoutStringValueWitnesses: Option { Option(id: 220) }
+  public static var disableLegacyTypeInfo: Option { Option(id: 221) }
+  public static var disableLifetimeDependenceDiagnostics: Option { Option(id: 222) }
+  public static var disableLlvmMergeFunctionsPass: Option { Option(id: 223) }
+  public static var disableLlvmOptzns: Option { Option(id: 224) }
+  public static var disableLlvmValueNames: Option { Option(id: 225) }
+  public static var disableLlvmVerifyEach: Option { Option(id: 226) }
+  public static var disableLlvmVerify: Option { Option(id: 227) }
+  public static var disableMigratorFixits: Option { Option(id: 228) }
+  public static var disableModuleSelectorsInModuleInterface: Option { Option(id: 229) }
+  public static var disableModulesValidateSystemHeaders: Option { Option(id: 230) }
+  public static var disableNamedLazyImportAsMemberLoading: Option { Option(id: 231) }
+  public static var disableNewLlvmPassManager: Option { Option(id: 232) }
+  public static var disableNewOperatorLookup: Option { Option(id: 233) }
+  public static var disableNonfrozenEnumExhaustivityDiagnostics: Option { Option(id: 234) }
+  public static var disableNoreturnPrediction: Option { Option(id: 235) }
+  public static var disableNskeyedarchiverDiagnostics: Option { Option(id: 236) }
+  public static var disableObjcAttrRequiresFoundationModule: Option { Option(id: 237) }
+  public static var disableObjcInterop: Option { Option(id: 238) }
+  public static var disableObjectiveCProtocolSymbolicReferences: Option { Option(id: 239) }
+  public static var disableOnlyOneDependencyFile: Option { Option(id: 240) }
+  public static var disableOsChecks: Option { Option(id: 241) }
+  public static var disableOsChecks_: Option { Option(id: 242) }
+  public static var disableOssaOpts: Option { Option(id: 243) }
+  public static var disablePlaygroundTransform: Option { Option(id: 244) }
+  public static var disablePreallocatedInstantiationCaches: Option { Option(id: 245) }
+  public static var disablePreviousImplementationCallsInDynamicReplacements: Option { Option(id: 246) }
+  public static var disablePrintMissingImportsInModuleInterface: Option { Option(id: 247) }
+  public static var disableProfilingMarkerThunks: Option { Option(id: 248) }
+  public static var disableReadonlyStaticObjects: Option { Option(id: 249) }
+  public static var disableReflectionMetadata: Option { Option(id: 250) }
+  public static var disableReflectionNames: Option { Option(id: 251) }
+  public static var disableRelativeProtocolWitnessTables: Option { Option(id: 252) }
+  public static var disableRemoveDeprecatedCheck: Option { Option(id: 253) }
+  public static var disableRemoveDeprecatedCheck_: Option { Option(id: 254) }
+  public static var disableRequirementMachineConcreteContraction: Option { Option(id: 255) }
+  public static var disableRequirementMachineLoopNormalization: Option { Option(id: 256) }
+  public static var disableRequirementMachineReuse: Option { Option(id: 257) }
+  public static var disableRoundTripDebugTypes: Option { Option(id: 258) }
+  public static var disableSafeInteropWrappers: Option { Option(id: 259) }
+  public static var disableSandbox: Option { Option(id: 260) }
+  public static var disableSendingArgsAndResultsWithRegionIsolation: Option { Option(id: 261) }
+  public static var disableSilOpaqueValues: Option { Option(id: 262) }
+  public static var disableSilOwnershipVerifier: Option { Option(id: 263) }
+  public static var disableSilPartialApply: Option { Option(id: 264) }
+  public static var disableSilPerfOptzns: Option { Option(id: 265) }
+  public static var disableSplitColdCode: Option { Option(id: 266) }
+  public static var disableStackProtector: Option { Option(id: 267) }
+  public static var disableStandardSubstitutionsInReflectionMangling: Option { Option(id: 268) }
+  public static var disableSubstSilFunctionTypes: Option { Option(id: 269) }
+  public static var disableSwiftBridgeAttr: Option { Option(id: 270) }
+  public static var disableSwiftSpecificLlvmOptzns: Option { Option(id: 271) }
+  public static var disableSwift3ObjcInference: Option { Option(id: 272) }
+  public static var disableTargetOsChecking: Option { Option(id: 273) }
+  public static var disableTestableAttrRequiresTestableModule: Option { Option(id: 274) }
+  public static var disableThrowsPrediction: Option { Option(id: 275) }
+  public static var disableTypeLayouts: Option { Option(id: 276) }
+  public static var disableTypoCorrection: Option { Option(id: 277) }
+  public static var disableUpcomingFeature: Option { Option(id: 278) }
+  public static var disableVerifyExclusivity: Option { Option(id: 279) }
+  public static var disableWorkaroundBrokenModules: Option { Option(id: 280) }
+  public static var disableX8664Corocc: Option { Option(id: 281) }
+  public static var disallowForwardingDriver: Option { Option(id: 282) }
+  public static var downgradeTypecheckInterfaceError: Option { Option(id: 283) }
+  public static var driverAlwaysRebuildDependents: Option { Option(id: 284) }
+  public static var driverBatchCount: Option { Option(id: 285) }
+  public static var driverBatchSeed: Option { Option(id: 286) }
+  public static var driverBatchSizeLimit: Option { Option(id: 287) }
+  public static var driverEmitFineGrainedDependencyDotFileAfterEveryImport: Option { Option(id: 288) }
+  public static var driverFilelistThresholdEQ: Option { Option(id: 289) }
+  public static var driverFilelistThreshold: Option { Option(id: 290) }
+  public static var driverForceResponseFiles: Option { Option(id: 291) }
+  public static var driverMode: Option { Option(id: 292) }
+  public static var driverPrintActions: Option { Option(id: 293) }
+  public static var driverPrintBindings: Option { Option(id: 294) }
+  public static var driverPrintDerivedOutputFileMap: Option { Option(id: 295) }
+  public static var driverPrintGraphviz: Option { Option(id: 296) }
+  public static var driverPrintJobs: Option { Option(id: 297) }
+  public static var driverPrintOutputFileMap: Option { Option(id: 298) }
+  public static var driverShowIncremental: Option { Option(id: 299) }
+  public static var driverShowJobLifecycle: Option { Option(id: 300) }
+  public static var driverSkipExecution: Option { Option(id: 301) }
+  public static var driverTimeCompilation: Option { Option(id: 302) }
+  public static var driverUseFilelists: Option { Option(id: 303) }
+  public static var driverUseFrontendPath: Option { Option(id: 304) }
+  public static var driverVerifyFineGrainedDependencyGraphAfterEveryImport: Option { Option(id: 305) }
+  public static var driverWarnUnusedOptions: Option { Option(id: 306) }
+  public static var dumpAbstractLayout: Option { Option(id: 307) }
+  public static var dumpApiPath: Option { Option(id: 308) }
+  public static var dumpAstFormat: Option { Option(id: 309) }
+  public static var dumpAst: Option { Option(id: 310) }
+  public static var dumpAvailabilityScopes: Option { Option(id: 311) }
+  public static var dumpClangDiagnostics: Option { Option(id: 312) }
+  public static var dumpClangLookupTables: Option { Option(id: 313) }
+  public static var dumpHiddenTypeLayouts: Option { Option(id: 314) }
+  public static var dumpInterfaceHash: Option { Option(id: 315) }
+  public static var dumpJit: Option { Option(id: 316) }
+  public static var dumpMacroExpansions: Option { Option(id: 317) }
+  public static var dumpMigrationStatesDir: Option { Option(id: 318) }
+  public static var dumpParse: Option { Option(id: 319) }
+  public static var dumpPcm: Option { Option(id: 320) }
+  public static var dumpRequirementMachine: Option { Option(id: 321) }
+  public static var dumpScopeMaps: Option { Option(id: 322) }
+  public static var dumpSdk: Option { Option(id: 323) }
+  public static var dumpSdk_: Option { Option(id: 324) }
+  public static var dumpSourceFileImports: Option { Option(id: 325) }
+  public static var dumpTypeInfo: Option { Option(id: 326) }
+  public static var dumpTypeWitnessSystems: Option { Option(id: 327) }
+  public static var dumpUsr: Option { Option(id: 328) }
+  public static var dwarfVersion: Option { Option(id: 329) }
+  public static var dynamicMemberLookupDepthLimitEQ: Option { Option(id: 330) }
+  public static var D: Option { Option(id: 331) }
+  public static var eagerMacroChecking: Option { Option(id: 332) }
+  public static var embedBitcodeMarker: Option { Option(id: 333) }
+  public static var embedBitcode: Option { Option(id: 334) }
+  public static var embedTbdForModule: Option { Option(id: 335) }
+  public static var emitAbiDescriptorPath: Option { Option(id: 336) }
+  public static var emitApiDescriptorPath: Option { Option(id: 337) }
+  public static var emitApiDescriptor: Option { Option(id: 338) }
+  public static var emitAssembly: Option { Option(id: 339) }
+  public static var emitAst: Option { Option(id: 340) }
+  public static var emitBc: Option { Option(id: 341) }
+  public static var emitClangHeaderMinAccess: Option { Option(id: 342) }
+  public static var emitClangHeaderNonmodularIncludes: Option { Option(id: 343) }
+  public static var emitClangHeaderPath: Option { Option(id: 344) }
+  public static var emitConstValuesPath: Option { Option(id: 345) }
+  public static var emitConstValues: Option { Option(id: 346) }
+  public static var emitDependenciesPath: Option { Option(id: 347) }
+  public static var emitDependencies: Option { Option(id: 348) }
+  public static var emitDigesterBaselinePath: Option { Option(id: 349) }
+  public static var emitDigesterBaseline: Option { Option(id: 350) }
+  public static var emitEmptyObjectFile: Option { Option(id: 351) }
+  public static var emitExecutable: Option { Option(id: 352) }
+  public static var emitExtensionBlockSymbols: Option { Option(id: 353) }
+  public static var emitFineGrainedDependencySourcefileDotFiles: Option { Option(id: 354) }
+  public static var emitFixitsPath: Option { Option(id: 355) }
+  public static var emitImportedModules: Option { Option(id: 356) }
+  public static var emitIrgen: Option { Option(id: 357) }
+  public static var emitIr: Option { Option(id: 358) }
+  public static var emitLibrary: Option { Option(id: 359) }
+  public static var emitLoadedModuleTracePathEQ: Option { Option(id: 360) }
+  public static var emitLoadedModuleTracePath: Option { Option(id: 361) }
+  public static var emitLoadedModuleTrace: Option { Option(id: 362) }
+  public static var emitLoweredSil: Option { Option(id: 363) }
+  public static var emitMacroExpansionFiles: Option { Option(id: 364) }
+  public static var emitMigratedFilePath: Option { Option(id: 365) }
+  public static var emitModuleDependenciesPath: Option { Option(id: 366) }
+  public static var emitModuleDocPath: Option { Option(id: 367) }
+  public static var emitModuleDoc: Option { Option(id: 368) }
+  public static var emitModuleInterfacePath: Option { Option(id: 369) }
+  public static var emitModuleInterface: Option { Option(id: 370) }
+  public static var emitModulePathEQ: Option { Option(id: 371) }
+  public static var emitModulePath: Option { Option(id: 372) }
+  public static var emitModuleSemanticInfoPath: Option { Option(id: 373) }
+  public static var emitModuleSeparatelyWMO: Option { Option(id: 374) }
+  public static var emitModuleSerializeDiagnosticsPath: Option { Option(id: 375) }
+  public static var emitModuleSourceInfoPath: Option { Option(id: 376) }
+  public static var emitModuleSourceInfo: Option { Option(id: 377) }
+  public static var emitModuleSummaryPath: Option { Option(id: 378) }
+  public static var emitModuleSummary: Option { Option(id: 379) }
+  public static var emitModule: Option { Option(id: 380) }
+  public static var emitObjcHeaderPath: Option { Option(id: 381) }
+  public static var emitObjcHeader: Option { Option(id: 382) }
+  public static var emitObject: Option { Option(id: 383) }
+  public static var emitPackageModuleInterfacePath: Option { Option(id: 384) }
+  public static var emitParseableModuleInterfacePath: Option { Option(id: 385) }
+  public static var emitParseableModuleInterface: Option { Option(id: 386) }
+  public static var emitParse: Option { Option(id: 387) }
+  public static var emitPch: Option { Option(id: 388) }
+  public static var emitPcm: Option { Option(id: 389) }
+  public static var emitPolyglotAst: Option { Option(id: 390) }
+  public static var emitPrivateModuleInterfacePath: Option { Option(id: 391) }
+  public static var emitReferenceDependenciesPath: Option { Option(id: 392) }
+  public static var emitReferenceDependencies: Option { Option(id: 393) }
+  public static var emitRemapFilePath: Option { Option(id: 394) }
+  public static var emitSibgen: Option { Option(id: 395) }
+  public static var emitSib: Option { Option(id: 396) }
+  public static var emitSilgen: Option { Option(id: 397) }
+  public static var emitSil: Option { Option(id: 398) }
+  public static var emitSingletonMetadataPointer: Option { Option(id: 399) }
+  public static var emitSortedSil: Option { Option(id: 400) }
+  public static var stackPromotionChecks: Option { Option(id: 401) }
+  public static var emitSupportedArguments: Option { Option(id: 402) }
+  public static var emitSupportedFeatures: Option { Option(id: 403) }
+  public static var emitSymbolGraphDir: Option { Option(id: 404) }
+  public static var emitSymbolGraph: Option { Option(id: 405) }
+  public static var emitTbdPathEQ: Option { Option(id: 406) }
+  public static var emitTbdPath: Option { Option(id: 407) }
+  public static var emitTbd: Option { Option(id: 408) }
+  public static var emitVariantAbiDescriptorPath: Option { Option(id: 409) }
+  public static var emitVariantApiDescriptorPath: Option { Option(id: 410) }
+  public static var emitVariantModuleDocPath: Option { Option(id: 411) }
+  public static var emitVariantModuleInterfacePath: Option { Option(id: 412) }
+  public static var emitVariantModulePath: Option { Option(id: 413) }
+  public static var emitVariantModuleSourceInfoPath: Option { Option(id: 414) }
+  public static var emitVariantPackageModuleInterfacePath: Option { Option(id: 415) }
+  public static var emitVariantPrivateModuleInterfacePath: Option { Option(id: 416) }
+  public static var emitVerboseSil: Option { Option(id: 417) }
+  public static var emptyAbiDescriptor: Option { Option(id: 418) }
+  public static var emptyBaseline: Option { Option(id: 419) }
+  public static var emptyBaseline_: Option { Option(id: 420) }
+  public static var enableAccessControl: Option { Option(id: 421) }
+  public static var enableActorDataRaceChecks: Option { Option(id: 422) }
+  public static var enableAddressDependencies: Option { Option(id: 423) }
+  public static var enableAggressiveReg2mem: Option { Option(id: 424) }
+  public static var enableAnonymousContextMangledNames: Option { Option(id: 425) }
+  public static var enableArm64Corocc: Option { Option(id: 426) }
+  public static var enableAssemblyVisionAll: Option { Option(id: 427) }
+  public static var enableAstVerifier: Option { Option(id: 428) }
+  public static var enableAsyncFramePointerAll: Option { Option(id: 429) }
+  public static var enableAsyncFramePushPopMetadata: Option { Option(id: 430) }
+  public static var enableAutolinkingRuntimeCompatibilityBytecodeLayouts: Option { Option(id: 431) }
+  public static var enableBareSlashRegex: Option { Option(id: 432) }
+  public static var enableBatchMode: Option { Option(id: 433) }
+  public static var enableBridgingPch: Option { Option(id: 434) }
+  public static var enableBuiltinModule: Option { Option(id: 435) }
+  public static var enableCalleeAllocatedCoroAbi: Option { Option(id: 436) }
+  public static var EnableCMOEverything: Option { Option(id: 437) }
+  public static var enableCollocateMetadataFunctions: Option { Option(id: 438) }
+  public static var enableColocateTypeDescriptors: Option { Option(id: 439) }
+  public static var enableCondFailMessageAnnotation: Option { Option(id: 440) }
+  public static var copyPropagationStateEQ: Option { Option(id: 441) }
+  public static var enableCopyPropagation: Option { Option(id: 442) }
+  public static var enableCrossImportOverlays: Option { Option(id: 443) }
+  public static var EnableDefaultCMO: Option { Option(id: 444) }
+  public static var enableDeserializationRecovery: Option { Option(id: 445) }
+  public static var enableDeserializationSafety: Option { Option(id: 446) }
+  public static var enableDestroyHoisting: Option { Option(id: 447) }
+  public static var enableDeterministicCheck: Option { Option(id: 448) }
+  public static var enableDirectRetainRelease: Option { Option(id: 449) }
+  public static var enableDynamicReplacementChaining: Option { Option(id: 450) }
+  public static var enableEmitGenericClassRoTList: Option { Option(id: 451) }
+  public static var enableEmitTypeMallocForCoroFrame: Option { Option(id: 452) }
+  public static var enableExperimentalAdditiveArithmeticDerivation: Option { Option(id: 453) }
+  public static var enableAsyncDemotion: Option { Option(id: 454) }
+  public static var enableExperimentalAsyncTopLevel: Option { Option(id: 455) }
+  public static var enableExperimentalConcisePoundFile: Option { Option(id: 456) }
+  public static var enableExperimentalConcurrency: Option { Option(id: 457) }
+  public static var enableExperimentalCxxInterop: Option { Option(id: 458) }
+  public static var enableExperimentalDistributed: Option { Option(id: 459) }
+  public static var enableExperimentalEagerClangModuleDiagnostics: Option { Option(id: 460) }
+  public static var enableExperimentalFeature: Option { Option(id: 461) }
+  public static var enableExperimentalFlowSensitiveConcurrentCaptures: Option { Option(id: 462) }
+  public static var enableExperimentalForwardModeDifferentiation: Option { Option(id: 463) }
+  public static var enableExperimentalLifetimeDependenceInference: Option { Option(id: 464) }
+  public static var enableExperimentalMoveOnly: Option { Option(id: 465) }
+  public static var enableExperimentalNamedOpaqueTypes: Option { Option(id: 466) }
+  public static var enableExperimentalOpaqueTypeErasure: Option { Option(id: 467) }
+  public static var enableExperimentalOpenedExistentialTypes: Option { Option(id: 468) }
+  public static var enableExperimentalPairwiseBuildBlock: Option { Option(id: 469) }
+  public static var enableExperimentalStaticAssert: Option { Option(id: 470) }
+  public static var enableExperimentalStringProcessing: Option { Option(id: 471) }
+  public static var enableExplicitExistentialTypes: Option { Option(id: 472) }
+  public static var enableFragileResilientProtocolWitnesses: Option { Option(id: 473) }
+  public static var enableImplicitDynamic: Option { Option(id: 474) }
+  public static var enableImportPtrauthFieldFunctionPointers: Option { Option(id: 475) }
+  public static var enableIncrementalFileHashing: Option { Option(id: 476) }
+  public static var enableIncrementalImports: Option { Option(id: 477) }
+  public static var enableInvalidEphemeralnessAsError: Option { Option(id: 478) }
+  public static var enableLargeLoadableTypesReg2mem: Option { Option(id: 479) }
+  public static var enableLayoutStringValueWitnessesInstantiation: Option { Option(id: 480) }
+  public static var enableLayoutStringValueWitnesses: Option { Option(id: 481) }
+  public static var enableLexicalLifetimes: Option { Option(id: 482) }
+  public static var enableLexicalLifetimesNoArg: Option { Option(id: 483) }
+  public static var enableLibraryEvolution: Option { Option(id: 484) }
+  public static var enableLifetimeDependenceDiagnostics: Option { Option(id: 485) }
+  public static var enableLlvmValueNames: Option { Option(id: 486) }
+  public static var enableLlvmVerifyEach: Option { Option(id: 487) }
+  public static var enableLlvmVfe: Option { Option(id: 488) }
+  public static var enableLlvmWme: Option { Option(id: 489) }
+  public static var enableModuleSelectorsInModuleInterface: Option { Option(id: 490) }
+  public static var enableMoveInoutStackProtector: Option { Option(id: 491) }
+  public static var enableNewLlvmPassManager: Option { Option(id: 492) }
+  public static var enableNewOperatorLookup: Option { Option(id: 493) }
+  public static var enableNonfrozenEnumExhaustivityDiagnostics: Option { Option(id: 494) }
+  public static var enableNoreturnPrediction: Option { Option(id: 495) }
+  public static var enableNskeyedarchiverDiagnostics: Option { Option(id: 496) }
+  public static var enableObjcAttrRequiresFoundationModule: Option { Option(id: 497) }
+  public static var enableObjcInterop: Option { Option(id: 498) }
+  public static var enableObjectiveCProtocolSymbolicReferences: Option { Option(id: 499) }
+  public static var enableOnlyOneDependencyFile: Option { Option(id: 500) }
+  public static var enableOssaModules: Option { Option(id: 501) }
+  public static var enablePackMetadataStackPromotion: Option { Option(id: 502) }
+  public static var enablePackMetadataStackPromotionNoArg: Option { Option(id: 503) }
+  public static var enablePrivateImports: Option { Option(id: 504) }
+  public static var enableProfilingMarkerThunks: Option { Option(id: 505) }
+  public static var enableRecompilationToOssaModule: Option { Option(id: 506) }
+  public static var enableRelativeProtocolWitnessTables: Option { Option(id: 507) }
+  public static var enableRemoveDeprecatedCheck: Option { Option(id: 508) }
+  public static var enableRemoveDeprecatedCheck_: Option { Option(id: 509) }
+  public static var enableRequirementMachineOpaqueArchetypes: Option { Option(id: 510) }
+  public static var enableResilience: Option { Option(id: 511) }
+  public static var enableRoundTripDebugTypes: Option { Option(id: 512) }
+  public static var enableSilOpaqueValues: Option { Option(id: 513) }
+  public static var enableSingleModuleLlvmEmission: Option { Option(id: 514) }
+  public static var enableSourceImport: Option { Option(id: 515) }
+  public static var enableSpecDevirt: Option { Option(id: 516) }
+  public static var enableSplitColdCode: Option { Option(id: 517) }
+  public static var enableStackProtector: Option { Option(id: 518) }
+  public static var enableSwift3ObjcInference: Option { Option(id: 519) }
+  public static var enableTargetOsChecking: Option { Option(id: 520) }
+  public static var enableTestableAttrRequiresTestableModule: Option { Option(id: 521) }
+  public static var enableTesting: Option { Option(id: 522) }
+  public static var enableThrowWithoutTry: Option { Option(id: 523) }
+  public static var enableThrowsPrediction: Option { Option(id: 524) }
+  public static var enableTypeLayouts: Option { Option(id: 525) }
+  public static var enableUpcomingFeature: Option { Option(id: 526) }
+  public static var enableVerifyExclusivity: Option { Option(id: 527) }
+  public static var enableVolatileModules: Option { Option(id: 528) }
+  public static var enableX8664Corocc: Option { Option(id: 529) }
+  public static var enforceExclusivityEQ: Option { Option(id: 530) }
+  public static var entryPointFunctionName: Option { Option(id: 531) }
+  public static var errorOnAbiBreakage: Option { Option(id: 532) }
+  public static var errorOnAbiBreakage_: Option { Option(id: 533) }
+  public static var experimentalAllowModuleWithCompilerErrors: Option { Option(id: 534) }
+  public static var experimentalAllowNonResilientAccess: Option { Option(id: 535) }
+  public static var experimentalAllowedReexportedModules: Option { Option(id: 536) }
+  public static var experimentalCForeignReferenceTypes: Option { Option(id: 537) }
+  public static var experimentalClangImporterDirectCc1Scan: Option { Option(id: 538) }
+  public static var emitModuleSeparately: Option { Option(id: 539) }
+  public static var experimentalEmitVariantModule: Option { Option(id: 540) }
+  public static var driverExperimentalExplicitModuleBuild: Option { Option(id: 541) }
+  public static var experimentalHermeticSealAtLink: Option { Option(id: 542) }
+  public static var experimentalLazyTypecheck: Option { Option(id: 543) }
+  public static var experimentalPackageBypassResilience: Option { Option(id: 544) }
+  public static var ExperimentalPackageCMOAbortOnDeserializationFail: Option { Option(id: 545) }
+  public static var ExperimentalPackageCMO: Option { Option(id: 546) }
+  public static var experimentalPackageInterfaceLoad: Option { Option(id: 547) }
+  public static var ExperimentalPerformanceAnnotations: Option { Option(id: 548) }
+  public static var platformCCallingConventionEQ: Option { Option(id: 549) }
+  public static var platformCCallingConvention: Option { Option(id: 550) }
+  public static var experimentalPrintFullConvention: Option { Option(id: 551) }
+  public static var experimentalSerializeDebugInfo: Option { Option(id: 552) }
+  public static var experimentalSkipAllFunctionBodies: Option { Option(id: 553) }
+  public static var experimentalSkipNonExportableDecls: Option { Option(id: 554) }
+  public static var experimentalSkipNonInlinableFunctionBodiesWithoutTypes: Option { Option(id: 555) }
+  public static var experimentalSkipNonInlinableFunctionBodies: Option { Option(id: 556) }
+  public static var experimentalSpiImports: Option { Option(id: 557) }
+  public static var experimentalSpiOnlyImports: Option { Option(id: 558) }
+  public static var explainModuleDependencyDetailed: Option { Option(id: 559) }
+  public static var explainModuleDependency: Option { Option(id: 560) }
+  public static var explicitAutoLinking: Option { Option(id: 561) }
+  public static var explicitDependencyGraphFormat: Option { Option(id: 562) }
+  public static var explicitInterfaceModuleBuild: Option { Option(id: 563) }
+  public static var driverExplicitModuleBuild: Option { Option(id: 564) }
+  public static var explicitSwiftModuleMap: Option { Option(id: 565) }
+  public static var exportAs: Option { Option(id: 566) }
+  public static var externalPassPipelineFilename: Option { Option(id: 567) }
+  public static var externalPluginPath: Option { Option(id: 568) }
+  public static var e: Option { Option(id: 569) }
+  public static var FEQ: Option { Option(id: 570) }
+  public static var fileCompilationDir: Option { Option(id: 571) }
+  public static var filePrefixMap: Option { Option(id: 572) }
+  public static var filelist: Option { Option(id: 573) }
+  public static var findUsr: Option { Option(id: 574) }
+  public static var findUsr_: Option { Option(id: 575) }
+  public static var fineGrainedTimers: Option { Option(id: 576) }
+  public static var fixitAll: Option { Option(id: 577) }
+  public static var forcePublicLinkage: Option { Option(id: 578) }
+  public static var forceSingleFrontendInvocation: Option { Option(id: 579) }
+  public static var forceStructTypeLayouts: Option { Option(id: 580) }
+  public static var formalCxxInteroperabilityMode: Option { Option(id: 581) }
+  public static var framework: Option { Option(id: 582) }
+  public static var frontendParseableOutput: Option { Option(id: 583) }
+  public static var Fsystem: Option { Option(id: 584) }
+  public static var functionSections: Option { Option(id: 585) }
+  public static var F: Option { Option(id: 586) }
+  public static var gccToolchain: Option { Option(id: 587) }
+  public static var gdwarfTypes: Option { Option(id: 588) }
+  public static var genReproducerDir: Option { Option(id: 589) }
+  public static var genReproducer: Option { Option(id: 590) }
+  public static var generateEmptyBaseline: Option { Option(id: 591) }
+  public static var generateEmptyBaseline_: Option { Option(id: 592) }
+  public static var generateMigrationScript: Option { Option(id: 593) }
+  public static var generateMigrationScript_: Option { Option(id: 594) }
+  public static var generateNameCorrection: Option { Option(id: 595) }
+  public static var generateNameCorrection_: Option { Option(id: 596) }
+  public static var glineTablesOnly: Option { Option(id: 597) }
+  public static var gnone: Option { Option(id: 598) }
+  public static var groupInfoPath: Option { Option(id: 599) }
+  public static var legacyGsil: Option { Option(id: 600) }
+  public static var g: Option { Option(id: 601) }
+  public static var helpHidden: Option { Option(id: 602) }
+  public static var helpHidden_: Option { Option(id: 603) }
+  public static var help: Option { Option(id: 604) }
+  public static var help_: Option { Option(id: 605) }
+  public static var h: Option { Option(id: 606) }
+  public static var IEQ: Option { Option(id: 607) }
+  public static var ignoreAlwaysInline: Option { Option(id: 608) }
+  public static var ignoreModuleSourceInfo: Option { Option(id: 609) }
+  public static var ignoreSpiGroupsNewApi: Option { Option(id: 610) }
+  public static var ignoreSpiGroupsNewApi_: Option { Option(id: 611) }
+  public static var ignoreSpiGroups: Option { Option(id: 612) }
+  public static var ignoreSpiGroups_: Option { Option(id: 613) }
+  public static var ignoredUsrs: Option { Option(id: 614) }
+  public static var ignoredUsrs_: Option { Option(id: 615) }
+  public static var importBridgingHeader: Option { Option(id: 616) }
+  public static var importCfTypes: Option { Option(id: 617) }
+  public static var importModule: Option { Option(id: 618) }
+  public static var importObjcHeader: Option { Option(id: 619) }
+  public static var importPch: Option { Option(id: 620) }
+  public static var importPrescan: Option { Option(id: 621) }
+  public static var importUnderlyingModule: Option { Option(id: 622) }
+  public static var inPlace: Option { Option(id: 623) }
+  public static var inProcessPluginServerPath: Option { Option(id: 624) }
+  public static var includeSpiSymbols: Option { Option(id: 625) }
+  public static var includeSubmodules: Option { Option(id: 626) }
+  public static var incrementalDependencyScan: Option { Option(id: 627) }
+  public static var incremental: Option { Option(id: 628) }
+  public static var indentSwitchCase: Option { Option(id: 629) }
+  public static var indentWidth: Option { Option(id: 630) }
+  public static var indexFilePath: Option { Option(id: 631) }
+  public static var indexFile: Option { Option(id: 632) }
+  public static var indexIgnoreClangModules: Option { Option(id: 633) }
+  public static var indexIgnoreStdlib: Option { Option(id: 634) }
+  public static var indexIgnoreSystemModules: Option { Option(id: 635) }
+  public static var indexIncludeLocals: Option { Option(id: 636) }
+  public static var indexStoreCompress: Option { Option(id: 637) }
+  public static var indexStorePath: Option { Option(id: 638) }
+  public static var indexSystemModules: Option { Option(id: 639) }
+  public static var indexUnitOutputPathFilelist: Option { Option(id: 640) }
+  public static var indexUnitOutputPath: Option { Option(id: 641) }
+  public static var inputFileKey: Option { Option(id: 642) }
+  public static var inputPaths: Option { Option(id: 643) }
+  public static var inputPaths_: Option { Option(id: 644) }
+  public static var swiftinterfaceCompilerVersion: Option { Option(id: 645) }
+  public static var internalImportBridgingHeader: Option { Option(id: 646) }
+  public static var internalImportPch: Option { Option(id: 647) }
+  public static var internalizeAtLink: Option { Option(id: 648) }
+  public static var interpret: Option { Option(id: 649) }
+  public static var ipiClangModule: Option { Option(id: 650) }
+  public static var irOutputDir: Option { Option(id: 651) }
+  public static var irOutputPath: Option { Option(id: 652) }
+  public static var irProfileGenerateEQ: Option { Option(id: 653) }
+  public static var irProfileGenerate: Option { Option(id: 654) }
+  public static var irProfileUse: Option { Option(id: 655) }
+  public static var Isystem: Option { Option(id: 656) }
+  public static var I: Option { Option(id: 657) }
+  public static var i: Option { Option(id: 658) }
+  public static var json: Option { Option(id: 659) }
+  public static var json_: Option { Option(id: 660) }
+  public static var j: Option { Option(id: 661) }
+  public static var LEQ: Option { Option(id: 662) }
+  public static var languageMode: Option { Option(id: 663) }
+  public static var ldPath: Option { Option(id: 664) }
+  public static var libc: Option { Option(id: 665) }
+  public static var libraryLevelEQ: Option { Option(id: 666) }
+  public static var libraryLevel: Option { Option(id: 667) }
+  public static var lineRange: Option { Option(id: 668) }
+  public static var linkObjcRuntime: Option { Option(id: 669) }
+  public static var lldbRepl: Option { Option(id: 670) }
+  public static var reuseDependencyScanCache: Option { Option(id: 671) }
+  public static var loadPassPluginEQ: Option { Option(id: 672) }
+  public static var loadPluginExecutable: Option { Option(id: 673) }
+  public static var loadPluginLibrary: Option { Option(id: 674) }
+  public static var loadResolvedPlugin: Option { Option(id: 675) }
+  public static var locale: Option { Option(id: 676) }
+  public static var localizationPath: Option { Option(id: 677) }
+  public static var location: Option { Option(id: 678) }
+  public static var location_: Option { Option(id: 679) }
+  public static var ltoLibrary: Option { Option(id: 680) }
+  public static var lto: Option { Option(id: 681) }
+  public static var L: Option { Option(id: 682) }
+  public static var l: Option { Option(id: 683) }
+  public static var maxSubstitutionCount: Option { Option(id: 684) }
+  public static var maxSubstitutionDepth: Option { Option(id: 685) }
+  public static var mergeModules: Option { Option(id: 686) }
+  public static var mergeableSymbols: Option { Option(id: 687) }
+  public static var mergeableTraps: Option { Option(id: 688) }
+  public static var migrateKeepObjcVisibility: Option { Option(id: 689) }
+  public static var migratorUpdateSdk: Option { Option(id: 690) }
+  public static var migratorUpdateSwift: Option { Option(id: 691) }
+  public static var migrator: Option { Option(id: 692) }
+  public static var migrator_: Option { Option(id: 693) }
+  public static var minRuntimeVersion: Option { Option(id: 694) }
+  public static var minSwiftRuntimeVersion: Option { Option(id: 695) }
+  public static var minValidPointerValue: Option { Option(id: 696) }
+  public static var minimumAccessLevel: Option { Option(id: 697) }
+  public static var moduleAbiName: Option { Option(id: 698) }
+  public static var moduleAlias: Option { Option(id: 699) }
+  public static var moduleCachePath: Option { Option(id: 700) }
+  public static var moduleCanImportVersion: Option { Option(id: 701) }
+  public static var moduleCanImport: Option { Option(id: 702) }
+  public static var moduleImportFromCas: Option { Option(id: 703) }
+  public static var moduleInterfacePreserveTypesAsWritten: Option { Option(id: 704) }
+  public static var moduleLinkNameEQ: Option { Option(id: 705) }
+  public static var moduleLinkName: Option { Option(id: 706) }
+  public static var moduleListFile: Option { Option(id: 707) }
+  public static var moduleLoadMode: Option { Option(id: 708) }
+  public static var moduleNameEQ: Option { Option(id: 709) }
+  public static var moduleName: Option { Option(id: 710) }
+  public static var module: Option { Option(id: 711) }
+  public static var module_: Option { Option(id: 712) }
+  public static var newDriverPath: Option { Option(id: 713) }
+  public static var noAllocations: Option { Option(id: 714) }
+  public static var noAutoBridgingHeaderChaining: Option { Option(id: 715) }
+  public static var noCacheCompileJob: Option { Option(id: 716) }
+  public static var noClangIncludeTree: Option { Option(id: 717) }
+  public static var noClangModuleBreadcrumbs: Option { Option(id: 718) }
+  public static var noClangCompilerInstanceSharing: Option { Option(id: 719) }
+  public static var noColorDiagnostics: Option { Option(id: 720) }
+  public static var noEmitModuleSeparatelyWMO: Option { Option(id: 721) }
+  public static var noEmitModuleSeparately: Option { Option(id: 722) }
+  public static var driverNoExplicitModuleBuild: Option { Option(id: 723) }
+  public static var noLinkObjcRuntime: Option { Option(id: 724) }
+  public static var noParallelScan: Option { Option(id: 725) }
+  public static var noScannerModuleValidation: Option { Option(id: 726) }
+  public static var noSerializeDebuggingOptions: Option { Option(id: 727) }
+  public static var noStaticExecutable: Option { Option(id: 728) }
+  public static var noStaticStdlib: Option { Option(id: 729) }
+  public static var noStdlibRpath: Option { Option(id: 730) }
+  public static var noStrictImplicitModuleContext: Option { Option(id: 731) }
+  public static var noToolchainStdlibRpath: Option { Option(id: 732) }
+  public static var noVerboseAsm: Option { Option(id: 733) }
+  public static var noVerifyEmittedModuleInterface: Option { Option(id: 734) }
+  public static var noWarningsAsErrors: Option { Option(id: 735) }
+  public static var noWholeModuleOptimization: Option { Option(id: 736) }
+  public static var driverScanDependenciesNonLib: Option { Option(id: 737) }
+  public static var nostartfiles: Option { Option(id: 738) }
+  public static var nostdimport: Option { Option(id: 739) }
+  public static var nostdlibimport: Option { Option(id: 740) }
+  public static var numThreads: Option { Option(id: 741) }
+  public static var omitExtensionBlockSymbols: Option { Option(id: 742) }
+  public static var Onone: Option { Option(id: 743) }
+  public static var Oplayground: Option { Option(id: 744) }
+  public static var Osize: Option { Option(id: 745) }
+  public static var Ounchecked: Option { Option(id: 746) }
+  public static var outputDir: Option { Option(id: 747) }
+  public static var outputFileMapEQ: Option { Option(id: 748) }
+  public static var outputFileMap: Option { Option(id: 749) }
+  public static var outputFilelist: Option { Option(id: 750) }
+  public static var O: Option { Option(id: 751) }
+  public static var o: Option { Option(id: 752) }
+  public static var PackageCMO: Option { Option(id: 753) }
+  public static var packageDescriptionVersion: Option { Option(id: 754) }
+  public static var packageName: Option { Option(id: 755) }
+  public static var parallelScan: Option { Option(id: 756) }
+  public static var parseAsLibrary: Option { Option(id: 757) }
+  public static var parseSil: Option { Option(id: 758) }
+  public static var parseStdlib: Option { Option(id: 759) }
+  public static var parseableOutput: Option { Option(id: 760) }
+  public static var parse: Option { Option(id: 761) }
+  public static var pcMacro: Option { Option(id: 762) }
+  public static var pchDisableValidation: Option { Option(id: 763) }
+  public static var pchOutputDir: Option { Option(id: 764) }
+  public static var playgroundHighPerformance: Option { Option(id: 765) }
+  public static var playgroundOption: Option { Option(id: 766) }
+  public static var playground: Option { Option(id: 767) }
+  public static var pluginPath: Option { Option(id: 768) }
+  public static var prebuiltModuleCachePathEQ: Option { Option(id: 769) }
+  public static var prebuiltModuleCachePath: Option { Option(id: 770) }
+  public static var prefixSerializedDebuggingOptions: Option { Option(id: 771) }
+  public static var prespecializeGenericMetadata: Option { Option(id: 772) }
+  public static var prettyPrint: Option { Option(id: 773) }
+  public static var previousModuleInstallnameMapFile: Option { Option(id: 774) }
+  public static var primaryFilelist: Option { Option(id: 775) }
+  public static var primaryFile: Option { Option(id: 776) }
+  public static var printAstDecl: Option { Option(id: 777) }
+  public static var printAst: Option { Option(id: 778) }
+  public static var printClangStats: Option { Option(id: 779) }
+  public static var printDiagnosticGroups: Option { Option(id: 780) }
+  public static var printEducationalNotes: Option { Option(id: 781) }
+  public static var printExplicitDependencyGraph: Option { Option(id: 782) }
+  public static var printFullyQualifiedTypes: Option { Option(id: 783) }
+  public static var printInstCounts: Option { Option(id: 784) }
+  public static var printLlvmInlineTree: Option { Option(id: 785) }
+  public static var printModule: Option { Option(id: 786) }
+  public static var printModule_: Option { Option(id: 787) }
+  public static var printPreprocessedExplicitDependencyGraph: Option { Option(id: 788) }
+  public static var printStaticBuildConfig: Option { Option(id: 789) }
+  public static var printStats: Option { Option(id: 790) }
+  public static var printSupportedFeatures: Option { Option(id: 791) }
+  public static var printTargetInfo: Option { Option(id: 792) }
+  public static var printZeroStats: Option { Option(id: 793) }
+  public static var profileCoverageMapping: Option { Option(id: 794) }
+  public static var profileGenerate: Option { Option(id: 795) }
+  public static var profileSampleUse: Option { Option(id: 796) }
+  public static var profileStatsEntities: Option { Option(id: 797) }
+  public static var profileStatsEvents: Option { Option(id: 798) }
+  public static var profileUse: Option { Option(id: 799) }
+  public static var projectName: Option { Option(id: 800) }
+  public static var protocolRequirementAllowList: Option { Option(id: 801) }
+  public static var protocolRequirementAllowList_: Option { Option(id: 802) }
+  public static var publicAutolinkLibrary: Option { Option(id: 803) }
+  public static var publicModuleName: Option { Option(id: 804) }
+  public static var RaccessNoteEQ: Option { Option(id: 805) }
+  public static var RaccessNote: Option { Option(id: 806) }
+  public static var cacheRemarks: Option { Option(id: 807) }
+  public static var emitCrossImportRemarks: Option { Option(id: 808) }
+  public static var dependencyScanCacheRemarks: Option { Option(id: 809) }
+  public static var dependencyScanRemarks: Option { Option(id: 810) }
+  public static var readLegacyTypeInfoPathEQ: Option { Option(id: 811) }
+  public static var reflectionMetadataForDebuggerOnly: Option { Option(id: 812) }
+  public static var registerModuleDependency: Option { Option(id: 813) }
+  public static var RemoveRuntimeAsserts: Option { Option(id: 814) }
+  public static var repl: Option { Option(id: 815) }
+  public static var reportErrorsToDebugger: Option { Option(id: 816) }
+  public static var requireExplicitAvailabilityTarget: Option { Option(id: 817) }
+  public static var requireExplicitAvailabilityEQ: Option { Option(id: 818) }
+  public static var requireExplicitAvailability: Option { Option(id: 819) }
+  public static var requireExplicitSendable: Option { Option(id: 820) }
+  public static var requirementMachineMaxConcreteNesting: Option { Option(id: 821) }
+  public static var requirementMachineMaxConcreteSize: Option { Option(id: 822) }
+  public static var requirementMachineMaxRuleCount: Option { Option(id: 823) }
+  public static var requirementMachineMaxRuleLength: Option { Option(id: 824) }
+  public static var requirementMachineMaxSplitConcreteEquivClassAttempts: Option { Option(id: 825) }
+  public static var requirementMachineMaxTypeDifferences: Option { Option(id: 826) }
+  public static var resolveImports: Option { Option(id: 827) }
+  public static var resolvedPluginVerification: Option { Option(id: 828) }
+  public static var resourceDir: Option { Option(id: 829) }
+  public static var remarkIndexingSystemModule: Option { Option(id: 830) }
+  public static var expansionRemarks: Option { Option(id: 831) }
+  public static var remarkMacroLoading: Option { Option(id: 832) }
+  public static var remarkModuleApiImport: Option { Option(id: 833) }
+  public static var RmoduleInterfaceRebuild: Option { Option(id: 834) }
+  public static var remarkLoadingModule: Option { Option(id: 835) }
+  public static var remarkModuleRecovery: Option { Option(id: 836) }
+  public static var remarkModuleSerialization: Option { Option(id: 837) }
+  public static var RpassMissedEQ: Option { Option(id: 838) }
+  public static var RpassEQ: Option { Option(id: 839) }
+  public static var remarkSkipExplicitInterfaceBuild: Option { Option(id: 840) }
+  public static var runtimeCompatibilityVersion: Option { Option(id: 841) }
+  public static var sanitizeAddressUseOdrIndicator: Option { Option(id: 842) }
+  public static var sanitizeCoverageEQ: Option { Option(id: 843) }
+  public static var sanitizeRecoverEQ: Option { Option(id: 844) }
+  public static var sanitizeStableAbiEQ: Option { Option(id: 845) }
+  public static var sanitizeEQ: Option { Option(id: 846) }
+  public static var saveOptimizationRecordPasses: Option { Option(id: 847) }
+  public static var saveOptimizationRecordPath: Option { Option(id: 848) }
+  public static var saveOptimizationRecordEQ: Option { Option(id: 849) }
+  public static var saveOptimizationRecord: Option { Option(id: 850) }
+  public static var saveTemps: Option { Option(id: 851) }
+  public static var scanDependencies: Option { Option(id: 852) }
+  public static var scannerCasFs: Option { Option(id: 853) }
+  public static var scannerDebugWriteOutput: Option { Option(id: 854) }
+  public static var scannerModuleValidation: Option { Option(id: 855) }
+  public static var scannerOutputDir: Option { Option(id: 856) }
+  public static var scannerPrefixMapPaths: Option { Option(id: 857) }
+  public static var scannerPrefixMapSdk: Option { Option(id: 858) }
+  public static var scannerPrefixMapToolchain: Option { Option(id: 859) }
+  public static var scannerPrefixMap: Option { Option(id: 860) }
+  public static var sdkModuleCachePath: Option { Option(id: 861) }
+  public static var sdk: Option { Option(id: 862) }
+  public static var serializeBreakingChangesPath: Option { Option(id: 863) }
+  public static var serializeDebuggingOptions: Option { Option(id: 864) }
+  public static var serializeDependencyScanCache: Option { Option(id: 865) }
+  public static var serializeDiagnosticsPathEQ: Option { Option(id: 866) }
+  public static var serializeDiagnosticsPath: Option { Option(id: 867) }
+  public static var serializeDiagnostics: Option { Option(id: 868) }
+  public static var serializeModuleInterfaceDependencyHashes: Option { Option(id: 869) }
+  public static var serializeParseableModuleInterfaceDependencyHashes: Option { Option(id: 870) }
+  public static var serializedPathObfuscate: Option { Option(id: 871) }
+  public static var showDiagnosticsAfterFatal: Option { Option(id: 872) }
+  public static var debugOnSil: Option { Option(id: 873) }
+  public static var silDebugSerialization: Option { Option(id: 874) }
+  public static var silInlineCallerBenefitReductionFactor: Option { Option(id: 875) }
+  public static var silInlineThreshold: Option { Option(id: 876) }
+  public static var silOutputDir: Option { Option(id: 877) }
+  public static var silOutputPath: Option { Option(id: 878) }
+  public static var silOwnershipVerifyAll: Option { Option(id: 879) }
+  public static var silRegionIsolationAssertOnUnknownPattern: Option { Option(id: 880) }
+  public static var silStopOptznsBeforeLoweringOwnership: Option { Option(id: 881) }
+  public static var silUnrollThreshold: Option { Option(id: 882) }
+  public static var silVerifyAll: Option { Option(id: 883) }
+  public static var silVerifyNone: Option { Option(id: 884) }
+  public static var skipInheritedDocs: Option { Option(id: 885) }
+  public static var skipProtocolImplementations: Option { Option(id: 886) }
+  public static var skipSynthesizedMembers: Option { Option(id: 887) }
+  public static var solverDisableBindingOptimizations: Option { Option(id: 888) }
+  public static var solverDisableCrashOnValidSalvage: Option { Option(id: 889) }
+  public static var solverDisableOptimizeOperatorDefaults: Option { Option(id: 890) }
+  public static var solverDisablePerformanceHacks: Option { Option(id: 891) }
+  public static var solverDisablePreparedOverloads: Option { Option(id: 892) }
+  public static var solverDisablePruneDisjunctions: Option { Option(id: 893) }
+  public static var solverDisableSplitter: Option { Option(id: 894) }
+  public static var solverDisableTransitiveConformance: Option { Option(id: 895) }
+  public static var solverEnableBindingOptimizations: Option { Option(id: 896) }
+  public static var solverEnableCrashOnValidSalvage: Option { Option(id: 897) }
+  public static var solverEnableOptimizeOperatorDefaults: Option { Option(id: 898) }
+  public static var solverEnablePerformanceHacks: Option { Option(id: 899) }
+  public static var solverEnablePreparedOverloads: Option { Option(id: 900) }
+  public static var solverEnablePruneDisjunctions: Option { Option(id: 901) }
+  public static var solverEnableTransitiveConformance: Option { Option(id: 902) }
+  public static var solverExpressionTimeThresholdEQ: Option { Option(id: 903) }
+  public static var solverMemoryThresholdEQ: Option { Option(id: 904) }
+  public static var solverScopeThresholdEQ: Option { Option(id: 905) }
+  public static var solverShrinkUnsolvedThreshold: Option { Option(id: 906) }
+  public static var solverShuffleChoicesEQ: Option { Option(id: 907) }
+  public static var solverShuffleDisjunctionsEQ: Option { Option(id: 908) }
+  public static var solverTrailThresholdEQ: Option { Option(id: 909) }
+  public static var stackPromotionLimit: Option { Option(id: 910) }
+  public static var staticExecutable: Option { Option(id: 911) }
+  public static var staticStdlib: Option { Option(id: 912) }
+  public static var `static`: Option { Option(id: 913) }
+  public static var statsOutputDir: Option { Option(id: 914) }
+  public static var strictConcurrency: Option { Option(id: 915) }
+  public static var strictImplicitModuleContext: Option { Option(id: 916) }
+  public static var strictMemorySafetyMigrate: Option { Option(id: 917) }
+  public static var strictMemorySafety: Option { Option(id: 918) }
+  public static var supplementaryOutputFileMap: Option { Option(id: 919) }
+  public static var suppressNotes: Option { Option(id: 920) }
+  public static var suppressRemarks: Option { Option(id: 921) }
+  public static var suppressStaticExclusivitySwap: Option { Option(id: 922) }
+  public static var suppressWarnings: Option { Option(id: 923) }
+  public static var swiftAsyncFramePointerEQ: Option { Option(id: 924) }
+  public static var swiftModuleCrossImport: Option { Option(id: 925) }
+  public static var swiftModuleFile: Option { Option(id: 926) }
+  public static var swiftOnly: Option { Option(id: 927) }
+  public static var swiftOnly_: Option { Option(id: 928) }
+  public static var swiftVersion: Option { Option(id: 929) }
+  public static var switchCheckingInvocationThresholdEQ: Option { Option(id: 930) }
+  public static var symbolGraphAllowAvailabilityPlatforms: Option { Option(id: 931) }
+  public static var symbolGraphBlockAvailabilityPlatforms: Option { Option(id: 932) }
+  public static var symbolGraphMinimumAccessLevel: Option { Option(id: 933) }
+  public static var symbolGraphPrettyPrint: Option { Option(id: 934) }
+  public static var symbolGraphShortenOutputNames: Option { Option(id: 935) }
+  public static var symbolGraphSkipInheritedDocs: Option { Option(id: 936) }
+  public static var symbolGraphSkipSynthesizedMembers: Option { Option(id: 937) }
+  public static var synthesizeInterfaceShow: Option { Option(id: 938) }
+  public static var sysroot: Option { Option(id: 939) }
+  public static var S: Option { Option(id: 940) }
+  public static var tabWidth: Option { Option(id: 941) }
+  public static var targetArchVariant: Option { Option(id: 942) }
+  public static var targetCpu: Option { Option(id: 943) }
+  public static var minInliningTargetVersion: Option { Option(id: 944) }
+  public static var targetSdkName: Option { Option(id: 945) }
+  public static var targetSdkVersion: Option { Option(id: 946) }
+  public static var targetVariantSdkVersion: Option { Option(id: 947) }
+  public static var targetVariant: Option { Option(id: 948) }
+  public static var targetLegacySpelling: Option { Option(id: 949) }
+  public static var target: Option { Option(id: 950) }
+  public static var tbdCompatibilityVersionEQ: Option { Option(id: 951) }
+  public static var tbdCompatibilityVersion: Option { Option(id: 952) }
+  public static var tbdCurrentVersionEQ: Option { Option(id: 953) }
+  public static var tbdCurrentVersion: Option { Option(id: 954) }
+  public static var tbdInstallNameEQ: Option { Option(id: 955) }
+  public static var tbdInstallName: Option { Option(id: 956) }
+  public static var tbdIsInstallapi: Option { Option(id: 957) }
+  public static var debugTestDependencyScanCacheSerialization: Option { Option(id: 958) }
+  public static var testableImportModule: Option { Option(id: 959) }
+  public static var throwsAsTraps: Option { Option(id: 960) }
+  public static var toolchainStdlibRpath: Option { Option(id: 961) }
+  public static var toolsDirectory: Option { Option(id: 962) }
+  public static var traceStatsEvents: Option { Option(id: 963) }
+  public static var trackSystemDependencies: Option { Option(id: 964) }
+  public static var trapFunction: Option { Option(id: 965) }
+  public static var triple: Option { Option(id: 966) }
+  public static var typeInfoDumpFilterEQ: Option { Option(id: 967) }
+  public static var typecheckModuleFromInterface: Option { Option(id: 968) }
+  public static var typecheck: Option { Option(id: 969) }
+  public static var typoCorrectionLimit: Option { Option(id: 970) }
+  public static var unavailableDeclOptimizationEQ: Option { Option(id: 971) }
+  public static var updateCode: Option { Option(id: 972) }
+  public static var useClangFunctionTypes: Option { Option(id: 973) }
+  public static var useFrontendParseableOutput: Option { Option(id: 974) }
+  public static var useInterfaceForModule: Option { Option(id: 975) }
+  public static var useInterfaceForModule_: Option { Option(id: 976) }
+  public static var useJit: Option { Option(id: 977) }
+  public static var useLd: Option { Option(id: 978) }
+  public static var useMalloc: Option { Option(id: 979) }
+  public static var useStaticResourceDir: Option { Option(id: 980) }
+  public static var useTabs: Option { Option(id: 981) }
+  public static var userModuleVersion: Option { Option(id: 982) }
+  public static var validateClangModulesOnce: Option { Option(id: 983) }
+  public static var validatePriorDependencyScanCache: Option { Option(id: 984) }
+  public static var validateTbdAgainstIrEQ: Option { Option(id: 985) }
+  public static var valueRecursionThreshold: Option { Option(id: 986) }
+  public static var verboseAsm: Option { Option(id: 987) }
+  public static var verifyAdditionalFile: Option { Option(id: 988) }
+  public static var verifyAdditionalPrefix: Option { Option(id: 989) }
+  public static var verifyAllSubstitutionMaps: Option { Option(id: 990) }
+  public static var verifyApplyFixes: Option { Option(id: 991) }
+  public static var verifyChildNotes: Option { Option(id: 992) }
+  public static var verifyDebugInfo: Option { Option(id: 993) }
+  public static var verifyEmittedModuleInterface: Option { Option(id: 994) }
+  public static var verifyGenericSignatures: Option { Option(id: 995) }
+  public static var verifyIgnoreMacroNote: Option { Option(id: 996) }
+  public static var verifyIgnoreUnknown: Option { Option(id: 997) }
+  public static var verifyIgnoreUnrelated: Option { Option(id: 998) }
+  public static var verifyIncrementalDependencies: Option { Option(id: 999) }
+  public static var verifyTypeLayout: Option { Option(id: 1000) }
+  public static var verify: Option { Option(id: 1001) }
+  public static var versionIndependentApinotes: Option { Option(id: 1002) }
+  public static var version: Option { Option(id: 1003) }
+  public static var version_: Option { Option(id: 1004) }
+  public static var vfsoverlayEQ: Option { Option(id: 1005) }
+  public static var vfsoverlay: Option { Option(id: 1006) }
+  public static var visualcToolsRoot: Option { Option(id: 1007) }
+  public static var visualcToolsVersion: Option { Option(id: 1008) }
+  public static var v: Option { Option(id: 1009) }
+  public static var warnConcurrency: Option { Option(id: 1010) }
+  public static var warnImplicitOverrides: Option { Option(id: 1011) }
+  public static var warnLongExpressionTypeCheckingScopesEQ: Option { Option(id: 1012) }
+  public static var warnLongExpressionTypeCheckingScopes: Option { Option(id: 1013) }
+  public static var warnLongExpressionTypeCheckingTrailEQ: Option { Option(id: 1014) }
+  public static var warnLongExpressionTypeCheckingTrail: Option { Option(id: 1015) }
+  public static var warnLongExpressionTypeCheckingEQ: Option { Option(id: 1016) }
+  public static var warnLongExpressionTypeChecking: Option { Option(id: 1017) }
+  public static var warnLongFunctionBodiesEQ: Option { Option(id: 1018) }
+  public static var warnLongFunctionBodies: Option { Option(id: 1019) }
+  public static var warnOnEditorPlaceholder: Option { Option(id: 1020) }
+  public static var warnOnPotentiallyUnavailableEnumCase: Option { Option(id: 1021) }
+  public static var warnSoftDeprecated: Option { Option(id: 1022) }
+  public static var warnSwift3ObjcInferenceComplete: Option { Option(id: 1023) }
+  public static var warnSwift3ObjcInferenceMinimal: Option { Option(id: 1024) }
+  public static var warnSwift3ObjcInference: Option { Option(id: 1025) }
+  public static var warningsAsErrors: Option { Option(id: 1026) }
+  public static var weakLinkAtTarget: Option { Option(id: 1027) }
+  public static var Werror: Option { Option(id: 1028) }
+  public static var wholeModuleOptimization: Option { Option(id: 1029) }
+  public static var windowsSdkRoot: Option { Option(id: 1030) }
+  public static var windowsSdkVersion: Option { Option(id: 1031) }
+  public static var wmo: Option { Option(id: 1032) }
+  public static var workingDirectoryEQ: Option { Option(id: 1033) }
+  public static var workingDirectory: Option { Option(id: 1034) }
+  public static var writeOutputHashXattr: Option { Option(id: 1035) }
+  public static var Wwarning: Option { Option(id: 1036) }
+  public static var Xcc: Option { Option(id: 1037) }
+  public static var XclangLinker: Option { Option(id: 1038) }
+  public static var Xfrontend: Option { Option(id: 1039) }
+  public static var XlinkerDriver: Option { Option(id: 1040) }
+  public static var Xlinker: Option { Option(id: 1041) }
+  public static var Xllvm: Option { Option(id: 1042) }
+  public static var DASHDASH: Option { Option(id: 1043) }
+  // Driver-only options
+  public static var parseableOutputCacheQueries: Option { Option(id: 1044) }
+  public static var cachePrefetchLimit: Option { Option(id: 1045) }
+  public static var reusePriorDependencyScan: Option { Option(id: 1046) }
+  public static var persistDependencyScanCache: Option { Option(id: 1047) }
+  public static var casSizeLimit: Option { Option(id: 1048) }
+  public static var incrementalFileHashFunction: Option { Option(id: 1049) }
 }
 
 extension Option {
-  public static var allOptions: [Option] {
-    return [
-      Option.INPUT,
-      Option.HASHHASHHASH,
-      Option.abi,
-      Option.abi_,
-      Option.abortOnModuleFail,
-      Option.abortOnModuleFail_,
-      Option.accessNotesPathEQ,
-      Option.accessNotesPath,
-      Option.activePlatformAvailabilityOnly,
-      Option.aliasModuleNamesInModuleInterface,
-      Option.allowAvailabilityPlatforms,
-      Option.allowNonResilientAccess,
-      Option.allowableClient,
-      Option.alwaysCompileOutputFiles,
-      Option.alwaysRebuildModuleDependencies,
-      Option.analyzeRequestEvaluator,
-      Option.analyzeRequirementMachine,
-      Option.apiDiffDataDir,
-      Option.apiDiffDataFile,
-      Option.enableAppExtensionLibrary,
-      Option.enableAppExtension,
-      Option.AssertConfig,
-      Option.AssumeSingleThreaded,
-      Option.autoBridgingHeaderChaining,
-      Option.autolinkForceLoad,
-      Option.autolinkLibrary,
-      Option.avoidEmitModuleSourceInfo,
-      Option.avoidLocation,
-      Option.avoidLocation_,
-      Option.avoidToolArgs,
-      Option.avoidToolArgs_,
-      Option.backupModuleInterfacePathEQ,
-      Option.backupModuleInterfacePath,
-      Option.badFileDescriptorRetryCount,
-      Option.baselineDir,
-      Option.baselinePath,
-      Option.BFEQ,
-      Option.BF,
-      Option.BIEQ,
-      Option.BI,
-      Option.blockAvailabilityPlatforms,
-      Option.blockListFile,
-      Option.breakageAllowlistPath,
-      Option.bridgingHeaderDirectoryForPrint,
-      Option.bridgingHeaderPchKey,
-      Option.bsdk,
-      Option.buildIdEQ,
-      Option.buildId,
-      Option.buildModuleFromParseableInterface,
-      Option.bypassBatchModeChecks,
-      Option.bypassResilience,
-      Option.cacheCompileJob,
-      Option.cacheDisableReplay,
-      Option.cacheReplayPrefixMap,
-      Option.candidateModuleFile,
-      Option.casBackendMode,
-      Option.casBackend,
-      Option.casEmitCasidFile,
-      Option.casFsEscape,
-      Option.casPath,
-      Option.casPluginOption,
-      Option.casPluginPath,
-      Option.checkApiAvailabilityOnly,
-      Option.checkOnoneCompleteness,
-      Option.checkedAsyncObjcBridging,
-      Option.clangBuildSessionFile,
-      Option.clangHeaderExposeDecls,
-      Option.clangHeaderExposeModule,
-      Option.clangIncludeTreeFilelist,
-      Option.clangIncludeTreeRoot,
-      Option.clangScannerModuleCachePath,
-      Option.clangTargetVariant,
-      Option.clangTarget,
-      Option.codeCompleteCallPatternHeuristics,
-      Option.codeCompleteInitsInPostfixExpr,
-      Option.colorDiagnostics,
-      Option.compareToBaselinePath,
-      Option.compileModuleFromInterface,
-      Option.compilerAssertions,
-      Option.compilerStyleDiags,
-      Option.compilerStyleDiags_,
-      Option.concurrencyModelEQ,
-      Option.concurrencyModel,
-      Option.conditionalRuntimeRecords,
-      Option.constGatherProtocolsFile,
-      Option.constGatherProtocolsList,
-      Option.continueBuildingAfterErrors,
-      Option.coveragePrefixMap,
-      Option.CrossModuleOptimization,
-      Option.crosscheckUnqualifiedLookup,
-      Option.csProfileGenerateEQ,
-      Option.csProfileGenerate,
-      Option.cxxInteropGettersSettersAsProperties,
-      Option.cxxInteropUseOpaquePointerForMoveonly,
-      Option.cxxInteroperabilityMode,
-      Option.c,
-      Option.debugAssertAfterParse,
-      Option.debugAssertImmediately,
-      Option.debugCallsiteInfo,
-      Option.debugConstraintsAttempt,
-      Option.debugConstraintsOnLineEQ,
-      Option.debugConstraintsOnLine,
-      Option.debugConstraints,
-      Option.debugCrashAfterParse,
-      Option.debugCrashImmediately,
-      Option.debugCycles,
-      Option.debugDiagnosticNames,
-      Option.debugEmitInvalidSwiftinterfaceSyntax,
-      Option.debugForbidTypecheckPrefix,
-      Option.debugGenericSignatures,
-      Option.debugInfoForProfiling,
-      Option.debugInfoFormat,
-      Option.debugInfoStoreInvocation,
-      Option.debugInverseRequirements,
-      Option.debugMapping,
-      Option.debugMapping_,
-      Option.debugModulePathEQ,
-      Option.debugModulePath,
-      Option.debugModuleSelfKey,
-      Option.debugPrefixMap,
-      Option.debugRequirementMachine,
-      Option.debugTimeExpressionTypeChecking,
-      Option.debugTimeFunctionBodies,
-      Option.debuggerSupport,
-      Option.debuggerTestingTransform,
-      Option.defaultIsolationEQ,
-      Option.defaultIsolation,
-      Option.defineAlwaysEnabledAvailabilityDomain,
-      Option.defineAvailability,
-      Option.defineDisabledAvailabilityDomain,
-      Option.defineDynamicAvailabilityDomain,
-      Option.defineEnabledAvailabilityDomain,
-      Option.dependencyOnlyImport,
-      Option.dependencyScanCachePath,
-      Option.dependencyScanSerializeDiagnosticsPath,
-      Option.deprecatedIntegratedRepl,
-      Option.deserializeDiff,
-      Option.deserializeDiff_,
-      Option.deserializeSdk,
-      Option.deserializeSdk_,
-      Option.diagnoseSdk,
-      Option.diagnoseSdk_,
-      Option.diagnosticDocumentationPath,
-      Option.diagnosticStyleEQ,
-      Option.diagnosticStyle,
-      Option.swiftDiagnosticsAssertOnError,
-      Option.swiftDiagnosticsAssertOnGroup,
-      Option.swiftDiagnosticsAssertOnWarning,
-      Option.diagnosticsEditorMode,
-      Option.digesterBreakageAllowlistPath,
-      Option.digesterMode,
-      Option.directClangCc1ModuleBuild,
-      Option.disableAccessControl,
-      Option.disableActorDataRaceChecks,
-      Option.disableAddressDependencies,
-      Option.disableAggressiveReg2mem,
-      Option.disableAliasModuleNamesInModuleInterface,
-      Option.disableAllAutolinking,
-      Option.disableArcOpts,
-      Option.disableArm64Corocc,
-      Option.disableAssemblyVisionAll,
-      Option.disableAstVerifier,
-      Option.disableAsyncFramePointerAll,
-      Option.disableAsyncFramePushPopMetadata,
-      Option.disableAutolinkFrameworks,
-      Option.disableAutolinkFramework,
-      Option.disableAutolinkLibrary,
-      Option.disableAutolinkingRuntimeCompatibilityConcurrency,
-      Option.disableAutolinkingRuntimeCompatibilityDynamicReplacements,
-      Option.disableAutolinkingRuntimeCompatibility,
-      Option.disableAvailabilityChecking,
-      Option.disableBatchMode,
-      Option.disableBridgingPch,
-      Option.disableBuildingInterface,
-      Option.disableCalleeAllocatedCoroAbi,
-      Option.disableClangSpi,
-      Option.disableClangTarget,
-      Option.disableClangimporterSourceImport,
-      Option.disableCrossModuleOptimization,
-      Option.disableCollocateMetadataFunctions,
-      Option.disableColocateTypeDescriptors,
-      Option.disableConcreteTypeMetadataMangledNameAccessors,
-      Option.disableCondFailMessageAnnotation,
-      Option.disableConstValueImporting,
-      Option.disableCrossImportOverlaySearch,
-      Option.disableCrossImportOverlays,
-      Option.cxxInteropDisableRequirementAtImport,
-      Option.disableDebuggerShadowCopies,
-      Option.disableDeserializationRecovery,
-      Option.disableDeserializationSafety,
-      Option.disableDiagnosticPasses,
-      Option.disableDirectRetainRelease,
-      Option.disableDynamicActorIsolation,
-      Option.disableEmitGenericClassRoTList,
-      Option.disableEmitTypeMallocForCoroFrame,
-      Option.disableExperimentalClangImporterDiagnostics,
-      Option.disableExperimentalFeature,
-      Option.disableExperimentalLifetimeDependenceInference,
-      Option.disableExperimentalOpenedExistentialTypes,
-      Option.disableExperimentalParserRoundTrip,
-      Option.disableExperimentalStringProcessing,
-      Option.disableFailOnError,
-      Option.disableFailOnError_,
-      Option.disableFineModuleTracing,
-      Option.disableForceLoadSymbols,
-      Option.disableFragileResilientProtocolWitnesses,
-      Option.disableGenericMetadataPrespecialization,
-      Option.disableImplicitConcurrencyModuleImport,
-      Option.disableImplicitCxxModuleImport,
-      Option.disableImplicitStringProcessingModuleImport,
-      Option.disableImplicitSwiftModules,
-      Option.disableImportPtrauthFieldFunctionPointers,
-      Option.disableIncrementalFileHashing,
-      Option.disableIncrementalImports,
-      Option.disableIncrementalLlvmCodegeneration,
-      Option.disableInferPublicConcurrentValue,
-      Option.disableInterfaceLockfile,
-      Option.disableInvalidEphemeralnessAsError,
-      Option.disableLargeLoadableTypesReg2mem,
-      Option.disableLayoutStringValueWitnessesInstantiation,
-      Option.disableLayoutStringValueWitnesses,
-      Option.disableLegacyTypeInfo,
-      Option.disableLifetimeDependenceDiagnostics,
-      Option.disableLlvmMergeFunctionsPass,
-      Option.disableLlvmOptzns,
-      Option.disableLlvmValueNames,
-      Option.disableLlvmVerifyEach,
-      Option.disableLlvmVerify,
-      Option.disableMigratorFixits,
-      Option.disableModuleSelectorsInModuleInterface,
-      Option.disableModulesValidateSystemHeaders,
-      Option.disableNamedLazyImportAsMemberLoading,
-      Option.disableNewLlvmPassManager,
-      Option.disableNewOperatorLookup,
-      Option.disableNonfrozenEnumExhaustivityDiagnostics,
-      Option.disableNoreturnPrediction,
-      Option.disableNskeyedarchiverDiagnostics,
-      Option.disableObjcAttrRequiresFoundationModule,
-      Option.disableObjcInterop,
-      Option.disableObjectiveCProtocolSymbolicReferences,
-      Option.disableOnlyOneDependencyFile,
-      Option.disableOsChecks,
-      Option.disableOsChecks_,
-      Option.disableOssaOpts,
-      Option.disablePlaygroundTransform,
-      Option.disablePreallocatedInstantiationCaches,
-      Option.disablePreviousImplementationCallsInDynamicReplacements,
-      Option.disablePrintMissingImportsInModuleInterface,
-      Option.disableProfilingMarkerThunks,
-      Option.disableReadonlyStaticObjects,
-      Option.disableReflectionMetadata,
-      Option.disableReflectionNames,
-      Option.disableRelativeProtocolWitnessTables,
-      Option.disableRemoveDeprecatedCheck,
-      Option.disableRemoveDeprecatedCheck_,
-      Option.disableRequirementMachineConcreteContraction,
-      Option.disableRequirementMachineLoopNormalization,
-      Option.disableRequirementMachineReuse,
-      Option.disableRoundTripDebugTypes,
-      Option.disableSafeInteropWrappers,
-      Option.disableSandbox,
-      Option.disableSendingArgsAndResultsWithRegionIsolation,
-      Option.disableSilOpaqueValues,
-      Option.disableSilOwnershipVerifier,
-      Option.disableSilPartialApply,
-      Option.disableSilPerfOptzns,
-      Option.disableSplitColdCode,
-      Option.disableStackProtector,
-      Option.disableStandardSubstitutionsInReflectionMangling,
-      Option.disableSubstSilFunctionTypes,
-      Option.disableSwiftBridgeAttr,
-      Option.disableSwiftSpecificLlvmOptzns,
-      Option.disableSwift3ObjcInference,
-      Option.disableTargetOsChecking,
-      Option.disableTestableAttrRequiresTestableModule,
-      Option.disableThrowsPrediction,
-      Option.disableTypeLayouts,
-      Option.disableTypoCorrection,
-      Option.disableUpcomingFeature,
-      Option.disableVerifyExclusivity,
-      Option.disableWorkaroundBrokenModules,
-      Option.disableX8664Corocc,
-      Option.disallowForwardingDriver,
-      Option.downgradeTypecheckInterfaceError,
-      Option.driverAlwaysRebuildDependents,
-      Option.driverBatchCount,
-      Option.driverBatchSeed,
-      Option.driverBatchSizeLimit,
-      Option.driverEmitFineGrainedDependencyDotFileAfterEveryImport,
-      Option.driverFilelistThresholdEQ,
-      Option.driverFilelistThreshold,
-      Option.driverForceResponseFiles,
-      Option.driverMode,
-      Option.driverPrintActions,
-      Option.driverPrintBindings,
-      Option.driverPrintDerivedOutputFileMap,
-      Option.driverPrintGraphviz,
-      Option.driverPrintJobs,
-      Option.driverPrintOutputFileMap,
-      Option.driverShowIncremental,
-      Option.driverShowJobLifecycle,
-      Option.driverSkipExecution,
-      Option.driverTimeCompilation,
-      Option.driverUseFilelists,
-      Option.driverUseFrontendPath,
-      Option.driverVerifyFineGrainedDependencyGraphAfterEveryImport,
-      Option.driverWarnUnusedOptions,
-      Option.dumpAbstractLayout,
-      Option.dumpApiPath,
-      Option.dumpAstFormat,
-      Option.dumpAst,
-      Option.dumpAvailabilityScopes,
-      Option.dumpClangDiagnostics,
-      Option.dumpClangLookupTables,
-      Option.dumpHiddenTypeLayouts,
-      Option.dumpInterfaceHash,
-      Option.dumpJit,
-      Option.dumpMacroExpansions,
-      Option.dumpMigrationStatesDir,
-      Option.dumpParse,
-      Option.dumpPcm,
-      Option.dumpRequirementMachine,
-      Option.dumpScopeMaps,
-      Option.dumpSdk,
-      Option.dumpSdk_,
-      Option.dumpSourceFileImports,
-      Option.dumpTypeInfo,
-      Option.dumpTypeWitnessSystems,
-      Option.dumpUsr,
-      Option.dwarfVersion,
-      Option.dynamicMemberLookupDepthLimitEQ,
-      Option.D,
-      Option.eagerMacroChecking,
-      Option.embedBitcodeMarker,
-      Option.embedBitcode,
-      Option.embedTbdForModule,
-      Option.emitAbiDescriptorPath,
-      Option.emitApiDescriptorPath,
-      Option.emitApiDescriptor,
-      Option.emitAssembly,
-      Option.emitAst,
-      Option.emitBc,
-      Option.emitClangHeaderMinAccess,
-      Option.emitClangHeaderNonmodularIncludes,
-      Option.emitClangHeaderPath,
-      Option.emitConstValuesPath,
-      Option.emitConstValues,
-      Option.emitDependenciesPath,
-      Option.emitDependencies,
-      Option.emitDigesterBaselinePath,
-      Option.emitDigesterBaseline,
-      Option.emitEmptyObjectFile,
-      Option.emitExecutable,
-      Option.emitExtensionBlockSymbols,
-      Option.emitFineGrainedDependencySourcefileDotFiles,
-      Option.emitFixitsPath,
-      Option.emitImportedModules,
-      Option.emitIrgen,
-      Option.emitIr,
-      Option.emitLibrary,
-      Option.emitLoadedModuleTracePathEQ,
-      Option.emitLoadedModuleTracePath,
-      Option.emitLoadedModuleTrace,
-      Option.emitLoweredSil,
-      Option.emitMacroExpansionFiles,
-      Option.emitMigratedFilePath,
-      Option.emitModuleDependenciesPath,
-      Option.emitModuleDocPath,
-      Option.emitModuleDoc,
-      Option.emitModuleInterfacePath,
-      Option.emitModuleInterface,
-      Option.emitModulePathEQ,
-      Option.emitModulePath,
-      Option.emitModuleSemanticInfoPath,
-      Option.emitModuleSeparatelyWMO,
-      Option.emitModuleSerializeDiagnosticsPath,
-      Option.emitModuleSourceInfoPath,
-      Option.emitModuleSourceInfo,
-      Option.emitModuleSummaryPath,
-      Option.emitModuleSummary,
-      Option.emitModule,
-      Option.emitObjcHeaderPath,
-      Option.emitObjcHeader,
-      Option.emitObject,
-      Option.emitPackageModuleInterfacePath,
-      Option.emitParseableModuleInterfacePath,
-      Option.emitParseableModuleInterface,
-      Option.emitParse,
-      Option.emitPch,
-      Option.emitPcm,
-      Option.emitPolyglotAst,
-      Option.emitPrivateModuleInterfacePath,
-      Option.emitReferenceDependenciesPath,
-      Option.emitReferenceDependencies,
-      Option.emitRemapFilePath,
-      Option.emitSibgen,
-      Option.emitSib,
-      Option.emitSilgen,
-      Option.emitSil,
-      Option.emitSingletonMetadataPointer,
-      Option.emitSortedSil,
-      Option.stackPromotionChecks,
-      Option.emitSupportedArguments,
-      Option.emitSupportedFeatures,
-      Option.emitSymbolGraphDir,
-      Option.emitSymbolGraph,
-      Option.emitTbdPathEQ,
-      Option.emitTbdPath,
-      Option.emitTbd,
-      Option.emitVariantAbiDescriptorPath,
-      Option.emitVariantApiDescriptorPath,
-      Option.emitVariantModuleDocPath,
-      Option.emitVariantModuleInterfacePath,
-      Option.emitVariantModulePath,
-      Option.emitVariantModuleSourceInfoPath,
-      Option.emitVariantPackageModuleInterfacePath,
-      Option.emitVariantPrivateModuleInterfacePath,
-      Option.emitVerboseSil,
-      Option.emptyAbiDescriptor,
-      Option.emptyBaseline,
-      Option.emptyBaseline_,
-      Option.enableAccessControl,
-      Option.enableActorDataRaceChecks,
-      Option.enableAddressDependencies,
-      Option.enableAggressiveReg2mem,
-      Option.enableAnonymousContextMangledNames,
-      Option.enableArm64Corocc,
-      Option.enableAssemblyVisionAll,
-      Option.enableAstVerifier,
-      Option.enableAsyncFramePointerAll,
-      Option.enableAsyncFramePushPopMetadata,
-      Option.enableAutolinkingRuntimeCompatibilityBytecodeLayouts,
-      Option.enableBareSlashRegex,
-      Option.enableBatchMode,
-      Option.enableBridgingPch,
-      Option.enableBuiltinModule,
-      Option.enableCalleeAllocatedCoroAbi,
-      Option.EnableCMOEverything,
-      Option.enableCollocateMetadataFunctions,
-      Option.enableColocateTypeDescriptors,
-      Option.enableCondFailMessageAnnotation,
-      Option.copyPropagationStateEQ,
-      Option.enableCopyPropagation,
-      Option.enableCrossImportOverlays,
-      Option.EnableDefaultCMO,
-      Option.enableDeserializationRecovery,
-      Option.enableDeserializationSafety,
-      Option.enableDestroyHoisting,
-      Option.enableDeterministicCheck,
-      Option.enableDirectRetainRelease,
-      Option.enableDynamicReplacementChaining,
-      Option.enableEmitGenericClassRoTList,
-      Option.enableEmitTypeMallocForCoroFrame,
-      Option.enableExperimentalAdditiveArithmeticDerivation,
-      Option.enableAsyncDemotion,
-      Option.enableExperimentalAsyncTopLevel,
-      Option.enableExperimentalConcisePoundFile,
-      Option.enableExperimentalConcurrency,
-      Option.enableExperimentalCxxInterop,
-      Option.enableExperimentalDistributed,
-      Option.enableExperimentalEagerClangModuleDiagnostics,
-      Option.enableExperimentalFeature,
-      Option.enableExperimentalFlowSensitiveConcurrentCaptures,
-      Option.enableExperimentalForwardModeDifferentiation,
-      Option.enableExperimentalLifetimeDependenceInference,
-      Option.enableExperimentalMoveOnly,
-      Option.enableExperimentalNamedOpaqueTypes,
-      Option.enableExperimentalOpaqueTypeErasure,
-      Option.enableExperimentalOpenedExistentialTypes,
-      Option.enableExperimentalPairwiseBuildBlock,
-      Option.enableExperimentalStaticAssert,
-      Option.enableExperimentalStringProcessing,
-      Option.enableExplicitExistentialTypes,
-      Option.enableFragileResilientProtocolWitnesses,
-      Option.enableImplicitDynamic,
-      Option.enableImportPtrauthFieldFunctionPointers,
-      Option.enableIncrementalFileHashing,
-      Option.enableIncrementalImports,
-      Option.enableInvalidEphemeralnessAsError,
-      Option.enableLargeLoadableTypesReg2mem,
-      Option.enableLayoutStringValueWitnessesInstantiation,
-      Option.enableLayoutStringValueWitnesses,
-      Option.enableLexicalLifetimes,
-      Option.enableLexicalLifetimesNoArg,
-      Option.enableLibraryEvolution,
-      Option.enableLifetimeDependenceDiagnostics,
-      Option.enableLlvmValueNames,
-      Option.enableLlvmVerifyEach,
-      Option.enableLlvmVfe,
-      Option.enableLlvmWme,
-      Option.enableModuleSelectorsInModuleInterface,
-      Option.enableMoveInoutStackProtector,
-      Option.enableNewLlvmPassManager,
-      Option.enableNewOperatorLookup,
-      Option.enableNonfrozenEnumExhaustivityDiagnostics,
-      Option.enableNoreturnPrediction,
-      Option.enableNskeyedarchiverDiagnostics,
-      Option.enableObjcAttrRequiresFoundationModule,
-      Option.enableObjcInterop,
-      Option.enableObjectiveCProtocolSymbolicReferences,
-      Option.enableOnlyOneDependencyFile,
-      Option.enableOssaModules,
-      Option.enablePackMetadataStackPromotion,
-      Option.enablePackMetadataStackPromotionNoArg,
-      Option.enablePrivateImports,
-      Option.enableProfilingMarkerThunks,
-      Option.enableRecompilationToOssaModule,
-      Option.enableRelativeProtocolWitnessTables,
-      Option.enableRemoveDeprecatedCheck,
-      Option.enableRemoveDeprecatedCheck_,
-      Option.enableRequirementMachineOpaqueArchetypes,
-      Option.enableResilience,
-      Option.enableRoundTripDebugTypes,
-      Option.enableSilOpaqueValues,
-      Option.enableSingleModuleLlvmEmission,
-      Option.enableSourceImport,
-      Option.enableSpecDevirt,
-      Option.enableSplitColdCode,
-      Option.enableStackProtector,
-      Option.enableSwift3ObjcInference,
-      Option.enableTargetOsChecking,
-      Option.enableTestableAttrRequiresTestableModule,
-      Option.enableTesting,
-      Option.enableThrowWithoutTry,
-      Option.enableThrowsPrediction,
-      Option.enableTypeLayouts,
-      Option.enableUpcomingFeature,
-      Option.enableVerifyExclusivity,
-      Option.enableVolatileModules,
-      Option.enableX8664Corocc,
-      Option.enforceExclusivityEQ,
-      Option.entryPointFunctionName,
-      Option.errorOnAbiBreakage,
-      Option.errorOnAbiBreakage_,
-      Option.experimentalAllowModuleWithCompilerErrors,
-      Option.experimentalAllowNonResilientAccess,
-      Option.experimentalAllowedReexportedModules,
-      Option.experimentalCForeignReferenceTypes,
-      Option.experimentalClangImporterDirectCc1Scan,
-      Option.emitModuleSeparately,
-      Option.experimentalEmitVariantModule,
-      Option.driverExperimentalExplicitModuleBuild,
-      Option.experimentalHermeticSealAtLink,
-      Option.experimentalLazyTypecheck,
-      Option.experimentalPackageBypassResilience,
-      Option.ExperimentalPackageCMOAbortOnDeserializationFail,
-      Option.ExperimentalPackageCMO,
-      Option.experimentalPackageInterfaceLoad,
-      Option.ExperimentalPerformanceAnnotations,
-      Option.platformCCallingConventionEQ,
-      Option.platformCCallingConvention,
-      Option.experimentalPrintFullConvention,
-      Option.experimentalSerializeDebugInfo,
-      Option.experimentalSkipAllFunctionBodies,
-      Option.experimentalSkipNonExportableDecls,
-      Option.experimentalSkipNonInlinableFunctionBodiesWithoutTypes,
-      Option.experimentalSkipNonInlinableFunctionBodies,
-      Option.experimentalSpiImports,
-      Option.experimentalSpiOnlyImports,
-      Option.explainModuleDependencyDetailed,
-      Option.explainModuleDependency,
-      Option.explicitAutoLinking,
-      Option.explicitDependencyGraphFormat,
-      Option.explicitInterfaceModuleBuild,
-      Option.driverExplicitModuleBuild,
-      Option.explicitSwiftModuleMap,
-      Option.exportAs,
-      Option.externalPassPipelineFilename,
-      Option.externalPluginPath,
-      Option.e,
-      Option.FEQ,
-      Option.fileCompilationDir,
-      Option.filePrefixMap,
-      Option.filelist,
-      Option.findUsr,
-      Option.findUsr_,
-      Option.fineGrainedTimers,
-      Option.fixitAll,
-      Option.forcePublicLinkage,
-      Option.forceSingleFrontendInvocation,
-      Option.forceStructTypeLayouts,
-      Option.formalCxxInteroperabilityMode,
-      Option.framework,
-      Option.frontendParseableOutput,
-      Option.Fsystem,
-      Option.functionSections,
-      Option.F,
-      Option.gccToolchain,
-      Option.gdwarfTypes,
-      Option.genReproducerDir,
-      Option.genReproducer,
-      Option.generateEmptyBaseline,
-      Option.generateEmptyBaseline_,
-      Option.generateMigrationScript,
-      Option.generateMigrationScript_,
-      Option.generateNameCorrection,
-      Option.generateNameCorrection_,
-      Option.glineTablesOnly,
-      Option.gnone,
-      Option.groupInfoPath,
-      Option.legacyGsil,
-      Option.g,
-      Option.helpHidden,
-      Option.helpHidden_,
-      Option.help,
-      Option.help_,
-      Option.h,
-      Option.IEQ,
-      Option.ignoreAlwaysInline,
-      Option.ignoreModuleSourceInfo,
-      Option.ignoreSpiGroupsNewApi,
-      Option.ignoreSpiGroupsNewApi_,
-      Option.ignoreSpiGroups,
-      Option.ignoreSpiGroups_,
-      Option.ignoredUsrs,
-      Option.ignoredUsrs_,
-      Option.importBridgingHeader,
-      Option.importCfTypes,
-      Option.importModule,
-      Option.importObjcHeader,
-      Option.importPch,
-      Option.importPrescan,
-      Option.importUnderlyingModule,
-      Option.inPlace,
-      Option.inProcessPluginServerPath,
-      Option.includeSpiSymbols,
-      Option.includeSubmodules,
-      Option.incrementalDependencyScan,
-      Option.incremental,
-      Option.indentSwitchCase,
-      Option.indentWidth,
-      Option.indexFilePath,
-      Option.indexFile,
-      Option.indexIgnoreClangModules,
-      Option.indexIgnoreStdlib,
-      Option.indexIgnoreSystemModules,
-      Option.indexIncludeLocals,
-      Option.indexStoreCompress,
-      Option.indexStorePath,
-      Option.indexSystemModules,
-      Option.indexUnitOutputPathFilelist,
-      Option.indexUnitOutputPath,
-      Option.inputFileKey,
-      Option.inputPaths,
-      Option.inputPaths_,
-      Option.swiftinterfaceCompilerVersion,
-      Option.internalImportBridgingHeader,
-      Option.internalImportPch,
-      Option.internalizeAtLink,
-      Option.interpret,
-      Option.ipiClangModule,
-      Option.irOutputDir,
-      Option.irOutputPath,
-      Option.irProfileGenerateEQ,
-      Option.irProfileGenerate,
-      Option.irProfileUse,
-      Option.Isystem,
-      Option.I,
-      Option.i,
-      Option.json,
-      Option.json_,
-      Option.j,
-      Option.LEQ,
-      Option.languageMode,
-      Option.ldPath,
-      Option.libc,
-      Option.libraryLevelEQ,
-      Option.libraryLevel,
-      Option.lineRange,
-      Option.linkObjcRuntime,
-      Option.lldbRepl,
-      Option.reuseDependencyScanCache,
-      Option.loadPassPluginEQ,
-      Option.loadPluginExecutable,
-      Option.loadPluginLibrary,
-      Option.loadResolvedPlugin,
-      Option.locale,
-      Option.localizationPath,
-      Option.location,
-      Option.location_,
-      Option.ltoLibrary,
-      Option.lto,
-      Option.L,
-      Option.l,
-      Option.maxSubstitutionCount,
-      Option.maxSubstitutionDepth,
-      Option.mergeModules,
-      Option.mergeableSymbols,
-      Option.mergeableTraps,
-      Option.migrateKeepObjcVisibility,
-      Option.migratorUpdateSdk,
-      Option.migratorUpdateSwift,
-      Option.migrator,
-      Option.migrator_,
-      Option.minRuntimeVersion,
-      Option.minSwiftRuntimeVersion,
-      Option.minValidPointerValue,
-      Option.minimumAccessLevel,
-      Option.moduleAbiName,
-      Option.moduleAlias,
-      Option.moduleCachePath,
-      Option.moduleCanImportVersion,
-      Option.moduleCanImport,
-      Option.moduleImportFromCas,
-      Option.moduleInterfacePreserveTypesAsWritten,
-      Option.moduleLinkNameEQ,
-      Option.moduleLinkName,
-      Option.moduleListFile,
-      Option.moduleLoadMode,
-      Option.moduleNameEQ,
-      Option.moduleName,
-      Option.module,
-      Option.module_,
-      Option.newDriverPath,
-      Option.noAllocations,
-      Option.noAutoBridgingHeaderChaining,
-      Option.noCacheCompileJob,
-      Option.noClangIncludeTree,
-      Option.noClangModuleBreadcrumbs,
-      Option.noClangCompilerInstanceSharing,
-      Option.noColorDiagnostics,
-      Option.noEmitModuleSeparatelyWMO,
-      Option.noEmitModuleSeparately,
-      Option.driverNoExplicitModuleBuild,
-      Option.noLinkObjcRuntime,
-      Option.noParallelScan,
-      Option.noScannerModuleValidation,
-      Option.noSerializeDebuggingOptions,
-      Option.noStaticExecutable,
-      Option.noStaticStdlib,
-      Option.noStdlibRpath,
-      Option.noStrictImplicitModuleContext,
-      Option.noToolchainStdlibRpath,
-      Option.noVerboseAsm,
-      Option.noVerifyEmittedModuleInterface,
-      Option.noWarningsAsErrors,
-      Option.noWholeModuleOptimization,
-      Option.driverScanDependenciesNonLib,
-      Option.nostartfiles,
-      Option.nostdimport,
-      Option.nostdlibimport,
-      Option.numThreads,
-      Option.omitExtensionBlockSymbols,
-      Option.Onone,
-      Option.Oplayground,
-      Option.Osize,
-      Option.Ounchecked,
-      Option.outputDir,
-      Option.outputFileMapEQ,
-      Option.outputFileMap,
-      Option.outputFilelist,
-      Option.O,
-      Option.o,
-      Option.PackageCMO,
-      Option.packageDescriptionVersion,
-      Option.packageName,
-      Option.parallelScan,
-      Option.parseAsLibrary,
-      Option.parseSil,
-      Option.parseStdlib,
-      Option.parseableOutput,
-      Option.parse,
-      Option.pcMacro,
-      Option.pchDisableValidation,
-      Option.pchOutputDir,
-      Option.playgroundHighPerformance,
-      Option.playgroundOption,
-      Option.playground,
-      Option.pluginPath,
-      Option.prebuiltModuleCachePathEQ,
-      Option.prebuiltModuleCachePath,
-      Option.prefixSerializedDebuggingOptions,
-      Option.prespecializeGenericMetadata,
-      Option.prettyPrint,
-      Option.previousModuleInstallnameMapFile,
-      Option.primaryFilelist,
-      Option.primaryFile,
-      Option.printAstDecl,
-      Option.printAst,
-      Option.printClangStats,
-      Option.printDiagnosticGroups,
-      Option.printEducationalNotes,
-      Option.printExplicitDependencyGraph,
-      Option.printFullyQualifiedTypes,
-      Option.printInstCounts,
-      Option.printLlvmInlineTree,
-      Option.printModule,
-      Option.printModule_,
-      Option.printPreprocessedExplicitDependencyGraph,
-      Option.printStaticBuildConfig,
-      Option.printStats,
-      Option.printSupportedFeatures,
-      Option.printTargetInfo,
-      Option.printZeroStats,
-      Option.profileCoverageMapping,
-      Option.profileGenerate,
-      Option.profileSampleUse,
-      Option.profileStatsEntities,
-      Option.profileStatsEvents,
-      Option.profileUse,
-      Option.projectName,
-      Option.protocolRequirementAllowList,
-      Option.protocolRequirementAllowList_,
-      Option.publicAutolinkLibrary,
-      Option.publicModuleName,
-      Option.RaccessNoteEQ,
-      Option.RaccessNote,
-      Option.cacheRemarks,
-      Option.emitCrossImportRemarks,
-      Option.dependencyScanCacheRemarks,
-      Option.dependencyScanRemarks,
-      Option.readLegacyTypeInfoPathEQ,
-      Option.reflectionMetadataForDebuggerOnly,
-      Option.registerModuleDependency,
-      Option.RemoveRuntimeAsserts,
-      Option.repl,
-      Option.reportErrorsToDebugger,
-      Option.requireExplicitAvailabilityTarget,
-      Option.requireExplicitAvailabilityEQ,
-      Option.requireExplicitAvailability,
-      Option.requireExplicitSendable,
-      Option.requirementMachineMaxConcreteNesting,
-      Option.requirementMachineMaxConcreteSize,
-      Option.requirementMachineMaxRuleCount,
-      Option.requirementMachineMaxRuleLength,
-      Option.requirementMachineMaxSplitConcreteEquivClassAttempts,
-      Option.requirementMachineMaxTypeDifferences,
-      Option.resolveImports,
-      Option.resolvedPluginVerification,
-      Option.resourceDir,
-      Option.remarkIndexingSystemModule,
-      Option.expansionRemarks,
-      Option.remarkMacroLoading,
-      Option.remarkModuleApiImport,
-      Option.RmoduleInterfaceRebuild,
-      Option.remarkLoadingModule,
-      Option.remarkModuleRecovery,
-      Option.remarkModuleSerialization,
-      Option.RpassMissedEQ,
-      Option.RpassEQ,
-      Option.remarkSkipExplicitInterfaceBuild,
-      Option.runtimeCompatibilityVersion,
-      Option.sanitizeAddressUseOdrIndicator,
-      Option.sanitizeCoverageEQ,
-      Option.sanitizeRecoverEQ,
-      Option.sanitizeStableAbiEQ,
-      Option.sanitizeEQ,
-      Option.saveOptimizationRecordPasses,
-      Option.saveOptimizationRecordPath,
-      Option.saveOptimizationRecordEQ,
-      Option.saveOptimizationRecord,
-      Option.saveTemps,
-      Option.scanDependencies,
-      Option.scannerCasFs,
-      Option.scannerDebugWriteOutput,
-      Option.scannerModuleValidation,
-      Option.scannerOutputDir,
-      Option.scannerPrefixMapPaths,
-      Option.scannerPrefixMapSdk,
-      Option.scannerPrefixMapToolchain,
-      Option.scannerPrefixMap,
-      Option.sdkModuleCachePath,
-      Option.sdk,
-      Option.serializeBreakingChangesPath,
-      Option.serializeDebuggingOptions,
-      Option.serializeDependencyScanCache,
-      Option.serializeDiagnosticsPathEQ,
-      Option.serializeDiagnosticsPath,
-      Option.serializeDiagnostics,
-      Option.serializeModuleInterfaceDependencyHashes,
-      Option.serializeParseableModuleInterfaceDependencyHashes,
-      Option.serializedPathObfuscate,
-      Option.showDiagnosticsAfterFatal,
-      Option.debugOnSil,
-      Option.silDebugSerialization,
-      Option.silInlineCallerBenefitReductionFactor,
-      Option.silInlineThreshold,
-      Option.silOutputDir,
-      Option.silOutputPath,
-      Option.silOwnershipVerifyAll,
-      Option.silRegionIsolationAssertOnUnknownPattern,
-      Option.silStopOptznsBeforeLoweringOwnership,
-      Option.silUnrollThreshold,
-      Option.silVerifyAll,
-      Option.silVerifyNone,
-      Option.skipInheritedDocs,
-      Option.skipProtocolImplementations,
-      Option.skipSynthesizedMembers,
-      Option.solverDisableBindingOptimizations,
-      Option.solverDisableCrashOnValidSalvage,
-      Option.solverDisableOptimizeOperatorDefaults,
-      Option.solverDisablePerformanceHacks,
-      Option.solverDisablePreparedOverloads,
-      Option.solverDisablePruneDisjunctions,
-      Option.solverDisableSplitter,
-      Option.solverDisableTransitiveConformance,
-      Option.solverEnableBindingOptimizations,
-      Option.solverEnableCrashOnValidSalvage,
-      Option.solverEnableOptimizeOperatorDefaults,
-      Option.solverEnablePerformanceHacks,
-      Option.solverEnablePreparedOverloads,
-      Option.solverEnablePruneDisjunctions,
-      Option.solverEnableTransitiveConformance,
-      Option.solverExpressionTimeThresholdEQ,
-      Option.solverMemoryThresholdEQ,
-      Option.solverScopeThresholdEQ,
-      Option.solverShrinkUnsolvedThreshold,
-      Option.solverShuffleChoicesEQ,
-      Option.solverShuffleDisjunctionsEQ,
-      Option.solverTrailThresholdEQ,
-      Option.stackPromotionLimit,
-      Option.staticExecutable,
-      Option.staticStdlib,
-      Option.`static`,
-      Option.statsOutputDir,
-      Option.strictConcurrency,
-      Option.strictImplicitModuleContext,
-      Option.strictMemorySafetyMigrate,
-      Option.strictMemorySafety,
-      Option.supplementaryOutputFileMap,
-      Option.suppressNotes,
-      Option.suppressRemarks,
-      Option.suppressStaticExclusivitySwap,
-      Option.suppressWarnings,
-      Option.swiftAsyncFramePointerEQ,
-      Option.swiftModuleCrossImport,
-      Option.swiftModuleFile,
-      Option.swiftOnly,
-      Option.swiftOnly_,
-      Option.swiftVersion,
-      Option.switchCheckingInvocationThresholdEQ,
-      Option.symbolGraphAllowAvailabilityPlatforms,
-      Option.symbolGraphBlockAvailabilityPlatforms,
-      Option.symbolGraphMinimumAccessLevel,
-      Option.symbolGraphPrettyPrint,
-      Option.symbolGraphShortenOutputNames,
-      Option.symbolGraphSkipInheritedDocs,
-      Option.symbolGraphSkipSynthesizedMembers,
-      Option.synthesizeInterfaceShow,
-      Option.sysroot,
-      Option.S,
-      Option.tabWidth,
-      Option.targetArchVariant,
-      Option.targetCpu,
-      Option.minInliningTargetVersion,
-      Option.targetSdkName,
-      Option.targetSdkVersion,
-      Option.targetVariantSdkVersion,
-      Option.targetVariant,
-      Option.targetLegacySpelling,
-      Option.target,
-      Option.tbdCompatibilityVersionEQ,
-      Option.tbdCompatibilityVersion,
-      Option.tbdCurrentVersionEQ,
-      Option.tbdCurrentVersion,
-      Option.tbdInstallNameEQ,
-      Option.tbdInstallName,
-      Option.tbdIsInstallapi,
-      Option.debugTestDependencyScanCacheSerialization,
-      Option.testableImportModule,
-      Option.throwsAsTraps,
-      Option.toolchainStdlibRpath,
-      Option.toolsDirectory,
-      Option.traceStatsEvents,
-      Option.trackSystemDependencies,
-      Option.trapFunction,
-      Option.triple,
-      Option.typeInfoDumpFilterEQ,
-      Option.typecheckModuleFromInterface,
-      Option.typecheck,
-      Option.typoCorrectionLimit,
-      Option.unavailableDeclOptimizationEQ,
-      Option.updateCode,
-      Option.useClangFunctionTypes,
-      Option.useFrontendParseableOutput,
-      Option.useInterfaceForModule,
-      Option.useInterfaceForModule_,
-      Option.useJit,
-      Option.useLd,
-      Option.useMalloc,
-      Option.useStaticResourceDir,
-      Option.useTabs,
-      Option.userModuleVersion,
-      Option.validateClangModulesOnce,
-      Option.validatePriorDependencyScanCache,
-      Option.validateTbdAgainstIrEQ,
-      Option.valueRecursionThreshold,
-      Option.verboseAsm,
-      Option.verifyAdditionalFile,
-      Option.verifyAdditionalPrefix,
-      Option.verifyAllSubstitutionMaps,
-      Option.verifyApplyFixes,
-      Option.verifyChildNotes,
-      Option.verifyDebugInfo,
-      Option.verifyEmittedModuleInterface,
-      Option.verifyGenericSignatures,
-      Option.verifyIgnoreMacroNote,
-      Option.verifyIgnoreUnknown,
-      Option.verifyIgnoreUnrelated,
-      Option.verifyIncrementalDependencies,
-      Option.verifyTypeLayout,
-      Option.verify,
-      Option.versionIndependentApinotes,
-      Option.version,
-      Option.version_,
-      Option.vfsoverlayEQ,
-      Option.vfsoverlay,
-      Option.visualcToolsRoot,
-      Option.visualcToolsVersion,
-      Option.v,
-      Option.warnConcurrency,
-      Option.warnImplicitOverrides,
-      Option.warnLongExpressionTypeCheckingScopesEQ,
-      Option.warnLongExpressionTypeCheckingScopes,
-      Option.warnLongExpressionTypeCheckingTrailEQ,
-      Option.warnLongExpressionTypeCheckingTrail,
-      Option.warnLongExpressionTypeCheckingEQ,
-      Option.warnLongExpressionTypeChecking,
-      Option.warnLongFunctionBodiesEQ,
-      Option.warnLongFunctionBodies,
-      Option.warnOnEditorPlaceholder,
-      Option.warnOnPotentiallyUnavailableEnumCase,
-      Option.warnSoftDeprecated,
-      Option.warnSwift3ObjcInferenceComplete,
-      Option.warnSwift3ObjcInferenceMinimal,
-      Option.warnSwift3ObjcInference,
-      Option.warningsAsErrors,
-      Option.weakLinkAtTarget,
-      Option.Werror,
-      Option.wholeModuleOptimization,
-      Option.windowsSdkRoot,
-      Option.windowsSdkVersion,
-      Option.wmo,
-      Option.workingDirectoryEQ,
-      Option.workingDirectory,
-      Option.writeOutputHashXattr,
-      Option.Wwarning,
-      Option.Xcc,
-      Option.XclangLinker,
-      Option.Xfrontend,
-      Option.XlinkerDriver,
-      Option.Xlinker,
-      Option.Xllvm,
-      Option.DASHDASH,
-    ]
-  }
+  static let builtinCount = 1050
+  static let builtinFingerprint: UInt64 = 0x827614a21e62ec31
+
+  static let builtinSpellingOffsets: [UInt32] = [
+    26527,
+    0,
+    1188,
+    8,
+    1193,
+    14,
+    1234,
+    1215,
+    1254,
+    1289,
+    1329,
+    1359,
+    1387,
+    1405,
+    1434,
+    1470,
+    1497,
+    1526,
+    1545,
+    1588,
+    1565,
+    1619,
+    1634,
+    1658,
+    1689,
+    1710,
+    1728,
+    1759,
+    37,
+    1775,
+    54,
+    1822,
+    1792,
+    1853,
+    1886,
+    1900,
+    680,
+    676,
+    689,
+    685,
+    1915,
+    1945,
+    1961,
+    1986,
+    2023,
+    2048,
+    2064,
+    2054,
+    2075,
+    2114,
+    2140,
+    2169,
+    2188,
+    2210,
+    2235,
+    2271,
+    2258,
+    2290,
+    2311,
+    2326,
+    2336,
+    2355,
+    2372,
+    2401,
+    2427,
+    2457,
+    2483,
+    2511,
+    2539,
+    2568,
+    2593,
+    2640,
+    2626,
+    2662,
+    2701,
+    2738,
+    2757,
+    2783,
+    2814,
+    2835,
+    72,
+    2876,
+    2857,
+    2896,
+    2925,
+    2954,
+    2983,
+    3015,
+    3036,
+    3063,
+    3115,
+    3094,
+    3137,
+    3180,
+    3225,
+    2166,
+    3253,
+    3279,
+    3305,
+    3345,
+    3399,
+    3372,
+    3326,
+    3427,
+    3452,
+    3477,
+    3491,
+    3515,
+    3557,
+    3588,
+    3614,
+    3640,
+    3660,
+    3689,
+    3717,
+    95,
+    3751,
+    3732,
+    3771,
+    3794,
+    3812,
+    3840,
+    3877,
+    3905,
+    3923,
+    3970,
+    3951,
+    3990,
+    4033,
+    4054,
+    4091,
+    4127,
+    4163,
+    4187,
+    4215,
+    4259,
+    4287,
+    111,
+    4305,
+    130,
+    4322,
+    148,
+    4336,
+    4385,
+    4367,
+    4404,
+    4433,
+    4462,
+    4493,
+    4518,
+    4552,
+    4567,
+    4598,
+    4622,
+    4654,
+    4684,
+    4712,
+    4760,
+    4785,
+    4803,
+    4825,
+    4854,
+    4876,
+    4909,
+    4976,
+    4948,
+    5005,
+    5074,
+    5129,
+    5031,
+    5193,
+    5224,
+    5244,
+    5266,
+    5294,
+    5329,
+    5348,
+    5370,
+    5407,
+    5420,
+    5458,
+    5493,
+    5548,
+    5586,
+    5617,
+    5654,
+    5685,
+    5728,
+    5760,
+    5794,
+    5826,
+    5853,
+    5884,
+    5917,
+    5955,
+    5996,
+    6045,
+    6075,
+    6127,
+    6174,
+    6214,
+    6254,
+    163,
+    6277,
+    6306,
+    6334,
+    6376,
+    6420,
+    6464,
+    6500,
+    6550,
+    6582,
+    6630,
+    6664,
+    6693,
+    6727,
+    6758,
+    6782,
+    6822,
+    6899,
+    6860,
+    6952,
+    6978,
+    7019,
+    7054,
+    7075,
+    7122,
+    7101,
+    7148,
+    7173,
+    7219,
+    7260,
+    7305,
+    7336,
+    7365,
+    7414,
+    7443,
+    7480,
+    7526,
+    7548,
+    7598,
+    7632,
+    187,
+    7651,
+    7670,
+    7700,
+    7743,
+    7806,
+    7857,
+    7890,
+    7923,
+    7952,
+    7978,
+    8020,
+    207,
+    8053,
+    8103,
+    8151,
+    8186,
+    8218,
+    8249,
+    8266,
+    8328,
+    8355,
+    8387,
+    8414,
+    8439,
+    8464,
+    8489,
+    8544,
+    8578,
+    8605,
+    8641,
+    8672,
+    8700,
+    8748,
+    8775,
+    8796,
+    8821,
+    8847,
+    8875,
+    8910,
+    8933,
+    8958,
+    8995,
+    9029,
+    9049,
+    9068,
+    9093,
+    9185,
+    9158,
+    9213,
+    241,
+    9242,
+    9264,
+    9287,
+    9325,
+    9348,
+    9367,
+    9397,
+    9422,
+    9449,
+    9472,
+    9497,
+    9519,
+    9545,
+    9609,
+    9637,
+    9659,
+    9684,
+    9674,
+    9701,
+    9727,
+    9751,
+    9777,
+    9803,
+    9824,
+    9834,
+    9857,
+    9884,
+    9896,
+    9906,
+    9932,
+    9949,
+    256,
+    9959,
+    9985,
+    10001,
+    10028,
+    10038,
+    10054,
+    694,
+    10093,
+    10130,
+    10115,
+    10152,
+    10174,
+    10221,
+    10200,
+    10247,
+    10262,
+    10272,
+    10281,
+    10311,
+    10350,
+    10393,
+    10374,
+    10436,
+    10417,
+    10484,
+    10460,
+    10513,
+    10537,
+    10554,
+    10584,
+    10635,
+    10653,
+    10685,
+    10676,
+    10697,
+    10768,
+    10737,
+    10711,
+    10800,
+    10818,
+    10846,
+    10884,
+    10932,
+    10915,
+    10977,
+    10954,
+    11023,
+    11005,
+    11042,
+    11074,
+    11102,
+    11167,
+    11142,
+    11218,
+    11197,
+    10871,
+    11262,
+    11244,
+    11285,
+    11298,
+    11379,
+    11346,
+    11334,
+    11417,
+    11427,
+    11437,
+    11456,
+    11521,
+    11492,
+    11555,
+    11587,
+    11577,
+    11610,
+    11600,
+    11623,
+    11656,
+    11673,
+    11702,
+    11728,
+    11772,
+    11753,
+    11820,
+    11805,
+    11795,
+    11836,
+    11870,
+    11904,
+    11934,
+    11970,
+    11996,
+    12034,
+    12078,
+    12122,
+    12140,
+    12162,
+    267,
+    12178,
+    12201,
+    12232,
+    12261,
+    12288,
+    12328,
+    12349,
+    12377,
+    12398,
+    12430,
+    12468,
+    12527,
+    12552,
+    12571,
+    12592,
+    12615,
+    12649,
+    12672,
+    12709,
+    12743,
+    12805,
+    12780,
+    12831,
+    12861,
+    12881,
+    12914,
+    12945,
+    12971,
+    12999,
+    13029,
+    13066,
+    13103,
+    13143,
+    13195,
+    13231,
+    13268,
+    13308,
+    13341,
+    13374,
+    13407,
+    13459,
+    13488,
+    13544,
+    13594,
+    13645,
+    13676,
+    13716,
+    13757,
+    13803,
+    13845,
+    13880,
+    13919,
+    13954,
+    13995,
+    14020,
+    14067,
+    14100,
+    14128,
+    14167,
+    14242,
+    14204,
+    14320,
+    14294,
+    14347,
+    14373,
+    14413,
+    14438,
+    14463,
+    14480,
+    14497,
+    14542,
+    14577,
+    14607,
+    14635,
+    14683,
+    14711,
+    14747,
+    14792,
+    14813,
+    14862,
+    14895,
+    14954,
+    14916,
+    14993,
+    15017,
+    15049,
+    15086,
+    15127,
+    284,
+    15159,
+    15205,
+    15224,
+    15255,
+    15281,
+    15317,
+    15339,
+    15359,
+    15383,
+    15407,
+    15437,
+    15464,
+    15511,
+    15527,
+    15553,
+    15579,
+    15599,
+    15624,
+    15651,
+    15676,
+    15698,
+    15720,
+    15747,
+    317,
+    15770,
+    15818,
+    15859,
+    15901,
+    15941,
+    15986,
+    16023,
+    16057,
+    16093,
+    16129,
+    16158,
+    16224,
+    16198,
+    16280,
+    16317,
+    16399,
+    16355,
+    16444,
+    16480,
+    16515,
+    16554,
+    16643,
+    16594,
+    16706,
+    16732,
+    16790,
+    16763,
+    16826,
+    16849,
+    16884,
+    16917,
+    16940,
+    16972,
+    16983,
+    17016,
+    10090,
+    700,
+    17038,
+    17060,
+    17077,
+    17087,
+    341,
+    17097,
+    17118,
+    17129,
+    17151,
+    17185,
+    17212,
+    17247,
+    17258,
+    704,
+    17285,
+    697,
+    17307,
+    17322,
+    17352,
+    17336,
+    17372,
+    352,
+    17397,
+    378,
+    17424,
+    406,
+    17450,
+    17469,
+    17476,
+    17493,
+    17304,
+    17508,
+    440,
+    17502,
+    433,
+    17499,
+    716,
+    17524,
+    17546,
+    17591,
+    473,
+    17573,
+    454,
+    17617,
+    500,
+    17631,
+    17655,
+    17672,
+    17687,
+    17707,
+    17719,
+    17735,
+    17761,
+    17771,
+    17802,
+    17823,
+    17856,
+    17843,
+    17885,
+    17905,
+    17931,
+    17919,
+    17948,
+    17976,
+    17997,
+    18026,
+    18048,
+    18070,
+    18088,
+    18134,
+    18110,
+    18167,
+    18183,
+    515,
+    18196,
+    18224,
+    18257,
+    18278,
+    18299,
+    18310,
+    18328,
+    18343,
+    18380,
+    18359,
+    18402,
+    720,
+    713,
+    17521,
+    18422,
+    529,
+    18419,
+    732,
+    18431,
+    18446,
+    18456,
+    18477,
+    18462,
+    18493,
+    18505,
+    18524,
+    18535,
+    18563,
+    18582,
+    18606,
+    18627,
+    18649,
+    18657,
+    18676,
+    536,
+    18686,
+    18699,
+    729,
+    18428,
+    18705,
+    18730,
+    18755,
+    18770,
+    18789,
+    18806,
+    18846,
+    18867,
+    18836,
+    547,
+    18890,
+    18911,
+    18938,
+    18964,
+    18994,
+    19011,
+    19025,
+    19063,
+    19044,
+    19090,
+    19114,
+    19176,
+    19158,
+    19195,
+    19213,
+    19244,
+    19231,
+    18986,
+    558,
+    19258,
+    19275,
+    19291,
+    19325,
+    19347,
+    19370,
+    19399,
+    19434,
+    19483,
+    19456,
+    19514,
+    19540,
+    19562,
+    19580,
+    19610,
+    19642,
+    19664,
+    19682,
+    19699,
+    19734,
+    19761,
+    19777,
+    19813,
+    19836,
+    19866,
+    19893,
+    19907,
+    19920,
+    19936,
+    19952,
+    739,
+    746,
+    759,
+    766,
+    19982,
+    20011,
+    19994,
+    20029,
+    736,
+    19949,
+    20046,
+    20059,
+    20088,
+    20102,
+    20124,
+    20142,
+    20153,
+    20167,
+    20117,
+    20185,
+    20195,
+    20219,
+    20247,
+    20276,
+    20235,
+    20295,
+    20336,
+    20308,
+    20365,
+    20402,
+    20434,
+    20448,
+    20500,
+    20486,
+    20529,
+    20518,
+    20545,
+    20564,
+    20589,
+    20614,
+    20647,
+    20676,
+    20695,
+    20719,
+    567,
+    20733,
+    20779,
+    20806,
+    20819,
+    20845,
+    20864,
+    20882,
+    20908,
+    20926,
+    20947,
+    20971,
+    20993,
+    21007,
+    21021,
+    582,
+    21054,
+    21079,
+    792,
+    778,
+    807,
+    827,
+    860,
+    842,
+    21099,
+    21128,
+    21167,
+    21195,
+    21219,
+    21225,
+    21283,
+    21321,
+    21252,
+    21353,
+    21380,
+    21423,
+    21463,
+    21500,
+    21538,
+    21600,
+    21643,
+    21660,
+    21690,
+    884,
+    909,
+    928,
+    944,
+    964,
+    991,
+    1008,
+    1026,
+    1049,
+    1064,
+    1072,
+    21704,
+    21735,
+    21771,
+    21791,
+    21810,
+    21831,
+    21868,
+    21901,
+    21932,
+    21842,
+    21959,
+    21971,
+    21990,
+    22006,
+    22034,
+    22061,
+    22101,
+    22127,
+    22151,
+    22081,
+    22186,
+    22181,
+    22209,
+    22242,
+    22271,
+    22355,
+    22327,
+    22304,
+    22384,
+    22430,
+    22486,
+    22513,
+    22543,
+    22564,
+    22589,
+    22633,
+    22655,
+    22671,
+    22688,
+    22714,
+    22762,
+    22805,
+    22827,
+    22843,
+    22860,
+    22881,
+    22912,
+    22938,
+    22976,
+    23015,
+    23058,
+    23092,
+    23127,
+    23162,
+    23187,
+    23226,
+    23263,
+    23301,
+    23343,
+    23376,
+    23410,
+    23444,
+    23482,
+    23517,
+    23543,
+    23568,
+    23602,
+    23627,
+    23657,
+    23682,
+    23713,
+    23732,
+    23705,
+    23747,
+    23765,
+    23786,
+    23840,
+    23818,
+    23870,
+    23901,
+    23917,
+    23935,
+    23969,
+    23988,
+    24016,
+    24043,
+    24063,
+    616,
+    24075,
+    24090,
+    24129,
+    24172,
+    24215,
+    24250,
+    24277,
+    24312,
+    24346,
+    24385,
+    24413,
+    1104,
+    24422,
+    24441,
+    24462,
+    24474,
+    24503,
+    24520,
+    24556,
+    24540,
+    629,
+    24433,
+    24611,
+    24584,
+    24660,
+    24639,
+    24700,
+    24682,
+    24719,
+    24738,
+    24780,
+    24804,
+    24821,
+    24845,
+    24862,
+    24882,
+    24909,
+    24924,
+    24932,
+    24967,
+    24956,
+    25000,
+    25023,
+    25055,
+    25068,
+    25094,
+    25125,
+    639,
+    25151,
+    25160,
+    25169,
+    25181,
+    25206,
+    25216,
+    25240,
+    25269,
+    25307,
+    25333,
+    25360,
+    25381,
+    25405,
+    25431,
+    25461,
+    25481,
+    25501,
+    25520,
+    25553,
+    25580,
+    25606,
+    25629,
+    25654,
+    25687,
+    25373,
+    25716,
+    25707,
+    666,
+    25758,
+    25746,
+    25771,
+    25791,
+    25237,
+    25814,
+    25832,
+    25936,
+    25893,
+    26022,
+    25980,
+    26065,
+    25857,
+    26129,
+    26102,
+    26157,
+    26185,
+    26228,
+    26278,
+    26315,
+    26250,
+    26351,
+    26371,
+    1107,
+    26392,
+    26419,
+    26437,
+    26458,
+    26482,
+    26463,
+    26502,
+    1115,
+    1125,
+    1130,
+    1145,
+    1165,
+    1156,
+    1181,
+    5,
+    84205,
+    84135,
+    84268,
+    84237,
+    84157,
+    84173,
+  ]
+
+  static let builtinSpellingLengths: [UInt16] = [
+    7,
+    4,
+    4,
+    5,
+    21,
+    22,
+    19,
+    18,
+    34,
+    39,
+    29,
+    27,
+    17,
+    28,
+    35,
+    26,
+    28,
+    18,
+    19,
+    30,
+    22,
+    14,
+    23,
+    30,
+    20,
+    17,
+    30,
+    15,
+    16,
+    16,
+    17,
+    30,
+    29,
+    32,
+    13,
+    14,
+    4,
+    3,
+    4,
+    3,
+    29,
+    15,
+    24,
+    36,
+    24,
+    5,
+    10,
+    9,
+    38,
+    25,
+    25,
+    18,
+    21,
+    24,
+    22,
+    18,
+    12,
+    20,
+    14,
+    9,
+    18,
+    16,
+    28,
+    25,
+    29,
+    25,
+    27,
+    27,
+    28,
+    24,
+    32,
+    21,
+    13,
+    38,
+    36,
+    18,
+    25,
+    30,
+    20,
+    21,
+    22,
+    19,
+    18,
+    28,
+    28,
+    28,
+    31,
+    20,
+    26,
+    30,
+    21,
+    20,
+    42,
+    44,
+    27,
+    2,
+    25,
+    25,
+    20,
+    26,
+    27,
+    26,
+    18,
+    24,
+    24,
+    13,
+    23,
+    41,
+    30,
+    25,
+    25,
+    19,
+    28,
+    27,
+    14,
+    15,
+    19,
+    18,
+    22,
+    17,
+    27,
+    36,
+    27,
+    17,
+    27,
+    19,
+    18,
+    42,
+    20,
+    36,
+    35,
+    35,
+    23,
+    27,
+    43,
+    27,
+    17,
+    18,
+    16,
+    17,
+    13,
+    14,
+    30,
+    18,
+    17,
+    28,
+    28,
+    30,
+    24,
+    33,
+    14,
+    30,
+    23,
+    31,
+    29,
+    27,
+    47,
+    24,
+    17,
+    21,
+    28,
+    21,
+    32,
+    38,
+    28,
+    27,
+    25,
+    54,
+    63,
+    42,
+    30,
+    19,
+    21,
+    27,
+    34,
+    18,
+    21,
+    36,
+    12,
+    37,
+    34,
+    54,
+    37,
+    30,
+    36,
+    30,
+    42,
+    31,
+    33,
+    31,
+    26,
+    30,
+    32,
+    37,
+    40,
+    48,
+    29,
+    51,
+    46,
+    39,
+    39,
+    22,
+    23,
+    28,
+    27,
+    41,
+    43,
+    43,
+    35,
+    49,
+    31,
+    47,
+    33,
+    28,
+    33,
+    30,
+    23,
+    39,
+    37,
+    52,
+    38,
+    25,
+    40,
+    34,
+    20,
+    25,
+    25,
+    20,
+    24,
+    45,
+    40,
+    44,
+    30,
+    28,
+    48,
+    28,
+    36,
+    45,
+    21,
+    49,
+    33,
+    18,
+    19,
+    18,
+    29,
+    42,
+    62,
+    50,
+    32,
+    32,
+    28,
+    25,
+    41,
+    32,
+    33,
+    49,
+    47,
+    34,
+    31,
+    30,
+    16,
+    61,
+    26,
+    31,
+    26,
+    24,
+    24,
+    24,
+    54,
+    33,
+    26,
+    35,
+    30,
+    27,
+    47,
+    26,
+    20,
+    24,
+    25,
+    27,
+    34,
+    22,
+    24,
+    36,
+    33,
+    19,
+    18,
+    24,
+    64,
+    27,
+    26,
+    28,
+    14,
+    21,
+    22,
+    37,
+    22,
+    18,
+    29,
+    24,
+    26,
+    22,
+    24,
+    21,
+    25,
+    63,
+    27,
+    21,
+    14,
+    16,
+    9,
+    25,
+    23,
+    25,
+    25,
+    20,
+    9,
+    22,
+    26,
+    11,
+    9,
+    25,
+    16,
+    9,
+    10,
+    25,
+    15,
+    26,
+    9,
+    15,
+    35,
+    2,
+    21,
+    21,
+    14,
+    21,
+    25,
+    25,
+    20,
+    14,
+    9,
+    8,
+    29,
+    38,
+    23,
+    23,
+    18,
+    23,
+    18,
+    28,
+    23,
+    23,
+    16,
+    29,
+    50,
+    17,
+    22,
+    11,
+    8,
+    13,
+    31,
+    30,
+    25,
+    17,
+    27,
+    24,
+    30,
+    21,
+    16,
+    27,
+    22,
+    18,
+    17,
+    31,
+    27,
+    39,
+    29,
+    24,
+    25,
+    20,
+    12,
+    22,
+    17,
+    12,
+    35,
+    37,
+    32,
+    11,
+    9,
+    9,
+    18,
+    35,
+    33,
+    28,
+    21,
+    12,
+    9,
+    12,
+    9,
+    32,
+    16,
+    28,
+    25,
+    24,
+    22,
+    18,
+    15,
+    14,
+    9,
+    33,
+    33,
+    29,
+    35,
+    25,
+    37,
+    43,
+    43,
+    17,
+    21,
+    15,
+    16,
+    22,
+    30,
+    28,
+    26,
+    39,
+    20,
+    27,
+    20,
+    31,
+    37,
+    58,
+    24,
+    18,
+    20,
+    22,
+    33,
+    22,
+    36,
+    33,
+    36,
+    25,
+    24,
+    29,
+    19,
+    32,
+    30,
+    25,
+    27,
+    29,
+    36,
+    36,
+    39,
+    51,
+    35,
+    36,
+    39,
+    32,
+    32,
+    32,
+    51,
+    28,
+    55,
+    49,
+    50,
+    30,
+    39,
+    40,
+    45,
+    41,
+    34,
+    38,
+    34,
+    40,
+    24,
+    46,
+    32,
+    27,
+    38,
+    36,
+    51,
+    37,
+    26,
+    25,
+    25,
+    39,
+    24,
+    24,
+    16,
+    16,
+    44,
+    34,
+    29,
+    27,
+    47,
+    27,
+    35,
+    44,
+    20,
+    48,
+    32,
+    20,
+    38,
+    37,
+    23,
+    31,
+    36,
+    40,
+    31,
+    32,
+    45,
+    18,
+    30,
+    25,
+    35,
+    21,
+    19,
+    23,
+    23,
+    29,
+    26,
+    46,
+    15,
+    25,
+    25,
+    19,
+    24,
+    26,
+    24,
+    21,
+    21,
+    26,
+    22,
+    23,
+    47,
+    40,
+    41,
+    39,
+    44,
+    36,
+    33,
+    35,
+    35,
+    28,
+    39,
+    55,
+    25,
+    36,
+    37,
+    44,
+    43,
+    35,
+    34,
+    38,
+    39,
+    62,
+    48,
+    25,
+    30,
+    35,
+    26,
+    22,
+    34,
+    32,
+    22,
+    31,
+    10,
+    32,
+    21,
+    2,
+    3,
+    21,
+    16,
+    9,
+    9,
+    10,
+    20,
+    10,
+    21,
+    33,
+    26,
+    34,
+    10,
+    26,
+    8,
+    18,
+    2,
+    14,
+    13,
+    19,
+    15,
+    24,
+    25,
+    26,
+    27,
+    25,
+    26,
+    18,
+    6,
+    16,
+    5,
+    2,
+    12,
+    13,
+    5,
+    6,
+    2,
+    3,
+    21,
+    26,
+    25,
+    26,
+    17,
+    18,
+    13,
+    14,
+    23,
+    16,
+    14,
+    19,
+    11,
+    15,
+    25,
+    9,
+    30,
+    20,
+    19,
+    28,
+    12,
+    19,
+    13,
+    16,
+    11,
+    27,
+    20,
+    28,
+    21,
+    21,
+    17,
+    21,
+    32,
+    23,
+    15,
+    12,
+    13,
+    27,
+    32,
+    20,
+    20,
+    10,
+    17,
+    14,
+    15,
+    21,
+    20,
+    16,
+    8,
+    2,
+    2,
+    5,
+    6,
+    2,
+    3,
+    14,
+    9,
+    5,
+    15,
+    14,
+    11,
+    18,
+    10,
+    27,
+    18,
+    23,
+    20,
+    21,
+    7,
+    18,
+    9,
+    10,
+    12,
+    5,
+    2,
+    2,
+    24,
+    24,
+    14,
+    18,
+    16,
+    29,
+    20,
+    22,
+    9,
+    10,
+    20,
+    26,
+    25,
+    21,
+    16,
+    13,
+    18,
+    26,
+    18,
+    23,
+    43,
+    18,
+    17,
+    17,
+    17,
+    13,
+    12,
+    7,
+    8,
+    16,
+    15,
+    33,
+    21,
+    22,
+    28,
+    34,
+    21,
+    30,
+    26,
+    25,
+    21,
+    17,
+    29,
+    31,
+    21,
+    17,
+    16,
+    34,
+    26,
+    15,
+    35,
+    22,
+    29,
+    26,
+    13,
+    12,
+    15,
+    12,
+    29,
+    6,
+    12,
+    6,
+    11,
+    11,
+    17,
+    16,
+    16,
+    2,
+    2,
+    12,
+    28,
+    13,
+    14,
+    17,
+    10,
+    13,
+    17,
+    6,
+    9,
+    23,
+    15,
+    28,
+    18,
+    11,
+    12,
+    28,
+    27,
+    36,
+    31,
+    13,
+    37,
+    17,
+    13,
+    15,
+    10,
+    18,
+    24,
+    24,
+    32,
+    28,
+    18,
+    23,
+    13,
+    14,
+    45,
+    26,
+    12,
+    25,
+    18,
+    17,
+    25,
+    17,
+    20,
+    23,
+    21,
+    13,
+    13,
+    32,
+    33,
+    24,
+    19,
+    14,
+    13,
+    19,
+    14,
+    23,
+    17,
+    28,
+    38,
+    27,
+    23,
+    5,
+    26,
+    37,
+    31,
+    30,
+    26,
+    42,
+    39,
+    36,
+    37,
+    61,
+    42,
+    16,
+    29,
+    13,
+    24,
+    18,
+    15,
+    19,
+    26,
+    16,
+    17,
+    22,
+    14,
+    7,
+    31,
+    30,
+    35,
+    19,
+    18,
+    20,
+    10,
+    32,
+    30,
+    26,
+    25,
+    11,
+    18,
+    15,
+    27,
+    26,
+    19,
+    25,
+    23,
+    29,
+    19,
+    22,
+    4,
+    32,
+    28,
+    32,
+    28,
+    27,
+    22,
+    45,
+    55,
+    26,
+    29,
+    20,
+    24,
+    43,
+    21,
+    15,
+    16,
+    25,
+    47,
+    42,
+    21,
+    15,
+    16,
+    20,
+    30,
+    25,
+    37,
+    38,
+    42,
+    33,
+    34,
+    34,
+    24,
+    38,
+    36,
+    37,
+    41,
+    32,
+    33,
+    33,
+    37,
+    34,
+    25,
+    24,
+    33,
+    24,
+    29,
+    24,
+    22,
+    18,
+    14,
+    7,
+    17,
+    20,
+    31,
+    29,
+    21,
+    30,
+    15,
+    17,
+    33,
+    18,
+    27,
+    26,
+    19,
+    11,
+    12,
+    14,
+    38,
+    42,
+    42,
+    34,
+    26,
+    34,
+    33,
+    38,
+    27,
+    8,
+    2,
+    10,
+    20,
+    11,
+    28,
+    16,
+    19,
+    27,
+    15,
+    9,
+    7,
+    27,
+    26,
+    21,
+    20,
+    18,
+    17,
+    18,
+    41,
+    23,
+    16,
+    23,
+    16,
+    19,
+    26,
+    14,
+    7,
+    23,
+    32,
+    10,
+    22,
+    31,
+    12,
+    25,
+    30,
+    25,
+    26,
+    8,
+    8,
+    11,
+    24,
+    9,
+    20,
+    28,
+    37,
+    25,
+    26,
+    12,
+    23,
+    25,
+    29,
+    19,
+    19,
+    18,
+    32,
+    26,
+    25,
+    22,
+    24,
+    32,
+    19,
+    7,
+    29,
+    8,
+    9,
+    12,
+    11,
+    19,
+    22,
+    2,
+    17,
+    24,
+    43,
+    42,
+    42,
+    41,
+    36,
+    35,
+    27,
+    26,
+    27,
+    42,
+    21,
+    36,
+    35,
+    27,
+    19,
+    20,
+    7,
+    26,
+    17,
+    20,
+    4,
+    19,
+    18,
+    24,
+    9,
+    4,
+    14,
+    10,
+    15,
+    8,
+    6,
+    2,
+    31,
+    21,
+    28,
+    30,
+    15,
+    31,
+  ]
+
+  static let builtinKinds: [Kind] = [
+    .input,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .separate,
+    .joinedOrSeparate,
+    .joinedOrSeparate,
+    .joined,
+    .joinedOrSeparate,
+    .joined,
+    .joinedOrSeparate,
+    .separate,
+    .separate,
+    .joinedOrSeparate,
+    .separate,
+    .separate,
+    .joinedOrSeparate,
+    .joined,
+    .joinedOrSeparate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .multiArg,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joinedOrSeparate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .joined,
+    .joinedOrSeparate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .joined,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .commaJoined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .joinedOrSeparate,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .joined,
+    .flag,
+    .commaJoined,
+    .separate,
+    .joinedOrSeparate,
+    .flag,
+    .flag,
+    .flag,
+    .joinedOrSeparate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .joined,
+    .joinedOrSeparate,
+    .joinedOrSeparate,
+    .joined,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .multiArg,
+    .separate,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .joinedOrSeparate,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .flag,
+    .joinedOrSeparate,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .commaJoined,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .joined,
+    .joined,
+    .joined,
+    .joined,
+    .joined,
+    .joined,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .joined,
+    .flag,
+    .separate,
+    .flag,
+    .commaJoined,
+    .commaJoined,
+    .flag,
+    .commaJoined,
+    .separate,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .multiArg,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .joined,
+    .joined,
+    .separate,
+    .joined,
+    .joined,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .multiArg,
+    .joined,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .separate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .separate,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .joined,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joinedOrSeparate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .joinedOrSeparate,
+    .separate,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .joined,
+    .separate,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .flag,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .flag,
+    .joined,
+    .separate,
+    .flag,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .separate,
+    .remaining,
+    .flag,
+    .separate,
+    .flag,
+    .flag,
+    .separate,
+    .separate,
+  ]
+
+  static let builtinAttributes: [UInt32] = [
+    0x200,
+    0x0,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x202,
+    0x202,
+    0x0,
+    0x7,
+    0x0,
+    0x2,
+    0x402,
+    0x7,
+    0x1,
+    0x7,
+    0x7,
+    0x22a,
+    0x22a,
+    0xa,
+    0xa,
+    0x402,
+    0x3,
+    0x3,
+    0x403,
+    0x6,
+    0x28,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x2006,
+    0x2006,
+    0x7,
+    0x204,
+    0x204,
+    0x4,
+    0x204,
+    0x4,
+    0x204,
+    0x0,
+    0x206,
+    0x204,
+    0x7,
+    0x7,
+    0x204,
+    0x0,
+    0x0,
+    0x7,
+    0x7,
+    0x7,
+    0x2,
+    0x2002,
+    0x2006,
+    0x7,
+    0x6,
+    0x6,
+    0x6,
+    0x2002,
+    0x2002,
+    0x2002,
+    0x2002,
+    0xb,
+    0x7,
+    0x7,
+    0x2202,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x2222,
+    0x102,
+    0x102,
+    0x7,
+    0x7,
+    0x22,
+    0x208,
+    0x7,
+    0x2022,
+    0x4,
+    0x4,
+    0x7,
+    0x7,
+    0x7,
+    0x206,
+    0x202,
+    0x22,
+    0x2,
+    0x3,
+    0x6,
+    0xa,
+    0xa,
+    0x7,
+    0x7,
+    0x102,
+    0xa,
+    0x7,
+    0x7,
+    0x6,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x23,
+    0x7,
+    0x7,
+    0x7,
+    0xa,
+    0x2,
+    0x2,
+    0x7,
+    0x4,
+    0x4,
+    0x202,
+    0x202,
+    0x2,
+    0x2,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x2,
+    0x2,
+    0xb,
+    0xa,
+    0xb,
+    0xb,
+    0xb,
+    0x7,
+    0x6,
+    0xa00,
+    0x12,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x2006,
+    0x22,
+    0x22,
+    0x6,
+    0x6,
+    0x6,
+    0x7,
+    0x208,
+    0x8,
+    0x7,
+    0x7,
+    0x22,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x2,
+    0x2,
+    0x2,
+    0x7,
+    0xb,
+    0x1,
+    0x7,
+    0x7,
+    0x6,
+    0x0,
+    0x7,
+    0x3,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x6,
+    0x6,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x22,
+    0x7,
+    0x7,
+    0x407,
+    0x502,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x4,
+    0x4,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x6,
+    0x7,
+    0x0,
+    0x2,
+    0x7,
+    0x6,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0xa,
+    0xa,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x407,
+    0x407,
+    0x7,
+    0x20,
+    0x4,
+    0x4,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x4,
+    0x4,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x103,
+    0x22,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x3,
+    0x7,
+    0x7,
+    0x6,
+    0x6,
+    0x7,
+    0x7,
+    0x6,
+    0x502,
+    0x7,
+    0x7,
+    0x7,
+    0x0,
+    0x7,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x0,
+    0x21,
+    0x21,
+    0x1,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x28,
+    0x21,
+    0x21,
+    0x21,
+    0x1,
+    0x7,
+    0x2006,
+    0x2a,
+    0x2a,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x22a,
+    0x2a,
+    0x2a,
+    0x7,
+    0x2a,
+    0x4,
+    0x4,
+    0x7,
+    0x2a,
+    0x7,
+    0xa,
+    0x2,
+    0x7,
+    0x2,
+    0x7,
+    0xa,
+    0xa,
+    0x2,
+    0x2006,
+    0x2a0a,
+    0x2808,
+    0x2a,
+    0x2a,
+    0x2a,
+    0x200a,
+    0x80a,
+    0x2a0a,
+    0x2a0a,
+    0x808,
+    0x2006,
+    0x80a,
+    0xa08,
+    0x808,
+    0x7,
+    0x28,
+    0x80b,
+    0x3,
+    0x2006,
+    0x2a,
+    0x2a,
+    0x2a,
+    0x8,
+    0x2a0a,
+    0x2a0a,
+    0x80a,
+    0x2a,
+    0x7,
+    0x2e,
+    0xa00,
+    0x2006,
+    0x6,
+    0x2a0a,
+    0x808,
+    0x2a0a,
+    0x2a0a,
+    0x2006,
+    0x1,
+    0xa00,
+    0x2a0a,
+    0x6,
+    0x2a0a,
+    0x808,
+    0x80a,
+    0x2a0a,
+    0x80a,
+    0x2a,
+    0x2a0b,
+    0x2a0b,
+    0x809,
+    0x2a,
+    0x7,
+    0x2a,
+    0x2a,
+    0x2a0b,
+    0x2006,
+    0x6,
+    0x2e,
+    0x2a,
+    0x2a,
+    0x2a,
+    0x2a,
+    0x7,
+    0x7,
+    0x7,
+    0x2a,
+    0x2b,
+    0x2a0b,
+    0x80b,
+    0x2a0a,
+    0x2a0a,
+    0x80a,
+    0x2006,
+    0x2a0a,
+    0x2006,
+    0x2a0a,
+    0x2a08,
+    0x2a0a,
+    0x2a0a,
+    0x2a0a,
+    0x7,
+    0x6,
+    0x4,
+    0x4,
+    0x7,
+    0x22,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x2,
+    0x402,
+    0xb,
+    0x1,
+    0x402,
+    0x7,
+    0x3,
+    0x7,
+    0x7,
+    0x7,
+    0x6,
+    0x6,
+    0x6,
+    0x3,
+    0x7,
+    0x7,
+    0x7,
+    0x2022,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x2,
+    0x7,
+    0x407,
+    0x402,
+    0x407,
+    0x7,
+    0x407,
+    0x407,
+    0x502,
+    0x407,
+    0x2,
+    0x7,
+    0x407,
+    0x7,
+    0x407,
+    0x7,
+    0x407,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x0,
+    0x2,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x402,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0xa,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x407,
+    0x407,
+    0x7,
+    0x20,
+    0x7,
+    0x7,
+    0x7,
+    0xb,
+    0x7,
+    0x7,
+    0x7,
+    0x4,
+    0x4,
+    0x7,
+    0x407,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x6,
+    0x6,
+    0xb,
+    0x7,
+    0x7,
+    0x7,
+    0x502,
+    0x7,
+    0x7,
+    0x7,
+    0x402,
+    0x7,
+    0x4,
+    0x4,
+    0x7,
+    0x2,
+    0x4,
+    0x403,
+    0x3,
+    0x1,
+    0x0,
+    0x1,
+    0x3,
+    0x7,
+    0x2,
+    0x2,
+    0x2,
+    0x3,
+    0x3,
+    0x7,
+    0x7,
+    0x7,
+    0x3,
+    0x7,
+    0x7,
+    0x3,
+    0x3,
+    0x7,
+    0x7,
+    0x0,
+    0x0,
+    0x0,
+    0x21,
+    0x7,
+    0x0,
+    0x6,
+    0x402,
+    0x7,
+    0x202,
+    0x0,
+    0x202,
+    0x2,
+    0x2,
+    0x1006,
+    0x4,
+    0x4,
+    0x3,
+    0x2a,
+    0x7,
+    0xb,
+    0x7,
+    0x7,
+    0x22,
+    0x2006,
+    0x302,
+    0x7,
+    0x302,
+    0x201,
+    0x2,
+    0x7,
+    0x7,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x2,
+    0x2,
+    0x2006,
+    0x7,
+    0x2,
+    0x3,
+    0x3,
+    0x1c2,
+    0x1c2,
+    0x0,
+    0x202,
+    0x7,
+    0x6,
+    0x4,
+    0x4,
+    0x4,
+    0x4,
+    0x204,
+    0x204,
+    0x202,
+    0x3,
+    0x7,
+    0x203,
+    0x203,
+    0x6,
+    0xa,
+    0x18,
+    0x202,
+    0x80b,
+    0x104,
+    0x1,
+    0x29,
+    0x18,
+    0x18,
+    0x228,
+    0x28,
+    0x2,
+    0x7,
+    0x8,
+    0x2,
+    0x2,
+    0x2202,
+    0x7,
+    0x2006,
+    0x2202,
+    0x7,
+    0x204,
+    0x204,
+    0x3,
+    0x202,
+    0x203,
+    0x7,
+    0x7,
+    0x3,
+    0xa00,
+    0x2006,
+    0xa,
+    0xa,
+    0x20a,
+    0x302,
+    0x302,
+    0x0,
+    0x4,
+    0x4,
+    0x20,
+    0x222,
+    0x502,
+    0x221,
+    0x0,
+    0x403,
+    0x403,
+    0x18,
+    0x20,
+    0x11,
+    0x6,
+    0x202,
+    0x222,
+    0x222,
+    0x222,
+    0x22,
+    0x222,
+    0x4,
+    0x4,
+    0x20a,
+    0xa,
+    0x222,
+    0x22,
+    0x7,
+    0x7,
+    0x6,
+    0x7,
+    0x7,
+    0xa,
+    0xa,
+    0xa,
+    0x4,
+    0x4,
+    0xb,
+    0x2,
+    0x7,
+    0x104,
+    0x402,
+    0x402,
+    0x2322,
+    0x6,
+    0x6,
+    0x6,
+    0x7,
+    0x2,
+    0x402,
+    0x204,
+    0x7,
+    0x2,
+    0x502,
+    0x4,
+    0x4,
+    0x7,
+    0x3,
+    0x3,
+    0x7,
+    0x7,
+    0x7,
+    0x6,
+    0x22,
+    0x1,
+    0x1,
+    0x0,
+    0x21,
+    0x6,
+    0x7,
+    0x6,
+    0x1,
+    0x21,
+    0x21,
+    0x3,
+    0x21,
+    0x7,
+    0x2a,
+    0x2,
+    0xa,
+    0x1,
+    0x2b,
+    0x2,
+    0x2,
+    0x2022,
+    0x80b,
+    0x402,
+    0x403,
+    0x402,
+    0x402,
+    0x204,
+    0x208,
+    0x208,
+    0x2006,
+    0x402,
+    0x23ca,
+    0x2,
+    0x403,
+    0x402,
+    0x6,
+    0xa,
+    0xa,
+    0x403,
+    0x28,
+    0x2a,
+    0x7,
+    0x7,
+    0x203,
+    0x7,
+    0x7,
+    0x7,
+    0x202,
+    0x2006,
+    0x2006,
+    0x2,
+    0x7,
+    0x0,
+    0x7,
+    0x1006,
+    0x206,
+    0x2a,
+    0x2a,
+    0x6,
+    0x23,
+    0x22,
+    0x21,
+    0x104,
+    0x7,
+    0x7,
+    0x4,
+    0x4,
+    0x1,
+    0x2,
+    0x7,
+    0x2,
+    0x2,
+    0x3,
+    0xa,
+    0xa,
+    0x20a,
+    0x3,
+    0x3,
+    0x20a,
+    0x102,
+    0x204,
+    0x204,
+    0x407,
+    0x2,
+    0x6,
+    0x6,
+    0x2002,
+    0x22,
+    0x6,
+    0x6,
+    0x7,
+    0x7,
+    0x0,
+    0x2,
+    0x13,
+    0x7,
+    0xa,
+    0xa,
+    0xa,
+    0xa,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x2a,
+    0x6,
+    0x303,
+    0x22,
+    0x6,
+    0x22,
+    0x22,
+    0x7,
+    0x22,
+    0x22,
+    0x22,
+    0x2,
+    0x2,
+    0x22,
+    0x2,
+    0xb,
+    0xa,
+    0xa,
+    0xa,
+    0xa,
+    0x2,
+    0x2202,
+    0x2,
+    0x2,
+    0x28,
+    0x2a,
+    0x2002,
+    0x7,
+    0x7,
+    0x7,
+    0x2,
+    0x0,
+    0x0,
+    0x2,
+    0x2222,
+    0x302,
+    0x208,
+    0x6,
+    0x6,
+    0x2a12,
+    0x2a12,
+    0x280a,
+    0x6,
+    0x6,
+    0x6,
+    0x6,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0xa00,
+    0x2006,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x80b,
+    0x80b,
+    0x4,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x23,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x0,
+    0x20,
+    0x40a,
+    0x203,
+    0x22,
+    0x3,
+    0x102,
+    0x102,
+    0x2006,
+    0x2,
+    0x2,
+    0x7,
+    0x2,
+    0x7,
+    0x6,
+    0x6,
+    0x4,
+    0x4,
+    0x503,
+    0x7,
+    0x80b,
+    0x80b,
+    0x80b,
+    0x80b,
+    0x80b,
+    0x80b,
+    0x80b,
+    0x104,
+    0x302,
+    0xa,
+    0x18,
+    0x58a,
+    0x402,
+    0x402,
+    0x7,
+    0x7,
+    0x7,
+    0x402,
+    0x2,
+    0x582,
+    0x6,
+    0x6,
+    0x6,
+    0x6,
+    0x6,
+    0x6,
+    0x6,
+    0x7,
+    0x7,
+    0x7,
+    0x21,
+    0x22a,
+    0x3,
+    0x2a,
+    0x7,
+    0x6,
+    0x7,
+    0x7,
+    0x2a,
+    0x3,
+    0xa,
+    0x2b,
+    0x6,
+    0x2001,
+    0x4,
+    0x4,
+    0x7,
+    0x20,
+    0x7,
+    0x7,
+    0x18,
+    0x402,
+    0x2,
+    0x6,
+    0x7,
+    0x23,
+    0x7,
+    0x6,
+    0x6,
+    0x7,
+    0x6,
+    0x6,
+    0x28,
+    0x28,
+    0x6,
+    0x6,
+    0x6,
+    0x6,
+    0x3,
+    0x7,
+    0x6,
+    0x7,
+    0x2,
+    0x2,
+    0x0,
+    0x202,
+    0x302,
+    0x102,
+    0x120,
+    0x22,
+    0x22,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x7,
+    0x23,
+    0x23,
+    0x23,
+    0x23,
+    0x2,
+    0x7,
+    0x3,
+    0xa,
+    0x302,
+    0x102,
+    0xb,
+    0x0,
+    0x0,
+    0x2002,
+    0x3,
+    0x102,
+    0x1,
+    0x1,
+    0x1,
+    0x20,
+    0x3,
+    0x22,
+    0x29,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+    0x21,
+  ]
+
+  static let builtinAliases: [UInt16] = [
+    0xffff,
+    297,
+    0xffff,
+    2,
+    0xffff,
+    4,
+    7,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    27,
+    0xffff,
+    29,
+    32,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    37,
+    0xffff,
+    39,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    47,
+    0xffff,
+    77,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    79,
+    82,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    383,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    101,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    114,
+    117,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    126,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    136,
+    0xffff,
+    138,
+    0xffff,
+    140,
+    0xffff,
+    144,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    201,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    241,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    253,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    290,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    323,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    310,
+    0xffff,
+    0xffff,
+    0xffff,
+    381,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    361,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    372,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    369,
+    370,
+    319,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    402,
+    0xffff,
+    0xffff,
+    407,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    419,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    508,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    532,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    564,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    550,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    586,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    574,
+    0xffff,
+    0xffff,
+    0xffff,
+    1029,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    591,
+    0xffff,
+    593,
+    0xffff,
+    595,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    602,
+    0xffff,
+    604,
+    604,
+    657,
+    0xffff,
+    0xffff,
+    0xffff,
+    610,
+    0xffff,
+    612,
+    0xffff,
+    614,
+    0xffff,
+    0xffff,
+    0xffff,
+    616,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    643,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    659,
+    0xffff,
+    682,
+    0xffff,
+    0xffff,
+    0xffff,
+    667,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    678,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    692,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    706,
+    0xffff,
+    0xffff,
+    0xffff,
+    710,
+    0xffff,
+    0xffff,
+    711,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    749,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    770,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    786,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    801,
+    0xffff,
+    0xffff,
+    806,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    867,
+    0xffff,
+    0xffff,
+    0xffff,
+    869,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    927,
+    663,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    339,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    950,
+    0xffff,
+    952,
+    0xffff,
+    954,
+    0xffff,
+    956,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    950,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    975,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    1003,
+    1006,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    1013,
+    0xffff,
+    1015,
+    0xffff,
+    1017,
+    0xffff,
+    1019,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    1023,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    1029,
+    1034,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+    0xffff,
+  ]
+
+  static let builtinMetaVarOffsets: [UInt32] = [
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26535,
+    0xffffffff,
+    26547,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26535,
+    26554,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26561,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26572,
+    26554,
+    26595,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    26615,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26631,
+    26658,
+    26705,
+    26705,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26714,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    26738,
+    0xffffffff,
+    0xffffffff,
+    26759,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26771,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26738,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26778,
+    26800,
+    26809,
+    26800,
+    26800,
+    26800,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26817,
+    26817,
+    0xffffffff,
+    26825,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26844,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26858,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26867,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26901,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26911,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    26554,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26926,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    26554,
+    26554,
+    26554,
+    26554,
+    26554,
+    26554,
+    26554,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26932,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26978,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26978,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26978,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26989,
+    27003,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    27012,
+    27033,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26738,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27061,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    26554,
+    26554,
+    27087,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27098,
+    26926,
+    26554,
+    26759,
+    0xffffffff,
+    27105,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    27116,
+    0xffffffff,
+    0xffffffff,
+    27123,
+    27123,
+    27131,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    27137,
+    26554,
+    27159,
+    27207,
+    26554,
+    27221,
+    27221,
+    27232,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26547,
+    27246,
+    27123,
+    0xffffffff,
+    27254,
+    0xffffffff,
+    27277,
+    27320,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27333,
+    0xffffffff,
+    0xffffffff,
+    27098,
+    27098,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26926,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    27399,
+    0xffffffff,
+    26547,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27406,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27415,
+    0xffffffff,
+    0xffffffff,
+    27105,
+    0xffffffff,
+    26554,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27430,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27461,
+    27470,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27490,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27507,
+    27514,
+    0xffffffff,
+    27514,
+    27522,
+    0xffffffff,
+    26858,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26572,
+    26554,
+    26554,
+    26738,
+    0xffffffff,
+    27530,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26738,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27536,
+    27540,
+    26926,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27545,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27551,
+    27591,
+    0xffffffff,
+    0xffffffff,
+    26547,
+    0xffffffff,
+    26535,
+    26535,
+    27123,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27605,
+    27615,
+    0xffffffff,
+    26854,
+    27625,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27406,
+    0xffffffff,
+    26901,
+    0xffffffff,
+    26901,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26759,
+    0xffffffff,
+    0xffffffff,
+    27098,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    27640,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27098,
+    27098,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26547,
+    0xffffffff,
+    0xffffffff,
+    27123,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27656,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27507,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    27670,
+    26901,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    26825,
+    0xffffffff,
+    27670,
+    26901,
+    0xffffffff,
+    0xffffffff,
+    26554,
+    0xffffffff,
+    26825,
+    27677,
+    27677,
+    27677,
+    27677,
+    0xffffffff,
+    27677,
+    0xffffffff,
+    0xffffffff,
+    26854,
+    0xffffffff,
+    0xffffffff,
+    84297,
+    84304,
+  ]
+
+  static let builtinHelpTextOffsets: [UInt32] = [
+    0xffffffff,
+    0xffffffff,
+    27959,
+    27959,
+    27981,
+    27981,
+    0xffffffff,
+    28014,
+    28092,
+    28178,
+    28260,
+    28334,
+    28455,
+    28507,
+    28572,
+    28607,
+    28686,
+    28761,
+    28879,
+    28913,
+    28974,
+    29026,
+    29139,
+    29206,
+    29254,
+    29319,
+    29341,
+    29375,
+    29375,
+    29422,
+    29422,
+    0xffffffff,
+    29477,
+    29538,
+    29626,
+    29750,
+    0xffffffff,
+    29811,
+    0xffffffff,
+    29865,
+    29897,
+    29984,
+    30027,
+    30075,
+    30143,
+    30177,
+    0xffffffff,
+    30223,
+    0xffffffff,
+    30274,
+    30311,
+    30352,
+    30376,
+    30423,
+    30469,
+    30527,
+    30558,
+    30605,
+    30670,
+    30729,
+    30741,
+    30767,
+    30786,
+    30812,
+    30879,
+    30985,
+    31074,
+    31142,
+    31398,
+    31432,
+    31457,
+    31514,
+    31622,
+    31690,
+    31755,
+    31813,
+    31840,
+    31944,
+    32010,
+    32054,
+    32054,
+    0xffffffff,
+    32098,
+    32154,
+    32274,
+    32274,
+    32348,
+    32401,
+    32437,
+    32471,
+    32557,
+    32705,
+    32841,
+    32900,
+    32955,
+    0xffffffff,
+    33030,
+    33071,
+    33110,
+    33154,
+    0xffffffff,
+    33201,
+    33255,
+    33295,
+    33323,
+    33349,
+    33410,
+    33449,
+    33504,
+    33601,
+    33626,
+    33718,
+    33785,
+    33833,
+    33893,
+    33893,
+    0xffffffff,
+    33932,
+    34020,
+    34101,
+    34134,
+    34193,
+    34247,
+    34304,
+    34353,
+    0xffffffff,
+    34514,
+    34602,
+    34677,
+    34756,
+    34829,
+    34909,
+    34980,
+    35019,
+    35079,
+    0xffffffff,
+    35157,
+    35157,
+    35195,
+    35195,
+    35235,
+    35235,
+    35269,
+    0xffffffff,
+    35312,
+    35384,
+    35456,
+    35542,
+    35615,
+    35650,
+    35730,
+    35812,
+    35919,
+    35961,
+    36005,
+    36073,
+    36117,
+    36209,
+    36247,
+    36286,
+    36353,
+    36395,
+    36712,
+    36757,
+    36795,
+    36838,
+    36889,
+    36938,
+    37011,
+    37092,
+    37151,
+    37201,
+    37246,
+    37297,
+    37352,
+    37411,
+    37449,
+    37520,
+    37596,
+    37630,
+    37667,
+    37701,
+    37755,
+    37793,
+    37844,
+    37892,
+    37952,
+    38066,
+    38169,
+    38235,
+    38296,
+    38324,
+    38376,
+    38415,
+    38501,
+    38562,
+    38644,
+    38676,
+    38727,
+    38791,
+    38839,
+    38878,
+    38878,
+    38933,
+    38988,
+    39040,
+    39081,
+    39183,
+    39239,
+    39303,
+    39364,
+    39422,
+    39489,
+    39581,
+    39669,
+    39711,
+    39783,
+    39830,
+    39898,
+    39951,
+    40032,
+    40076,
+    40114,
+    40178,
+    40221,
+    40256,
+    40299,
+    40348,
+    40380,
+    40443,
+    40534,
+    40590,
+    40746,
+    40780,
+    40846,
+    40907,
+    40984,
+    41044,
+    41119,
+    41185,
+    41234,
+    41315,
+    41315,
+    41343,
+    41383,
+    41417,
+    41478,
+    41546,
+    41636,
+    41668,
+    41728,
+    41786,
+    39040,
+    41870,
+    41870,
+    41916,
+    42027,
+    42087,
+    42163,
+    42208,
+    42277,
+    42331,
+    42430,
+    42456,
+    42516,
+    42563,
+    42609,
+    42656,
+    42684,
+    42760,
+    42836,
+    42877,
+    30786,
+    42928,
+    42981,
+    43011,
+    43080,
+    43115,
+    43139,
+    43213,
+    43281,
+    43346,
+    43405,
+    43436,
+    43507,
+    43566,
+    43650,
+    43710,
+    43787,
+    0xffffffff,
+    43860,
+    43932,
+    43976,
+    44026,
+    44058,
+    44094,
+    44143,
+    44182,
+    44211,
+    44252,
+    44312,
+    44360,
+    44415,
+    44478,
+    44526,
+    44624,
+    44677,
+    44747,
+    44803,
+    44874,
+    45013,
+    45064,
+    45099,
+    45132,
+    45201,
+    45314,
+    45368,
+    45386,
+    45428,
+    45497,
+    45533,
+    45593,
+    45658,
+    45719,
+    45719,
+    45749,
+    45796,
+    45859,
+    45927,
+    45967,
+    46016,
+    46111,
+    46156,
+    46219,
+    46262,
+    46292,
+    46346,
+    46400,
+    46457,
+    46504,
+    0xffffffff,
+    46531,
+    46552,
+    46626,
+    46716,
+    46766,
+    0xffffffff,
+    46821,
+    46878,
+    46924,
+    46993,
+    47052,
+    47121,
+    47146,
+    47323,
+    47361,
+    47410,
+    47446,
+    47493,
+    47539,
+    0xffffffff,
+    47561,
+    47605,
+    47676,
+    47701,
+    47778,
+    47818,
+    47889,
+    47929,
+    47994,
+    48033,
+    0xffffffff,
+    48062,
+    48098,
+    48147,
+    48197,
+    48267,
+    48308,
+    48339,
+    48376,
+    48403,
+    48429,
+    48471,
+    48503,
+    48528,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    48575,
+    48621,
+    48671,
+    48734,
+    48781,
+    48828,
+    48865,
+    48934,
+    48972,
+    49016,
+    49037,
+    49064,
+    49160,
+    49237,
+    49297,
+    49357,
+    49419,
+    49458,
+    0xffffffff,
+    49478,
+    49506,
+    49522,
+    49591,
+    49663,
+    49729,
+    49791,
+    49862,
+    49926,
+    49996,
+    50066,
+    50101,
+    50163,
+    50163,
+    50198,
+    50234,
+    50275,
+    50342,
+    50385,
+    50451,
+    50512,
+    50553,
+    50864,
+    50921,
+    50958,
+    51032,
+    51098,
+    51142,
+    51192,
+    51242,
+    51295,
+    51414,
+    51450,
+    51483,
+    51563,
+    51598,
+    51718,
+    51771,
+    51818,
+    51878,
+    51933,
+    51968,
+    52022,
+    52073,
+    52113,
+    52198,
+    52258,
+    52320,
+    52376,
+    52426,
+    52473,
+    52511,
+    52581,
+    52636,
+    52757,
+    52788,
+    52830,
+    52879,
+    52929,
+    52959,
+    53017,
+    53081,
+    53144,
+    53206,
+    53234,
+    53272,
+    53331,
+    53371,
+    53405,
+    53495,
+    53586,
+    53673,
+    53739,
+    53791,
+    53871,
+    53914,
+    53950,
+    53975,
+    54037,
+    54100,
+    54137,
+    54180,
+    54251,
+    54323,
+    54407,
+    54466,
+    54499,
+    54564,
+    54628,
+    54704,
+    54767,
+    54841,
+    54906,
+    54954,
+    55034,
+    55067,
+    55130,
+    55182,
+    55243,
+    55274,
+    53331,
+    55372,
+    55372,
+    55413,
+    55544,
+    55594,
+    55638,
+    55663,
+    55725,
+    30786,
+    55764,
+    55810,
+    30786,
+    55837,
+    55889,
+    55918,
+    55979,
+    56023,
+    56091,
+    56125,
+    56198,
+    56265,
+    56294,
+    56347,
+    56374,
+    56407,
+    56407,
+    56449,
+    56514,
+    56566,
+    56720,
+    56795,
+    56893,
+    56929,
+    57080,
+    57131,
+    57232,
+    57289,
+    57315,
+    57395,
+    57432,
+    30786,
+    0xffffffff,
+    57519,
+    57630,
+    57820,
+    57874,
+    57932,
+    57976,
+    58052,
+    58124,
+    58168,
+    58200,
+    58327,
+    58408,
+    58550,
+    58628,
+    57080,
+    58739,
+    58808,
+    58872,
+    58926,
+    58998,
+    0xffffffff,
+    59051,
+    59144,
+    59198,
+    59262,
+    59262,
+    59300,
+    59326,
+    59382,
+    0xffffffff,
+    59438,
+    59483,
+    59570,
+    59623,
+    59665,
+    59711,
+    59748,
+    59787,
+    59880,
+    59907,
+    59953,
+    60000,
+    60000,
+    60027,
+    60027,
+    60090,
+    60090,
+    60124,
+    60168,
+    60190,
+    60255,
+    60302,
+    60374,
+    60374,
+    60426,
+    60426,
+    0xffffffff,
+    0xffffffff,
+    60452,
+    60489,
+    60547,
+    60547,
+    60626,
+    60626,
+    60663,
+    60663,
+    60737,
+    60772,
+    60817,
+    0xffffffff,
+    60856,
+    60888,
+    60982,
+    61034,
+    61076,
+    61114,
+    61167,
+    61232,
+    61286,
+    61327,
+    61362,
+    61394,
+    61429,
+    61466,
+    61502,
+    61554,
+    61584,
+    61649,
+    61703,
+    61733,
+    61794,
+    61868,
+    61926,
+    61951,
+    61951,
+    61985,
+    62059,
+    62116,
+    62160,
+    62369,
+    62384,
+    62493,
+    62573,
+    62638,
+    62768,
+    62886,
+    62961,
+    63008,
+    0xffffffff,
+    63048,
+    63048,
+    63077,
+    0xffffffff,
+    63119,
+    63179,
+    63223,
+    0xffffffff,
+    63251,
+    63316,
+    63415,
+    63426,
+    63450,
+    63544,
+    63601,
+    63716,
+    63785,
+    63960,
+    64002,
+    64050,
+    64050,
+    64088,
+    64119,
+    64177,
+    64219,
+    64270,
+    64330,
+    64393,
+    64451,
+    64503,
+    64549,
+    64642,
+    64642,
+    64696,
+    64696,
+    64747,
+    64820,
+    64888,
+    64939,
+    64986,
+    65034,
+    65147,
+    65179,
+    65217,
+    65247,
+    65294,
+    0xffffffff,
+    65378,
+    65425,
+    65478,
+    0xffffffff,
+    65498,
+    65526,
+    65526,
+    65543,
+    65577,
+    65649,
+    65704,
+    65729,
+    65814,
+    65929,
+    66001,
+    66035,
+    66096,
+    66151,
+    63415,
+    66216,
+    66274,
+    66362,
+    66425,
+    66462,
+    66511,
+    66540,
+    66636,
+    66709,
+    66762,
+    66834,
+    66861,
+    66925,
+    67023,
+    67074,
+    67146,
+    67204,
+    67257,
+    67436,
+    67469,
+    67525,
+    67579,
+    67639,
+    0xffffffff,
+    67656,
+    67703,
+    67761,
+    67788,
+    67811,
+    67880,
+    67971,
+    68013,
+    68054,
+    68104,
+    68155,
+    59623,
+    68209,
+    68229,
+    68274,
+    68312,
+    68384,
+    68448,
+    68507,
+    68557,
+    0xffffffff,
+    68597,
+    68657,
+    68731,
+    68826,
+    68855,
+    68943,
+    69008,
+    69059,
+    69136,
+    69195,
+    69227,
+    69296,
+    69365,
+    69455,
+    69495,
+    69596,
+    69624,
+    69624,
+    69658,
+    69715,
+    69803,
+    69828,
+    69887,
+    69974,
+    70013,
+    70075,
+    70130,
+    70224,
+    70299,
+    70345,
+    70406,
+    70458,
+    70458,
+    70518,
+    70547,
+    0xffffffff,
+    70613,
+    70656,
+    70690,
+    70748,
+    70828,
+    70892,
+    70960,
+    71041,
+    71111,
+    71141,
+    71191,
+    71239,
+    71330,
+    71415,
+    71477,
+    71538,
+    71599,
+    71657,
+    71706,
+    71751,
+    71901,
+    71981,
+    72024,
+    72048,
+    72101,
+    72145,
+    72192,
+    72240,
+    72313,
+    72400,
+    72433,
+    72497,
+    72537,
+    72644,
+    72754,
+    72871,
+    72935,
+    73103,
+    73206,
+    73410,
+    73450,
+    73497,
+    73630,
+    73689,
+    73763,
+    73804,
+    73842,
+    73887,
+    73967,
+    74025,
+    74075,
+    74135,
+    74178,
+    74232,
+    74135,
+    74302,
+    74367,
+    74389,
+    74452,
+    74516,
+    0xffffffff,
+    74592,
+    74637,
+    0xffffffff,
+    0xffffffff,
+    34101,
+    74678,
+    74735,
+    74809,
+    74906,
+    75052,
+    75104,
+    75180,
+    75241,
+    75279,
+    75367,
+    75464,
+    75510,
+    75542,
+    75578,
+    75670,
+    75780,
+    75846,
+    75915,
+    75957,
+    76042,
+    76153,
+    76206,
+    76285,
+    76350,
+    76405,
+    76473,
+    76515,
+    76599,
+    76708,
+    76760,
+    76838,
+    76892,
+    76937,
+    77016,
+    77053,
+    77151,
+    77231,
+    77304,
+    77348,
+    77422,
+    77453,
+    77496,
+    77588,
+    77647,
+    77935,
+    78030,
+    78080,
+    78117,
+    78189,
+    78208,
+    78229,
+    78288,
+    78310,
+    78345,
+    78377,
+    78444,
+    78444,
+    78488,
+    0xffffffff,
+    28260,
+    29897,
+    78558,
+    78634,
+    78676,
+    75578,
+    75780,
+    78817,
+    78996,
+    0xffffffff,
+    79020,
+    79044,
+    79146,
+    79189,
+    79294,
+    79348,
+    79395,
+    79450,
+    0xffffffff,
+    79582,
+    0xffffffff,
+    79658,
+    0xffffffff,
+    79714,
+    0xffffffff,
+    79764,
+    79811,
+    79882,
+    79979,
+    80033,
+    80075,
+    80153,
+    80220,
+    80264,
+    80329,
+    0xffffffff,
+    80396,
+    80435,
+    80497,
+    80532,
+    80607,
+    80779,
+    80797,
+    80860,
+    80934,
+    80934,
+    80977,
+    81032,
+    81078,
+    81148,
+    81195,
+    81221,
+    81272,
+    81397,
+    81488,
+    81564,
+    81622,
+    81669,
+    81729,
+    81806,
+    81850,
+    81901,
+    81948,
+    81998,
+    82064,
+    82114,
+    82156,
+    82214,
+    82296,
+    82349,
+    82414,
+    82483,
+    82532,
+    82532,
+    0xffffffff,
+    82567,
+    82601,
+    82622,
+    82648,
+    82692,
+    82820,
+    0xffffffff,
+    82870,
+    0xffffffff,
+    82942,
+    0xffffffff,
+    83019,
+    0xffffffff,
+    83083,
+    83144,
+    83196,
+    83243,
+    30786,
+    30786,
+    0xffffffff,
+    83297,
+    83322,
+    83481,
+    83515,
+    83569,
+    83586,
+    0xffffffff,
+    0xffffffff,
+    83606,
+    83661,
+    83776,
+    83812,
+    83857,
+    83906,
+    83939,
+    84026,
+    84083,
+    0xffffffff,
+    84315,
+    84403,
+    84519,
+    84631,
+    84729,
+    84814,
+  ]
+
+  static let builtinGroups: [Group?] = [
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .internalDebug,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .debugCrash,
+    .debugCrash,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .debugCrash,
+    .debugCrash,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    nil,
+    .internalDebug,
+    .internalDebug,
+    nil,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    nil,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    nil,
+    .internalDebug,
+    .internalDebug,
+    .internalDebug,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    .modes,
+    .modes,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    .modes,
+    .modes,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .pluginSearch,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .linkerOption,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .g,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .g,
+    .g,
+    nil,
+    nil,
+    .g,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .codeFormatting,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .codeFormatting,
+    .codeFormatting,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    .linkerOption,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .codeFormatting,
+    nil,
+    .modes,
+    nil,
+    nil,
+    .pluginSearch,
+    .pluginSearch,
+    .pluginSearch,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .linkerOption,
+    .linkerOption,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .warningTreating,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .O,
+    .O,
+    .O,
+    .O,
+    nil,
+    nil,
+    nil,
+    nil,
+    .O,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .pluginSearch,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .codeFormatting,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .modes,
+    .modes,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .codeFormatting,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .warningTreating,
+    nil,
+    .warningTreating,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    .warningTreating,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+    nil,
+  ]
+
+  static let builtinNumArgs: [UInt16] = [
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+  ]
+}
+
+extension Option {
+  static let builtinBatchDriverOptions = OptionBitSet(words: [
+    0x7c18c10005fe5dc3, 0xe0f1c400cde059c2, 0x00051b800261804f, 0x0001003000300011,
+    0xc067fffff4404018, 0xfdde4ff777feeb45, 0x102f8041f5fc78ef, 0x011004103000a121,
+    0x1f57991f7e844400, 0x7b9b5b00fe601d4b, 0x1cce0f3f2fe7ece2, 0x13efb7ffdf1f0c66,
+    0x681e6191ffb07629, 0x00602010fe3ffffb, 0x0071dbfa0b7f8400, 0xc00ff88604c45e1e,
+    0x0000000003fffff7,
+  ])
+
+  static let builtinInteractiveDriverOptions = OptionBitSet(words: [
+    0x3c18c10001e05dc3, 0x60f1840041e049c2, 0x00051380020180c0, 0x0001000000300011,
+    0x0007bffff4404018, 0x00c0400400008a00, 0x102d804000000000, 0x001000103000a121,
+    0x1f57991f7e844000, 0x72091b00fe601d41, 0x1c800c3f6fe70ce2, 0x108e87ba9f1f0c66,
+    0x6000e19163b07029, 0x0000200c7e2783fb, 0x007188020b7d8400, 0xc00ff88004c4440a,
+    0x0000000003effed7,
+  ])
+
+  static let builtinAttributeBitsets: [OptionBitSet] = [
+    // .helpHidden
+    OptionBitSet(words: [
+      0xc047180201c1e200, 0x9f023ffb310e263d, 0xfcfe7c7ffd90001e, 0x9ff8ffcfff4bf9ee,
+      0x3f8fbffdfb99ffef, 0x00401006800014a2, 0xf1f67fa2003b8097, 0xcfeffbefcfff5ede,
+      0x008c7ff8ee4bbcff, 0x841a1e010d006a3d, 0x0141b0004d0007a4, 0xfc8401463f567e11,
+      0x27e1980862535050, 0xff7f9e0001c00404, 0xc00e03fe14147fff, 0xfff005804e1a55ab,
+      0x0000000003f5d11b,
+    ]),
+    // .frontend
+    OptionBitSet(words: [
+      0xffff1a0383ffbac0, 0xfff3fffffffe6fff, 0xfffeefffff9fc0bf, 0x9ff8ffffffeff9ff,
+      0xfff800000bffffff, 0xf73bbf7e9bfbffe7, 0xfffbffe7dffffffb, 0xcfefffffefffffff,
+      0x3de87fffc6cfffff, 0xf6037f03bfe077ff, 0xfdcfff3f8cc3f7e7, 0xfeffc7fde8e1fe77,
+      0xffffdff9ffe33fdf, 0xff7fdfff73f7ffff, 0xffffdbfe7ffe7fff, 0xfffddff9ffda3ffd,
+      0x00000000000c39ff,
+    ]),
+    // .noDriver
+    OptionBitSet(words: [
+      0x83e73efffa01a23c, 0x1f0e3bff321fa63d, 0xfffae47ffd9e7f30, 0xfffeffcfffcfffee,
+      0x3f9800000bbfbfe7, 0x0221b008880114ba, 0xefd07fbe0a038710, 0xfeeffbefcfff5ede,
+      0xe0a866e0817bbbff, 0x840424ff019fe2b4, 0xe331f0c08018131d, 0xec10480020e0f399,
+      0x97e11e6e004f89d6, 0xff9fdfe301c00004, 0xff8e0405f4807bff, 0x3ff00779fb1ba1e1,
+      0x0000000000000008,
+    ]),
+    // .noInteractive
+    OptionBitSet(words: [
+      0x40000000041e0000, 0x800040008c001000, 0x000008000060000f, 0x0000003000000000,
+      0xc060400000000000, 0xfd1e2ff377fe6145, 0x00020001f5fc7cef, 0x0100040000000000,
+      0x0000000000000400, 0x09f2c0000000000a, 0x004e03001000e000, 0x0361304540000000,
+      0x081e00009c000600, 0x0060001080187c00, 0x000073f800020000, 0x0000000600201a14,
+      0x0000000000100120,
+    ]),
+    // .noBatch
+    OptionBitSet(words: [
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000080, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0060800000000000, 0x0000000050000000, 0x0000000000000000,
+      0x0000800000000000, 0x0000000c00000000, 0x0000200000000000, 0x0000000000200000,
+      0x0000000000000000,
+    ]),
+    // .doesNotAffectIncrementalBuild
+    OptionBitSet(words: [
+      0x0000000004060000, 0x0000040000404840, 0x0000000002018000, 0x0001000000000001,
+      0xc063ffedf0000010, 0x8000287100380045, 0x00000040000c7c68, 0x0010000000000001,
+      0x0004000000000000, 0x0190000000000042, 0x10000c3e21600000, 0x0300002456110000,
+      0x4800010000007600, 0x000000002018013b, 0x0000000000090400, 0xc00e000604041216,
+      0x0000000003fa0003,
+    ]),
+    // .autolinkExtract
+    OptionBitSet(words: [
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000030000000, 0x0000000000000000, 0x0001000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000,
+    ]),
+    // .moduleWrap
+    OptionBitSet(words: [
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000030000000, 0x0000000000000000, 0x0001000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0040400000000000, 0x0000000000000000,
+      0x0000000000000000,
+    ]),
+    // .synthesizeInterface
+    OptionBitSet(words: [
+      0x0000000000000000, 0x0000000040000180, 0x0000000000000000, 0x0000000000000010,
+      0x0000000000400008, 0x0000000000000000, 0x0000000000000000, 0x0000000000002000,
+      0x0000000000004000, 0x0004000030000500, 0x1200000000830000, 0x0001000000000040,
+      0x2000000100008000, 0x0000000040000000, 0x00404c0200600000, 0x0003800000000000,
+      0x00000000000020c0,
+    ]),
+    // .argumentIsPath
+    OptionBitSet(words: [
+      0x000026ac000600c1, 0x0030000000301042, 0x0000000000200040, 0x0000000000000000,
+      0x4000000000000000, 0x259a430023020000, 0x00000001f4d00083, 0x0000000000000000,
+      0x0500000000000000, 0x408119c080000d00, 0x1000052f014388da, 0x1001380000000008,
+      0x2000000690000101, 0x0000200ce0010000, 0x0000080000040000, 0x0000c00000000004,
+      0x0000000000000040,
+    ]),
+    // .moduleInterface
+    OptionBitSet(words: [
+      0x0000000001201000, 0x0000000000000000, 0x0000000000000000, 0x0000600000000018,
+      0x0000000000400000, 0x0000000000000000, 0x0009000000000000, 0x80060010002a7b80,
+      0x0040000002044000, 0x0000000000000000, 0x0c0000000c800000, 0x008c878000000044,
+      0x0000000800000000, 0x0000000000000000, 0x0051c00200020000, 0x0000000000400000,
+      0x0000000000000000,
+    ]),
+    // .supplementaryOutput
+    OptionBitSet(words: [
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000040, 0x0000000000000000,
+      0x0000000000000000, 0x7d9e470277860000, 0x00000001f5f00087, 0x0000000000000000,
+      0x0000000000000000, 0x0002000000000000, 0x0000000000000800, 0x0000004000000000,
+      0x0000000000000000, 0x0060201c00000000, 0x000003f800000000, 0x0000000000000000,
+      0x0000000000000000,
+    ]),
+    // .argumentIsFileList
+    OptionBitSet(words: [
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x2000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000080, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+      0x0000000000000000,
+    ]),
+    // .cacheInvariant
+    OptionBitSet(words: [
+      0x3c30000180000000, 0x0000000000004042, 0x0000000000004000, 0x0000000000000000,
+      0x0010000000000000, 0x253a83080b470000, 0x00000001fed00183, 0x0000000000000001,
+      0x0000000000000000, 0x4000000000800080, 0x1000000000001003, 0x0001402000000000,
+      0x0000008000000006, 0x0000401c20210000, 0x0000000000800000, 0x0000000000004000,
+      0x0000000000000800,
+    ]),
+  ]
+}
+
+extension Option {
+  static let builtinCanonicalIDs: [UInt16] = [
+    0,
+    297,
+    2,
+    2,
+    4,
+    4,
+    7,
+    7,
+    8,
+    9,
+    10,
+    11,
+    12,
+    13,
+    14,
+    15,
+    16,
+    17,
+    18,
+    19,
+    20,
+    21,
+    22,
+    23,
+    24,
+    25,
+    26,
+    27,
+    27,
+    29,
+    29,
+    32,
+    32,
+    33,
+    34,
+    35,
+    37,
+    37,
+    39,
+    39,
+    40,
+    41,
+    42,
+    43,
+    44,
+    45,
+    47,
+    47,
+    77,
+    49,
+    50,
+    51,
+    52,
+    53,
+    54,
+    55,
+    56,
+    57,
+    58,
+    59,
+    60,
+    61,
+    62,
+    63,
+    64,
+    65,
+    66,
+    67,
+    68,
+    69,
+    70,
+    71,
+    72,
+    73,
+    74,
+    75,
+    76,
+    77,
+    78,
+    79,
+    79,
+    82,
+    82,
+    83,
+    84,
+    85,
+    86,
+    87,
+    88,
+    89,
+    90,
+    91,
+    92,
+    93,
+    94,
+    383,
+    96,
+    97,
+    98,
+    99,
+    101,
+    101,
+    102,
+    103,
+    104,
+    105,
+    106,
+    107,
+    108,
+    109,
+    110,
+    111,
+    112,
+    113,
+    114,
+    114,
+    117,
+    117,
+    118,
+    119,
+    120,
+    121,
+    122,
+    123,
+    124,
+    126,
+    126,
+    127,
+    128,
+    129,
+    130,
+    131,
+    132,
+    133,
+    134,
+    135,
+    136,
+    136,
+    138,
+    138,
+    140,
+    140,
+    142,
+    144,
+    144,
+    145,
+    146,
+    147,
+    148,
+    149,
+    150,
+    151,
+    152,
+    153,
+    154,
+    155,
+    156,
+    157,
+    158,
+    159,
+    160,
+    161,
+    162,
+    163,
+    164,
+    165,
+    166,
+    167,
+    168,
+    169,
+    170,
+    171,
+    172,
+    173,
+    174,
+    175,
+    176,
+    177,
+    178,
+    179,
+    180,
+    181,
+    182,
+    183,
+    184,
+    185,
+    186,
+    187,
+    188,
+    189,
+    190,
+    191,
+    192,
+    193,
+    194,
+    195,
+    196,
+    197,
+    198,
+    199,
+    200,
+    201,
+    201,
+    203,
+    204,
+    205,
+    206,
+    207,
+    208,
+    209,
+    210,
+    211,
+    212,
+    213,
+    214,
+    215,
+    216,
+    217,
+    218,
+    219,
+    220,
+    221,
+    222,
+    223,
+    224,
+    225,
+    226,
+    227,
+    228,
+    229,
+    230,
+    231,
+    232,
+    233,
+    234,
+    235,
+    236,
+    237,
+    238,
+    239,
+    240,
+    241,
+    241,
+    243,
+    244,
+    245,
+    246,
+    247,
+    248,
+    249,
+    250,
+    251,
+    252,
+    253,
+    253,
+    255,
+    256,
+    257,
+    258,
+    259,
+    260,
+    261,
+    262,
+    263,
+    264,
+    265,
+    266,
+    267,
+    268,
+    269,
+    270,
+    271,
+    272,
+    273,
+    274,
+    275,
+    276,
+    277,
+    278,
+    279,
+    280,
+    281,
+    282,
+    283,
+    284,
+    285,
+    286,
+    287,
+    288,
+    290,
+    290,
+    291,
+    292,
+    293,
+    294,
+    295,
+    296,
+    297,
+    298,
+    299,
+    300,
+    301,
+    302,
+    303,
+    304,
+    305,
+    306,
+    307,
+    308,
+    309,
+    310,
+    311,
+    312,
+    313,
+    314,
+    315,
+    316,
+    317,
+    318,
+    319,
+    320,
+    321,
+    322,
+    323,
+    323,
+    325,
+    326,
+    327,
+    328,
+    329,
+    330,
+    331,
+    332,
+    333,
+    334,
+    335,
+    336,
+    337,
+    338,
+    339,
+    310,
+    341,
+    342,
+    343,
+    381,
+    345,
+    346,
+    347,
+    348,
+    349,
+    350,
+    351,
+    352,
+    353,
+    354,
+    355,
+    356,
+    357,
+    358,
+    359,
+    361,
+    361,
+    362,
+    363,
+    364,
+    365,
+    366,
+    367,
+    368,
+    369,
+    370,
+    372,
+    372,
+    373,
+    374,
+    375,
+    376,
+    377,
+    378,
+    379,
+    380,
+    381,
+    382,
+    383,
+    384,
+    369,
+    370,
+    319,
+    388,
+    389,
+    390,
+    391,
+    392,
+    393,
+    394,
+    395,
+    396,
+    397,
+    398,
+    399,
+    400,
+    401,
+    402,
+    402,
+    404,
+    405,
+    407,
+    407,
+    408,
+    409,
+    410,
+    411,
+    412,
+    413,
+    414,
+    415,
+    416,
+    417,
+    418,
+    419,
+    419,
+    421,
+    422,
+    423,
+    424,
+    425,
+    426,
+    427,
+    428,
+    429,
+    430,
+    431,
+    432,
+    433,
+    434,
+    435,
+    436,
+    437,
+    438,
+    439,
+    440,
+    441,
+    442,
+    443,
+    444,
+    445,
+    446,
+    447,
+    448,
+    449,
+    450,
+    451,
+    452,
+    453,
+    454,
+    455,
+    456,
+    457,
+    458,
+    459,
+    460,
+    461,
+    462,
+    463,
+    464,
+    465,
+    466,
+    467,
+    468,
+    469,
+    470,
+    471,
+    472,
+    473,
+    474,
+    475,
+    476,
+    477,
+    478,
+    479,
+    480,
+    481,
+    482,
+    483,
+    484,
+    485,
+    486,
+    487,
+    488,
+    489,
+    490,
+    491,
+    492,
+    493,
+    494,
+    495,
+    496,
+    497,
+    498,
+    499,
+    500,
+    501,
+    502,
+    503,
+    504,
+    505,
+    506,
+    507,
+    508,
+    508,
+    510,
+    511,
+    512,
+    513,
+    514,
+    515,
+    516,
+    517,
+    518,
+    519,
+    520,
+    521,
+    522,
+    523,
+    524,
+    525,
+    526,
+    527,
+    528,
+    529,
+    530,
+    531,
+    532,
+    532,
+    534,
+    535,
+    536,
+    537,
+    538,
+    539,
+    540,
+    564,
+    542,
+    543,
+    544,
+    545,
+    546,
+    547,
+    548,
+    550,
+    550,
+    551,
+    552,
+    553,
+    554,
+    555,
+    556,
+    557,
+    558,
+    559,
+    560,
+    561,
+    562,
+    563,
+    564,
+    565,
+    566,
+    567,
+    568,
+    569,
+    586,
+    571,
+    572,
+    573,
+    574,
+    574,
+    576,
+    577,
+    578,
+    1029,
+    580,
+    581,
+    582,
+    583,
+    584,
+    585,
+    586,
+    587,
+    588,
+    589,
+    590,
+    591,
+    591,
+    593,
+    593,
+    595,
+    595,
+    597,
+    598,
+    599,
+    600,
+    601,
+    602,
+    602,
+    604,
+    604,
+    604,
+    657,
+    608,
+    609,
+    610,
+    610,
+    612,
+    612,
+    614,
+    614,
+    616,
+    617,
+    618,
+    616,
+    620,
+    621,
+    622,
+    623,
+    624,
+    625,
+    626,
+    627,
+    628,
+    629,
+    630,
+    631,
+    632,
+    633,
+    634,
+    635,
+    636,
+    637,
+    638,
+    639,
+    640,
+    641,
+    642,
+    643,
+    643,
+    645,
+    646,
+    647,
+    648,
+    649,
+    650,
+    651,
+    652,
+    653,
+    654,
+    655,
+    656,
+    657,
+    658,
+    659,
+    659,
+    661,
+    682,
+    663,
+    664,
+    665,
+    667,
+    667,
+    668,
+    669,
+    670,
+    671,
+    672,
+    673,
+    674,
+    675,
+    676,
+    677,
+    678,
+    678,
+    680,
+    681,
+    682,
+    683,
+    684,
+    685,
+    686,
+    687,
+    688,
+    689,
+    690,
+    691,
+    692,
+    692,
+    694,
+    695,
+    696,
+    697,
+    698,
+    699,
+    700,
+    701,
+    702,
+    703,
+    704,
+    706,
+    706,
+    707,
+    708,
+    710,
+    710,
+    711,
+    711,
+    713,
+    714,
+    715,
+    716,
+    717,
+    718,
+    719,
+    720,
+    721,
+    722,
+    723,
+    724,
+    725,
+    726,
+    727,
+    728,
+    729,
+    730,
+    731,
+    732,
+    733,
+    734,
+    735,
+    736,
+    737,
+    738,
+    739,
+    740,
+    741,
+    742,
+    743,
+    744,
+    745,
+    746,
+    747,
+    749,
+    749,
+    750,
+    751,
+    752,
+    753,
+    754,
+    755,
+    756,
+    757,
+    758,
+    759,
+    760,
+    761,
+    762,
+    763,
+    764,
+    765,
+    766,
+    767,
+    768,
+    770,
+    770,
+    771,
+    772,
+    773,
+    774,
+    775,
+    776,
+    777,
+    778,
+    779,
+    780,
+    781,
+    782,
+    783,
+    784,
+    785,
+    786,
+    786,
+    788,
+    789,
+    790,
+    791,
+    792,
+    793,
+    794,
+    795,
+    796,
+    797,
+    798,
+    799,
+    800,
+    801,
+    801,
+    803,
+    804,
+    806,
+    806,
+    807,
+    808,
+    809,
+    810,
+    811,
+    812,
+    813,
+    814,
+    815,
+    816,
+    817,
+    818,
+    819,
+    820,
+    821,
+    822,
+    823,
+    824,
+    825,
+    826,
+    827,
+    828,
+    829,
+    830,
+    831,
+    832,
+    833,
+    834,
+    835,
+    836,
+    837,
+    838,
+    839,
+    840,
+    841,
+    842,
+    843,
+    844,
+    845,
+    846,
+    847,
+    848,
+    849,
+    850,
+    851,
+    852,
+    853,
+    854,
+    855,
+    856,
+    857,
+    858,
+    859,
+    860,
+    861,
+    862,
+    863,
+    864,
+    865,
+    867,
+    867,
+    868,
+    869,
+    869,
+    871,
+    872,
+    873,
+    874,
+    875,
+    876,
+    877,
+    878,
+    879,
+    880,
+    881,
+    882,
+    883,
+    884,
+    885,
+    886,
+    887,
+    888,
+    889,
+    890,
+    891,
+    892,
+    893,
+    894,
+    895,
+    896,
+    897,
+    898,
+    899,
+    900,
+    901,
+    902,
+    903,
+    904,
+    905,
+    906,
+    907,
+    908,
+    909,
+    910,
+    911,
+    912,
+    913,
+    914,
+    915,
+    916,
+    917,
+    918,
+    919,
+    920,
+    921,
+    922,
+    923,
+    924,
+    925,
+    926,
+    927,
+    927,
+    663,
+    930,
+    931,
+    932,
+    933,
+    934,
+    935,
+    936,
+    937,
+    938,
+    939,
+    339,
+    941,
+    942,
+    943,
+    944,
+    945,
+    946,
+    947,
+    948,
+    950,
+    950,
+    952,
+    952,
+    954,
+    954,
+    956,
+    956,
+    957,
+    958,
+    959,
+    960,
+    961,
+    962,
+    963,
+    964,
+    965,
+    950,
+    967,
+    968,
+    969,
+    970,
+    971,
+    972,
+    973,
+    974,
+    975,
+    975,
+    977,
+    978,
+    979,
+    980,
+    981,
+    982,
+    983,
+    984,
+    985,
+    986,
+    987,
+    988,
+    989,
+    990,
+    991,
+    992,
+    993,
+    994,
+    995,
+    996,
+    997,
+    998,
+    999,
+    1000,
+    1001,
+    1002,
+    1003,
+    1003,
+    1006,
+    1006,
+    1007,
+    1008,
+    1009,
+    1010,
+    1011,
+    1013,
+    1013,
+    1015,
+    1015,
+    1017,
+    1017,
+    1019,
+    1019,
+    1020,
+    1021,
+    1022,
+    1023,
+    1024,
+    1023,
+    1026,
+    1027,
+    1028,
+    1029,
+    1030,
+    1031,
+    1029,
+    1034,
+    1034,
+    1035,
+    1036,
+    1037,
+    1038,
+    1039,
+    1040,
+    1041,
+    1042,
+    1043,
+    1044,
+    1045,
+    1046,
+    1047,
+    1048,
+    1049,
+  ]
+
+  static let builtinIDsByGroup: [UInt16] = [
+    // .O
+    743,
+    744,
+    745,
+    746,
+    751,
+    // .codeFormatting
+    623,
+    629,
+    630,
+    668,
+    941,
+    981,
+    // .debugCrash
+    96,
+    97,
+    103,
+    104,
+    // .g
+    588,
+    597,
+    598,
+    601,
+    // .`internal`
+    // .internalDebug
+    78,
+    284,
+    285,
+    286,
+    287,
+    288,
+    290,
+    291,
+    293,
+    294,
+    295,
+    297,
+    298,
+    299,
+    300,
+    301,
+    303,
+    304,
+    305,
+    // .linkerOption
+    582,
+    662,
+    682,
+    683,
+    // .modes
+    48,
+    77,
+    95,
+    135,
+    310,
+    315,
+    319,
+    320,
+    322,
+    326,
+    339,
+    341,
+    352,
+    356,
+    357,
+    358,
+    359,
+    363,
+    383,
+    388,
+    389,
+    390,
+    395,
+    396,
+    397,
+    398,
+    402,
+    403,
+    632,
+    649,
+    658,
+    670,
+    686,
+    761,
+    777,
+    778,
+    815,
+    827,
+    852,
+    940,
+    968,
+    969,
+    // .pluginSearch
+    568,
+    673,
+    674,
+    675,
+    768,
+    // .warningTreating
+    735,
+    1026,
+    1028,
+    1036,
+  ]
+
+  static let builtinGroupRanges: [Range<Int>] = [
+    0..<5,
+    5..<11,
+    11..<15,
+    15..<19,
+    19..<19,
+    19..<38,
+    38..<42,
+    42..<84,
+    84..<89,
+    89..<93,
+  ]
+}
+
+extension Option {
+  static let driverPrefixTable = OptionPrefixTable(
+    optionIDs: [
+      1,
+      1043,
+      292,
+      605,
+      603,
+      949,
+      1004,
+      331,
+      586,
+      570,
+      584,
+      657,
+      607,
+      656,
+      682,
+      662,
+      751,
+      743,
+      744,
+      745,
+      746,
+      807,
+      808,
+      830,
+      832,
+      833,
+      835,
+      836,
+      837,
+      838,
+      839,
+      840,
+      940,
+      1028,
+      1036,
+      1037,
+      1038,
+      1039,
+      1041,
+      1040,
+      1042,
+      7,
+      6,
+      8,
+      10,
+      11,
+      12,
+      14,
+      17,
+      18,
+      20,
+      19,
+      21,
+      22,
+      23,
+      24,
+      26,
+      40,
+      47,
+      46,
+      95,
+      51,
+      52,
+      1045,
+      58,
+      59,
+      60,
+      61,
+      1048,
+      62,
+      65,
+      70,
+      72,
+      71,
+      75,
+      76,
+      78,
+      85,
+      86,
+      87,
+      88,
+      91,
+      90,
+      94,
+      106,
+      110,
+      111,
+      112,
+      117,
+      116,
+      118,
+      119,
+      126,
+      125,
+      127,
+      128,
+      129,
+      130,
+      131,
+      134,
+      135,
+      144,
+      143,
+      149,
+      150,
+      153,
+      169,
+      167,
+      168,
+      171,
+      172,
+      176,
+      178,
+      192,
+      196,
+      212,
+      213,
+      228,
+      229,
+      240,
+      259,
+      260,
+      270,
+      278,
+      282,
+      284,
+      285,
+      286,
+      287,
+      288,
+      290,
+      289,
+      291,
+      293,
+      294,
+      295,
+      296,
+      297,
+      298,
+      299,
+      300,
+      301,
+      302,
+      303,
+      304,
+      305,
+      306,
+      310,
+      309,
+      318,
+      319,
+      320,
+      322,
+      326,
+      328,
+      329,
+      569,
+      334,
+      333,
+      335,
+      338,
+      337,
+      339,
+      340,
+      341,
+      342,
+      343,
+      344,
+      346,
+      345,
+      348,
+      350,
+      349,
+      352,
+      353,
+      354,
+      356,
+      358,
+      357,
+      359,
+      362,
+      361,
+      360,
+      363,
+      380,
+      366,
+      370,
+      369,
+      372,
+      371,
+      374,
+      375,
+      376,
+      379,
+      378,
+      382,
+      381,
+      383,
+      384,
+      387,
+      386,
+      385,
+      389,
+      390,
+      391,
+      396,
+      395,
+      398,
+      397,
+      402,
+      403,
+      405,
+      404,
+      408,
+      407,
+      406,
+      410,
+      412,
+      413,
+      414,
+      415,
+      416,
+      422,
+      431,
+      432,
+      433,
+      434,
+      435,
+      437,
+      444,
+      448,
+      453,
+      456,
+      461,
+      463,
+      476,
+      477,
+      484,
+      490,
+      500,
+      504,
+      522,
+      526,
+      530,
+      535,
+      537,
+      538,
+      539,
+      540,
+      541,
+      542,
+      544,
+      546,
+      545,
+      547,
+      548,
+      552,
+      556,
+      555,
+      560,
+      559,
+      561,
+      562,
+      564,
+      566,
+      568,
+      571,
+      572,
+      576,
+      577,
+      579,
+      582,
+      601,
+      587,
+      588,
+      597,
+      598,
+      606,
+      604,
+      602,
+      658,
+      616,
+      617,
+      619,
+      620,
+      622,
+      623,
+      624,
+      625,
+      628,
+      627,
+      1049,
+      629,
+      630,
+      632,
+      631,
+      633,
+      635,
+      636,
+      637,
+      638,
+      641,
+      645,
+      646,
+      647,
+      650,
+      651,
+      654,
+      653,
+      655,
+      661,
+      683,
+      663,
+      664,
+      665,
+      667,
+      666,
+      668,
+      669,
+      670,
+      672,
+      673,
+      674,
+      675,
+      676,
+      677,
+      680,
+      681,
+      689,
+      690,
+      691,
+      694,
+      695,
+      698,
+      699,
+      700,
+      706,
+      705,
+      710,
+      709,
+      714,
+      715,
+      720,
+      722,
+      721,
+      723,
+      724,
+      728,
+      729,
+      730,
+      731,
+      732,
+      734,
+      735,
+      736,
+      737,
+      738,
+      739,
+      740,
+      741,
+      752,
+      742,
+      749,
+      748,
+      753,
+      754,
+      755,
+      761,
+      757,
+      758,
+      759,
+      760,
+      1044,
+      764,
+      1047,
+      768,
+      771,
+      773,
+      778,
+      777,
+      780,
+      781,
+      782,
+      788,
+      789,
+      791,
+      792,
+      793,
+      794,
+      795,
+      796,
+      797,
+      798,
+      799,
+      800,
+      804,
+      813,
+      814,
+      815,
+      819,
+      817,
+      818,
+      820,
+      827,
+      829,
+      1046,
+      841,
+      842,
+      843,
+      844,
+      845,
+      846,
+      850,
+      847,
+      848,
+      849,
+      851,
+      852,
+      853,
+      860,
+      857,
+      858,
+      859,
+      862,
+      861,
+      863,
+      868,
+      867,
+      866,
+      877,
+      885,
+      886,
+      906,
+      913,
+      911,
+      912,
+      914,
+      915,
+      916,
+      918,
+      917,
+      920,
+      921,
+      923,
+      929,
+      931,
+      932,
+      933,
+      934,
+      935,
+      936,
+      937,
+      939,
+      941,
+      950,
+      942,
+      943,
+      944,
+      948,
+      961,
+      962,
+      963,
+      964,
+      969,
+      970,
+      971,
+      972,
+      974,
+      978,
+      981,
+      982,
+      1009,
+      983,
+      986,
+      993,
+      994,
+      999,
+      1003,
+      1006,
+      1005,
+      1007,
+      1008,
+      1010,
+      1011,
+      1022,
+      1025,
+      1023,
+      1024,
+      1026,
+      1029,
+      1030,
+      1031,
+      1032,
+      1034,
+      1033,
+      1035,
+      0,
+    ],
+    parents: [
+      -1,
+      -1,
+      1,
+      1,
+      3,
+      1,
+      1,
+      -1,
+      -1,
+      8,
+      8,
+      -1,
+      11,
+      11,
+      -1,
+      14,
+      -1,
+      16,
+      16,
+      16,
+      16,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      38,
+      -1,
+      -1,
+      41,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      50,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      58,
+      -1,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      72,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      60,
+      81,
+      60,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      88,
+      -1,
+      -1,
+      -1,
+      92,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      101,
+      -1,
+      -1,
+      -1,
+      -1,
+      106,
+      106,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      130,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      147,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      156,
+      157,
+      156,
+      156,
+      160,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      168,
+      156,
+      156,
+      171,
+      156,
+      156,
+      156,
+      156,
+      156,
+      177,
+      156,
+      156,
+      180,
+      181,
+      156,
+      156,
+      184,
+      184,
+      186,
+      184,
+      188,
+      184,
+      184,
+      184,
+      184,
+      193,
+      156,
+      195,
+      156,
+      156,
+      156,
+      199,
+      200,
+      156,
+      156,
+      156,
+      156,
+      205,
+      156,
+      207,
+      156,
+      156,
+      156,
+      211,
+      156,
+      213,
+      214,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      156,
+      252,
+      156,
+      156,
+      156,
+      156,
+      257,
+      156,
+      259,
+      156,
+      156,
+      156,
+      156,
+      156,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      272,
+      272,
+      272,
+      272,
+      -1,
+      277,
+      278,
+      -1,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      289,
+      289,
+      280,
+      280,
+      280,
+      294,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      280,
+      307,
+      280,
+      -1,
+      -1,
+      311,
+      311,
+      311,
+      311,
+      315,
+      311,
+      311,
+      311,
+      311,
+      311,
+      311,
+      311,
+      311,
+      311,
+      311,
+      311,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      336,
+      -1,
+      338,
+      -1,
+      -1,
+      -1,
+      -1,
+      343,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      360,
+      360,
+      362,
+      -1,
+      -1,
+      -1,
+      -1,
+      367,
+      367,
+      367,
+      367,
+      371,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      378,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      399,
+      399,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      412,
+      412,
+      412,
+      -1,
+      -1,
+      -1,
+      -1,
+      419,
+      419,
+      419,
+      -1,
+      423,
+      -1,
+      -1,
+      426,
+      427,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      433,
+      433,
+      -1,
+      -1,
+      -1,
+      -1,
+      439,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      454,
+      454,
+      454,
+      454,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      471,
+      471,
+      471,
+      471,
+      471,
+      471,
+      471,
+      478,
+      471,
+      471,
+      -1,
+      -1,
+      -1,
+      -1,
+      485,
+      485,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      -1,
+      493,
+      -1,
+      -1,
+    ])
 }
 
 extension Option {
@@ -2133,55 +12881,2136 @@ extension Option {
 }
 
 extension Option.Group {
-  public var name: String {
+  var index: Int {
     switch self {
       case .O:
-        return "<optimization level options>"
+        return 0
       case .codeFormatting:
-        return "<code formatting options>"
+        return 1
       case .debugCrash:
-        return "<automatic crashing options>"
+        return 2
       case .g:
-        return "<debug info options>"
+        return 3
       case .`internal`:
-        return "<swift internal options>"
+        return 4
       case .internalDebug:
-        return "<swift debug/development internal options>"
+        return 5
       case .linkerOption:
-        return "<linker-specific options>"
+        return 6
       case .modes:
-        return "<mode options>"
+        return 7
       case .pluginSearch:
-        return "<plugin search options>"
+        return 8
       case .warningTreating:
-        return "<options to control warning treating>"
+        return 9
     }
   }
 }
 
-extension Option.Group {
-  public var helpText: String? {
-    switch self {
-      case .O:
-        return nil
-      case .codeFormatting:
-        return nil
-      case .debugCrash:
-        return nil
-      case .g:
-        return nil
-      case .`internal`:
-        return nil
-      case .internalDebug:
-        return "DEBUG/DEVELOPMENT OPTIONS"
-      case .linkerOption:
-        return nil
-      case .modes:
-        return "MODES"
-      case .pluginSearch:
-        return nil
-      case .warningTreating:
-        return nil
-    }
-  }
+extension Option {
+  static let builtinGroupNameOffsets: [UInt32] = [
+    27683,
+    27712,
+    27738,
+    27767,
+    27788,
+    27813,
+    27856,
+    27882,
+    27897,
+    27921,
+  ]
+
+  static let builtinGroupHelpTextOffsets: [UInt32] = [
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    0xffffffff,
+    84103,
+    0xffffffff,
+    84129,
+    0xffffffff,
+    0xffffffff,
+  ]
+}
+
+extension Option {
+  static let builtinStrings: StaticString = """
+    -###\0\
+    --\0\
+    --abi\0\
+    --abort-on-module-fail\0\
+    --avoid-location\0\
+    --avoid-tool-args\0\
+    --compiler-style-diags\0\
+    --debug-mapping\0\
+    --deserialize-diff\0\
+    --deserialize-sdk\0\
+    --diagnose-sdk\0\
+    --disable-fail-on-error\0\
+    --disable-os-checks\0\
+    --disable-remove-deprecated-check\0\
+    --driver-mode=\0\
+    --dump-sdk\0\
+    --empty-baseline\0\
+    --enable-remove-deprecated-check\0\
+    --error-on-abi-breakage\0\
+    --find-usr\0\
+    --generate-empty-baseline\0\
+    --generate-migration-script\0\
+    --generate-name-correction\0\
+    --help\0\
+    --help-hidden\0\
+    --ignore-spi-group\0\
+    --ignore-spi-group-new-api\0\
+    --ignored-usrs\0\
+    --input-paths\0\
+    --json\0\
+    --location\0\
+    --migrator\0\
+    --module\0\
+    --print-module\0\
+    --protocol-requirement-allow-list\0\
+    --swift-only\0\
+    --target=\0\
+    --use-interface-for-module\0\
+    --version\0\
+    -BF\0\
+    -BF=\0\
+    -BI\0\
+    -BI=\0\
+    -D\0\
+    -F\0\
+    -F=\0\
+    -Fsystem\0\
+    -I\0\
+    -I=\0\
+    -Isystem\0\
+    -L\0\
+    -L=\0\
+    -O\0\
+    -Onone\0\
+    -Oplayground\0\
+    -Osize\0\
+    -Ounchecked\0\
+    -Raccess-note\0\
+    -Raccess-note=\0\
+    -Rcache-compile-job\0\
+    -Rcross-import\0\
+    -Rdependency-scan\0\
+    -Rdependency-scan-cache\0\
+    -Rindexing-system-module\0\
+    -Rmacro-expansions\0\
+    -Rmacro-loading\0\
+    -Rmodule-api-import\0\
+    -Rmodule-interface-rebuild\0\
+    -Rmodule-loading\0\
+    -Rmodule-recovery\0\
+    -Rmodule-serialization\0\
+    -Rpass-missed=\0\
+    -Rpass=\0\
+    -Rskip-explicit-interface-build\0\
+    -S\0\
+    -Werror\0\
+    -Wwarning\0\
+    -Xcc\0\
+    -Xclang-linker\0\
+    -Xfrontend\0\
+    -Xlinker\0\
+    -Xlinker-driver\0\
+    -Xllvm\0\
+    -abi\0\
+    -abort-on-module-fail\0\
+    -access-notes-path\0\
+    -access-notes-path=\0\
+    -active-platform-availability-only\0\
+    -alias-module-names-in-module-interface\0\
+    -allow-availability-platforms\0\
+    -allow-non-resilient-access\0\
+    -allowable-client\0\
+    -always-compile-output-files\0\
+    -always-rebuild-module-dependencies\0\
+    -analyze-request-evaluator\0\
+    -analyze-requirement-machine\0\
+    -api-diff-data-dir\0\
+    -api-diff-data-file\0\
+    -application-extension\0\
+    -application-extension-library\0\
+    -assert-config\0\
+    -assume-single-threaded\0\
+    -auto-bridging-header-chaining\0\
+    -autolink-force-load\0\
+    -autolink-library\0\
+    -avoid-emit-module-source-info\0\
+    -avoid-location\0\
+    -avoid-tool-args\0\
+    -backup-module-interface-path\0\
+    -backup-module-interface-path=\0\
+    -bad-file-descriptor-retry-count\0\
+    -baseline-dir\0\
+    -baseline-path\0\
+    -block-availability-platforms\0\
+    -blocklist-file\0\
+    -breakage-allowlist-path\0\
+    -bridging-header-directory-for-print\0\
+    -bridging-header-pch-key\0\
+    -bsdk\0\
+    -build-id\0\
+    -build-id=\0\
+    -build-module-from-parseable-interface\0\
+    -bypass-batch-mode-checks\0\
+    -bypass-resilience-checks\0\
+    -c\0\
+    -cache-compile-job\0\
+    -cache-disable-replay\0\
+    -cache-replay-prefix-map\0\
+    -candidate-module-file\0\
+    -cas-backend\0\
+    -cas-backend-mode=\0\
+    -cas-emit-casid-file\0\
+    -cas-fs-escape\0\
+    -cas-path\0\
+    -cas-plugin-option\0\
+    -cas-plugin-path\0\
+    -check-api-availability-only\0\
+    -check-onone-completeness\0\
+    -checked-async-objc-bridging=\0\
+    -clang-build-session-file\0\
+    -clang-header-expose-decls=\0\
+    -clang-header-expose-module\0\
+    -clang-include-tree-filelist\0\
+    -clang-include-tree-root\0\
+    -clang-scanner-module-cache-path\0\
+    -clang-target\0\
+    -clang-target-variant\0\
+    -code-complete-call-pattern-heuristics\0\
+    -code-complete-inits-in-postfix-expr\0\
+    -color-diagnostics\0\
+    -compare-to-baseline-path\0\
+    -compile-module-from-interface\0\
+    -compiler-assertions\0\
+    -compiler-style-diags\0\
+    -concurrency-model\0\
+    -concurrency-model=\0\
+    -conditional-runtime-records\0\
+    -const-gather-protocols-file\0\
+    -const-gather-protocols-list\0\
+    -continue-building-after-errors\0\
+    -coverage-prefix-map\0\
+    -cross-module-optimization\0\
+    -crosscheck-unqualified-lookup\0\
+    -cs-profile-generate\0\
+    -cs-profile-generate=\0\
+    -cxx-interop-getters-setters-as-properties\0\
+    -cxx-interop-use-opaque-pointer-for-moveonly\0\
+    -cxx-interoperability-mode=\0\
+    -debug-assert-after-parse\0\
+    -debug-assert-immediately\0\
+    -debug-callsite-info\0\
+    -debug-constraints\0\
+    -debug-constraints-attempt\0\
+    -debug-constraints-on-line\0\
+    -debug-constraints-on-line=\0\
+    -debug-crash-after-parse\0\
+    -debug-crash-immediately\0\
+    -debug-cycles\0\
+    -debug-diagnostic-names\0\
+    -debug-emit-invalid-swiftinterface-syntax\0\
+    -debug-forbid-typecheck-prefix\0\
+    -debug-generic-signatures\0\
+    -debug-info-for-profiling\0\
+    -debug-info-format=\0\
+    -debug-info-store-invocation\0\
+    -debug-inverse-requirements\0\
+    -debug-mapping\0\
+    -debug-module-path\0\
+    -debug-module-path=\0\
+    -debug-module-self-key\0\
+    -debug-prefix-map\0\
+    -debug-requirement-machine=\0\
+    -debug-time-expression-type-checking\0\
+    -debug-time-function-bodies\0\
+    -debugger-support\0\
+    -debugger-testing-transform\0\
+    -default-isolation\0\
+    -default-isolation=\0\
+    -define-always-enabled-availability-domain\0\
+    -define-availability\0\
+    -define-disabled-availability-domain\0\
+    -define-dynamic-availability-domain\0\
+    -define-enabled-availability-domain\0\
+    -dependency-only-import\0\
+    -dependency-scan-cache-path\0\
+    -dependency-scan-serialize-diagnostics-path\0\
+    -deprecated-integrated-repl\0\
+    -deserialize-diff\0\
+    -deserialize-sdk\0\
+    -diagnose-sdk\0\
+    -diagnostic-documentation-path\0\
+    -diagnostic-style\0\
+    -diagnostic-style=\0\
+    -diagnostics-assert-on-error\0\
+    -diagnostics-assert-on-group\0\
+    -diagnostics-assert-on-warning\0\
+    -diagnostics-editor-mode\0\
+    -digester-breakage-allowlist-path\0\
+    -digester-mode\0\
+    -direct-clang-cc1-module-build\0\
+    -disable-access-control\0\
+    -disable-actor-data-race-checks\0\
+    -disable-address-dependencies\0\
+    -disable-aggressive-reg2mem\0\
+    -disable-alias-module-names-in-module-interface\0\
+    -disable-all-autolinking\0\
+    -disable-arc-opts\0\
+    -disable-arm64-corocc\0\
+    -disable-assembly-vision-all\0\
+    -disable-ast-verifier\0\
+    -disable-async-frame-pointer-all\0\
+    -disable-async-frame-push-pop-metadata\0\
+    -disable-autolink-framework\0\
+    -disable-autolink-frameworks\0\
+    -disable-autolink-library\0\
+    -disable-autolinking-runtime-compatibility\0\
+    -disable-autolinking-runtime-compatibility-concurrency\0\
+    -disable-autolinking-runtime-compatibility-dynamic-replacements\0\
+    -disable-availability-checking\0\
+    -disable-batch-mode\0\
+    -disable-bridging-pch\0\
+    -disable-building-interface\0\
+    -disable-callee-allocated-coro-abi\0\
+    -disable-clang-spi\0\
+    -disable-clang-target\0\
+    -disable-clangimporter-source-import\0\
+    -disable-cmo\0\
+    -disable-collocate-metadata-functions\0\
+    -disable-colocate-type-descriptors\0\
+    -disable-concrete-type-metadata-mangled-name-accessors\0\
+    -disable-cond-fail-message-annotation\0\
+    -disable-const-value-importing\0\
+    -disable-cross-import-overlay-search\0\
+    -disable-cross-import-overlays\0\
+    -disable-cxx-interop-requirement-at-import\0\
+    -disable-debugger-shadow-copies\0\
+    -disable-deserialization-recovery\0\
+    -disable-deserialization-safety\0\
+    -disable-diagnostic-passes\0\
+    -disable-direct-retain-release\0\
+    -disable-dynamic-actor-isolation\0\
+    -disable-emit-generic-class-ro_t-list\0\
+    -disable-emit-type-malloc-for-coro-frame\0\
+    -disable-experimental-clang-importer-diagnostics\0\
+    -disable-experimental-feature\0\
+    -disable-experimental-lifetime-dependence-inference\0\
+    -disable-experimental-opened-existential-types\0\
+    -disable-experimental-parser-round-trip\0\
+    -disable-experimental-string-processing\0\
+    -disable-fail-on-error\0\
+    -disable-fine-module-tracing\0\
+    -disable-force-load-symbols\0\
+    -disable-fragile-relative-protocol-tables\0\
+    -disable-generic-metadata-prespecialization\0\
+    -disable-implicit-concurrency-module-import\0\
+    -disable-implicit-cxx-module-import\0\
+    -disable-implicit-string-processing-module-import\0\
+    -disable-implicit-swift-modules\0\
+    -disable-import-ptrauth-field-function-pointers\0\
+    -disable-incremental-file-hashing\0\
+    -disable-incremental-imports\0\
+    -disable-incremental-llvm-codegen\0\
+    -disable-infer-public-sendable\0\
+    -disable-interface-lock\0\
+    -disable-invalid-ephemeralness-as-error\0\
+    -disable-large-loadable-types-reg2mem\0\
+    -disable-layout-string-value-witnesses\0\
+    -disable-layout-string-value-witnesses-instantiation\0\
+    -disable-legacy-type-info\0\
+    -disable-lifetime-dependence-diagnostics\0\
+    -disable-llvm-merge-functions-pass\0\
+    -disable-llvm-optzns\0\
+    -disable-llvm-value-names\0\
+    -disable-llvm-verify\0\
+    -disable-llvm-verify-each\0\
+    -disable-migrator-fixits\0\
+    -disable-module-selectors-in-module-interface\0\
+    -disable-modules-validate-system-headers\0\
+    -disable-named-lazy-import-as-member-loading\0\
+    -disable-new-llvm-pass-manager\0\
+    -disable-new-operator-lookup\0\
+    -disable-nonfrozen-enum-exhaustivity-diagnostics\0\
+    -disable-noreturn-prediction\0\
+    -disable-nskeyedarchiver-diagnostics\0\
+    -disable-objc-attr-requires-foundation-module\0\
+    -disable-objc-interop\0\
+    -disable-objective-c-protocol-symbolic-references\0\
+    -disable-only-one-dependency-file\0\
+    -disable-os-checks\0\
+    -disable-ossa-opts\0\
+    -disable-playground-transform\0\
+    -disable-preallocated-instantiation-caches\0\
+    -disable-previous-implementation-calls-in-dynamic-replacements\0\
+    -disable-print-missing-imports-in-module-interface\0\
+    -disable-profiling-marker-thunks\0\
+    -disable-readonly-static-objects\0\
+    -disable-reflection-metadata\0\
+    -disable-reflection-names\0\
+    -disable-relative-protocol-witness-tables\0\
+    -disable-remove-deprecated-check\0\
+    -disable-requirement-machine-concrete-contraction\0\
+    -disable-requirement-machine-loop-normalization\0\
+    -disable-requirement-machine-reuse\0\
+    -disable-round-trip-debug-types\0\
+    -disable-safe-interop-wrappers\0\
+    -disable-sandbox\0\
+    -disable-sending-args-and-results-with-region-based-isolation\0\
+    -disable-sil-opaque-values\0\
+    -disable-sil-ownership-verifier\0\
+    -disable-sil-partial-apply\0\
+    -disable-sil-perf-optzns\0\
+    -disable-split-cold-code\0\
+    -disable-stack-protector\0\
+    -disable-standard-substitutions-in-reflection-mangling\0\
+    -disable-subst-sil-function-types\0\
+    -disable-swift-bridge-attr\0\
+    -disable-swift-specific-llvm-optzns\0\
+    -disable-swift3-objc-inference\0\
+    -disable-target-os-checking\0\
+    -disable-testable-attr-requires-testable-module\0\
+    -disable-throws-prediction\0\
+    -disable-type-layout\0\
+    -disable-typo-correction\0\
+    -disable-upcoming-feature\0\
+    -disable-verify-exclusivity\0\
+    -disable-workaround-broken-modules\0\
+    -disable-x86_64-corocc\0\
+    -disallow-use-new-driver\0\
+    -downgrade-typecheck-interface-error\0\
+    -driver-always-rebuild-dependents\0\
+    -driver-batch-count\0\
+    -driver-batch-seed\0\
+    -driver-batch-size-limit\0\
+    -driver-emit-fine-grained-dependency-dot-file-after-every-import\0\
+    -driver-filelist-threshold\0\
+    -driver-filelist-threshold=\0\
+    -driver-force-response-files\0\
+    -driver-print-actions\0\
+    -driver-print-bindings\0\
+    -driver-print-derived-output-file-map\0\
+    -driver-print-graphviz\0\
+    -driver-print-jobs\0\
+    -driver-print-output-file-map\0\
+    -driver-show-incremental\0\
+    -driver-show-job-lifecycle\0\
+    -driver-skip-execution\0\
+    -driver-time-compilation\0\
+    -driver-use-filelists\0\
+    -driver-use-frontend-path\0\
+    -driver-verify-fine-grained-dependency-graph-after-every-import\0\
+    -driver-warn-unused-options\0\
+    -dump-abstract-layout\0\
+    -dump-api-path\0\
+    -dump-ast\0\
+    -dump-ast-format\0\
+    -dump-availability-scopes\0\
+    -dump-clang-diagnostics\0\
+    -dump-clang-lookup-tables\0\
+    -dump-hidden-type-layouts\0\
+    -dump-interface-hash\0\
+    -dump-jit\0\
+    -dump-macro-expansions\0\
+    -dump-migration-states-dir\0\
+    -dump-parse\0\
+    -dump-pcm\0\
+    -dump-requirement-machine\0\
+    -dump-scope-maps\0\
+    -dump-sdk\0\
+    -dump-source-file-imports\0\
+    -dump-type-info\0\
+    -dump-type-witness-systems\0\
+    -dump-usr\0\
+    -dwarf-version=\0\
+    -dynamic-member-lookup-depth-limit=\0\
+    -e\0\
+    -eager-macro-checking\0\
+    -embed-bitcode\0\
+    -embed-bitcode-marker\0\
+    -embed-tbd-for-module\0\
+    -emit-abi-descriptor-path\0\
+    -emit-api-descriptor\0\
+    -emit-api-descriptor-path\0\
+    -emit-assembly\0\
+    -emit-ast\0\
+    -emit-bc\0\
+    -emit-clang-header-min-access\0\
+    -emit-clang-header-nonmodular-includes\0\
+    -emit-clang-header-path\0\
+    -emit-const-values\0\
+    -emit-const-values-path\0\
+    -emit-dependencies\0\
+    -emit-dependencies-path\0\
+    -emit-digester-baseline\0\
+    -emit-digester-baseline-path\0\
+    -emit-empty-object-file\0\
+    -emit-executable\0\
+    -emit-extension-block-symbols\0\
+    -emit-fine-grained-dependency-sourcefile-dot-files\0\
+    -emit-fixits-path\0\
+    -emit-imported-modules\0\
+    -emit-ir\0\
+    -emit-irgen\0\
+    -emit-library\0\
+    -emit-loaded-module-trace\0\
+    -emit-loaded-module-trace-path\0\
+    -emit-loaded-module-trace-path=\0\
+    -emit-lowered-sil\0\
+    -emit-macro-expansion-files\0\
+    -emit-migrated-file-path\0\
+    -emit-module\0\
+    -emit-module-dependencies-path\0\
+    -emit-module-doc\0\
+    -emit-module-doc-path\0\
+    -emit-module-interface\0\
+    -emit-module-interface-path\0\
+    -emit-module-path\0\
+    -emit-module-path=\0\
+    -emit-module-semantic-info-path\0\
+    -emit-module-separately-wmo\0\
+    -emit-module-serialize-diagnostics-path\0\
+    -emit-module-source-info\0\
+    -emit-module-source-info-path\0\
+    -emit-module-summary\0\
+    -emit-module-summary-path\0\
+    -emit-objc-header\0\
+    -emit-objc-header-path\0\
+    -emit-object\0\
+    -emit-package-module-interface-path\0\
+    -emit-parse\0\
+    -emit-parseable-module-interface\0\
+    -emit-parseable-module-interface-path\0\
+    -emit-pch\0\
+    -emit-pcm\0\
+    -emit-polyglot-ast\0\
+    -emit-private-module-interface-path\0\
+    -emit-reference-dependencies\0\
+    -emit-reference-dependencies-path\0\
+    -emit-remap-file-path\0\
+    -emit-sib\0\
+    -emit-sibgen\0\
+    -emit-sil\0\
+    -emit-silgen\0\
+    -emit-singleton-metadata-pointer\0\
+    -emit-sorted-sil\0\
+    -emit-stack-promotion-checks\0\
+    -emit-supported-arguments\0\
+    -emit-supported-features\0\
+    -emit-symbol-graph\0\
+    -emit-symbol-graph-dir\0\
+    -emit-tbd\0\
+    -emit-tbd-path\0\
+    -emit-tbd-path=\0\
+    -emit-variant-abi-descriptor-path\0\
+    -emit-variant-api-descriptor-path\0\
+    -emit-variant-module-doc-path\0\
+    -emit-variant-module-interface-path\0\
+    -emit-variant-module-path\0\
+    -emit-variant-module-source-info-path\0\
+    -emit-variant-package-module-interface-path\0\
+    -emit-variant-private-module-interface-path\0\
+    -emit-verbose-sil\0\
+    -empty-abi-descriptor\0\
+    -empty-baseline\0\
+    -enable-access-control\0\
+    -enable-actor-data-race-checks\0\
+    -enable-address-dependencies\0\
+    -enable-aggressive-reg2mem\0\
+    -enable-anonymous-context-mangled-names\0\
+    -enable-arm64-corocc\0\
+    -enable-assembly-vision-all\0\
+    -enable-ast-verifier\0\
+    -enable-async-frame-pointer-all\0\
+    -enable-async-frame-push-pop-metadata\0\
+    -enable-autolinking-runtime-compatibility-bytecode-layouts\0\
+    -enable-bare-slash-regex\0\
+    -enable-batch-mode\0\
+    -enable-bridging-pch\0\
+    -enable-builtin-module\0\
+    -enable-callee-allocated-coro-abi\0\
+    -enable-cmo-everything\0\
+    -enable-collocate-metadata-functions\0\
+    -enable-colocate-type-descriptors\0\
+    -enable-cond-fail-message-annotation\0\
+    -enable-copy-propagation\0\
+    -enable-copy-propagation=\0\
+    -enable-cross-import-overlays\0\
+    -enable-default-cmo\0\
+    -enable-deserialization-recovery\0\
+    -enable-deserialization-safety\0\
+    -enable-destroy-hoisting=\0\
+    -enable-deterministic-check\0\
+    -enable-direct-retain-release\0\
+    -enable-dynamic-replacement-chaining\0\
+    -enable-emit-generic-class-ro_t-list\0\
+    -enable-emit-type-malloc-for-coro-frame\0\
+    -enable-experimental-additive-arithmetic-derivation\0\
+    -enable-experimental-async-demotion\0\
+    -enable-experimental-async-top-level\0\
+    -enable-experimental-concise-pound-file\0\
+    -enable-experimental-concurrency\0\
+    -enable-experimental-cxx-interop\0\
+    -enable-experimental-distributed\0\
+    -enable-experimental-eager-clang-module-diagnostics\0\
+    -enable-experimental-feature\0\
+    -enable-experimental-flow-sensitive-concurrent-captures\0\
+    -enable-experimental-forward-mode-differentiation\0\
+    -enable-experimental-lifetime-dependence-inference\0\
+    -enable-experimental-move-only\0\
+    -enable-experimental-named-opaque-types\0\
+    -enable-experimental-opaque-type-erasure\0\
+    -enable-experimental-opened-existential-types\0\
+    -enable-experimental-pairwise-build-block\0\
+    -enable-experimental-static-assert\0\
+    -enable-experimental-string-processing\0\
+    -enable-explicit-existential-types\0\
+    -enable-fragile-relative-protocol-tables\0\
+    -enable-implicit-dynamic\0\
+    -enable-import-ptrauth-field-function-pointers\0\
+    -enable-incremental-file-hashing\0\
+    -enable-incremental-imports\0\
+    -enable-invalid-ephemeralness-as-error\0\
+    -enable-large-loadable-types-reg2mem\0\
+    -enable-layout-string-value-witnesses\0\
+    -enable-layout-string-value-witnesses-instantiation\0\
+    -enable-lexical-lifetimes\0\
+    -enable-lexical-lifetimes=\0\
+    -enable-library-evolution\0\
+    -enable-lifetime-dependence-diagnostics\0\
+    -enable-llvm-value-names\0\
+    -enable-llvm-verify-each\0\
+    -enable-llvm-vfe\0\
+    -enable-llvm-wme\0\
+    -enable-module-selectors-in-module-interface\0\
+    -enable-move-inout-stack-protector\0\
+    -enable-new-llvm-pass-manager\0\
+    -enable-new-operator-lookup\0\
+    -enable-nonfrozen-enum-exhaustivity-diagnostics\0\
+    -enable-noreturn-prediction\0\
+    -enable-nskeyedarchiver-diagnostics\0\
+    -enable-objc-attr-requires-foundation-module\0\
+    -enable-objc-interop\0\
+    -enable-objective-c-protocol-symbolic-references\0\
+    -enable-only-one-dependency-file\0\
+    -enable-ossa-modules\0\
+    -enable-pack-metadata-stack-promotion\0\
+    -enable-pack-metadata-stack-promotion=\0\
+    -enable-private-imports\0\
+    -enable-profiling-marker-thunks\0\
+    -enable-recompilation-to-ossa-module\0\
+    -enable-relative-protocol-witness-tables\0\
+    -enable-remove-deprecated-check\0\
+    -enable-requirement-machine-opaque-archetypes\0\
+    -enable-resilience\0\
+    -enable-round-trip-debug-types\0\
+    -enable-sil-opaque-values\0\
+    -enable-single-module-llvm-emission\0\
+    -enable-source-import\0\
+    -enable-spec-devirt\0\
+    -enable-split-cold-code\0\
+    -enable-stack-protector\0\
+    -enable-swift3-objc-inference\0\
+    -enable-target-os-checking\0\
+    -enable-testable-attr-requires-testable-module\0\
+    -enable-testing\0\
+    -enable-throw-without-try\0\
+    -enable-throws-prediction\0\
+    -enable-type-layout\0\
+    -enable-upcoming-feature\0\
+    -enable-verify-exclusivity\0\
+    -enable-volatile-modules\0\
+    -enable-x86_64-corocc\0\
+    -enforce-exclusivity=\0\
+    -entry-point-function-name\0\
+    -error-on-abi-breakage\0\
+    -experimental-allow-module-with-compiler-errors\0\
+    -experimental-allow-non-resilient-access\0\
+    -experimental-allowed-reexported-modules=\0\
+    -experimental-c-foreign-reference-types\0\
+    -experimental-clang-importer-direct-cc1-scan\0\
+    -experimental-emit-module-separately\0\
+    -experimental-emit-variant-module\0\
+    -experimental-explicit-module-build\0\
+    -experimental-hermetic-seal-at-link\0\
+    -experimental-lazy-typecheck\0\
+    -experimental-package-bypass-resilience\0\
+    -experimental-package-cmo\0\
+    -experimental-package-cmo-abort-on-deserialization-fail\0\
+    -experimental-package-interface-load\0\
+    -experimental-performance-annotations\0\
+    -experimental-platform-c-calling-convention\0\
+    -experimental-platform-c-calling-convention=\0\
+    -experimental-print-full-convention\0\
+    -experimental-serialize-debug-info\0\
+    -experimental-skip-all-function-bodies\0\
+    -experimental-skip-non-exportable-decls\0\
+    -experimental-skip-non-inlinable-function-bodies\0\
+    -experimental-skip-non-inlinable-function-bodies-without-types\0\
+    -experimental-spi-imports\0\
+    -experimental-spi-only-imports\0\
+    -explain-module-dependency\0\
+    -explain-module-dependency-detailed\0\
+    -explicit-auto-linking\0\
+    -explicit-dependency-graph-format=\0\
+    -explicit-interface-module-build\0\
+    -explicit-module-build\0\
+    -explicit-swift-module-map-file\0\
+    -export-as\0\
+    -external-pass-pipeline-filename\0\
+    -external-plugin-path\0\
+    -file-compilation-dir\0\
+    -file-prefix-map\0\
+    -filelist\0\
+    -find-usr\0\
+    -fine-grained-timers\0\
+    -fixit-all\0\
+    -force-public-linkage\0\
+    -force-single-frontend-invocation\0\
+    -force-struct-type-layouts\0\
+    -formal-cxx-interoperability-mode=\0\
+    -framework\0\
+    -frontend-parseable-output\0\
+    -function-sections\0\
+    -g\0\
+    -gcc-toolchain\0\
+    -gdwarf-types\0\
+    -gen-reproducer\0\
+    -gen-reproducer-dir\0\
+    -generate-empty-baseline\0\
+    -generate-migration-script\0\
+    -generate-name-correction\0\
+    -gline-tables-only\0\
+    -gnone\0\
+    -group-info-path\0\
+    -gsil\0\
+    -h\0\
+    -help\0\
+    -help-hidden\0\
+    -i\0\
+    -ignore-always-inline\0\
+    -ignore-module-source-info\0\
+    -ignore-spi-group\0\
+    -ignore-spi-group-new-api\0\
+    -ignored-usrs\0\
+    -import-bridging-header\0\
+    -import-cf-types\0\
+    -import-module\0\
+    -import-objc-header\0\
+    -import-pch\0\
+    -import-prescan\0\
+    -import-underlying-module\0\
+    -in-place\0\
+    -in-process-plugin-server-path\0\
+    -include-spi-symbols\0\
+    -include-submodules\0\
+    -incremental\0\
+    -incremental-dependency-scan\0\
+    -indent-switch-case\0\
+    -indent-width\0\
+    -index-file\0\
+    -index-file-path\0\
+    -index-ignore-clang-modules\0\
+    -index-ignore-stdlib\0\
+    -index-ignore-system-modules\0\
+    -index-include-locals\0\
+    -index-store-compress\0\
+    -index-store-path\0\
+    -index-system-modules\0\
+    -index-unit-output-path\0\
+    -index-unit-output-path-filelist\0\
+    -input-file-key\0\
+    -input-paths\0\
+    -interface-compiler-version\0\
+    -internal-import-bridging-header\0\
+    -internal-import-pch\0\
+    -internalize-at-link\0\
+    -interpret\0\
+    -ipi-clang-module\0\
+    -ir-output-dir\0\
+    -ir-output-path\0\
+    -ir-profile-generate\0\
+    -ir-profile-generate=\0\
+    -ir-profile-use=\0\
+    -j\0\
+    -json\0\
+    -l\0\
+    -language-mode\0\
+    -ld-path=\0\
+    -libc\0\
+    -library-level\0\
+    -library-level=\0\
+    -line-range\0\
+    -link-objc-runtime\0\
+    -lldb-repl\0\
+    -load-dependency-scan-cache\0\
+    -load-pass-plugin=\0\
+    -load-plugin-executable\0\
+    -load-plugin-library\0\
+    -load-resolved-plugin\0\
+    -locale\0\
+    -localization-path\0\
+    -location\0\
+    -lto-library\0\
+    -lto=\0\
+    -max-substitution-count=\0\
+    -max-substitution-depth=\0\
+    -merge-modules\0\
+    -mergeable-symbols\0\
+    -mergeable-traps\0\
+    -migrate-keep-objc-visibility\0\
+    -migrator\0\
+    -migrator-update-sdk\0\
+    -migrator-update-swift\0\
+    -min-runtime-version\0\
+    -min-swift-runtime-version\0\
+    -min-valid-pointer-value=\0\
+    -minimum-access-level\0\
+    -module\0\
+    -module-abi-name\0\
+    -module-alias\0\
+    -module-cache-path\0\
+    -module-can-import\0\
+    -module-can-import-version\0\
+    -module-import-from-cas\0\
+    -module-interface-preserve-types-as-written\0\
+    -module-link-name\0\
+    -module-link-name=\0\
+    -module-list-file\0\
+    -module-load-mode\0\
+    -module-name\0\
+    -module-name=\0\
+    -new-driver-path\0\
+    -no-allocations\0\
+    -no-auto-bridging-header-chaining\0\
+    -no-cache-compile-job\0\
+    -no-clang-include-tree\0\
+    -no-clang-module-breadcrumbs\0\
+    -no-clang-scanner-instance-sharing\0\
+    -no-color-diagnostics\0\
+    -no-emit-module-separately\0\
+    -no-emit-module-separately-wmo\0\
+    -no-explicit-module-build\0\
+    -no-link-objc-runtime\0\
+    -no-parallel-scan\0\
+    -no-scanner-module-validation\0\
+    -no-serialize-debugging-options\0\
+    -no-static-executable\0\
+    -no-static-stdlib\0\
+    -no-stdlib-rpath\0\
+    -no-strict-implicit-module-context\0\
+    -no-toolchain-stdlib-rpath\0\
+    -no-verbose-asm\0\
+    -no-verify-emitted-module-interface\0\
+    -no-warnings-as-errors\0\
+    -no-whole-module-optimization\0\
+    -nonlib-dependency-scanner\0\
+    -nostartfiles\0\
+    -nostdimport\0\
+    -nostdlibimport\0\
+    -num-threads\0\
+    -o\0\
+    -omit-extension-block-symbols\0\
+    -output-dir\0\
+    -output-file-map\0\
+    -output-file-map=\0\
+    -output-filelist\0\
+    -package-cmo\0\
+    -package-description-version\0\
+    -package-name\0\
+    -parallel-scan\0\
+    -parse\0\
+    -parse-as-library\0\
+    -parse-sil\0\
+    -parse-stdlib\0\
+    -parseable-output\0\
+    -pc-macro\0\
+    -pch-disable-validation\0\
+    -pch-output-dir\0\
+    -playground\0\
+    -playground-high-performance\0\
+    -playground-option\0\
+    -plugin-path\0\
+    -prebuilt-module-cache-path\0\
+    -prebuilt-module-cache-path=\0\
+    -prefix-serialized-debugging-options\0\
+    -prespecialize-generic-metadata\0\
+    -pretty-print\0\
+    -previous-module-installname-map-file\0\
+    -primary-file\0\
+    -primary-filelist\0\
+    -print-ast\0\
+    -print-ast-decl\0\
+    -print-clang-stats\0\
+    -print-diagnostic-groups\0\
+    -print-educational-notes\0\
+    -print-explicit-dependency-graph\0\
+    -print-fully-qualified-types\0\
+    -print-inst-counts\0\
+    -print-llvm-inline-tree\0\
+    -print-module\0\
+    -print-preprocessed-explicit-dependency-graph\0\
+    -print-static-build-config\0\
+    -print-stats\0\
+    -print-supported-features\0\
+    -print-target-info\0\
+    -print-zero-stats\0\
+    -profile-coverage-mapping\0\
+    -profile-generate\0\
+    -profile-sample-use=\0\
+    -profile-stats-entities\0\
+    -profile-stats-events\0\
+    -profile-use=\0\
+    -project-name\0\
+    -protocol-requirement-allow-list\0\
+    -public-autolink-library\0\
+    -public-module-name\0\
+    -read-legacy-type-info-path=\0\
+    -reflection-metadata-for-debugger-only\0\
+    -register-module-dependency\0\
+    -remove-runtime-asserts\0\
+    -repl\0\
+    -report-errors-to-debugger\0\
+    -require-explicit-availability\0\
+    -require-explicit-availability-target\0\
+    -require-explicit-availability=\0\
+    -require-explicit-sendable\0\
+    -requirement-machine-max-concrete-nesting=\0\
+    -requirement-machine-max-concrete-size=\0\
+    -requirement-machine-max-rule-count=\0\
+    -requirement-machine-max-rule-length=\0\
+    -requirement-machine-max-split-concrete-equiv-class-attempts=\0\
+    -requirement-machine-max-type-differences=\0\
+    -resolve-imports\0\
+    -resolved-plugin-verification\0\
+    -resource-dir\0\
+    -runtime-compatibility-version\0\
+    -sanitize-address-use-odr-indicator\0\
+    -sanitize-coverage=\0\
+    -sanitize-recover=\0\
+    -sanitize-stable-abi\0\
+    -sanitize=\0\
+    -save-optimization-record\0\
+    -save-optimization-record-passes\0\
+    -save-optimization-record-path\0\
+    -save-optimization-record=\0\
+    -save-temps\0\
+    -scan-dependencies\0\
+    -scanner-cas-fs\0\
+    -scanner-debug-write-output\0\
+    -scanner-module-validation\0\
+    -scanner-output-dir\0\
+    -scanner-prefix-map\0\
+    -scanner-prefix-map-paths\0\
+    -scanner-prefix-map-sdk\0\
+    -scanner-prefix-map-toolchain\0\
+    -sdk\0\
+    -sdk-module-cache-path\0\
+    -serialize-breaking-changes-path\0\
+    -serialize-debugging-options\0\
+    -serialize-dependency-scan-cache\0\
+    -serialize-diagnostics\0\
+    -serialize-diagnostics-path\0\
+    -serialize-diagnostics-path=\0\
+    -serialize-module-interface-dependency-hashes\0\
+    -serialize-parseable-module-interface-dependency-hashes\0\
+    -serialized-path-obfuscate\0\
+    -show-diagnostics-after-fatal\0\
+    -sil-based-debuginfo\0\
+    -sil-debug-serialization\0\
+    -sil-inline-caller-benefit-reduction-factor\0\
+    -sil-inline-threshold\0\
+    -sil-output-dir\0\
+    -sil-output-path\0\
+    -sil-ownership-verify-all\0\
+    -sil-region-isolation-assert-on-unknown-pattern\0\
+    -sil-stop-optzns-before-lowering-ownership\0\
+    -sil-unroll-threshold\0\
+    -sil-verify-all\0\
+    -sil-verify-none\0\
+    -skip-inherited-docs\0\
+    -skip-protocol-implementations\0\
+    -skip-synthesized-members\0\
+    -solver-disable-binding-optimizations\0\
+    -solver-disable-crash-on-valid-salvage\0\
+    -solver-disable-optimize-operator-defaults\0\
+    -solver-disable-performance-hacks\0\
+    -solver-disable-prepared-overloads\0\
+    -solver-disable-prune-disjunctions\0\
+    -solver-disable-splitter\0\
+    -solver-disable-transitive-conformance\0\
+    -solver-enable-binding-optimizations\0\
+    -solver-enable-crash-on-valid-salvage\0\
+    -solver-enable-optimize-operator-defaults\0\
+    -solver-enable-performance-hacks\0\
+    -solver-enable-prepared-overloads\0\
+    -solver-enable-prune-disjunctions\0\
+    -solver-enable-transitive-conformance\0\
+    -solver-expression-time-threshold=\0\
+    -solver-memory-threshold=\0\
+    -solver-scope-threshold=\0\
+    -solver-shrink-unsolved-threshold\0\
+    -solver-shuffle-choices=\0\
+    -solver-shuffle-disjunctions=\0\
+    -solver-trail-threshold=\0\
+    -stack-promotion-limit\0\
+    -static\0\
+    -static-executable\0\
+    -static-stdlib\0\
+    -stats-output-dir\0\
+    -strict-concurrency=\0\
+    -strict-implicit-module-context\0\
+    -strict-memory-safety\0\
+    -strict-memory-safety:migrate\0\
+    -supplementary-output-file-map\0\
+    -suppress-notes\0\
+    -suppress-remarks\0\
+    -suppress-static-exclusivity-swap\0\
+    -suppress-warnings\0\
+    -swift-async-frame-pointer=\0\
+    -swift-module-cross-import\0\
+    -swift-module-file=\0\
+    -swift-only\0\
+    -swift-version\0\
+    -switch-checking-invocation-threshold=\0\
+    -symbol-graph-allow-availability-platforms\0\
+    -symbol-graph-block-availability-platforms\0\
+    -symbol-graph-minimum-access-level\0\
+    -symbol-graph-pretty-print\0\
+    -symbol-graph-shorten-output-names\0\
+    -symbol-graph-skip-inherited-docs\0\
+    -symbol-graph-skip-synthesized-members\0\
+    -synthesize-interface-show=\0\
+    -sysroot\0\
+    -tab-width\0\
+    -target\0\
+    -target-arch-variant\0\
+    -target-cpu\0\
+    -target-min-inlining-version\0\
+    -target-sdk-name\0\
+    -target-sdk-version\0\
+    -target-variant\0\
+    -target-variant-sdk-version\0\
+    -tbd-compatibility-version\0\
+    -tbd-compatibility-version=\0\
+    -tbd-current-version\0\
+    -tbd-current-version=\0\
+    -tbd-install_name\0\
+    -tbd-install_name=\0\
+    -tbd-is-installapi\0\
+    -test-dependency-scan-cache-serialization\0\
+    -testable-import-module\0\
+    -throws-as-traps\0\
+    -toolchain-stdlib-rpath\0\
+    -tools-directory\0\
+    -trace-stats-events\0\
+    -track-system-dependencies\0\
+    -trap-function\0\
+    -triple\0\
+    -type-info-dump-filter=\0\
+    -typecheck\0\
+    -typecheck-module-from-interface\0\
+    -typo-correction-limit\0\
+    -unavailable-decl-optimization=\0\
+    -update-code\0\
+    -use-clang-function-types\0\
+    -use-frontend-parseable-output\0\
+    -use-interface-for-module\0\
+    -use-jit\0\
+    -use-ld=\0\
+    -use-malloc\0\
+    -use-static-resource-dir\0\
+    -use-tabs\0\
+    -user-module-version\0\
+    -v\0\
+    -validate-clang-modules-once\0\
+    -validate-prior-dependency-scan-cache\0\
+    -validate-tbd-against-ir=\0\
+    -value-recursion-threshold\0\
+    -verbose-asm\0\
+    -verify\0\
+    -verify-additional-file\0\
+    -verify-additional-prefix\0\
+    -verify-all-substitution-maps\0\
+    -verify-apply-fixes\0\
+    -verify-child-notes\0\
+    -verify-debug-info\0\
+    -verify-emitted-module-interface\0\
+    -verify-generic-signatures\0\
+    -verify-ignore-macro-note\0\
+    -verify-ignore-unknown\0\
+    -verify-ignore-unrelated\0\
+    -verify-incremental-dependencies\0\
+    -verify-type-layout\0\
+    -version\0\
+    -version-independent-apinotes\0\
+    -vfsoverlay\0\
+    -vfsoverlay=\0\
+    -visualc-tools-root\0\
+    -visualc-tools-version\0\
+    -warn-concurrency\0\
+    -warn-implicit-overrides\0\
+    -warn-long-expression-type-checking\0\
+    -warn-long-expression-type-checking-scopes\0\
+    -warn-long-expression-type-checking-scopes=\0\
+    -warn-long-expression-type-checking-trail\0\
+    -warn-long-expression-type-checking-trail=\0\
+    -warn-long-expression-type-checking=\0\
+    -warn-long-function-bodies\0\
+    -warn-long-function-bodies=\0\
+    -warn-on-editor-placeholder\0\
+    -warn-on-potentially-unavailable-enum-case\0\
+    -warn-soft-deprecated\0\
+    -warn-swift3-objc-inference\0\
+    -warn-swift3-objc-inference-complete\0\
+    -warn-swift3-objc-inference-minimal\0\
+    -warnings-as-errors\0\
+    -weak-link-at-target\0\
+    -whole-module-optimization\0\
+    -windows-sdk-root\0\
+    -windows-sdk-version\0\
+    -wmo\0\
+    -working-directory\0\
+    -working-directory=\0\
+    -write-output-hash-xattr\0\
+    <input>\0\
+    <platforms>\0\
+    <vers>\0\
+    <path>\0\
+    <build-id>\0\
+    <prefix> <replacement>\0\
+    native|casid|verify\0\
+    <name>=<option>\0\
+    all-public|has-expose-attr\0\
+    <imported-module-name>=<generated-header-name>\0\
+    <cas-id>\0\
+    standard|task-to-thread\0\
+    <prefix=replacement>\0\
+    <directory>\0\
+    <line>\0\
+    MainActor|nonisolated\0\
+    <domain>\0\
+    <macro>\0\
+    <style>\0\
+    <diagnostic_group>\0\
+    <api|abi>\0\
+    <n>\0\
+    <format>\0\
+    <expanded-or-list-of-line:column>\0\
+    <version>\0\
+    <access-level>\0\
+    <dir>\0\
+    always|optimizing|requested-passes-only|false\0\
+    true|false\0\
+    <enforcement>\0\
+    <string>\0\
+    <pass_pipeline_file>\0\
+    <path>#<plugin-server-path>\0\
+    <cxx-interop-version>|off\0\
+    <intcvers>\0\
+    <name>\0\
+    <profdata>\0\
+    <mode>\0\
+    <level>\0\
+    <n:n>\0\
+    <path>#<module-names>\0\
+    <library-path>#<executable-path>#<module-names>\0\
+    <locale-code>\0\
+    <location>\0\
+    <lto-library>\0\
+    <value>\0\
+    <alias_name=real_name>\0\
+    <moduleName> <version> <underlyingVersion>\0\
+    <moduleName>\0\
+    only-interface|prefer-interface|prefer-serialized|only-serialized\0\
+    <file>\0\
+    <triple>\0\
+    <profile data>\0\
+    none|failures|all|all-validate\0\
+    <target>\0\
+    <error,warn,ignore>\0\
+    </usr/lib/swift>\0\
+    <type>\0\
+    <check>\0\
+    <regex>\0\
+    <sdk>\0\
+    <2>\0\
+    <50>\0\
+    <250>\0\
+    <moduleName> <crossImport.swiftoverlay>\0\
+    <name>=<path>\0\
+    <options>\0\
+    <sysroot>\0\
+    <arch-variant>\0\
+    <complete,none>\0\
+    <module-name>\0\
+    <root>\0\
+    <arg>\0\
+    <optimization level options>\0\
+    <code formatting options>\0\
+    <automatic crashing options>\0\
+    <debug info options>\0\
+    <swift internal options>\0\
+    <swift debug/development internal options>\0\
+    <linker-specific options>\0\
+    <mode options>\0\
+    <plugin search options>\0\
+    <options to control warning treating>\0\
+    Dumping ABI interface\0\
+    Abort if a module failed to load\0\
+    Specify YAML file to override attributes on Swift declarations in this module\0\
+    Only emit availability metadata for platforms that are active according to the target\0\
+    When emitting a module interface, disambiguate modules using distinct alias names\0\
+    Restrict availability metadata to the given platforms, e.g. 'macOS,Swift'\0\
+    Ensures all contents are generated besides exportable decls in the binary module, so non-resilient access can be allowed\0\
+    Module names that are allowed to import this module\0\
+    Always compile output files even it might not change the results\0\
+    Always rebuild module dependencies\0\
+    Print out request evaluator cache statistics at the end of the compilation job\0\
+    Print out requirement machine statistics at the end of the compilation job\0\
+    Load platform and version specific API migration data files from <path>. Ignored if -api-diff-data-file is specified.\0\
+    API migration data is from <path>\0\
+    Restrict code to those available for App Extension Libraries\0\
+    Restrict code to those available for App Extensions\0\
+    Specify the assert_configuration replacement. Possible values are Debug, Release, Unchecked, DisableReplacement.\0\
+    Assume that code will be executed in a single-threaded environment\0\
+    Automatically chaining all the bridging headers\0\
+    Force ld to link against this module even if no symbols are used\0\
+    Add dependent library\0\
+    don't emit Swift source info file\0\
+    Avoid serializing the file paths of SDK nodes.\0\
+    Avoid serializing the arguments for invoking the tool.\0\
+    Directory of module interfaces as backups to those from SDKs\0\
+    Number of retrying opening a file if previous open returns a bad file descriptor error.\0\
+    The path to a directory containing baseline files: macos.json, iphoneos.json, appletvos.json, watchos.json, and iosmac.json\0\
+    The path to the Json file that we should use as the baseline\0\
+    add a directory to the baseline framework search path\0\
+    add a module for baseline input\0\
+    Remove the given platforms from symbol graph availability metadata, e.g. 'macOS,Swift'\0\
+    The path to a blocklist configuration file\0\
+    An allowlist of breakages to not complain about\0\
+    Directory for bridging header to be printed in compatibility header\0\
+    Cache Key for bridging header pch\0\
+    path to the baseline SDK to import frameworks\0\
+    Specify the build ID argument passed to the linker\0\
+    Bypass checks for batch-mode errors.\0\
+    Ignore all checks for module resilience.\0\
+    Enable compiler caching\0\
+    Skip loading the compilation result from cache\0\
+    Remap paths when replaying outputs from cache\0\
+    Specify Swift module may be ready to use for an interface\0\
+    CASBackendMode for output kind\0\
+    Enable using CASBackend for object file output\0\
+    Emit .casid file next to object file when CAS Backend is enabled\0\
+    Path for using the underlying file system instead of CASFS\0\
+    Path to CAS\0\
+    Option pass to CAS Plugin\0\
+    Path to CAS Plugin\0\
+    Deprecated, has no effect\0\
+    Print errors if the compile OnoneSupport module is missing symbols\0\
+    Control whether checked continuations are used when bridging async calls from Swift to ObjC: 'on', 'off' \0\
+    Use the last modification time of <file> as the underlying Clang build session timestamp\0\
+    Which declarations should be exposed in the generated clang header.\0\
+    Allow the compiler to assume that APIs from the specified module are exposed to C/C++/Objective-C in another generated header, so that APIs in the current module that depend on declarations from the specified module can be exposed in the generated header.\0\
+    Clang Include Tree FileList CASID\0\
+    Clang Include Tree CASID\0\
+    Specifies the Clang dependency scanner module cache path\0\
+    Separately set the target we should use for internal Clang instance for the 'zippered' code for macCatalyst\0\
+    Separately set the target we should use for internal Clang instance\0\
+    Use heuristics to guess whether we want call pattern completions\0\
+    Include initializers when completing a postfix expression\0\
+    Print diagnostics in color\0\
+    Compare the built module to the baseline at <path> and diagnose breaking changes using the API digester\0\
+    Treat the (single) input as a swiftinterface and produce a module\0\
+    Enable internal self-checks while compiling\0\
+    Print compiler style diagnostics to stderr.\0\
+    Which concurrency model is used.  Defaults to standard.\0\
+    Allow removal of runtime metadata records (public types, protocol conformances) based on whether they're used or unused\0\
+    Specify a list of protocols for extraction of conformances 'const values'\0\
+    Continue building, even after errors are encountered\0\
+    Remap source paths in coverage info\0\
+    Perform cross-module optimization\0\
+    Compare legacy DeclContext- to ASTScope-based unqualified name lookup (for debugging)\0\
+    Generate instrumented code to collect context sensitive execution counts into <directory>/default.profraw (overridden by LLVM_PROFILE_FILE env var)\0\
+    Generate instrumented code to collect context sensitive execution counts into default.profraw (overridden by LLVM_PROFILE_FILE env var)\0\
+    Import getters and setters as computed properties in Swift\0\
+    Testing flag that will be eliminated soon. Do not use.\0\
+    Enables C++ interoperability; pass 'default' to enable or 'off' to disable\0\
+    Force an assertion failure after parsing\0\
+    Force an assertion failure immediately\0\
+    Generate callsite information in debug info\0\
+    Debug the constraint solver at a given attempt\0\
+    Debug the constraint solver for expressions on <line>\0\
+    Debug the constraint-based type checker\0\
+    Force a crash after parsing\0\
+    Force a crash immediately\0\
+    Print out debug dumps when cycles are detected in evaluation\0\
+    Include diagnostic names when printing\0\
+    Write an invalid declaration into swiftinterface files\0\
+    Triggers llvm fatal_error if typechecker tries to typecheck a decl with the provided prefix name\0\
+    Debug generic signatures\0\
+    Emit extra debug info (DWARF discriminators) to make sampling-based profiling more accurate\0\
+    Specify the debug info format type to either 'dwarf' or 'codeview'\0\
+    Emit the compiler invocation in the debug info.\0\
+    Print real requirements in -debug-generic-signatures output\0\
+    Dumping information for debug purposes\0\
+    Path or cache key to this module's binary swiftmodule artifact (required by debug info)\0\
+    Embeded the key of current job in debug info generation (required by debug info)\0\
+    Remap source paths in debug info\0\
+    Fine-grained debug output from the generics implementation\0\
+    Dumps the time it takes to type-check each expression\0\
+    Dumps the time it takes to type-check each function body\0\
+    Process swift code as if running in the debugger\0\
+    Instrument the code with calls to an intrinsic that record the expected values of local variables so they can be compared against the results from the debugger.\0\
+    Specify the default actor isolation: MainActor or nonisolated. Defaults to nonisolated.\0\
+    Defines a custom availability domain that is available for all deployments\0\
+    Define an availability macro in the format 'macroName : iOS 13.0, macOS 10.15'\0\
+    Defines a custom availability domain that is unavailable at compile time\0\
+    Defines a custom availability domain that can be enabled or disabled at runtime\0\
+    Defines a custom availability domain that is available at compile time\0\
+    Import the module as a dependency only\0\
+    The path to output the dependency scanner's internal state.\0\
+    Emit a serialized diagnostics file for the dependency scanning task to <path>\0\
+    Deserialize diff items in a JSON file\0\
+    Deserialize sdk digester in a JSON file\0\
+    Diagnose SDK content in JSON file\0\
+    Path to diagnostic documentation resources\0\
+    The formatting style used when printing diagnostics ('swift' or 'llvm')\0\
+    Trap when an error diagnostic is emitted. For compiler developers only.\0\
+    Trap when any diagnostic in the given group is emitted. For compiler developers only.\0\
+    Trap when a warning diagnostic is emitted. For compiler developers only.\0\
+    Diagnostics will be used in editor\0\
+    The path to a list of permitted breaking changes the API digester should ignore\0\
+    Whether the API digester should run in API or ABI mode (defaults to API checking)\0\
+    Use the specified -Xcc options to build a PCM by using Clang frontend directly, bypassing the Clang driver\0\
+    Don't respect access control restrictions\0\
+    Disable runtime checks for actor data races\0\
+    Disable enforcement of lifetime dependencies on addressable values.\0\
+    Disable a more aggressive reg2mem heuristic\0\
+    When emitting a module interface, disable disambiguating modules using distinct alias names\0\
+    Disable all Swift autolink directives\0\
+    Don't run SIL ARC optimization passes.\0\
+    Don't use swiftcorocc for yield_once_2 routines on arm64 variants.\0\
+    Disable assembly vision for all functions\0\
+    Do not run the AST verifier during compilation. NOTE: This lets the user override the default behavior on whether or not the ASTVerifier is run. The default behavior is to run the verifier when asserts are enabled and not run it when asserts are disabled. NOTE: Can not be used if enable-ast-verifier is used as well\0\
+    Disable always emit async frame stack frames\0\
+    Disable async frame push pop metadata\0\
+    Disable autolinking against all frameworks\0\
+    Disable autolinking against the provided framework\0\
+    Disable autolinking against the provided library\0\
+    Do not use autolinking for the concurrency runtime compatibility library\0\
+    Do not use autolinking for the dynamic replacement runtime compatibility library\0\
+    Do not use autolinking for runtime compatibility libraries\0\
+    Disable checking for potentially unavailable APIs\0\
+    Disable combining frontend jobs into batches\0\
+    Disable automatic generation of bridging PCH files\0\
+    Disallow building binary module from textual interface\0\
+    Override per-platform settings and don't use yield_once_2.\0\
+    Don't import Clang SPIs as Swift SPIs\0\
+    Disable a separately specified target triple for Clang instance to use\0\
+    Disable ClangImporter and forward all requests straight the DWARF importer.\0\
+    Disable cross-module optimization\0\
+    Disable collocate metadata functions\0\
+    Disable colocate type descriptors\0\
+    Disable concrete type metadata access by mangled name\0\
+    Disable cond_fail message annotation.\0\
+    Disable constant value importing in ClangImporter.\0\
+    Disable searching for cross import overlay file\0\
+    Do not automatically import declared cross-import overlays.\0\
+    Do not require C++ interoperability to be enabled when importing a Swift module that enables C++ interoperability\0\
+    Disable debugger shadow copies of local variables.This option is only useful for testing the compiler.\0\
+    Don't attempt to recover from missing xrefs (etc) in swiftmodules\0\
+    Don't avoid reading potentially unsafe decls in swiftmodules\0\
+    Don't run diagnostic passes\0\
+    Disable use of swift_retain/releaseDirect functions\0\
+    Disable dynamic actor isolation checks\0\
+    Disable emission of a section with references to class_ro_t of generic class patterns\0\
+    Disable emitting typed malloc for coroutine frame allocation\0\
+    Disable experimental diagnostics when importing C, C++, and Objective-C libraries\0\
+    Disable an experimental feature\0\
+    Disable experimental lifetime dependence inference\0\
+    Disable experimental support for implicitly opened existentials\0\
+    Disable round trip through the new swift parser\0\
+    Disable experimental string processing\0\
+    Don't exit with a nonzero status if errors are emitted\0\
+    Skip the emission of fine grained module tracing file.\0\
+    Disable generation of all Swift _FORCE_LOAD symbols\0\
+    Disable relative protocol witness tables\0\
+    Do not statically specialize metadata for generic types at types that are known to be used in source.\0\
+    Disable the implicit import of the _Concurrency module.\0\
+    Disable the implicit import of the C++ Standard Library module.\0\
+    Disable the implicit import of the _StringProcessing module.\0\
+    Disable building Swift modules implicitly by the compiler\0\
+    Disable import of custom ptrauth qualified field function pointers\0\
+    Disable hashing of input and dependency file data that can prevent unnecessary invalidation\0\
+    Disable cross-module incremental build metadata and driver scheduling for Swift modules\0\
+    Disable incremental llvm code generation.\0\
+    Disable inference of Sendable conformances for public structs and enums\0\
+    Don't lock interface file when building module\0\
+    Diagnose invalid ephemeral to non-ephemeral conversions as warnings\0\
+    Disable large loadable types register to memory pass\0\
+    Disable runtime instantiation of layout string value witnesses for generic types\0\
+    Disable layout string based value witnesses\0\
+    Completely disable legacy type layout\0\
+    Disable lifetime dependence diagnostics for Nonescapable types.\0\
+    Disable the MergeFunctionPass LLVM IR pass\0\
+    Don't run LLVM optimization passes\0\
+    Don't add names to local values in LLVM IR\0\
+    Don't run the LLVM IR verifier after every pass.\0\
+    Don't run the LLVM IR verifier.\0\
+    Disable the Migrator phase which automatically applies fix-its\0\
+    When emitting module interface files, do not use module selectors to avoid name collisions\0\
+    Disable validating system headers in the Clang importer\0\
+    Import all of a type's import-as-member globals together, as Swift 5.10 and earlier did; temporary workaround for modules that are sensitive to this change\0\
+    Disable the new llvm pass manager\0\
+    Disable the new operator decl and precedencegroup lookup behavior\0\
+    Allow switches over non-frozen enums without catch-all cases\0\
+    Disables optimization assumption that calls to no-return functions are cold.\0\
+    Allow classes with unstable mangled names to adopt NSCoding\0\
+    Disable requiring uses of @objc to require importing the Foundation module\0\
+    Disable Objective-C interop code generation and config directives\0\
+    Disable objective-c protocol symbolic references\0\
+    Disables incremental build optimization that only produces one dependencies file\0\
+    Skip OS related diagnostics\0\
+    Don't run SIL OSSA optimization passes.\0\
+    Disable playground transformation\0\
+    Avoid preallocating metadata instantiation caches in globals\0\
+    Disable calling the previous implementation in dynamic replacements\0\
+    Disable adding to the module interface imports used from API and missing from the sources\0\
+    Disable profiling marker thunks\0\
+    Avoid allocating static objects in a read-only data section\0\
+    Disable emission of reflection metadata for nominal types\0\
+    Disable emission of names of stored properties and enum cases inreflection metadata\0\
+    Skip diagnosing removal of deprecated symbols\0\
+    Disable preprocessing pass to eliminate conformance requirements on generic parameters which are made concrete\0\
+    Disable stronger minimization algorithm, for debugging only\0\
+    Disable re-use of requirement machines for minimization, for debugging only\0\
+    Disables verification of debug info mangling\0\
+    Disable safe interop wrapper generation and bounds attribute parsing\0\
+    Disable using the sandbox when executing subprocesses\0\
+    Disable sending args and results when region-based isolation is enabled. Only enabled with asserts\0\
+    Disable SIL Opaque Values\0\
+    Do not verify ownership invariants during SIL Verification \0\
+    Disable use of partial_apply in SIL generation\0\
+    Don't run SIL performance optimization passes\0\
+    Disable splitting of cold code when optimizing\0\
+    Disable the stack-protector\0\
+    Disable referencing stdlib symbols via mangled names in reflection mangling\0\
+    Disable substituted function types for SIL type lowering of function values\0\
+    Disable using the swift bridge attribute\0\
+    Don't run Swift specific LLVM optimization passes.\0\
+    Disable checking the target OS of serialized modules\0\
+    Disable checking of @testable\0\
+    Disables optimization assumption that functions rarely throw errors.\0\
+    Disable type layout based lowering\0\
+    Disable typo correction\0\
+    Disable a feature that will be introduced in an upcoming language version\0\
+    Disable verification of access markers used to enforce exclusivity.\0\
+    Disable recovery for imported modules with broken modularization\0\
+    Don't use swiftcorocc for yield_once_2 routines on x86_64.\0\
+    Disable using new swift-driver\0\
+    Downgrade error to warning when typechecking emitted module interfaces\0\
+    Always rebuild dependents of files that have been modified\0\
+    Use the given number of batch-mode partitions, rather than partitioning dynamically\0\
+    Use the given seed value to randomize batch-mode partitions\0\
+    Use the given number as the upper limit on dynamic batch-mode partition size\0\
+    Emit dot files every time driver imports an fine-grained swiftdeps file.\0\
+    Pass input or output file names as filelists if there are more than <n>\0\
+    Force the use of response files for testing\0\
+    Set the driver mode to either 'swift' or 'swiftc'\0\
+    Dump list of actions to perform\0\
+    Dump list of job inputs and outputs\0\
+    Dump the contents of the derived output file map\0\
+    Write the job graph as a graphviz file\0\
+    Dump list of jobs to execute\0\
+    Dump the contents of the output file map\0\
+    With -v, dump information about why files are being rebuilt\0\
+    Show every step in the lifecycle of driver jobs\0\
+    Skip execution of subtasks when performing compilation\0\
+    Prints the total time it took to execute all compilation tasks\0\
+    Pass input files as filelists whenever possible\0\
+    Use the given executable to perform compilations. Arguments can be passed as a ';' separated list\0\
+    Debug DriverGraph by verifying it after every import\0\
+    Emit warnings for any provided options which are unused by the driver\0\
+    Dump abstract layout information for Clang-backed types\0\
+    The path to output swift interface files for the compiled source files\0\
+    Desired format for -dump-ast output ('default', 'json', or 'json-zlib'); no format is guaranteed stable across different compiler versions\0\
+    Parse and type-check input file(s) and dump AST(s)\0\
+    Dump availability scopes to stderr\0\
+    Dump Clang diagnostics to stderr\0\
+    Dump the importer's Swift-name-to-Clang-name lookup tables to stderr\0\
+    Dump every hidden-type layout known to this compilation, including those deserialized from imported swiftmodules\0\
+    Parse input file(s) and dump interface token hash(es)\0\
+    Dump JIT contents\0\
+    Dumps the results of each macro expansion\0\
+    Dump the input text, output text, and states for migration to <path>\0\
+    Parse input file(s) and dump AST(s)\0\
+    Dump debugging information about a precompiled Clang module\0\
+    Enables dumping rewrite systems from the generics implementation\0\
+    Parse and type-check input file(s) and dump the scope map(s)\0\
+    Dump SDK content to JSON file\0\
+    Dumps the list of imports for each source file\0\
+    Output YAML dump of fixed-size types from all imported modules\0\
+    Enables dumping type witness systems from associated type inference\0\
+    Dump USR for each declaration reference\0\
+    DWARF debug info version to produce if requested\0\
+    The maximum number of dynamic member lookups that can be chained to resolve a member reference\0\
+    Marks a conditional compilation flag as true\0\
+    Enable eager type-checking of declarations in macro expansions\0\
+    Embed placeholder LLVM IR data as a marker\0\
+    Embed LLVM IR bitcode as data\0\
+    Embed symbols from the module in the emitted tbd file\0\
+    Output the ABI descriptor of current module to <path>\0\
+    Output a JSON file describing the module's API to <path>\0\
+    Output a JSON file describing the module's API\0\
+    Emit assembly file(s) (-S)\0\
+    Emit LLVM BC file(s)\0\
+    The minimum access level of declarations to include in the emitted header\0\
+    Augment emitted Objective-C header with textual imports for every included modular import\0\
+    Emit an Objective-C and C++ header file to <path>\0\
+    Emit the extracted compile-time known values to <path>\0\
+    Output basic Make-compatible dependencies file to <path>\0\
+    Emit basic Make-compatible dependencies files\0\
+    Emit a baseline file for the module to <path> using the API digester\0\
+    Emit a baseline file for the module using the API digester\0\
+    Produce a valid but dummy object file when building a library module\0\
+    Emit a linked executable\0\
+    Emit 'swift.extension' symbols for extensions to external types instead of directly associating members and conformances with the extended nominal when generating symbol graphs\0\
+    Emit dot files for every source file.\0\
+    Output compiler fixits as source edits to <path>\0\
+    Emit a list of the imported modules\0\
+    Emit LLVM IR file(s) before LLVM optimizations\0\
+    Emit LLVM IR file(s) after LLVM optimizations\0\
+    Emit a linked library\0\
+    Emit the loaded module trace JSON to <path>\0\
+    Emit a JSON file containing information about what modules were loaded\0\
+    Emit lowered SIL file(s)\0\
+    Specify when to emit macro expansion file: 'none', 'debug', or 'diagnostics'\0\
+    Emit the migrated source file to <path>\0\
+    Emit a discovered dependencies file for the emit-module task to <path>\0\
+    Output module documentation file <path>\0\
+    Emit a module documentation file based on documentation comments\0\
+    Output module interface file to <path>\0\
+    Output module interface file\0\
+    Emit an importable module to <path>\0\
+    Output semantic info of current module to <path>\0\
+    Emit module files as a distinct job in wmo builds\0\
+    Emit a serialized diagnostics file for the emit-module task to <path>\0\
+    Output module source info file to <path>\0\
+    Output module source info file\0\
+    Output module summary file to <path>\0\
+    Output module summary file\0\
+    Emit an importable module\0\
+    Emit an Objective-C header file to <path>\0\
+    Emit an Objective-C header file\0\
+    Emit object file(s) (-c)\0\
+    Output package module interface file to <path>\0\
+    Emit PCH for imported Objective-C header file\0\
+    Emit a precompiled Clang module from a module map\0\
+    Parse the Objective-C input file and emit polyglot AST as JSON\0\
+    Output private module interface file to <path>\0\
+    Output Swift-style dependencies file to <path>\0\
+    Emit a Swift-style dependencies file\0\
+    Emit the replacement map describing Swift Migrator changes to <path>\0\
+    Emit serialized AST + raw SIL file(s)\0\
+    Emit serialized AST + canonical SIL file(s)\0\
+    Emit raw SIL file(s)\0\
+    Emit canonical SIL file(s)\0\
+    Emit a pointer to the corresponding type metadata into non-public non-generic type descriptors.\0\
+    When printing SIL, print out all sil entities sorted by name to ease diffing\0\
+    Emit runtime checks for correct stack promotion of objects.\0\
+    Emit a JSON file including all supported compiler arguments\0\
+    This is a compatibility alias for '-emit-supported-arguments'\0\
+    Emit a symbol graph to directory <dir>\0\
+    Emit a symbol graph\0\
+    Emit the TBD file to <path>\0\
+    Emit a TBD file\0\
+    Output the ABI descriptor of current target variant module to <path>\0\
+    Output a JSON file describing the target variant module's API to <path>\0\
+    Output module documentation file for the target variant to <path>\0\
+    Output module interface file for the target variant to <path>\0\
+    Emit an importable module for the target variant at the specified path\0\
+    Output module source info file for the target variant to <path>\0\
+    Output package module interface file for the target variant to <path>\0\
+    Output private module interface file for the target variant to <path>\0\
+    Emit locations during SIL emission\0\
+    Avoid printing actual module content into ABI descriptor file\0\
+    Use empty baseline for diagnostics\0\
+    Respect access control restrictions\0\
+    Emit runtime checks for actor data races\0\
+    Enable enforcement of lifetime dependencies on addressable values.\0\
+    Enable a more aggressive reg2mem heuristic\0\
+    Enable emission of mangled names in anonymous context descriptors\0\
+    Use swiftcorocc for yield_once_2 routines on arm64 variants.\0\
+    Enable assembly vision for all functions\0\
+    Run the AST verifier during compilation. NOTE: This lets the user override the default behavior on whether or not the ASTVerifier is run. The default behavior is to run the verifier when asserts are enabled and not run it when asserts are disabled. NOTE: Can not be used if disable-ast-verifier is used as well\0\
+    Always emit async frame stack frames (frame-pointer=all)\0\
+    Enable async frame push pop metadata\0\
+    Enable autolinking for the bytecode layouts runtime compatibility library\0\
+    Enable the use of forward slash regular-expression literal syntax\0\
+    Enable combining frontend jobs into batches\0\
+    Enable automatic generation of bridging PCH files\0\
+    Enables the explicit import of the Builtin module\0\
+    Override per-platform settings and use yield_once_2.\0\
+    Perform cross-module optimization on everything (all APIs). This is the same level of serialization as Embedded Swift.\0\
+    Enable collocate metadata functions\0\
+    Enable colocate type descriptors\0\
+    Enable cond_fail message annotation. Will serialize a .o.yaml file per .o file.\0\
+    Whether to enable copy propagation\0\
+    Always run SIL copy propagation with lexical lifetimes to shorten object lifetimes while preserving variable lifetimes.\0\
+    Automatically import declared cross-import overlays.\0\
+    Perform conservative cross-module optimization\0\
+    Attempt to recover from missing xrefs (etc) in swiftmodules\0\
+    Avoid reading potentially unsafe decls in swiftmodules\0\
+    Whether to enable destroy hoisting\0\
+    Check compiler output determinism by running it twice\0\
+    Enable use of swift_retain/releaseDirect functions\0\
+    Enable chaining of dynamic replacements\0\
+    Enable emission of a section with references to class_ro_t of generic class patterns\0\
+    Enable emitting typed malloc for coroutine frame allocation\0\
+    Enable experimental 'AdditiveArithmetic' derived conformances\0\
+    Enables an optimization pass to demote async functions.\0\
+    Enable experimental concurrency in top-level code\0\
+    Enable experimental concise '#file' identifier\0\
+    Enable experimental concurrency model\0\
+    Enable experimental C++ interop code generation and config directives\0\
+    Enable experimental 'distributed' actors and functions\0\
+    Enable experimental eager diagnostics reporting on the importability of all referenced C, C++, and Objective-C libraries\0\
+    Enable an experimental feature\0\
+    Enable flow-sensitive concurrent captures\0\
+    Enable experimental forward mode differentiation\0\
+    Enable experimental lifetime dependence inference\0\
+    Enable experimental move only\0\
+    Enable experimental support for named opaque result types\0\
+    Type-erases opaque types that conform to @_typeEraser protocols\0\
+    Enable experimental support for implicitly opened existentials\0\
+    Enable experimental pairwise 'buildBlock' for result builders\0\
+    Enable experimental #assert\0\
+    Enable experimental string processing\0\
+    Enable experimental support for explicit existential types\0\
+    Enable relative protocol witness tables\0\
+    Add 'dynamic' to all declarations\0\
+    Enable import of custom ptrauth qualified field function pointers. This is on by default.\0\
+    Enable hashing of input and dependency file data that can prevent unnecessary invalidation\0\
+    Enable cross-module incremental build metadata and driver scheduling for Swift modules\0\
+    Diagnose invalid ephemeral to non-ephemeral conversions as errors\0\
+    Enable large loadable types register to memory pass\0\
+    Enable runtime instantiation of layout string value witnesses for generic types\0\
+    Enable layout string based value witnesses\0\
+    Whether to enable lexical lifetimes\0\
+    Enable lexical lifetimes\0\
+    Build the module to allow binary-compatible library evolution\0\
+    Enable lifetime dependence diagnostics for Nonescapable types.\0\
+    Add names to local values in LLVM IR\0\
+    Run the LLVM IR verifier after every pass.\0\
+    Use LLVM IR Virtual Function Elimination on Swift class virtual tables\0\
+    Use LLVM IR Witness Method Elimination on Swift protocol witness tables\0\
+    When emitting module interface files, use module selectors to avoid name collisions\0\
+    Enable the stack protector by moving values to temporaries\0\
+    Enable the new llvm pass manager\0\
+    Enable the new operator decl and precedencegroup lookup behavior\0\
+    Diagnose switches over non-frozen enums without catch-all cases\0\
+    Enables optimization assumption that calls to no-return functions are cold.\0\
+    Diagnose classes with unstable mangled names adopting NSCoding\0\
+    Enable requiring uses of @objc to require importing the Foundation module\0\
+    Enable Objective-C interop code generation and config directives\0\
+    Enable objective-c protocol symbolic references\0\
+    Enables incremental build optimization that only produces one dependencies file\0\
+    Obsolete. This option is ignored\0\
+    Whether to skip heapifying stack metadata packs when possible.\0\
+    Skip heapifying stack metadata packs when possible.\0\
+    Allows this module's internal and private API to be accessed\0\
+    Enable profiling marker thunks\0\
+    Allow recompilation of a non-OSSA module to an OSSA module when imported from another OSSA module\0\
+    Diagnosing removal of deprecated symbols\0\
+    Enable more correct opaque archetype support, which is off by default because it might fail to produce a convergent rewrite system\0\
+    Deprecated, use -enable-library-evolution instead\0\
+    Enables verification of debug info mangling\0\
+    Enable SIL Opaque Values\0\
+    Emit LLVM IR into a single LLVM module in multithreaded mode.\0\
+    Enable importing of Swift source files\0\
+    Enable splitting of cold code when optimizing\0\
+    Enable the stack protector\0\
+    Enable checking the target OS of serialized modules\0\
+    Enable checking of @testable\0\
+    Allows this module's internal API to be accessed for testing\0\
+    Allow throwing function calls without 'try'\0\
+    Enables optimization assumption that functions rarely throw errors.\0\
+    Enable type layout based lowering\0\
+    Enable a feature that will be introduced in an upcoming language version\0\
+    Enable verification of access markers used to enforce exclusivity.\0\
+    Load Swift modules in memory\0\
+    Use swiftcorocc for yield_once_2 routines on x86_64.\0\
+    Enforce law of exclusivity\0\
+    Name of the entry point function\0\
+    Always treat ABI checker issues as errors\0\
+    Attempt to output .swiftmodule, regardless of compilation errors\0\
+    Deprecated; use -allow-non-resilient-access instead\0\
+    Allow reexporting symbols from the provided modules if they are themselves exported from the main module. This is a comma separated list of module names.\0\
+    Enable experimental C foreign references types. Deprecated, has no effect.\0\
+    Enables swift driver to construct swift-frontend invocations using -direct-clang-cc1-module-build\0\
+    Emit module files as a distinct job\0\
+    When a target variant triple is specified, the same driver invocation will emit two Swift modules, one for the primary target and one for the variant.\0\
+    Prebuild module dependencies to make them explicit\0\
+    Library code can assume that all clients are visible at linktime, and aggressively strip unused code\0\
+    Type-check lazily as needed to produce requested outputs\0\
+    Deprecated; has no effect\0\
+    Abort if a deserialization error is found while package optimization is enabled\0\
+    Deprecated; use -package-cmo instead\0\
+    Enables loading a package interface if in the same package specified with package-name\0\
+    Which calling convention is used to perform non-swift calls. Defaults to llvm's standard C calling convention.\0\
+    When emitting a module interface or SIL, emit additional @convention arguments, regardless of whether they were written in the source. Also requires -use-clang-function-types to be enabled.\0\
+    Enables serialization/deserialization of debug scopes\0\
+    Skip type-checking function bodies and all SIL generation\0\
+    Skip decls that are not exported to clients\0\
+    Skip work on non-inlinable function bodies that do not declare nested types\0\
+    Skip type-checking and SIL generation for non-inlinable function bodies\0\
+    Enable experimental support for SPI imports\0\
+    Enable use of @_spiOnly imports\0\
+    Emit remarks describing every possible dependency path that explains why compilation may depend on a module with a given name.\0\
+    Emit remark describing why compilation may depend on a module with a given name.\0\
+    Instead of linker-load directives, have the driver specify all link dependencies on the linker invocation. Requires '-explicit-module-build'.\0\
+    Specify the explicit dependency graph output format to either 'json' or 'dot'\0\
+    Use the specified command-line to build the module from interface, instead of flags specified in the interface\0\
+    Specify a JSON file containing information of explicit Swift modules\0\
+    Module name to use when referenced in clients module interfaces\0\
+    Use the pass pipeline defined by <pass_pipeline_file>\0\
+    Add directory to the plugin search path with a plugin server executable\0\
+    Executes a line of code provided on the command line\0\
+    The compilation directory to embed in the debug info. Coverage mapping is not supported yet.\0\
+    Remap source paths in debug, coverage, and index info\0\
+    Specify source inputs in a file rather than on the command line\0\
+    Find USR for decls by given condition\0\
+    Enable per-request timers\0\
+    Apply all fixits from diagnostics without any filtering\0\
+    Force public linkage for private symbols. Used by LLDB.\0\
+    Force type layout based lowering for structs\0\
+    What version of C++ interoperability a textual interface was originally generated with\0\
+    Specifies a framework which should be linked against\0\
+    Emit textual output in a parseable format\0\
+    Add directory to system framework search path\0\
+    Emit functions to separate sections.\0\
+    Add directory to framework search path\0\
+    Specify a directory where the clang importer and clang linker can find headers and libraries\0\
+    Emit full DWARF type info.\0\
+    Path to directory where reproducers write to.\0\
+    Generate a reproducer for current compilation.\0\
+    Generate an empty baseline\0\
+    Compare SDK content in JSON file and generate migration script\0\
+    Generate name correction template\0\
+    Emit minimal debug info for backtraces only\0\
+    Don't emit debug info\0\
+    The path to collect the group information of the compiled module\0\
+    Deprecated, use '-sil-based-debuginfo' instead\0\
+    Emit debug info. This is the preferred setting for debugging with LLDB.\0\
+    Display available options, including hidden options\0\
+    Display available options\0\
+    Ignore @inline(__always) attributes.\0\
+    Avoid getting source location from .swiftsourceinfo files\0\
+    Suppress “new API without '@available’ diagnostic for given SPI group name\0\
+    SPI group name to not diagnose about\0\
+    the file containing USRs of removed decls that the digester should ignore\0\
+    Implicitly imports a C header file\0\
+    Recognize and import CF types as class types\0\
+    Implicitly import the specified module\0\
+    Import bridging header PCH file\0\
+    When performing a dependency scan, only identify all imports of the main Swift module sources\0\
+    Implicitly imports the Objective-C half of a module\0\
+    Overwrite input file with formatted file.\0\
+    Path to dynamic library plugin server\0\
+    Add symbols with SPI information to the symbol graph\0\
+    Also print the declarations synthesized for any Clang submodules\0\
+    Re-use/validate prior build dependency scan artifacts\0\
+    Perform an incremental build if possible\0\
+    Indent cases in switch statements.\0\
+    Number of characters to indent.\0\
+    Produce index data for file <path>\0\
+    Produce index data for a source file\0\
+    Avoid indexing clang modules (pcms)\0\
+    Avoid emitting index data for the standard library.\0\
+    Avoid indexing system modules\0\
+    Include local definitions/references in the produced index data.\0\
+    Compress the unit and record files in the index store\0\
+    Store indexing data to <path>\0\
+    Emit index data for imported serialized swift system modules\0\
+    Specify index unit output paths in a file rather than on the command line\0\
+    Use <path> as the output path in the produced index data.\0\
+    Cache Key for input file\0\
+    The SDK contents under comparison\0\
+    The version of the Swift compiler used to generate a .swiftinterface file\0\
+    Implicitly imports a C header file as an internal import\0\
+    Import bridging header PCH file as internal\0\
+    Allow internalizing public symbols and vtables at link time (assume all client code of public types is part of the same link unit, or that external symbols are explicitly requested via -exported_symbols_list)\0\
+    Immediate mode\0\
+    Mark a Clang module by name as project-internal (IPI). Public imports of the named module will be diagnosed.\0\
+    Output LLVM IR files to directory <dir> as additional output during compilation\0\
+    Output LLVM IR to <path> as additional output during compilation\0\
+    Generate instrumented code to collect execution counts into <directory>/default.profraw (overridden by LLVM_PROFILE_FILE env var)\0\
+    Generate instrumented code to collect execution counts into default.profraw (overridden by LLVM_PROFILE_FILE env var)\0\
+    Supply an IR-level PGO profdata file to enable profile-guided optimization\0\
+    Add directory to the system import search path\0\
+    Add directory to the import search path\0\
+    Print output in JSON format.\0\
+    Number of commands to execute in parallel\0\
+    Interpret input according to a specific Swift language mode\0\
+    Specifies the path to the linker to be used\0\
+    libc runtime library to use\0\
+    Library distribution level 'api', 'spi' or 'other' (the default)\0\
+    <start line>:<end line>. Formats a range of lines (1-based). Can only be used with one input file.\0\
+    Deprecated\0\
+    LLDB-enhanced REPL mode\0\
+    For performing a dependency scan, deserialize the scanner's internal state from a prior scan.\0\
+    Load LLVM pass plugin from a dynamic shared object file.\0\
+    Path to a compiler plugin executable and a comma-separated list of module names where the macro types are declared\0\
+    Path to a dynamic library containing compiler plugins such as macros\0\
+    Path to resolved plugin configuration and a comma-separated list of module names where the macro types are declared. Library path and executable path can be empty if not used\0\
+    Choose a language for diagnostic messages\0\
+    Path to localized diagnostic messages directory\0\
+    Filter nodes with the given location.\0\
+    Perform LTO with <lto-library>\0\
+    Specify the LTO type to either 'llvm-thin' or 'llvm-full'\0\
+    Add directory to library link search path\0\
+    Specifies a library which should be linked against\0\
+    Set the maximum step count for type substitution operations\0\
+    Set the maximum nesting depth for type substitution operations\0\
+    Merge the input modules without otherwise processing them\0\
+    Emit symbol definitions as mergeable (linkonce_odr)\0\
+    Emit mergeable traps even in optimized builds\0\
+    When migrating, add '@objc' to declarations that would've been implicitly visible in Swift 3\0\
+    Does nothing. Temporary compatibility flag for Xcode.\0\
+    Dump Json suitable for generating migration script\0\
+    Specify the minimum runtime version to build force on non-Darwin systems\0\
+    The minimum Swift runtime version that will be available at runtime\0\
+    Overrides the target's least valid pointer value.'\0\
+    Include symbols with this access level or more\0\
+    ABI name to use for the contents of this module\0\
+    If a source file imports or references module <alias_name>, the <real_name> is used for the contents of the file\0\
+    Specifies the module cache path\0\
+    Specify canImport module and versions\0\
+    Specify canImport module name\0\
+    Import modules from CAS instead of file system\0\
+    When emitting a module interface, preserve types as they were written in the source\0\
+    Library to link against when using this module\0\
+    File containing a new-line separated list of modules\0\
+    Module loading mode\0\
+    Name of the module to build\0\
+    Names of modules\0\
+    Path of the new driver to be used\0\
+    Diagnose any code that needs to heap allocate (classes, closures, etc.)\0\
+    Do not automatically chaining all the bridging headers\0\
+    Disable compiler caching\0\
+    Do not use clang include tree, fallback to use CAS filesystem to build clang modules\0\
+    Don't emit DWARF skeleton CUs for imported Clang modules. Use this when building a redistributable static archive.\0\
+    Disable sharing of the Clang compiler instance across dependency scans.\0\
+    Do not print diagnostics in color\0\
+    Force emitting the swiftmodule in the same job in wmo builds\0\
+    Force using merge-module as the incremental build mode\0\
+    Opt out of the default explicit-module-build behavior for swiftc\0\
+    Perform dependency scanning in a single-threaded fashion.\0\
+    Do not validate binary modules in scanner and delegate the validation to swift-frontend\0\
+    Never serialize options for debugging (default: only for apps)\0\
+    Don't statically link the executable\0\
+    Don't statically link the Swift standard library\0\
+    Don't add any rpath entries.\0\
+    Disable the strict forwarding of compilation context to downstream implicit module dependencies\0\
+    Do not add an rpath entry for the toolchain's standard library (default)\0\
+    Disable verbose assembly output (default is enabled)\0\
+    Don't check that module interfaces emitted during compilation typecheck\0\
+    Treat warnings as warnings\0\
+    Disable optimizing input files together instead of individually\0\
+    Use calls to `swift-frontend -scan-dependencies` instead of dedicated dependency scanning library\0\
+    Do not link in the Swift language startup routines\0\
+    Don't search the standard library or toolchain import paths for modules\0\
+    Don't search the standard library import path for modules\0\
+    Enable multi-threading and specify number of threads\0\
+    Directly associate members and conformances with the extended nominal when generating symbol graphs instead of emitting 'swift.extension' symbols for extensions to external types\0\
+    Compile without any optimization\0\
+    Compile with optimizations appropriate for a playground\0\
+    Compile with optimizations and target small code size\0\
+    Compile with optimizations and remove runtime safety checks\0\
+    Output directory\0\
+    A file which specifies the location of outputs\0\
+    Specify outputs in a file rather than on the command line\0\
+    Compile with optimizations\0\
+    Write output to <file>\0\
+    Enable optimization to perform default CMO within a package boundary\0\
+    The version number to be applied on the input for the PackageDescription availability kind\0\
+    Name of the package the module belongs to\0\
+    Perform dependency scanning in-parallel.\0\
+    Parse the input file(s) as libraries, not scripts\0\
+    Parse the input file as SIL code, not Swift source\0\
+    Parse the input file(s) as the Swift standard library\0\
+    Parse input file(s)\0\
+    Apply the 'program counter simulation' macro\0\
+    Disable validating the persistent PCH\0\
+    Directory to persist automatically created precompiled bridging headers\0\
+    Omit instrumentation that has a high runtime performance impact\0\
+    Provide an option to the playground transform (if enabled)\0\
+    Apply the playground semantics and transformation\0\
+    Add directory to the plugin search path\0\
+    Directory of prebuilt modules for loading module interfaces\0\
+    Apply debug prefix mappings to serialized debug info in Swiftmodule files\0\
+    Statically specialize metadata for generic types at types that are known to be used in source.\0\
+    Pretty-print the output JSON\0\
+    Path to a Json file indicating module name to installname map for @_originallyDefinedIn\0\
+    Specify primary inputs in a file rather than on the command line\0\
+    Produce output for this file, not the whole module\0\
+    Parse and type-check input file(s) and pretty print declarations from AST(s)\0\
+    Parse and type-check input file(s) and pretty print AST(s)\0\
+    Print Clang importer statistics\0\
+    Include diagnostic groups in printed diagnostic output, if available\0\
+    Include educational notes in printed diagnostic output, if available\0\
+    Print the result of module dependency scanning after external module resolution to output\0\
+    Always print fully qualified type names\0\
+    Before IRGen, count all the various SIL instructions. Must be used in conjunction with -print-stats.\0\
+    Print the LLVM inline tree.\0\
+    Print module names in diagnostics\0\
+    Print the result of module dependency scanning to output\0\
+    Print static build configuration that can be used to evaluate #ifs in Swift source code\0\
+    Print various statistics\0\
+    Print information about features supported by the compiler\0\
+    Print target information for the given target <triple>, such as x86_64-apple-macos10.9\0\
+    Prints all stats even if they are zero\0\
+    Generate coverage data for use with profiled execution counts\0\
+    Generate instrumented code to collect execution counts\0\
+    Supply sampling-based profiling data from llvm-profdata to enable profile-guided optimization\0\
+    Profile changes to stats in -stats-output-dir, subdivided by source entity\0\
+    Profile changes to stats in -stats-output-dir\0\
+    Supply a profdata file to enable profile-guided optimization\0\
+    Name of the project this module to build belongs to\0\
+    File containing a new-line separated list of protocol names\0\
+    Add public dependent library\0\
+    Public facing module name to use in diagnostics and documentation\0\
+    Control access note remarks (default: all)\0\
+    Show remarks for compiler caching\0\
+    Emit a remark if a cross-import of a module is triggered.\0\
+    Emit remarks indicating use of the serialized module dependency scanning cache.\0\
+    Emit remarks for various steps taken by the dependency scanner.\0\
+    Read legacy type layout from the given path instead of default path\0\
+    Emit reflection metadata for debugger only, don't make them available at runtime\0\
+    Register module for dependency scan without importing in the frontend\0\
+    Remove runtime safety checks.\0\
+    REPL mode (the default if there is no input file)\0\
+    Deprecated, will be removed in future versions.\0\
+    Suggest fix-its adding @available(<target>, *) to public declarations without availability\0\
+    Set diagnostic level to report public declarations without an availability attribute\0\
+    Warn on public declarations without an availability attribute\0\
+    Require explicit Sendable annotations on public declarations\0\
+    Set the maximum concrete type nesting depth before giving up\0\
+    Set the maximum concrete type total size before giving up\0\
+    Set the maximum number of rules before giving up\0\
+    Set the maximum rule length before giving up\0\
+    Set the maximum concrete number of attempts at splitting concrete equivalence classes before giving up. There should never be a reason to change this\0\
+    Set the maximum number of type difference structures allocated before giving up\0\
+    Parse and resolve imports in input file(s)\0\
+    verify resolved plugins\0\
+    The directory that holds the compiler resource files\0\
+    Emit a remark when indexing a system module\0\
+    Show remarks for each line in macro expansions\0\
+    Emit remarks about loaded macro implementations\0\
+    Emit remarks about the import bridging in each element composing the API\0\
+    Emits a remark if an imported module needs to be re-compiled from its module interface\0\
+    Emit remarks about loaded module\0\
+    Emit remarks about contextual inconsistencies in loaded modules\0\
+    Emit remarks about module serialization\0\
+    Report missed transformations by optimization passes whose name matches the given POSIX regular expression\0\
+    Report performed transformations by optimization passes whose name matches the given POSIX regular expression\0\
+    Emit a remark if an explicit module interface invocation has an early exit because the expected output is up-to-date\0\
+    Link compatibility library for Swift runtime version, or 'none'\0\
+    When using AddressSanitizer enable ODR indicator globals to avoid false ODR violation reports in partially sanitized programs at the cost of an increase in binary size\0\
+    Specify the type of coverage instrumentation for Sanitizers and additional options separated by commas\0\
+    Specify which sanitizer runtime checks (see -sanitize=) will generate instrumentation that allows error recovery. Listed checks should be comma separated. Default behavior is to not allow error recovery.\0\
+    Link against the Sanitizers stable ABI.\0\
+    Turn on runtime checks for erroneous behavior.\0\
+    Only include passes which match a specified regular expression in the generated optimization record (by default, include all passes)\0\
+    Specify the file name of any generated optimization record\0\
+    Generate an optimization record file in a specific format (default: YAML)\0\
+    Generate a YAML optimization record file\0\
+    Save intermediate compilation results\0\
+    Scan dependencies of the given Swift sources\0\
+    Configure the filesystem to read from the provided CAS tree during dep-scanning\0\
+    Write generated output from scanner for debugging purpose\0\
+    Validate binary modules in the dependency scanner\0\
+    Directory for generated files from swift dependency scanner\0\
+    Remap paths reported by dependency scanner\0\
+    Remap paths within SDK reported by dependency scanner\0\
+    Remap paths within toolchain directory reported by dependency scanner\0\
+    Specifies the module cache path for explicitly-built SDK modules\0\
+    Compile against <sdk>\0\
+    Serialize breaking changes found by the API digester to <path>\0\
+    Always serialize options for debugging (default: only for apps)\0\
+    After performing a dependency scan, serialize the scanner's internal state.\0\
+    Emit a serialized diagnostics file to <path>\0\
+    Serialize diagnostics in a binary format\0\
+    Keep emitting subsequent diagnostics after a fatal error\0\
+    Write the SIL into a file and generate debug-info to debug on SIL  level.\0\
+    Do not eliminate functions in Mandatory Inlining/SILCombine dead functions. (for debugging only)\0\
+    Controls the aggressiveness of performance inlining in -Osize mode by reducing the base benefits of a caller (lower value permits more inlining!)\0\
+    Controls the aggressiveness of performance inlining\0\
+    Output SIL files to directory <dir> as additional output during compilation\0\
+    Output SIL to <path> as additional output during compilation\0\
+    Verify ownership after each transform\0\
+    Abort if SIL region isolation detects an unknown pattern. For compiler developers only.\0\
+    Stop optimizing at SIL time before we lower ownership from SIL. Intended only for SIL ossa tests\0\
+    Controls the aggressiveness of loop unrolling\0\
+    Verify SIL after each transform\0\
+    Completely disable SIL verification\0\
+    Skip emitting doc comments for members inherited through classes or default implementations\0\
+    Skip emitting symbols that are implementations of protocol requirements or inherited from protocol extensions\0\
+    Skip members inherited through classes or default implementations\0\
+    Disable experimental optimizations to speed up type variable binding\0\
+    Accept valid solutions in diagnostic mode\0\
+    Disable experimental optimization to sometimes skip operators in protocol extensions\0\
+    Disable various constraint solver performance optimizations that have been subsumed by subsequent improvements\0\
+    Disable experimental prepared overloads optimization\0\
+    Disable experimental disjunction pruning algorithm for lookahead in the solver\0\
+    Disable the component splitter phase of expression type checking\0\
+    Disable transitive conformance constraint optimization\0\
+    Enable experimental optimizations to speed up type variable binding\0\
+    Reject valid solutions in diagnostic mode\0\
+    Enable experimental optimization to sometimes skip operators in protocol extensions\0\
+    Enble various constraint solver performance optimizations that have been subsumed by subsequent improvements\0\
+    Enable experimental prepared overloads optimization\0\
+    Enable experimental disjunction pruning algorithm for lookahead in the solver\0\
+    Enable transitive conformance constraint optimization\0\
+    Expression type checking timeout, in seconds\0\
+    Set the upper bound for memory consumption, in bytes, by the constraint solver\0\
+    Expression type checking scope limit\0\
+    Set The upper bound to number of sub-expressions unsolved before termination of the shrink phrase\0\
+    Random seed for shuffling disjunction choices. For debugging solver performance\0\
+    Random seed for shuffling disjunctions. For debugging solver performance\0\
+    Expression type checking trail change limit\0\
+    Limit the size of stack promoted objects to the provided number of bytes.\0\
+    Statically link the executable\0\
+    Statically link the Swift standard library\0\
+    Make this module statically linkable and make the output of -emit-library a static library.\0\
+    Directory to write unified compilation-statistics files to\0\
+    Specify the how strict concurrency checking will be. The value may be 'minimal' (most 'Sendable' checking is disabled), 'targeted' ('Sendable' checking is enabled in code that uses the concurrency model, or 'complete' ('Sendable' and other checking is enabled for all code in the module)\0\
+    Enable the strict forwarding of compilation context to downstream implicit module dependencies\0\
+    Enable migration to strict memory safety checking\0\
+    Enable strict memory safety checking\0\
+    Specify supplementary outputs in a file rather than on the command line\0\
+    Suppress all notes\0\
+    Suppress all remarks\0\
+    Suppress static violations of exclusive access with swap()\0\
+    Suppress all warnings\0\
+    One of 'auto', 'always' or 'never'\0\
+    Specify the cross import module\0\
+    Specify Swift module input explicitly built from textual interface\0\
+    Only include APIs defined from Swift source\0\
+    Interpret input according to a specific Swift language version number\0\
+    Include symbols with this access level or more when emitting a symbol graph\0\
+    Pretty-print the output symbol graph JSON\0\
+    Shorten the symbol graph output file names by hashing the module name; outputs an additional JSON file with the map of hash to original name\0\
+    Comma-separated options controlling what gets printed. Options: 'unavailable', 'implicit-attrs', 'qualified-types'. Shorthands: 'all' (every option enabled), 'minimal' (default).\0\
+    Native Platform sysroot\0\
+    Width of tab character.\0\
+    Generate code for an additional arch/slice variant of the target architectureinto fat mach-o binaries\0\
+    Generate code for a particular CPU variant\0\
+    Require inlinable code with no '@available' attribute to back-deploy to this version of the '-target' OS\0\
+    Canonical name of the target SDK used for compilation\0\
+    The version of target SDK used for compilation\0\
+    The version of target variant SDK used for compilation\0\
+    Generate 'zippered' code for macCatalyst that can run on the specified variant target triple in addition to the main -target triple\0\
+    Generate code for the given target <triple>, such as x86_64-apple-macos10.9\0\
+    The compatibility_version to use in an emitted TBD file\0\
+    The current_version to use in an emitted TBD file\0\
+    The install_name to use in an emitted TBD file\0\
+    If the TBD file should indicate it's being generated during InstallAPI\0\
+    After performing a dependency scan, serialize and then deserialize the scanner's internal state.\0\
+    Implicitly import the specified module with @testable\0\
+    Turn all throw sites into immediate traps\0\
+    Add an rpath entry for the toolchain's standard library, rather than the OS's\0\
+    Look for external executables (ld, clang, binutils) in <directory>\0\
+    Trace changes to stats in -stats-output-dir\0\
+    Track system dependencies while emitting Make-style dependencies\0\
+    Lower traps to calls to this function instead of trap instructions\0\
+    One of 'all', 'resilient' or 'fragile'\0\
+    Treat the (single) input as a swiftinterface and typecheck it\0\
+    Parse and type-check input file(s)\0\
+    Limit the number of times the compiler will attempt typo correction to <n>\0\
+    Specify the optimization mode for unavailable declarations. The value may be 'none' (no optimization) or 'complete' (code is not generated at all unavailable declarations)\0\
+    Update Swift code\0\
+    Use stored Clang function types for computing canonical types.\0\
+    Emit parseable-output from swift-frontend jobs instead of from the driver\0\
+    Prefer loading these modules via interface\0\
+    Register Objective-C classes as if the JIT were in use\0\
+    Specifies the flavor of the linker to be used\0\
+    Allocate internal data structures using malloc (for memory debugging)\0\
+    Use resources in the static resource directory\0\
+    Use tabs for indentation.\0\
+    Module version specified from Swift module authors\0\
+    Don't verify input files for Clang modules if the module has been successfully validated or loaded during this build session\0\
+    For performing a dependency scan with a prior scanner state, validate module dependencies.\0\
+    Compare the symbols in the IR against the TBD file that would be generated.\0\
+    Set the maximum depth for direct recursion in value types\0\
+    Generate verbose assembly output with comments\0\
+    Verify diagnostics in this file in addition to source files\0\
+    Check for diagnostics with the prefix expected-<PREFIX> as well as expected-\0\
+    Verify all SubstitutionMaps on construction\0\
+    Like -verify, but updates the original source file\0\
+    Verify child notes in child diagnostics blocks\0\
+    Verify the binary representation of debug output.\0\
+    Check that module interfaces emitted during compilation typecheck\0\
+    Verify the generic signatures in the given module\0\
+    Skip verifying notes about macro location\0\
+    Allow diagnostics for '<unknown>' location in verify mode\0\
+    Allow diagnostics in files outside those with expected diagnostics in verify mode\0\
+    Enable the dependency verifier for each frontend job\0\
+    Verify compile-time and runtime type layout information for type\0\
+    Verify diagnostics against expected-{error|warning|note} annotations\0\
+    Input clang modules carry all versioned APINotes\0\
+    Print version information and exit\0\
+    Add directory to VFS overlay file\0\
+    VisualC++ Tools Root\0\
+    VisualC++ ToolSet Version\0\
+    Show commands to run and use verbose output\0\
+    Warn about code that is unsafe according to the Swift Concurrency model and will become ill-formed in a future language version\0\
+    Warn about implicit overrides of protocol members\0\
+    Warns when type-checking an expression uses more than <n> solver scopes\0\
+    Warns when type-checking an expression uses more than <n> solver trail steps\0\
+    Warns when type-checking an expression takes longer than <n> ms\0\
+    Warns when type-checking a function takes longer than <n> ms\0\
+    Downgrade the editor placeholder error to a warning\0\
+    Deprecated, will be removed in future versions\0\
+    Warn when soft-deprecated declarations are referenced\0\
+    Treat warnings as errors\0\
+    Weakly link symbols for declarations that were introduced at the deployment target. Symbols introduced before the deployment target are still strongly linked.\0\
+    Treat this warning group as error\0\
+    Optimize input files together instead of individually\0\
+    Windows SDK Root\0\
+    Windows SDK Version\0\
+    Resolve file paths relative to the specified directory\0\
+    When caching, write the output file's hash (as determined by the CAS hashing schema) as a file extended attribute.\0\
+    Treat this warning group as warning\0\
+    Pass <arg> to the C/C++/Objective-C compiler\0\
+    Pass <arg> to Clang when it is used for linking.\0\
+    Pass <arg> to the Swift frontend\0\
+    Pass <arg> to the linker driver (clang, emcc, etc.) regardless of which one is in use.\0\
+    Specifies an option which should be passed to the linker\0\
+    Pass <arg> to LLVM.\0\
+    DEBUG/DEVELOPMENT OPTIONS\0\
+    MODES\0\
+    -cache-prefetch-limit\0\
+    -cas-size-limit\0\
+    -incremental-file-hash-function\0\
+    -parseable-output-cache-queries\0\
+    -persist-dependency-scan-cache\0\
+    -reuse-prior-dependency-scan\0\
+    <size>\0\
+    <function>\0\
+    With -parseable-output, also report the compilation cache queries made before execution\0\
+    Fetch the cached outputs of at most <n> jobs into the local CAS at once, ahead of the jobs; 0 turns prefetching off\0\
+    With -incremental-dependency-scan, bring the prior build's dependency scan up to date instead of scanning again\0\
+    Keep the dependency scanner's cache next to the build record for builds which are not incremental\0\
+    Prune the on-disk CAS to stay within <size> bytes, which may have a K, M or G suffix\0\
+    Hash inputs with <function>, sha256 or stable, with -enable-incremental-file-hashing\0
+    """
 }
@@ -94,20 +94,19 @@ public struct ParsedOptions {
   /// The parsed options, which match up an option with its argument(s).
   private var parsedOptions: [ParsedOption] = []
 
-  /// Maps the canonical spelling of an option to all the instances of
-  /// that option that we've seen in the map, and their index in the
-  /// parsedOptions array. Prefer to use this for lookup
+  /// The positions in `parsedOptions` of all the instances of each option,
+  /// indexed by the ID of the canonical option. Prefer to use this for lookup
   /// whenever you can.
-  private var optionIndex = [String: [ParsedOption]]()
+  private var optionPositions: [OptionPositions] = []
 
-  /// Maps option groups to the set of parsed options that are present for
-  /// them.
-  private var groupIndex = [Option.Group: [ParsedOption]]()
+  /// Maps the index of each option group to the parsed options that are
+  /// present for it.
+  private var groupIndex = [[ParsedOption]](repeating: [], count: Option.Group.count)
 
   /// Indication of which of the parsed options have been "consumed" by the
-  /// driver. Any unconsumed options could have been omitted from the command
-  /// line.
-  private var consumed: [Bool] = []
+  /// driver, as a bitset indexed by `ParsedOption.index`. Any unconsumed
+  /// options could have been omitted from the command line.
+  private var consumed: [UInt64] = []
 
   /// Delay unknown flags throwing because some of them may be recognized as
   /// swift-frontend flags.
@@ -140,13 +139,47 @@ extension ParsedOptions {
   }
 }
 
+/// The positions of the instances of an option in a `ParsedOptions`. Most
+/// options occur at most once, so the last position is stored inline and
+/// only the earlier ones need an array.
+struct OptionPositions {
+  /// The position of the last instance, or -1 if there are none.
+  private(set) var last: Int = -1
+
+  /// The positions of the instances before the last one.
+  private var earlier: [Int] = []
+
+  var isEmpty: Bool { last < 0 }
+
+  mutating func append(_ position: Int) {
+    if last >= 0 {
+      earlier.append(last)
+    }
+    last = position
+  }
+
+  /// Calls `body` with each position, in order.
+  func forEach(_ body: (Int) throws -> Void) rethrows {
+    guard last >= 0 else { return }
+    try earlier.forEach(body)
+    try body(last)
+  }
+}
+
 public extension ParsedOptions {
   internal mutating func buildIndex() {
-    optionIndex.removeAll()
-    for parsed in parsedOptions {
-      optionIndex[parsed.option.canonical.spelling, default: []].append(parsed)
+    optionPositions = [OptionPositions](repeating: OptionPositions(),
+                                        count: Option.builtinCount)
+    groupIndex = [[ParsedOption]](repeating: [], count: Option.Group.count)
+    for (position, parsed) in parsedOptions.enumerated() {
+      let id = Int(parsed.option.canonical.spellingID)
+      if id >= optionPositions.count {
+        optionPositions.append(contentsOf: repeatElement(
+          OptionPositions(), count: id - optionPositions.count + 1))
+      }
+      optionPositions[id].append(position)
       if let group = parsed.option.group {
-        groupIndex[group, default: []].append(parsed)
+        groupIndex[group.index].append(parsed)
       }
     }
   }
@@ -158,7 +191,9 @@ public extension ParsedOptions {
       index: parsedOptions.count
     )
     parsedOptions.append(parsed)
-    consumed.append(false)
+    if parsed.index / 64 >= consumed.count {
+      consumed.append(0)
+    }
   }
 
   mutating func addInput(_ input: String) {
@@ -213,7 +248,7 @@ extension ParsedOptions {
     var result: [ParsedOption] = []
     for option in parsedOptions {
       if try isIncluded(option) {
-        consumed[option.index] = true
+        markConsumed(option)
         result.append(option)
       }
     }
@@ -232,7 +267,7 @@ extension ParsedOptions {
   }
 
   public mutating func arguments(in group: Option.Group) -> [ParsedOption] {
-    return groupIndex[group, default: []]
+    return groupIndex[group.index]
   }
 
   public mutating func last(for options: Option...) -> ParsedOption? {
@@ -253,7 +288,7 @@ extension ParsedOptions {
   /// Does this contain a particular option.
   public mutating func contains(_ option: Option) -> Bool {
     assert(option.alias == nil, "Don't check for aliased options")
-    return !lookup(option).isEmpty
+    return consumeLastPosition(of: option) != nil
   }
 
   /// Determine whether the parsed options contains an option in the given
@@ -266,7 +301,16 @@ extension ParsedOptions {
   ///
   /// This operation does not consume any inputs.
   public var hasAnyInput: Bool {
-    return !lookupWithoutConsuming(.INPUT).isEmpty || !lookupWithoutConsuming(.e).isEmpty
+    return !positions(of: .INPUT).isEmpty || !positions(of: .e).isEmpty
+  }
+
+  /// Walk through all of the parsed options, in command-line order.
+  ///
+  /// This operation does not consume any options.
+  public func forEach(body: (ParsedOption) throws -> Void) rethrows {
+    for parsed in parsedOptions {
+      try body(parsed)
+    }
   }
 
   /// Walk through all of the parsed options, modifying each one.
@@ -279,14 +323,40 @@ extension ParsedOptions {
     buildIndex()
   }
 
+  /// The positions in `parsedOptions` of the instances of the given option.
+  private func positions(of option: Option) -> OptionPositions {
+    let id = Int(option.canonical.spellingID)
+    return id < optionPositions.count ? optionPositions[id] : OptionPositions()
+  }
+
+  private func isConsumed(_ parsed: ParsedOption) -> Bool {
+    let (word, bit) = parsed.index.quotientAndRemainder(dividingBy: 64)
+    return consumed[word] & (1 << UInt64(bit)) != 0
+  }
+
+  private mutating func markConsumed(_ parsed: ParsedOption) {
+    let (word, bit) = parsed.index.quotientAndRemainder(dividingBy: 64)
+    consumed[word] |= 1 << UInt64(bit)
+  }
+
+  /// Marks all the instances of the given option as consumed, returning the
+  /// position of the last one, if any.
+  private mutating func consumeLastPosition(of option: Option) -> Int? {
+    let instances = positions(of: option)
+    instances.forEach { markConsumed(parsedOptions[$0]) }
+    return instances.isEmpty ? nil : instances.last
+  }
+
   internal func lookupWithoutConsuming(_ option: Option) -> [ParsedOption] {
-    optionIndex[option.canonical.spelling, default: []]
+    var result: [ParsedOption] = []
+    positions(of: option).forEach { result.append(parsedOptions[$0]) }
+    return result
   }
 
   internal mutating func lookup(_ option: Option) -> [ParsedOption] {
     let opts = lookupWithoutConsuming(option)
     for opt in opts {
-      consumed[opt.index] = true
+      markConsumed(opt)
     }
     return opts
   }
@@ -301,7 +371,7 @@ extension ParsedOptions {
   /// Determine whether the parsed options contain an argument with one of
   /// the given options
   public func hasArgument(_ options: Option...) -> Bool {
-    return options.contains { !lookupWithoutConsuming($0).isEmpty }
+    return options.contains { !positions(of: $0).isEmpty }
   }
 
   /// Given an option and its negative form, return
@@ -311,65 +381,62 @@ extension ParsedOptions {
   public mutating func hasFlag(positive: Option,
                                negative: Option,
                                default: Bool) -> Bool {
-    let positiveOpt = lookup(positive).last
-    let negativeOpt = lookup(negative).last
+    let positivePosition = consumeLastPosition(of: positive)
+    let negativePosition = consumeLastPosition(of: negative)
 
     // If neither are present, return the default
-    guard positiveOpt != nil || negativeOpt != nil else {
+    guard positivePosition != nil || negativePosition != nil else {
       return `default`
     }
 
     // If the positive isn't provided, then the negative will be
-    guard let positive = positiveOpt else { return false }
+    guard let positive = positivePosition else { return false }
 
     // If the negative isn't provided, then the positive will be
-    guard let negative = negativeOpt else { return true }
+    guard let negative = negativePosition else { return true }
 
     // Otherwise, return true if the positive index is greater than the negative,
     // false otherwise
-    return positive.index > negative.index
+    return positive > negative
   }
 
   /// Get the last argument matching the given option.
   public mutating func getLastArgument(_ option: Option) -> Argument? {
     assert(option.alias == nil, "Don't check for aliased options")
-    return lookup(option).last?.argument
+    return consumeLastPosition(of: option).map { parsedOptions[$0].argument }
   }
 
   /// Get the last parsed option within the given option group.
   /// FIXME: Should mark the gotten option as "used". That's why must be `mutating`
   public mutating func getLast(in group: Option.Group) -> ParsedOption? {
-    return groupIndex[group]?.last
+    return groupIndex[group.index].last
   }
 
   /// Remove argument from parsed options.
   public mutating func eraseArgument(_ option: Option) {
     parsedOptions.removeAll { $0.option == option }
-    optionIndex.removeValue(forKey: option.spelling)
-    if let group = option.group {
-      groupIndex[group]?.removeAll { $0.option == option }
-    }
+    // Erasing shifts the positions of the following options.
+    buildIndex()
   }
 
   /// Remove all arguments of a given group from parsed options.
   public mutating func eraseAllArguments(in group: Option.Group) {
-    for parsedOption in parsedOptions {
-      if parsedOption.option.group == group {
-        eraseArgument(parsedOption.option)
-      }
+    // Only the options of the group that are present need to be erased.
+    for option in OptionBitSet(groupIndex[group.index].map(\.option)).options {
+      eraseArgument(option)
     }
   }
 
   /// Remove all arguments with a .supplementaryOutput attribute
   public mutating func eraseSupplementaryOutputs() {
     for parsedOption in parsedOptions {
-      if parsedOption.option.attributes.contains(.supplementaryOutput) {
+      if parsedOption.option.hasAttributes(.supplementaryOutput) {
         eraseArgument(parsedOption.option)
       }
     }
   }
 
   public var unconsumedOptions: [ParsedOption] {
-    zip(parsedOptions, consumed).filter { !$0.1 }.map(\.0)
+    parsedOptions.filter { !isConsumed($0) }
   }
 }
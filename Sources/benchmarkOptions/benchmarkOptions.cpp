@@ -0,0 +1,176 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+//
+// A baseline for the driver's command-line processing benchmarks: expands and
+// parses the recorded command lines in `TestInputs/CommandLineCorpus` with
+// LLVM's `OptTable`, using the same `Options.inc` as `makeOptions`, the same
+// way as `CommandLinePerformanceTests` does with the driver.
+//
+//   benchmarkOptions [-inputs <count>] [-iterations <count>] <corpus file>...
+//
+//===----------------------------------------------------------------------===//
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "swift/Option/Options.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Option/ArgList.h"
+#include "llvm/Option/OptTable.h"
+#include "llvm/Support/Allocator.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Error.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/StringSaver.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+using namespace swift::options;
+
+#define OPTTABLE_STR_TABLE_CODE
+#include "swift/Option/Options.inc"
+#undef OPTTABLE_STR_TABLE_CODE
+
+#define OPTTABLE_PREFIXES_TABLE_CODE
+#include "swift/Option/Options.inc"
+#undef OPTTABLE_PREFIXES_TABLE_CODE
+
+namespace {
+const opt::OptTable::Info infoTable[] = {
+#define OPTION(...) LLVM_CONSTRUCT_OPT_INFO(__VA_ARGS__),
+#include "swift/Option/Options.inc"
+#undef OPTION
+};
+
+class SwiftOptTable : public opt::GenericOptTable {
+public:
+  SwiftOptTable()
+      : GenericOptTable(OptionStrTable, OptionPrefixesTable, infoTable) {}
+};
+} // end anonymous namespace
+
+[[noreturn]] static void fail(const Twine &message) {
+  errs() << "error: " << message << "\n";
+  exit(1);
+}
+
+/// Writes the given contents to a new temporary response file.
+static std::string writeResponseFile(StringRef prefix, StringRef contents) {
+  SmallString<128> path;
+  int fd;
+  if (std::error_code error =
+          sys::fs::createTemporaryFile(prefix, "resp", fd, path))
+    fail("unable to create a temporary file: " + error.message());
+  raw_fd_ostream os(fd, /*shouldClose=*/true);
+  os << contents;
+  return std::string(path);
+}
+
+/// Lists the inputs in the same way as `CommandLinePerformanceTests`.
+static std::string makeInputs(unsigned count) {
+  std::string result;
+  for (unsigned index = 0; index != count; ++index) {
+    std::string path = "Sources/Module" + std::to_string(index % 50) +
+                       "/File" + std::to_string(index) + ".swift";
+    if (index % 10 == 0)
+      result += "\"/Users/build/My Project/" + path + "\"";
+    else
+      result += "/Users/build/MyProject/" + path;
+    result += "\n";
+  }
+  return result;
+}
+
+/// Calls `body` the given number of times, returning the mean duration in
+/// microseconds.
+template <typename Body>
+static double measure(unsigned iterations, Body body) {
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i != iterations; ++i)
+    body();
+  std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+static void expand(BumpPtrAllocator &allocator, const std::string &invocation,
+                   SmallVectorImpl<const char *> &arguments) {
+  StringSaver saver(allocator);
+  arguments.clear();
+  arguments.push_back(saver.save("@" + invocation).data());
+  cl::ExpansionContext context(allocator, cl::TokenizeGNUCommandLine);
+  if (Error error = context.expandResponseFiles(arguments))
+    fail(toString(std::move(error)));
+}
+
+int main(int argc, char **argv) {
+  unsigned inputCount = 5000;
+  unsigned iterations = 10;
+  std::vector<std::string> corpus;
+  for (int i = 1; i < argc; ++i) {
+    StringRef argument = argv[i];
+    if ((argument == "-inputs" || argument == "-iterations") && i + 1 < argc) {
+      unsigned &value = argument == "-inputs" ? inputCount : iterations;
+      if (StringRef(argv[++i]).getAsInteger(10, value))
+        fail("invalid count '" + Twine(argv[i]) + "'");
+    } else {
+      corpus.push_back(argument.str());
+    }
+  }
+  if (corpus.empty() || iterations == 0)
+    fail("usage: benchmarkOptions [-inputs <count>] [-iterations <count>] "
+         "<corpus file>...");
+
+  std::string inputs = writeResponseFile("inputs", makeInputs(inputCount));
+  SwiftOptTable table;
+  for (const std::string &name : corpus) {
+    auto recorded = MemoryBuffer::getFile(name);
+    if (!recorded)
+      fail("unable to read '" + name + "': " + recorded.getError().message());
+    std::string invocation = writeResponseFile(
+        "invocation", (*recorded)->getBuffer().str() + "\n@" + inputs + "\n");
+
+    size_t allocated = 0;
+    SmallVector<const char *, 0> arguments;
+    double expandTime = measure(iterations, [&] {
+      BumpPtrAllocator allocator;
+      expand(allocator, invocation, arguments);
+      allocated = allocator.getBytesAllocated();
+    });
+
+    BumpPtrAllocator allocator;
+    expand(allocator, invocation, arguments);
+    unsigned missingIndex, missingCount;
+    double parseTime = measure(iterations, [&] {
+      opt::InputArgList parsed =
+          table.ParseArgs(arguments, missingIndex, missingCount);
+      if (missingCount)
+        fail("missing argument value for '" +
+             Twine(parsed.getArgString(missingIndex)) + "'");
+    });
+
+    outs() << sys::path::filename(name) << ": " << arguments.size()
+           << " arguments, expand " << format("%.1f", expandTime) << "us ("
+           << allocated << " bytes), parse " << format("%.1f", parseTime)
+           << "us\n";
+    sys::fs::remove(invocation);
+  }
+  sys::fs::remove(inputs);
+  return 0;
+}
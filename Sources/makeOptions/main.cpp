@@ -2,7 +2,7 @@
 //
 // This source file is part of the Swift open source project
 //
-// Copyright (c) 2014 - 2019 Apple Inc. and the Swift project authors
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
 // Licensed under Apache License v2.0
 //
 // See LICENSE.txt for license information
@@ -11,8 +11,22 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 //===----------------------------------------------------------------------===//
-extern int makeOptions_main();
+#include <cstring>
 
-int main() {
-    return makeOptions_main();
+#include <iostream>
+
+/// Writes Options.swift to standard output or, given a path, the binary
+/// option table to that file.
+extern int makeOptions_main(const char *binaryTablePath);
+
+int main(int argc, char **argv) {
+    const char *binaryTablePath = nullptr;
+    if (argc > 1 && std::strcmp(argv[1], "--binary-table") == 0) {
+      if (argc != 3) {
+        std::cerr << "usage: makeOptions [--binary-table <output-path>]\n";
+        return 1;
+      }
+      binaryTablePath = argv[2];
+    }
+    return makeOptions_main(binaryTablePath);
 }
@@ -12,8 +12,12 @@
 //
 //===----------------------------------------------------------------------===//
 #include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <set>
 #include <string>
@@ -123,6 +127,31 @@ static const RawOption rawOptions[] = {
 #include "swift/Option/Options.inc"
 #undef OPTION
 };
+
+/// The IDs of the options that only the driver knows about, which continue
+/// the IDs of the options from `Options.inc`.
+enum DriverOnlyID : unsigned {
+  OPT_DRIVER_ONLY_FIRST = swift::options::LastOption,
+#define DRIVER_OPTION(ID, SPELLING, KIND, FLAGS, METAVAR, HELPTEXT) OPT_##ID,
+#include "DriverOptions.def"
+};
+
+/// Options that only the driver knows about, from `DriverOptions.def`.
+static const std::vector<RawOption> driverOnlyRawOptions = {
+#define DRIVER_OPTION(ID, SPELLING, KIND, FLAGS, METAVAR, HELPTEXT)            \
+  {static_cast<swift::options::ID>(OPT_##ID),                                  \
+   {},                                                                         \
+   SPELLING,                                                                   \
+   swiftify(#ID),                                                              \
+   llvm::opt::Option::KIND##Class,                                             \
+   OPT_INVALID,                                                                \
+   OPT_INVALID,                                                                \
+   FLAGS,                                                                      \
+   HELPTEXT,                                                                   \
+   METAVAR,                                                                    \
+   0},
+#include "DriverOptions.def"
+};
 } // end anonymous namespace
 
 struct Group {
@@ -135,21 +164,64 @@ static std::vector<Group> groups;
 static std::map<swift::options::ID, unsigned> groupIndexByID;
 static std::map<swift::options::ID, unsigned> optionIndexByID;
 
-static std::string stringOrNil(const char *text) {
+/// A contiguous pool of NUL-terminated UTF-8 strings, laid out like the
+/// `OptionStrTable` of `Options.inc`, which is emitted as a single Swift
+/// `StaticString`. Identical strings are only stored once.
+struct StringPool {
+  std::string bytes;
+  std::map<std::string, unsigned> offsets;
+
+  /// Adds the string to the pool if needed, returning its offset.
+  unsigned intern(const std::string &string) {
+    auto known = offsets.find(string);
+    if (known != offsets.end())
+      return known->second;
+
+    unsigned offset = bytes.size();
+    bytes += string;
+    bytes += '\0';
+    offsets.emplace(string, offset);
+    return offset;
+  }
+};
+
+/// The pool offset of absent strings (`Option.noStringOffset`).
+static const unsigned noStringOffset = 0xFFFFFFFF;
+
+static unsigned internOrAbsent(StringPool &pool, const char *text) {
   if (!text)
-    return "nil";
+    return noStringOffset;
 
-  return "\"" + std::string(text) + "\"";
+  return pool.intern(text);
 }
 
-static std::string stringOrNilLeftTrimmed(const char *text) {
+static unsigned internOrAbsentLeftTrimmed(StringPool &pool, const char *text) {
   if (!text)
-    return "nil";
+    return noStringOffset;
 
   while (*text == ' ' && *text)
     ++text;
 
-  return "\"" + std::string(text) + "\"";
+  return pool.intern(text);
+}
+
+/// Renders a pool offset, spelling out the offset of absent strings.
+static std::string renderOffset(unsigned offset) {
+  if (offset == noStringOffset)
+    return "0xffffffff";
+
+  return std::to_string(offset);
+}
+
+/// Escapes a string for use in a Swift multi-line string literal.
+static std::string escapeForSwift(const std::string &string) {
+  std::string result;
+  for (char c : string) {
+    if (c == '\\' || c == '"')
+      result += '\\';
+    result += c;
+  }
+  return result;
 }
 
 void forEachOption(std::function<void(const RawOption &)> fn) {
@@ -162,6 +234,11 @@ void forEachOption(std::function<void(const RawOption &)> fn) {
 
     fn(rawOption);
   }
+
+  // The driver-only options come last, so that they don't change the IDs of
+  // the options from Options.inc.
+  for (const auto &rawOption : driverOnlyRawOptions)
+    fn(rawOption);
 }
 
 void forEachSpelling(
@@ -186,7 +263,116 @@ void forEachSpelling(
   }
 }
 
-int makeOptions_main() {
+/// A single spelling of an option, which is a distinct `Option` in Swift.
+struct Spelling {
+  const RawOption *option;
+  std::string spelling;
+  bool isAlternateSpelling;
+
+  /// The name of the static property for this spelling. Alternate spellings
+  /// get a '_' suffix.
+  std::string swiftName() const {
+    return option->idName + (isAlternateSpelling ? "_" : "");
+  }
+};
+
+/// The alias ID of options that aren't aliases (`Option.noAliasID`).
+static const unsigned noAliasID = 0xFFFF;
+
+/// The Swift `OptionAttributes` corresponding to the option flags, where
+/// each attribute's raw value is `1 << n` with `n` its index in this table.
+/// This must be kept in sync with the `OptionAttributes` declaration.
+static const struct {
+  const char *name;
+  unsigned flag;
+} optionAttributes[] = {
+    {"helpHidden", llvm::opt::HelpHidden},
+    {"frontend", swift::options::FrontendOption},
+    {"noDriver", swift::options::NoDriverOption},
+    {"noInteractive", swift::options::NoInteractiveOption},
+    {"noBatch", swift::options::NoBatchOption},
+    {"doesNotAffectIncrementalBuild",
+     swift::options::DoesNotAffectIncrementalBuild},
+    {"autolinkExtract", swift::options::AutolinkExtractOption},
+    {"moduleWrap", swift::options::ModuleWrapOption},
+    {"synthesizeInterface", swift::options::SwiftSynthesizeInterfaceOption},
+    {"argumentIsPath", swift::options::ArgumentIsPath},
+    {"moduleInterface", swift::options::ModuleInterfaceOption},
+    {"supplementaryOutput", swift::options::SupplementaryOutput},
+    {"argumentIsFileList", swift::options::ArgumentIsFileList},
+    {"cacheInvariant", swift::options::CacheInvariant},
+};
+
+/// The Swift `Option.Kind` cases corresponding to the option classes, in the
+/// order of their declaration. The index of each kind is its code in binary
+/// option tables.
+static const struct {
+  llvm::opt::Option::OptionClass optionClass;
+  const char *name;
+} optionKinds[] = {
+    {llvm::opt::Option::InputClass, "input"},
+    {llvm::opt::Option::FlagClass, "flag"},
+    {llvm::opt::Option::JoinedClass, "joined"},
+    {llvm::opt::Option::SeparateClass, "separate"},
+    {llvm::opt::Option::JoinedOrSeparateClass, "joinedOrSeparate"},
+    {llvm::opt::Option::RemainingArgsClass, "remaining"},
+    {llvm::opt::Option::CommaJoinedClass, "commaJoined"},
+    {llvm::opt::Option::MultiArgClass, "multiArg"},
+};
+
+/// Computes the index in `optionKinds` of the kind of an option.
+static unsigned kindCode(const RawOption &option) {
+  assert(!option.isGroup() && option.kind != llvm::opt::Option::UnknownClass &&
+         "Should have been filtered out");
+  for (unsigned code = 0, e = std::size(optionKinds); code != e; ++code) {
+    if (optionKinds[code].optionClass == option.kind)
+      return code;
+  }
+  assert(false && "Not implemented");
+  return 0;
+}
+
+/// The raw value of the `.argumentIsPath` attribute.
+static const unsigned argumentIsPathAttribute = 1 << 9;
+
+/// Computes the raw value of the Swift `OptionAttributes` of an option.
+static unsigned attributesMask(const RawOption &option) {
+  unsigned mask = 0;
+  unsigned attribute = 1;
+  for (const auto &optionAttribute : optionAttributes) {
+    if (option.flags & optionAttribute.flag)
+      mask |= attribute;
+    attribute <<= 1;
+  }
+  if (option.kind == llvm::opt::Option::InputClass)
+    mask |= argumentIsPathAttribute;
+  return mask;
+}
+
+/// The version of the binary option table format, which must match
+/// `BinaryOptionTable.formatVersion`.
+static const uint32_t binaryTableVersion = 1;
+
+/// The group index of options that aren't in a group.
+static const unsigned noGroupIndex = 0xFFFF;
+
+/// Appends an unsigned integer of the given size in bytes, little-endian.
+static void appendInteger(std::string &bytes, uint64_t value, unsigned size) {
+  for (unsigned i = 0; i != size; ++i)
+    bytes += char((value >> (8 * i)) & 0xFF);
+}
+
+/// Computes the 64-bit FNV-1a hash of the given bytes.
+static uint64_t fnv1a(const std::string &bytes) {
+  uint64_t hash = 0xcbf29ce484222325;
+  for (unsigned char byte : bytes) {
+    hash ^= byte;
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+int makeOptions_main(const char *binaryTablePath) {
   // Check if options were available.
   if (sizeof(rawOptions) == 0) {
     std::cerr << "error: swift/Options/Options.inc unavailable at compile time\n";
@@ -213,7 +399,125 @@ int makeOptions_main() {
     optionIndexByID[rawOption.id] = rawOptionIdx++;
   }
 
-  // Add static properties to Option for each of the options.
+  // Assign each spelling of each option a dense ID, in the order the options
+  // are listed. An option's primary spelling comes before its alternates.
+  std::vector<Spelling> spellings;
+  std::map<swift::options::ID, unsigned> spellingIDByOptionID;
+  forEachOption([&](const RawOption &option) {
+    forEachSpelling(option, [&](const std::string &spelling,
+                                bool isAlternateSpelling) {
+      if (!isAlternateSpelling)
+        spellingIDByOptionID[option.id] = spellings.size();
+      spellings.push_back({&option, spelling, isAlternateSpelling});
+    });
+  });
+  assert(spellings.size() < noAliasID && "Too many options for UInt16 IDs");
+
+  // The options from Options.inc, which the frontend knows about too.
+  unsigned swiftSpellingCount = spellings.size() - driverOnlyRawOptions.size();
+  std::set<std::string> swiftSpellings;
+  for (unsigned id = 0; id != swiftSpellingCount; ++id)
+    swiftSpellings.insert(spellings[id].spelling);
+  for (unsigned id = swiftSpellingCount, e = spellings.size(); id != e; ++id) {
+    if (swiftSpellings.count(spellings[id].spelling)) {
+      std::cerr << "error: " << spellings[id].spelling
+                << " is now in Options.inc; remove it from DriverOptions.def\n";
+      return 1;
+    }
+  }
+
+  // Intern all of the strings into a single pool. The spellings come first,
+  // in sorted order, so that matching arguments only touches the start of the
+  // pool. Help text is only needed to print help, so it comes last. The
+  // strings of the driver-only options follow all of the others, so that
+  // the strings of the options from Options.inc are laid out the same
+  // whichever driver-only options there are.
+  StringPool strings;
+  auto internStrings = [&](unsigned firstID, unsigned endID, bool withGroups) {
+    std::set<std::string> sortedSpellings;
+    for (unsigned id = firstID; id != endID; ++id)
+      sortedSpellings.insert(spellings[id].spelling);
+    for (const auto &spelling : sortedSpellings)
+      strings.intern(spelling);
+    for (unsigned id = firstID; id != endID; ++id)
+      internOrAbsent(strings, spellings[id].option->metaVar);
+    if (withGroups) {
+      for (const auto &group : groups)
+        strings.intern(group.name);
+    }
+    for (unsigned id = firstID; id != endID; ++id)
+      internOrAbsentLeftTrimmed(strings, spellings[id].option->helpText);
+    if (withGroups) {
+      for (const auto &group : groups)
+        internOrAbsent(strings, group.description);
+    }
+  };
+  internStrings(0, swiftSpellingCount, /*withGroups=*/true);
+  size_t swiftStringsSize = strings.bytes.size();
+  internStrings(swiftSpellingCount, spellings.size(), /*withGroups=*/false);
+
+  auto aliasID = [&](const Spelling &spelling) -> unsigned {
+    const auto &option = *spelling.option;
+    if (option.isAlias())
+      return spellingIDByOptionID[option.alias];
+    if (spelling.isAlternateSpelling)
+      return spellingIDByOptionID[option.id];
+    return noAliasID;
+  };
+
+  auto groupIndex = [&](const Spelling &spelling) -> unsigned {
+    if (spelling.option->group == swift::options::OPT_INVALID)
+      return noGroupIndex;
+    return groupIndexByID[spelling.option->group];
+  };
+
+  auto numArgs = [&](const Spelling &spelling) -> unsigned {
+    if (spelling.option->kind == llvm::opt::Option::MultiArgClass)
+      return spelling.option->numArgs;
+    return 0;
+  };
+
+  // Serialize one fixed-size record per option for the binary option table,
+  // which only describes the options from Options.inc. The hash of their
+  // records and strings identifies the set of options generated from this
+  // `Options.inc`, whichever driver-only options there are.
+  std::string records;
+  for (unsigned id = 0; id != swiftSpellingCount; ++id) {
+    const auto &spelling = spellings[id];
+    const auto &option = *spelling.option;
+    appendInteger(records, strings.offsets[spelling.spelling], 4);
+    appendInteger(records, spelling.spelling.size(), 2);
+    appendInteger(records, kindCode(option), 1);
+    appendInteger(records, 0, 1);
+    appendInteger(records, attributesMask(option), 4);
+    appendInteger(records, aliasID(spelling), 2);
+    appendInteger(records, groupIndex(spelling), 2);
+    appendInteger(records, numArgs(spelling), 2);
+    appendInteger(records, 0, 2);
+    appendInteger(records, internOrAbsent(strings, option.metaVar), 4);
+    appendInteger(records,
+                  internOrAbsentLeftTrimmed(strings, option.helpText), 4);
+  }
+  uint64_t fingerprint = fnv1a(records + strings.bytes.substr(0, swiftStringsSize));
+
+  // Write the binary option table: a 32-byte header, the records and then
+  // the string pool.
+  if (binaryTablePath) {
+    std::ofstream table(binaryTablePath, std::ios::out | std::ios::binary);
+    if (!table) {
+      std::cerr << "error: unable to open " << binaryTablePath << "\n";
+      return 1;
+    }
+    std::string header = "SWIFTOPT";
+    appendInteger(header, binaryTableVersion, 4);
+    appendInteger(header, swiftSpellingCount, 4);
+    appendInteger(header, fingerprint, 8);
+    appendInteger(header, swiftStringsSize, 4);
+    appendInteger(header, 0, 4);
+    table << header << records << strings.bytes.substr(0, swiftStringsSize);
+    return table.good() ? 0 : 1;
+  }
+
   auto &out = std::cout;
 
   out <<
@@ -233,150 +537,209 @@ int makeOptions_main() {
       "//\n"
       "// NOTE: Generated file, do not edit!\n"
       "//\n"
-      "// This file is generated from 'apple/swift:include/swift/Option/Options.td'.\n"
+      "// This file is generated from 'apple/swift:include/swift/Option/Options.td'\n"
+      "// and 'Sources/makeOptions/DriverOptions.def'.\n"
       "// Please see README.md#rebuilding-optionsswift for details\n"
       "//\n"
       "//===----------------------------------------------------------------------===//\n\n";
-  out << "extension Option {\n";
-  forEachOption([&](const RawOption &option) {
-    // Look through each spelling of the option.
-    forEachSpelling(option, [&](const std::string &spelling,
-                                bool isAlternateSpelling) {
-      out << "  public static let " << option.idName;
 
-      // Add a '_' suffix if this is an alternate spelling.
-      if (isAlternateSpelling)
-        out << "_";
+  // Add static properties to Option for each of the options.
+  out << "extension Option {\n";
+  for (unsigned id = 0, e = spellings.size(); id != e; ++id) {
+    if (id == swiftSpellingCount)
+      out << "  // Driver-only options\n";
+    out << "  public static var " << spellings[id].swiftName()
+        << ": Option { Option(id: " << id << ") }\n";
+  }
+  out << "}\n";
 
-      // All options have Option type.
-      out << ": Option = Option(\"" << spelling << "\"";
+  // Describe the options with parallel tables indexed by option ID.
+  auto emitTable = [&](const char *name, const char *type,
+                       std::function<void(const Spelling &)> emitEntry) {
+    out << "\n  static let " << name << ": [" << type << "] = [\n";
+    for (const auto &spelling : spellings) {
+      out << "    ";
+      emitEntry(spelling);
+      out << ",\n";
+    }
+    out << "  ]\n";
+  };
 
-      out << ", ";
-      switch (option.kind) {
-      case llvm::opt::Option::InputClass:
-        out << ".input";
-        break;
+  out << "\nextension Option {\n";
+  out << "  static let builtinCount = " << spellings.size() << "\n";
+  char fingerprintText[32];
+  snprintf(fingerprintText, sizeof(fingerprintText), "0x%016llx",
+           (unsigned long long)fingerprint);
+  out << "  static let builtinFingerprint: UInt64 = " << fingerprintText
+      << "\n";
+
+  emitTable("builtinSpellingOffsets", "UInt32", [&](const Spelling &spelling) {
+    out << strings.offsets[spelling.spelling];
+  });
 
-      case llvm::opt::Option::CommaJoinedClass:
-        out << ".commaJoined";
-        break;
+  emitTable("builtinSpellingLengths", "UInt16", [&](const Spelling &spelling) {
+    out << spelling.spelling.size();
+  });
 
-      case llvm::opt::Option::FlagClass:
-        out << ".flag";
-        break;
+  emitTable("builtinKinds", "Kind", [&](const Spelling &spelling) {
+    out << "." << optionKinds[kindCode(*spelling.option)].name;
+  });
 
-      case llvm::opt::Option::JoinedClass:
-        out << ".joined";
-        break;
+  emitTable("builtinAttributes", "UInt32", [&](const Spelling &spelling) {
+    out << "0x" << std::hex << attributesMask(*spelling.option) << std::dec;
+  });
 
-      case llvm::opt::Option::JoinedOrSeparateClass:
-        out << ".joinedOrSeparate";
-        break;
+  emitTable("builtinAliases", "UInt16", [&](const Spelling &spelling) {
+    unsigned alias = aliasID(spelling);
+    if (alias == noAliasID)
+      out << "0x" << std::hex << noAliasID << std::dec;
+    else
+      out << alias;
+  });
 
-      case llvm::opt::Option::RemainingArgsClass:
-        out << ".remaining";
-        break;
+  emitTable("builtinMetaVarOffsets", "UInt32", [&](const Spelling &spelling) {
+    out << renderOffset(internOrAbsent(strings, spelling.option->metaVar));
+  });
 
-      case llvm::opt::Option::SeparateClass:
-        out << ".separate";
-        break;
+  emitTable("builtinHelpTextOffsets", "UInt32", [&](const Spelling &spelling) {
+    out << renderOffset(
+        internOrAbsentLeftTrimmed(strings, spelling.option->helpText));
+  });
 
-      case llvm::opt::Option::MultiArgClass:
-        out << ".multiArg";
-        break;
+  emitTable("builtinGroups", "Group?", [&](const Spelling &spelling) {
+    unsigned group = groupIndex(spelling);
+    if (group == noGroupIndex)
+      out << "nil";
+    else
+      out << "." << groups[group].id;
+  });
 
-      case llvm::opt::Option::GroupClass:
-      case llvm::opt::Option::UnknownClass:
-        assert(false && "Should have been filtered out");
+  emitTable("builtinNumArgs", "UInt16", [&](const Spelling &spelling) {
+    out << numArgs(spelling);
+  });
+  out << "}\n";
 
-      case llvm::opt::Option::ValuesClass:
-      case llvm::opt::Option::JoinedAndSeparateClass:
-      case llvm::opt::Option::RemainingArgsJoinedClass:
-        assert(false && "Not implemented");
-      }
+  // Precompute packed bitsets, indexed by option ID, of the options accepted
+  // by each kind of driver and of the options with each attribute.
+  auto emitBitset = [&](const char *indent,
+                        std::function<bool(const Spelling &)> isMember) {
+    std::vector<uint64_t> words((spellings.size() + 63) / 64);
+    for (unsigned id = 0, e = spellings.size(); id != e; ++id) {
+      if (isMember(spellings[id]))
+        words[id / 64] |= uint64_t(1) << (id % 64);
+    }
+    out << "OptionBitSet(words: [\n";
+    for (unsigned i = 0, e = words.size(); i != e; ++i) {
+      if (i % 4 == 0)
+        out << indent << "  ";
+      char word[32];
+      snprintf(word, sizeof(word), "0x%016llx,", (unsigned long long)words[i]);
+      out << word << ((i % 4 == 3 || i + 1 == e) ? "\n" : " ");
+    }
+    out << indent << "])";
+  };
 
-      if (option.isAlias()) {
-        const auto &aliased = rawOptions[optionIndexByID[option.alias]];
-        out << ", alias: Option." << aliased.idName;
-      } else if (isAlternateSpelling) {
-        out << ", alias: Option." << option.idName;
-      }
+  out << "\nextension Option {\n";
+  out << "  static let builtinBatchDriverOptions = ";
+  emitBitset("  ", [](const Spelling &spelling) {
+    return !(spelling.option->flags &
+             (swift::options::NoDriverOption | swift::options::NoBatchOption));
+  });
+  out << "\n\n";
+  out << "  static let builtinInteractiveDriverOptions = ";
+  emitBitset("  ", [](const Spelling &spelling) {
+    return !(spelling.option->flags & (swift::options::NoDriverOption |
+                                       swift::options::NoInteractiveOption));
+  });
+  out << "\n\n";
+  out << "  static let builtinAttributeBitsets: [OptionBitSet] = [\n";
+  unsigned attribute = 1;
+  for (const auto &optionAttribute : optionAttributes) {
+    out << "    // ." << optionAttribute.name << "\n";
+    out << "    ";
+    emitBitset("    ", [&](const Spelling &spelling) {
+      return (attributesMask(*spelling.option) & attribute) != 0;
+    });
+    out << ",\n";
+    attribute <<= 1;
+  }
+  out << "  ]\n";
+  out << "}\n";
 
-      if (option.flags != 0 || option.kind == llvm::opt::Option::InputClass) {
-        bool anyEmitted = false;
-        auto emitFlag = [&](const char *name) {
-          if (anyEmitted) {
-            out << ", ";
-          } else {
-            anyEmitted = true;
-          }
-
-          out << name;
-        };
-
-        auto emitFlagIf = [&](unsigned flag, const char *name) {
-          if ((option.flags & flag) == 0) {
-            return;
-          }
-          emitFlag(name);
-        };
-
-        out << ", attributes: [";
-        emitFlagIf(llvm::opt::HelpHidden, ".helpHidden");
-        emitFlagIf(swift::options::FrontendOption, ".frontend");
-        emitFlagIf(swift::options::NoDriverOption, ".noDriver");
-        emitFlagIf(swift::options::NoInteractiveOption, ".noInteractive");
-        emitFlagIf(swift::options::NoBatchOption, ".noBatch");
-        emitFlagIf(swift::options::DoesNotAffectIncrementalBuild,
-                   ".doesNotAffectIncrementalBuild");
-        emitFlagIf(swift::options::AutolinkExtractOption, ".autolinkExtract");
-        emitFlagIf(swift::options::ModuleWrapOption, ".moduleWrap");
-        emitFlagIf(swift::options::SwiftSynthesizeInterfaceOption,
-                   ".synthesizeInterface");
-        if (option.kind == llvm::opt::Option::InputClass)
-          emitFlag(".argumentIsPath");
-        else
-          emitFlagIf(swift::options::ArgumentIsPath, ".argumentIsPath");
-        emitFlagIf(swift::options::ModuleInterfaceOption, ".moduleInterface");
-        emitFlagIf(swift::options::SupplementaryOutput, ".supplementaryOutput");
-        emitFlagIf(swift::options::ArgumentIsFileList, ".argumentIsFileList");
-        emitFlagIf(swift::options::CacheInvariant, ".cacheInvariant");
-        out << "]";
-      }
+  // Resolve every alias to its canonical option up front, and index the
+  // options by group: option IDs are sorted by group, and each group records
+  // the range of its members.
+  auto canonicalID = [&](unsigned id) {
+    const RawOption *option = spellings[id].option;
+    while (option->isAlias())
+      option = &rawOptions[optionIndexByID[option->alias]];
+    return spellingIDByOptionID[option->id];
+  };
+  std::vector<std::vector<unsigned>> groupMembers(groups.size());
+  for (unsigned id = 0, e = spellings.size(); id != e; ++id) {
+    if (spellings[id].option->group != swift::options::OPT_INVALID)
+      groupMembers[groupIndexByID[spellings[id].option->group]].push_back(id);
+  }
 
-      if (option.metaVar) {
-        out << ", metaVar: " << stringOrNil(option.metaVar);
-      }
-      if (option.helpText) {
-        out << ", helpText: " << stringOrNilLeftTrimmed(option.helpText);
-      }
-      if (option.group != swift::options::OPT_INVALID) {
-        out << ", group: ." << groups[groupIndexByID[option.group]].id;
-      }
-      if (option.kind == llvm::opt::Option::MultiArgClass) {
-        out << ", numArgs: " << option.numArgs;
-      }
-      out << ")\n";
-    });
-  });
+  out << "\nextension Option {\n";
+  out << "  static let builtinCanonicalIDs: [UInt16] = [\n";
+  for (unsigned id = 0, e = spellings.size(); id != e; ++id)
+    out << "    " << canonicalID(id) << ",\n";
+  out << "  ]\n\n";
+  out << "  static let builtinIDsByGroup: [UInt16] = [\n";
+  for (unsigned group = 0, e = groups.size(); group != e; ++group) {
+    out << "    // ." << groups[group].id << "\n";
+    for (unsigned id : groupMembers[group])
+      out << "    " << id << ",\n";
+  }
+  out << "  ]\n\n";
+  out << "  static let builtinGroupRanges: [Range<Int>] = [\n";
+  unsigned groupStart = 0;
+  for (const auto &members : groupMembers) {
+    out << "    " << groupStart << "..<" << groupStart + members.size()
+        << ",\n";
+    groupStart += members.size();
+  }
+  out << "  ]\n";
   out << "}\n";
 
-  // Produce an "allOptions" property containing all of the known options.
+  // Produce a flattened prefix-match table of the spellings accepted by the
+  // driver, so that parsing doesn't need to build a trie. Spellings are sorted
+  // by their bytes, and each one records the index of its longest proper
+  // prefix within the table.
+  std::map<std::string, unsigned> driverSpellingMap;
+  for (unsigned id = 0, e = spellings.size(); id != e; ++id) {
+    if (spellings[id].option->flags & swift::options::NoDriverOption)
+      continue;
+    driverSpellingMap[spellings[id].spelling] = id;
+  }
+  std::vector<std::pair<std::string, unsigned>> driverSpellings(
+      driverSpellingMap.begin(), driverSpellingMap.end());
+  std::vector<int> driverSpellingParents;
+  std::vector<int> prefixStack;
+  for (const auto &entry : driverSpellings) {
+    const std::string &spelling = entry.first;
+    while (!prefixStack.empty()) {
+      const std::string &prefix = driverSpellings[prefixStack.back()].first;
+      if (spelling.compare(0, prefix.size(), prefix) == 0)
+        break;
+      prefixStack.pop_back();
+    }
+    driverSpellingParents.push_back(prefixStack.empty() ? -1
+                                                        : prefixStack.back());
+    prefixStack.push_back(driverSpellingParents.size() - 1);
+  }
+
   out << "\nextension Option {\n";
-  out << "  public static var allOptions: [Option] {\n"
-      << "    return [\n";
-  forEachOption([&](const RawOption &option) {
-      // Look through each spelling of the option.
-      forEachSpelling(
-          option, [&](const std::string &spelling, bool isAlternateSpelling) {
-            out << "      Option." << option.idName;
-            if (isAlternateSpelling)
-              out << "_";
-            out << ",\n";
-          });
-    });
-  out << "    ]\n";
-  out << "  }\n";
+  out << "  static let driverPrefixTable = OptionPrefixTable(\n";
+  out << "    optionIDs: [\n";
+  for (const auto &entry : driverSpellings)
+    out << "      " << entry.second << ",\n";
+  out << "    ],\n";
+  out << "    parents: [\n";
+  for (int parent : driverSpellingParents)
+    out << "      " << parent << ",\n";
+  out << "    ])\n";
   out << "}\n";
 
   // Render the Option.Group type.
@@ -388,32 +751,43 @@ int makeOptions_main() {
   out << "  }\n";
   out << "}\n";
 
-  // Retrieve the display name of the group.
+  // Retrieve the index of the group, in the order of declaration.
   out << "\n";
   out << "extension Option.Group {\n";
-  out << "  public var name: String {\n";
+  out << "  var index: Int {\n";
   out << "    switch self {\n";
-  for (const auto &group : groups) {
-    out << "      case ." << group.id << ":\n";
-    out << "        return \"" << group.name << "\"\n";
+  for (unsigned group = 0, e = groups.size(); group != e; ++group) {
+    out << "      case ." << groups[group].id << ":\n";
+    out << "        return " << group << "\n";
   }
   out << "    }\n";
   out << "  }\n";
   out << "}\n";
 
-  // Retrieve the help text for the group.
-  out << "\n";
-  out << "extension Option.Group {\n";
-  out << "  public var helpText: String? {\n";
-  out << "    switch self {\n";
-  for (const auto &group : groups) {
-    out << "      case ." << group.id << ":\n";
-    out << "        return " << stringOrNil(group.description) << "\n";
-  }
-  out << "    }\n";
-  out << "  }\n";
+  // Locate the display name and help text of each group in the string pool.
+  out << "\nextension Option {\n";
+  out << "  static let builtinGroupNameOffsets: [UInt32] = [\n";
+  for (const auto &group : groups)
+    out << "    " << strings.offsets[group.name] << ",\n";
+  out << "  ]\n\n";
+  out << "  static let builtinGroupHelpTextOffsets: [UInt32] = [\n";
+  for (const auto &group : groups)
+    out << "    " << renderOffset(internOrAbsent(strings, group.description))
+        << ",\n";
+  out << "  ]\n";
   out << "}\n";
 
+  // Emit the string pool, with one string per line.
+  out << "\nextension Option {\n";
+  out << "  static let builtinStrings: StaticString = \"\"\"\n";
+  for (size_t start = 0, e = strings.bytes.size(); start != e;) {
+    size_t end = strings.bytes.find('\0', start);
+    out << "    " << escapeForSwift(strings.bytes.substr(start, end - start))
+        << "\\0" << (end + 1 == e ? "\n" : "\\\n");
+    start = end + 1;
+  }
+  out << "    \"\"\"\n";
+  out << "}\n";
 
   return 0;
 }
@@ -428,5 +802,5 @@ static_assert(false, "Failed to locate/include swift/Option/Options.h");
 #endif
 #else
 #warning "Unable to include 'swift/Option/Options.inc', `makeOptions` will not be usable"
-int makeOptions_main() {return 0;}
+int makeOptions_main(const char *) {return 0;}
 #endif
@@ -0,0 +1,1141 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+// For nanosleep.
+#define _POSIX_C_SOURCE 200809L
+
+#include "include/mock_swiftscan.h"
+#include "swiftscan_header.h"
+
+// The scanner is only needed where the driver loads libSwiftScan with dlopen.
+#if !defined(_WIN32)
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MOCK_EXPORT __attribute__((visibility("default")))
+
+//=== Strings -------------------------------------------------------------===//
+
+static swiftscan_string_ref_t make_string(const char *string) {
+  swiftscan_string_ref_t result = {NULL, 0};
+  size_t length = string ? strlen(string) : 0;
+  if (length == 0)
+    return result;
+  char *data = malloc(length + 1);
+  memcpy(data, string, length + 1);
+  result.data = data;
+  result.length = length;
+  return result;
+}
+
+static swiftscan_string_ref_t make_formatted_string(const char *format, ...) {
+  char buffer[512];
+  va_list arguments;
+  va_start(arguments, format);
+  vsnprintf(buffer, sizeof(buffer), format, arguments);
+  va_end(arguments);
+  return make_string(buffer);
+}
+
+static void free_string(swiftscan_string_ref_t string) {
+  free((void *)string.data);
+}
+
+static swiftscan_string_set_t *make_string_set(size_t count) {
+  swiftscan_string_set_t *set = malloc(sizeof(swiftscan_string_set_t));
+  set->strings = count ? calloc(count, sizeof(swiftscan_string_ref_t)) : NULL;
+  set->count = count;
+  return set;
+}
+
+static void free_string_set(swiftscan_string_set_t *set) {
+  if (!set)
+    return;
+  for (size_t i = 0; i < set->count; ++i)
+    free_string(set->strings[i]);
+  free(set->strings);
+  free(set);
+}
+
+/// A string of `length` bytes, which need not be terminated.
+static char *copy_bytes(const void *bytes, size_t length) {
+  char *copy = malloc(length + 1);
+  memcpy(copy, bytes, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+static uint64_t fnv1a(uint64_t hash, const void *bytes, size_t length) {
+  const unsigned char *data = bytes;
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= data[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+static const uint64_t fnv1a_basis = 0xcbf29ce484222325ULL;
+
+static uint64_t hash_string(const char *string) {
+  return fnv1a(fnv1a_basis, string, strlen(string));
+}
+
+static void sleep_microseconds(unsigned long microseconds) {
+  struct timespec duration = {(time_t)(microseconds / 1000000),
+                              (long)(microseconds % 1000000) * 1000};
+  while (nanosleep(&duration, &duration) != 0)
+    continue;
+}
+
+MOCK_EXPORT void swiftscan_string_dispose(swiftscan_string_ref_t string) {
+  free_string(string);
+}
+
+MOCK_EXPORT void swiftscan_string_set_dispose(swiftscan_string_set_t *set) {
+  free_string_set(set);
+}
+
+//=== Scan Invocations ----------------------------------------------------===//
+
+struct swiftscan_scan_invocation_s {
+  swiftscan_string_ref_t working_directory;
+  swiftscan_string_set_t *argv;
+};
+
+MOCK_EXPORT swiftscan_scan_invocation_t swiftscan_scan_invocation_create(void) {
+  swiftscan_scan_invocation_t invocation =
+      calloc(1, sizeof(struct swiftscan_scan_invocation_s));
+  invocation->argv = make_string_set(0);
+  return invocation;
+}
+
+MOCK_EXPORT void
+swiftscan_scan_invocation_set_working_directory(swiftscan_scan_invocation_t invocation,
+                                                const char *working_directory) {
+  free_string(invocation->working_directory);
+  invocation->working_directory = make_string(working_directory);
+}
+
+MOCK_EXPORT void
+swiftscan_scan_invocation_set_argv(swiftscan_scan_invocation_t invocation,
+                                   int argc, const char **argv) {
+  free_string_set(invocation->argv);
+  invocation->argv = make_string_set((size_t)argc);
+  for (int i = 0; i < argc; ++i)
+    invocation->argv->strings[i] = make_string(argv[i]);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_scan_invocation_get_working_directory(swiftscan_scan_invocation_t invocation) {
+  return invocation->working_directory;
+}
+
+MOCK_EXPORT int
+swiftscan_scan_invocation_get_argc(swiftscan_scan_invocation_t invocation) {
+  return (int)invocation->argv->count;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_scan_invocation_get_argv(swiftscan_scan_invocation_t invocation) {
+  return invocation->argv;
+}
+
+MOCK_EXPORT void
+swiftscan_scan_invocation_dispose(swiftscan_scan_invocation_t invocation) {
+  free_string(invocation->working_directory);
+  free_string_set(invocation->argv);
+  free(invocation);
+}
+
+/// The shape of the graph a scan synthesizes, from its invocation.
+typedef struct {
+  const char *module_name;
+  const char **source_files;
+  size_t source_file_count;
+  unsigned long module_count;
+  unsigned long fanout;
+  unsigned long clang_percent;
+  unsigned long latency_us;
+} mock_scan_config_t;
+
+static const char *argument(swiftscan_scan_invocation_t invocation, size_t i) {
+  swiftscan_string_ref_t string = invocation->argv->strings[i];
+  return string.data ? string.data : "";
+}
+
+static mock_scan_config_t read_scan_config(swiftscan_scan_invocation_t invocation) {
+  mock_scan_config_t config = {"main", NULL, 0,
+                               MOCK_SWIFTSCAN_DEFAULT_MODULE_COUNT,
+                               MOCK_SWIFTSCAN_DEFAULT_FANOUT,
+                               MOCK_SWIFTSCAN_DEFAULT_CLANG_PERCENT, 0};
+  size_t argc = invocation->argv->count;
+  config.source_files = calloc(argc ? argc : 1, sizeof(const char *));
+  for (size_t i = 0; i < argc; ++i) {
+    const char *arg = argument(invocation, i);
+    const char *value = i + 1 < argc ? argument(invocation, i + 1) : NULL;
+    size_t length = strlen(arg);
+    if (value && !strcmp(arg, "-module-name")) {
+      config.module_name = value;
+      ++i;
+    } else if (value && !strcmp(arg, "-mock-scan-modules")) {
+      config.module_count = strtoul(value, NULL, 10);
+      ++i;
+    } else if (value && !strcmp(arg, "-mock-scan-fanout")) {
+      config.fanout = strtoul(value, NULL, 10);
+      ++i;
+    } else if (value && !strcmp(arg, "-mock-scan-clang-percent")) {
+      config.clang_percent = strtoul(value, NULL, 10);
+      ++i;
+    } else if (value && !strcmp(arg, "-mock-scan-latency-us")) {
+      config.latency_us = strtoul(value, NULL, 10);
+      ++i;
+    } else if (length > 6 && !strcmp(arg + length - 6, ".swift")) {
+      config.source_files[config.source_file_count++] = arg;
+    }
+  }
+  if (config.fanout == 0)
+    config.fanout = 1;
+  if (config.clang_percent > 100)
+    config.clang_percent = 100;
+  return config;
+}
+
+//=== Dependency Graphs ---------------------------------------------------===//
+
+struct swiftscan_module_details_s {
+  swiftscan_dependency_info_kind_t kind;
+  swiftscan_string_ref_t module_interface_path;
+  swiftscan_string_ref_t module_map_path;
+  swiftscan_string_ref_t context_hash;
+  swiftscan_string_set_t *command_line;
+  swiftscan_string_set_t *empty_set;
+};
+
+struct swiftscan_dependency_info_s {
+  swiftscan_string_ref_t module_name;
+  swiftscan_string_ref_t module_path;
+  swiftscan_string_set_t *source_files;
+  swiftscan_string_set_t *direct_dependencies;
+  swiftscan_link_library_set_t link_libraries;
+  swiftscan_import_info_set_t imports;
+  struct swiftscan_module_details_s details;
+};
+
+struct swiftscan_dependency_graph_s {
+  swiftscan_string_ref_t main_module_name;
+  swiftscan_dependency_set_t dependencies;
+  swiftscan_diagnostic_set_t diagnostics;
+};
+
+/// Whether the `index`th module of the graph is a Clang module. They come
+/// last, so that Swift modules can import them but not the other way around.
+static int is_clang_module(const mock_scan_config_t *config, unsigned long index) {
+  unsigned long swift_count =
+      config->module_count - config->module_count * config->clang_percent / 100;
+  return index >= swift_count;
+}
+
+static swiftscan_string_ref_t encoded_module_name(const mock_scan_config_t *config,
+                                                  unsigned long index) {
+  return make_formatted_string(is_clang_module(config, index) ? "clang:M%lu"
+                                                              : "swiftTextual:M%lu",
+                               index);
+}
+
+static swiftscan_string_set_t *make_command_line(const char **arguments, size_t count) {
+  swiftscan_string_set_t *set = make_string_set(count);
+  for (size_t i = 0; i < count; ++i)
+    set->strings[i] = make_string(arguments[i]);
+  return set;
+}
+
+/// The modules the `index`th module imports: its children in a tree with
+/// `fanout` children per module, and the last module, which every other
+/// module imports. The main module is `index == module_count`, whose
+/// children are the first `fanout` modules.
+static swiftscan_string_set_t *make_direct_dependencies(const mock_scan_config_t *config,
+                                                        unsigned long index) {
+  unsigned long module_count = config->module_count;
+  unsigned long first_child = index == module_count ? 0 : (index + 1) * config->fanout;
+  unsigned long names[config->fanout + 1];
+  size_t count = 0;
+  for (unsigned long child = first_child;
+       child < first_child + config->fanout && child < module_count; ++child)
+    names[count++] = child;
+  unsigned long last = module_count - 1;
+  if (module_count > 0 && index != last &&
+      (count == 0 || names[count - 1] != last) &&
+      (!is_clang_module(config, index) || is_clang_module(config, last)))
+    names[count++] = last;
+
+  swiftscan_string_set_t *set = make_string_set(count);
+  for (size_t i = 0; i < count; ++i)
+    set->strings[i] = encoded_module_name(config, names[i]);
+  return set;
+}
+
+static void init_module(swiftscan_dependency_info_t module,
+                        const mock_scan_config_t *config, unsigned long index) {
+  int is_main = index == config->module_count;
+  int is_clang = !is_main && is_clang_module(config, index);
+  char name[64];
+  snprintf(name, sizeof(name), "M%lu", index);
+
+  module->direct_dependencies = make_direct_dependencies(config, index);
+  module->details.empty_set = make_string_set(0);
+  module->details.context_hash = make_string("mockcontexthash");
+  if (is_main) {
+    module->module_name = make_formatted_string("swiftTextual:%s", config->module_name);
+    module->module_path = make_formatted_string("%s.swiftmodule", config->module_name);
+    module->source_files = make_command_line(config->source_files,
+                                             config->source_file_count);
+    module->details.kind = SWIFTSCAN_DEPENDENCY_INFO_SWIFT_TEXTUAL;
+    module->details.command_line = make_string_set(0);
+  } else if (is_clang) {
+    module->module_name = encoded_module_name(config, index);
+    module->module_path = make_formatted_string("/mock/ModuleCache/M%lu.pcm", index);
+    module->details.kind = SWIFTSCAN_DEPENDENCY_INFO_CLANG;
+    module->details.module_map_path = make_string("/mock/Headers/module.modulemap");
+    const char *command_line[] = {"-emit-pcm", "-fmodule-name", name,
+                                  "/mock/Headers/module.modulemap"};
+    module->details.command_line = make_command_line(command_line, 4);
+  } else {
+    module->module_name = encoded_module_name(config, index);
+    module->module_path = make_formatted_string("/mock/ModuleCache/M%lu.swiftmodule", index);
+    module->details.kind = SWIFTSCAN_DEPENDENCY_INFO_SWIFT_TEXTUAL;
+    module->details.module_interface_path =
+        make_formatted_string("/mock/Interfaces/M%lu.swiftinterface", index);
+    const char *command_line[] = {"-frontend", "-compile-module-from-interface",
+                                  "-module-name", name};
+    module->details.command_line = make_command_line(command_line, 4);
+  }
+}
+
+static void dispose_module(swiftscan_dependency_info_t module) {
+  free_string(module->module_name);
+  free_string(module->module_path);
+  free_string_set(module->source_files);
+  free_string_set(module->direct_dependencies);
+  free_string(module->details.module_interface_path);
+  free_string(module->details.module_map_path);
+  free_string(module->details.context_hash);
+  free_string_set(module->details.command_line);
+  free_string_set(module->details.empty_set);
+  free(module);
+}
+
+MOCK_EXPORT swiftscan_scanner_t swiftscan_scanner_create(void) {
+  // The scanner keeps no state between scans; it only needs to be non-null.
+  return malloc(1);
+}
+
+MOCK_EXPORT void swiftscan_scanner_dispose(swiftscan_scanner_t scanner) {
+  free(scanner);
+}
+
+MOCK_EXPORT swiftscan_dependency_graph_t
+swiftscan_dependency_graph_create(swiftscan_scanner_t scanner,
+                                  swiftscan_scan_invocation_t invocation) {
+  (void)scanner;
+  mock_scan_config_t config = read_scan_config(invocation);
+  sleep_microseconds(config.latency_us);
+
+  swiftscan_dependency_graph_t graph = calloc(1, sizeof(struct swiftscan_dependency_graph_s));
+  graph->main_module_name = make_string(config.module_name);
+  size_t count = config.module_count + 1;
+  graph->dependencies.count = count;
+  graph->dependencies.modules = calloc(count, sizeof(swiftscan_dependency_info_t));
+  // The main module is reported first, the way the scanner does.
+  for (size_t i = 0; i < count; ++i) {
+    swiftscan_dependency_info_t module = calloc(1, sizeof(struct swiftscan_dependency_info_s));
+    init_module(module, &config, i == 0 ? config.module_count : i - 1);
+    graph->dependencies.modules[i] = module;
+  }
+  free(config.source_files);
+  return graph;
+}
+
+MOCK_EXPORT void swiftscan_dependency_graph_dispose(swiftscan_dependency_graph_t graph) {
+  for (size_t i = 0; i < graph->dependencies.count; ++i)
+    dispose_module(graph->dependencies.modules[i]);
+  free(graph->dependencies.modules);
+  free_string(graph->main_module_name);
+  free(graph);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_dependency_graph_get_main_module_name(swiftscan_dependency_graph_t graph) {
+  return graph->main_module_name;
+}
+
+MOCK_EXPORT swiftscan_dependency_set_t *
+swiftscan_dependency_graph_get_dependencies(swiftscan_dependency_graph_t graph) {
+  return &graph->dependencies;
+}
+
+MOCK_EXPORT swiftscan_diagnostic_set_t *
+swiftscan_dependency_graph_get_diagnostics(swiftscan_dependency_graph_t graph) {
+  return &graph->diagnostics;
+}
+
+//=== Module Info ---------------------------------------------------------===//
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_module_info_get_module_name(swiftscan_dependency_info_t info) {
+  return info->module_name;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_module_info_get_module_path(swiftscan_dependency_info_t info) {
+  return info->module_path;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_module_info_get_source_files(swiftscan_dependency_info_t info) {
+  return info->source_files;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_module_info_get_direct_dependencies(swiftscan_dependency_info_t info) {
+  return info->direct_dependencies;
+}
+
+MOCK_EXPORT swiftscan_link_library_set_t *
+swiftscan_module_info_get_link_libraries(swiftscan_dependency_info_t info) {
+  return &info->link_libraries;
+}
+
+MOCK_EXPORT swiftscan_import_info_set_t *
+swiftscan_module_info_get_imports(swiftscan_dependency_info_t info) {
+  return &info->imports;
+}
+
+MOCK_EXPORT swiftscan_module_details_t
+swiftscan_module_info_get_details(swiftscan_dependency_info_t info) {
+  return &info->details;
+}
+
+MOCK_EXPORT swiftscan_library_level_t
+swiftscan_module_info_get_library_level(swiftscan_dependency_info_t info) {
+  (void)info;
+  return SWIFTSCAN_LIBRARY_LEVEL_API;
+}
+
+MOCK_EXPORT swiftscan_dependency_info_kind_t
+swiftscan_module_detail_get_kind(swiftscan_module_details_t details) {
+  return details->kind;
+}
+
+//=== Swift Textual Module Details ----------------------------------------===//
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_textual_detail_get_module_interface_path(swiftscan_module_details_t details) {
+  return details->module_interface_path;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_swift_textual_detail_get_compiled_module_candidates(swiftscan_module_details_t details) {
+  return details->empty_set;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_textual_detail_get_bridging_header_path(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_swift_textual_detail_get_bridging_source_files(swiftscan_module_details_t details) {
+  return details->empty_set;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_swift_textual_detail_get_bridging_module_dependencies(swiftscan_module_details_t details) {
+  return details->empty_set;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_swift_textual_detail_get_command_line(swiftscan_module_details_t details) {
+  return details->command_line;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_textual_detail_get_context_hash(swiftscan_module_details_t details) {
+  return details->context_hash;
+}
+
+MOCK_EXPORT bool
+swiftscan_swift_textual_detail_get_is_framework(swiftscan_module_details_t details) {
+  (void)details;
+  return false;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_swift_textual_detail_get_swift_overlay_dependencies(swiftscan_module_details_t details) {
+  return details->empty_set;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_textual_detail_get_module_cache_key(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+//=== Swift Binary Module Details -----------------------------------------===//
+
+// No module is reported as a binary module, but the scanner has to provide
+// these queries all the same.
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_binary_detail_get_compiled_module_path(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_binary_detail_get_module_doc_path(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_binary_detail_get_module_source_info_path(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_swift_binary_detail_get_module_cache_key(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+//=== Clang Module Details ------------------------------------------------===//
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_clang_detail_get_module_map_path(swiftscan_module_details_t details) {
+  return details->module_map_path;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_clang_detail_get_context_hash(swiftscan_module_details_t details) {
+  return details->context_hash;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_clang_detail_get_command_line(swiftscan_module_details_t details) {
+  return details->command_line;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_clang_detail_get_module_cache_key(swiftscan_module_details_t details) {
+  (void)details;
+  return make_string(NULL);
+}
+
+//=== Import Prescan ------------------------------------------------------===//
+
+struct swiftscan_import_set_s {
+  swiftscan_string_set_t *imports;
+  swiftscan_diagnostic_set_t diagnostics;
+};
+
+MOCK_EXPORT swiftscan_import_set_t
+swiftscan_import_set_create(swiftscan_scanner_t scanner,
+                            swiftscan_scan_invocation_t invocation) {
+  (void)scanner;
+  mock_scan_config_t config = read_scan_config(invocation);
+  swiftscan_import_set_t import_set = calloc(1, sizeof(struct swiftscan_import_set_s));
+  size_t count = config.module_count < config.fanout ? config.module_count : config.fanout;
+  import_set->imports = make_string_set(count);
+  for (size_t i = 0; i < count; ++i)
+    import_set->imports->strings[i] = make_formatted_string("M%zu", i);
+  free(config.source_files);
+  return import_set;
+}
+
+MOCK_EXPORT swiftscan_string_set_t *
+swiftscan_import_set_get_imports(swiftscan_import_set_t import_set) {
+  return import_set->imports;
+}
+
+MOCK_EXPORT swiftscan_diagnostic_set_t *
+swiftscan_import_set_get_diagnostics(swiftscan_import_set_t import_set) {
+  return &import_set->diagnostics;
+}
+
+MOCK_EXPORT void swiftscan_import_set_dispose(swiftscan_import_set_t import_set) {
+  free_string_set(import_set->imports);
+  free(import_set);
+}
+
+//=== Diagnostics ---------------------------------------------------------===//
+
+// Scans never report diagnostics, so there are none to query.
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_diagnostic_get_message(swiftscan_diagnostic_info_t diagnostic) {
+  (void)diagnostic;
+  return make_string(NULL);
+}
+
+MOCK_EXPORT swiftscan_diagnostic_severity_t
+swiftscan_diagnostic_get_severity(swiftscan_diagnostic_info_t diagnostic) {
+  (void)diagnostic;
+  return SWIFTSCAN_DIAGNOSTIC_SEVERITY_NOTE;
+}
+
+MOCK_EXPORT void swiftscan_diagnostics_set_dispose(swiftscan_diagnostic_set_t *set) {
+  (void)set;
+}
+
+//=== CAS -----------------------------------------------------------------===//
+
+struct swiftscan_cas_options_s {
+  char *ondisk_path;
+  char *plugin_path;
+  unsigned long latency_us;
+  unsigned long hit_percent;
+  unsigned long outputs_per_key;
+};
+
+/// A set of strings, each with a size, for the objects and cache keys in the
+/// local CAS.
+typedef struct {
+  char **keys;
+  int64_t *sizes;
+  size_t capacity;
+  size_t count;
+} string_table_t;
+
+static size_t string_table_find(const string_table_t *table, const char *key) {
+  size_t mask = table->capacity - 1;
+  size_t slot = (size_t)hash_string(key) & mask;
+  while (table->keys[slot] && strcmp(table->keys[slot], key))
+    slot = (slot + 1) & mask;
+  return slot;
+}
+
+static int string_table_contains(const string_table_t *table, const char *key) {
+  return table->capacity && table->keys[string_table_find(table, key)] != NULL;
+}
+
+/// Returns the number of bytes `key` added.
+static int64_t string_table_insert(string_table_t *table, const char *key, int64_t size) {
+  if ((table->count + 1) * 2 > table->capacity) {
+    string_table_t grown = {NULL, NULL, table->capacity ? table->capacity * 2 : 64, 0};
+    grown.keys = calloc(grown.capacity, sizeof(char *));
+    grown.sizes = calloc(grown.capacity, sizeof(int64_t));
+    for (size_t i = 0; i < table->capacity; ++i) {
+      if (!table->keys[i])
+        continue;
+      size_t slot = string_table_find(&grown, table->keys[i]);
+      grown.keys[slot] = table->keys[i];
+      grown.sizes[slot] = table->sizes[i];
+      ++grown.count;
+    }
+    free(table->keys);
+    free(table->sizes);
+    *table = grown;
+  }
+  size_t slot = string_table_find(table, key);
+  if (table->keys[slot])
+    return 0;
+  table->keys[slot] = copy_bytes(key, strlen(key));
+  table->sizes[slot] = size;
+  ++table->count;
+  return size;
+}
+
+static void string_table_clear(string_table_t *table) {
+  for (size_t i = 0; i < table->capacity; ++i)
+    free(table->keys[i]);
+  free(table->keys);
+  free(table->sizes);
+  memset(table, 0, sizeof(*table));
+}
+
+/// The size a loaded output takes in the local CAS.
+static const int64_t output_size = 1024;
+
+struct swiftscan_cas_s {
+  struct swiftscan_cas_options_s options;
+  int is_remote;
+  pthread_mutex_t lock;
+  /// The objects in the local CAS, by CAS ID.
+  string_table_t objects;
+  /// The cache keys whose compilation is in the local CAS.
+  string_table_t keys;
+  int64_t size;
+  int64_t size_limit;
+};
+
+MOCK_EXPORT swiftscan_cas_options_t swiftscan_cas_options_create(void) {
+  swiftscan_cas_options_t options = calloc(1, sizeof(struct swiftscan_cas_options_s));
+  options->hit_percent = 100;
+  options->outputs_per_key = MOCK_SWIFTSCAN_DEFAULT_OUTPUTS_PER_KEY;
+  return options;
+}
+
+MOCK_EXPORT void swiftscan_cas_options_dispose(swiftscan_cas_options_t options) {
+  free(options->ondisk_path);
+  free(options->plugin_path);
+  free(options);
+}
+
+MOCK_EXPORT void swiftscan_cas_options_set_ondisk_path(swiftscan_cas_options_t options,
+                                                       const char *path) {
+  free(options->ondisk_path);
+  options->ondisk_path = copy_bytes(path, strlen(path));
+}
+
+MOCK_EXPORT void swiftscan_cas_options_set_plugin_path(swiftscan_cas_options_t options,
+                                                       const char *path) {
+  free(options->plugin_path);
+  options->plugin_path = copy_bytes(path, strlen(path));
+}
+
+MOCK_EXPORT bool
+swiftscan_cas_options_set_plugin_option(swiftscan_cas_options_t options,
+                                        const char *name, const char *value,
+                                        swiftscan_string_ref_t *error) {
+  unsigned long number = strtoul(value, NULL, 10);
+  if (!strcmp(name, "mock-latency-us")) {
+    options->latency_us = number;
+  } else if (!strcmp(name, "mock-hit-percent")) {
+    options->hit_percent = number;
+  } else if (!strcmp(name, "mock-outputs-per-key")) {
+    options->outputs_per_key = number;
+  } else {
+    *error = make_formatted_string("unknown mock CAS option '%s'", name);
+    return true;
+  }
+  return false;
+}
+
+MOCK_EXPORT swiftscan_cas_t
+swiftscan_cas_create_from_options(swiftscan_cas_options_t options,
+                                  swiftscan_string_ref_t *error) {
+  (void)error;
+  swiftscan_cas_t cas = calloc(1, sizeof(struct swiftscan_cas_s));
+  cas->options = *options;
+  cas->options.ondisk_path = NULL;
+  cas->options.plugin_path = NULL;
+  cas->is_remote = options->plugin_path != NULL;
+  cas->size_limit = -1;
+  pthread_mutex_init(&cas->lock, NULL);
+  return cas;
+}
+
+MOCK_EXPORT void swiftscan_cas_dispose(swiftscan_cas_t cas) {
+  string_table_clear(&cas->objects);
+  string_table_clear(&cas->keys);
+  pthread_mutex_destroy(&cas->lock);
+  free(cas);
+}
+
+static void add_object(swiftscan_cas_t cas, const char *casid, int64_t size) {
+  pthread_mutex_lock(&cas->lock);
+  cas->size += string_table_insert(&cas->objects, casid, size);
+  pthread_mutex_unlock(&cas->lock);
+}
+
+static int contains_object(swiftscan_cas_t cas, const char *casid) {
+  pthread_mutex_lock(&cas->lock);
+  int result = string_table_contains(&cas->objects, casid);
+  pthread_mutex_unlock(&cas->lock);
+  return result;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t swiftscan_cas_store(swiftscan_cas_t cas,
+                                                       uint8_t *data, unsigned size,
+                                                       swiftscan_string_ref_t *error) {
+  (void)error;
+  char casid[64];
+  snprintf(casid, sizeof(casid), "mock-cas:%016llx",
+           (unsigned long long)fnv1a(fnv1a_basis, data, size));
+  add_object(cas, casid, size);
+  return make_string(casid);
+}
+
+MOCK_EXPORT int64_t swiftscan_cas_get_ondisk_size(swiftscan_cas_t cas,
+                                                  swiftscan_string_ref_t *error) {
+  (void)error;
+  pthread_mutex_lock(&cas->lock);
+  int64_t size = cas->size;
+  pthread_mutex_unlock(&cas->lock);
+  return size;
+}
+
+MOCK_EXPORT bool swiftscan_cas_set_ondisk_size_limit(swiftscan_cas_t cas,
+                                                     int64_t size_limit,
+                                                     swiftscan_string_ref_t *error) {
+  (void)error;
+  pthread_mutex_lock(&cas->lock);
+  cas->size_limit = size_limit;
+  pthread_mutex_unlock(&cas->lock);
+  return false;
+}
+
+/// Like the on-disk CAS, evicts everything once it has outgrown its limit.
+MOCK_EXPORT bool swiftscan_cas_prune_ondisk_data(swiftscan_cas_t cas,
+                                                 swiftscan_string_ref_t *error) {
+  (void)error;
+  pthread_mutex_lock(&cas->lock);
+  if (cas->size_limit >= 0 && cas->size > cas->size_limit) {
+    string_table_clear(&cas->objects);
+    string_table_clear(&cas->keys);
+    cas->size = 0;
+  }
+  pthread_mutex_unlock(&cas->lock);
+  return false;
+}
+
+static swiftscan_string_ref_t make_cache_key(int argc, const char **argv,
+                                             const void *input, size_t input_length) {
+  uint64_t hash = fnv1a_basis;
+  for (int i = 0; i < argc; ++i)
+    hash = fnv1a(hash, argv[i], strlen(argv[i]) + 1);
+  hash = fnv1a(hash, input, input_length);
+  char key[64];
+  snprintf(key, sizeof(key), "mock-key:%016llx", (unsigned long long)hash);
+  return make_string(key);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_cache_compute_key(swiftscan_cas_t cas, int argc, const char **argv,
+                            const char *input, swiftscan_string_ref_t *error) {
+  (void)cas;
+  (void)error;
+  return make_cache_key(argc, argv, input, strlen(input));
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_cache_compute_key_from_input_index(swiftscan_cas_t cas, int argc,
+                                             const char **argv, unsigned input_index,
+                                             swiftscan_string_ref_t *error) {
+  (void)cas;
+  (void)error;
+  return make_cache_key(argc, argv, &input_index, sizeof(input_index));
+}
+
+//=== Cached Compilations -------------------------------------------------===//
+
+struct swiftscan_cached_compilation_s {
+  swiftscan_cas_t cas;
+  char *key;
+};
+
+struct swiftscan_cached_output_s {
+  swiftscan_cas_t cas;
+  char *casid;
+  const char *name;
+};
+
+static const char *output_kinds[] = {"object", "swiftmodule", "swiftdoc",
+                                     "swiftsourceinfo", "dependencies"};
+
+/// Returns the compilation cached under `key`, or null if there is none.
+static swiftscan_cached_compilation_t query(swiftscan_cas_t cas, const char *key,
+                                            bool globally) {
+  if (hash_string(key) % 100 >= cas->options.hit_percent)
+    return NULL;
+  pthread_mutex_lock(&cas->lock);
+  int is_local = !cas->is_remote || string_table_contains(&cas->keys, key);
+  // A compilation found in the remote cache is recorded locally, though its
+  // outputs are not.
+  if (!is_local && globally)
+    string_table_insert(&cas->keys, key, 0);
+  pthread_mutex_unlock(&cas->lock);
+  if (!is_local && !globally)
+    return NULL;
+
+  swiftscan_cached_compilation_t compilation =
+      malloc(sizeof(struct swiftscan_cached_compilation_s));
+  compilation->cas = cas;
+  compilation->key = copy_bytes(key, strlen(key));
+  return compilation;
+}
+
+MOCK_EXPORT swiftscan_cached_compilation_t
+swiftscan_cache_query(swiftscan_cas_t cas, const char *key, bool globally,
+                      swiftscan_string_ref_t *error) {
+  (void)error;
+  if (globally && cas->is_remote)
+    sleep_microseconds(cas->options.latency_us);
+  return query(cas, key, globally);
+}
+
+MOCK_EXPORT unsigned
+swiftscan_cached_compilation_get_num_outputs(swiftscan_cached_compilation_t compilation) {
+  return (unsigned)compilation->cas->options.outputs_per_key;
+}
+
+MOCK_EXPORT swiftscan_cached_output_t
+swiftscan_cached_compilation_get_output(swiftscan_cached_compilation_t compilation,
+                                        unsigned index) {
+  swiftscan_cached_output_t output = malloc(sizeof(struct swiftscan_cached_output_s));
+  output->cas = compilation->cas;
+  output->name = output_kinds[index % (sizeof(output_kinds) / sizeof(output_kinds[0]))];
+  char casid[64];
+  uint64_t hash = fnv1a(hash_string(compilation->key), &index, sizeof(index));
+  snprintf(casid, sizeof(casid), "mock-cas:%016llx", (unsigned long long)hash);
+  output->casid = copy_bytes(casid, strlen(casid));
+  return output;
+}
+
+MOCK_EXPORT bool
+swiftscan_cached_compilation_is_uncacheable(swiftscan_cached_compilation_t compilation) {
+  (void)compilation;
+  return false;
+}
+
+MOCK_EXPORT void
+swiftscan_cached_compilation_make_global_async(
+    swiftscan_cached_compilation_t compilation, void *context,
+    void (*callback)(void *context, swiftscan_string_ref_t error),
+    swiftscan_cache_cancellation_token_t *token) {
+  (void)compilation;
+  if (token)
+    *token = NULL;
+  callback(context, make_string(NULL));
+}
+
+MOCK_EXPORT void
+swiftscan_cached_compilation_dispose(swiftscan_cached_compilation_t compilation) {
+  free(compilation->key);
+  free(compilation);
+}
+
+MOCK_EXPORT bool swiftscan_cached_output_is_materialized(swiftscan_cached_output_t output) {
+  return !output->cas->is_remote || contains_object(output->cas, output->casid);
+}
+
+MOCK_EXPORT bool swiftscan_cached_output_load(swiftscan_cached_output_t output,
+                                              swiftscan_string_ref_t *error) {
+  (void)error;
+  if (!swiftscan_cached_output_is_materialized(output)) {
+    sleep_microseconds(output->cas->options.latency_us);
+    add_object(output->cas, output->casid, output_size);
+  }
+  return true;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_cached_output_get_casid(swiftscan_cached_output_t output) {
+  return make_string(output->casid);
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_cached_output_get_name(swiftscan_cached_output_t output) {
+  return make_string(output->name);
+}
+
+MOCK_EXPORT void swiftscan_cached_output_dispose(swiftscan_cached_output_t output) {
+  free(output->casid);
+  free(output);
+}
+
+//=== Asynchronous Operations ---------------------------------------------===//
+
+/// Shared by the operation and the client, each of which releases it.
+struct swiftscan_cache_cancellation_token_s {
+  atomic_int references;
+  atomic_bool is_cancelled;
+};
+
+static void release_token(swiftscan_cache_cancellation_token_t token) {
+  if (atomic_fetch_sub(&token->references, 1) == 1)
+    free(token);
+}
+
+MOCK_EXPORT void swiftscan_cache_action_cancel(swiftscan_cache_cancellation_token_t token) {
+  atomic_store(&token->is_cancelled, true);
+}
+
+MOCK_EXPORT void
+swiftscan_cache_cancellation_token_dispose(swiftscan_cache_cancellation_token_t token) {
+  release_token(token);
+}
+
+typedef enum { MOCK_QUERY, MOCK_LOAD, MOCK_DOWNLOAD } mock_operation_kind_t;
+
+/// An operation which completes on its own thread after the CAS's latency.
+typedef struct {
+  mock_operation_kind_t kind;
+  swiftscan_cas_t cas;
+  /// The cache key to query, or the CAS ID to load or download.
+  char *name;
+  bool globally;
+  void *context;
+  void (*query_callback)(void *, swiftscan_cached_compilation_t, swiftscan_string_ref_t);
+  void (*load_callback)(void *, bool, swiftscan_string_ref_t);
+  swiftscan_cache_cancellation_token_t token;
+} mock_operation_t;
+
+/// Waits out the latency in short steps, so that cancelling an operation
+/// completes it promptly. Returns whether it was cancelled.
+static int wait_for_latency(mock_operation_t *operation) {
+  unsigned long remaining = operation->cas->is_remote ? operation->cas->options.latency_us : 0;
+  while (remaining > 0 && !atomic_load(&operation->token->is_cancelled)) {
+    unsigned long step = remaining < 1000 ? remaining : 1000;
+    sleep_microseconds(step);
+    remaining -= step;
+  }
+  return atomic_load(&operation->token->is_cancelled);
+}
+
+static void *run_operation(void *argument) {
+  mock_operation_t *operation = argument;
+  int is_cancelled = wait_for_latency(operation);
+  swiftscan_string_ref_t error =
+      is_cancelled ? make_string("operation cancelled") : make_string(NULL);
+  switch (operation->kind) {
+  case MOCK_QUERY: {
+    swiftscan_cached_compilation_t compilation =
+        is_cancelled ? NULL : query(operation->cas, operation->name, operation->globally);
+    operation->query_callback(operation->context, compilation, error);
+    break;
+  }
+  case MOCK_LOAD:
+  case MOCK_DOWNLOAD:
+    if (!is_cancelled)
+      add_object(operation->cas, operation->name, output_size);
+    operation->load_callback(operation->context, !is_cancelled, error);
+    break;
+  }
+  free_string(error);
+  release_token(operation->token);
+  free(operation->name);
+  free(operation);
+  return NULL;
+}
+
+static void start_operation(mock_operation_t *operation,
+                            swiftscan_cache_cancellation_token_t *token) {
+  operation->token = calloc(1, sizeof(struct swiftscan_cache_cancellation_token_s));
+  atomic_init(&operation->token->references, token ? 2 : 1);
+  atomic_init(&operation->token->is_cancelled, false);
+  if (token)
+    *token = operation->token;
+
+  pthread_t thread;
+  pthread_attr_t attributes;
+  pthread_attr_init(&attributes);
+  pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+  if (pthread_create(&thread, &attributes, run_operation, operation) != 0)
+    run_operation(operation);
+  pthread_attr_destroy(&attributes);
+}
+
+MOCK_EXPORT void swiftscan_cache_query_async(
+    swiftscan_cas_t cas, const char *key, bool globally, void *context,
+    void (*callback)(void *context, swiftscan_cached_compilation_t,
+                     swiftscan_string_ref_t error),
+    swiftscan_cache_cancellation_token_t *token) {
+  mock_operation_t *operation = calloc(1, sizeof(mock_operation_t));
+  operation->kind = MOCK_QUERY;
+  operation->cas = cas;
+  operation->name = copy_bytes(key, strlen(key));
+  operation->globally = globally;
+  operation->context = context;
+  operation->query_callback = callback;
+  start_operation(operation, token);
+}
+
+MOCK_EXPORT void swiftscan_cached_output_load_async(
+    swiftscan_cached_output_t output, void *context,
+    void (*callback)(void *context, bool success, swiftscan_string_ref_t error),
+    swiftscan_cache_cancellation_token_t *token) {
+  mock_operation_t *operation = calloc(1, sizeof(mock_operation_t));
+  operation->kind = MOCK_LOAD;
+  operation->cas = output->cas;
+  operation->name = copy_bytes(output->casid, strlen(output->casid));
+  operation->context = context;
+  operation->load_callback = callback;
+  start_operation(operation, token);
+}
+
+MOCK_EXPORT void swiftscan_cache_download_cas_object_async(
+    swiftscan_cas_t cas, const char *casid, void *context,
+    void (*callback)(void *context, bool success, swiftscan_string_ref_t error),
+    swiftscan_cache_cancellation_token_t *token) {
+  mock_operation_t *operation = calloc(1, sizeof(mock_operation_t));
+  operation->kind = MOCK_DOWNLOAD;
+  operation->cas = cas;
+  operation->name = copy_bytes(casid, strlen(casid));
+  operation->context = context;
+  operation->load_callback = callback;
+  start_operation(operation, token);
+}
+
+//=== Cache Replay --------------------------------------------------------===//
+
+// Replaying a compilation produces no output, since none was recorded.
+
+struct swiftscan_cache_replay_instance_s {
+  int unused;
+};
+
+struct swiftscan_cache_replay_result_s {
+  swiftscan_string_ref_t std_out;
+  swiftscan_string_ref_t std_err;
+};
+
+MOCK_EXPORT swiftscan_cache_replay_instance_t
+swiftscan_cache_replay_instance_create(int argc, const char **argv,
+                                       swiftscan_string_ref_t *error) {
+  (void)argc;
+  (void)argv;
+  (void)error;
+  return calloc(1, sizeof(struct swiftscan_cache_replay_instance_s));
+}
+
+MOCK_EXPORT void
+swiftscan_cache_replay_instance_dispose(swiftscan_cache_replay_instance_t instance) {
+  free(instance);
+}
+
+MOCK_EXPORT swiftscan_cache_replay_result_t
+swiftscan_cache_replay_compilation(swiftscan_cache_replay_instance_t instance,
+                                   swiftscan_cached_compilation_t compilation,
+                                   swiftscan_string_ref_t *error) {
+  (void)instance;
+  (void)compilation;
+  (void)error;
+  return calloc(1, sizeof(struct swiftscan_cache_replay_result_s));
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_cache_replay_result_get_stdout(swiftscan_cache_replay_result_t result) {
+  return result->std_out;
+}
+
+MOCK_EXPORT swiftscan_string_ref_t
+swiftscan_cache_replay_result_get_stderr(swiftscan_cache_replay_result_t result) {
+  return result->std_err;
+}
+
+MOCK_EXPORT void
+swiftscan_cache_replay_result_dispose(swiftscan_cache_replay_result_t result) {
+  free(result);
+}
+
+#endif // !defined(_WIN32)
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef MOCK_SWIFTSCAN_H
+#define MOCK_SWIFTSCAN_H
+
+// A stand-in for libSwiftScan which implements the entry points declared in
+// `swiftscan_header.h` without a compiler behind them, so that the driver's
+// scanning and caching paths can be exercised and benchmarked on any host.
+//
+// Dependency scans synthesize a graph rather than reading any file. Its shape
+// is taken from the scan invocation's arguments:
+//
+//   -module-name <name>          The main module (default: "main").
+//   <file>.swift                 The main module's source files.
+//   -mock-scan-modules <n>       The number of modules the main module
+//                                depends on, directly or not (default: 100).
+//   -mock-scan-fanout <n>        The number of modules each one imports
+//                                (default: 4).
+//   -mock-scan-clang-percent <n> The share of those which are Clang modules,
+//                                which only import other Clang modules
+//                                (default: 50).
+//   -mock-scan-latency-us <n>    How long each scan takes (default: 0).
+//
+// The modules form a tree, in which every module also imports the last one,
+// the way every module imports the standard library.
+//
+// The CAS is kept in memory. It is configured with these plugin options:
+//
+//   mock-latency-us <n>          How long each query, load and download of a
+//                                remote object takes (default: 0).
+//   mock-hit-percent <n>         The share of cache keys with a cached
+//                                compilation (default: 100).
+//   mock-outputs-per-key <n>     How many outputs each one has (default: 2).
+//
+// With a plugin path, cached compilations are only in the "remote" cache
+// until queried globally, and their outputs until loaded or downloaded.
+// Without one, everything is in the local CAS already.
+
+#define MOCK_SWIFTSCAN_DEFAULT_MODULE_COUNT 100
+#define MOCK_SWIFTSCAN_DEFAULT_FANOUT 4
+#define MOCK_SWIFTSCAN_DEFAULT_CLANG_PERCENT 50
+#define MOCK_SWIFTSCAN_DEFAULT_OUTPUTS_PER_KEY 2
+
+#endif // MOCK_SWIFTSCAN_H
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Dispatch
+@_spi(Testing) import SwiftDriver
+import Testing
+
+@Suite struct CachedOutputPrefetcherTests {
+  @Test func fetchesEveryKeyWithinLimit() throws {
+    let keys = (0..<32).map { "key\($0)" }
+    let fetcher = MockCachedOutputFetcher(latency: .milliseconds(2),
+                                          cachedKeys: Set(keys.filter { !$0.hasSuffix("1") }))
+    let prefetcher = CachedOutputPrefetcher(fetcher: fetcher, maxInFlight: 4)
+    prefetcher.prefetch(Array(keys[..<16]))
+    prefetcher.prefetch(Array(keys[16...]))
+    let statistics = prefetcher.wait()
+
+    #expect(Set(fetcher.fetchedKeys) == Set(keys))
+    #expect(fetcher.peakInFlight <= 4)
+    #expect(statistics.peakInFlight == 4)
+    #expect(statistics.fetched + statistics.unavailable == keys.count)
+    #expect(statistics.unavailable == keys.filter { $0.hasSuffix("1") }.count)
+    #expect(statistics.failed == 0)
+    #expect(statistics.skipped == 0)
+    #expect(statistics.abandoned == 0)
+  }
+
+  @Test func cancellationStopsPendingAndInFlightFetches() throws {
+    let keys = (0..<8).map { "key\($0)" }
+    // Long enough that nothing finishes before it is cancelled.
+    let fetcher = MockCachedOutputFetcher(latency: .seconds(60), cachedKeys: Set(keys))
+    let prefetcher = CachedOutputPrefetcher(fetcher: fetcher, maxInFlight: 2)
+    prefetcher.prefetch(keys)
+    prefetcher.cancel()
+    let statistics = prefetcher.wait()
+
+    #expect(fetcher.fetchedKeys.isEmpty)
+    #expect(Set(fetcher.cancelledKeys) == ["key0", "key1"])
+    #expect(statistics.fetched == 0)
+    #expect(statistics.unavailable == 0)
+    #expect(statistics.failed == 0)
+    #expect(statistics.skipped == 6)
+    #expect(statistics.abandoned == 2)
+    #expect(statistics.peakInFlight == 2)
+
+    // Nothing more is fetched once cancelled.
+    prefetcher.prefetch(["key8"])
+    #expect(prefetcher.wait().skipped == 7)
+  }
+
+  @Test func waitDoesNotBlockOnCancelledFetches() throws {
+    let keys = (0..<4).map { "key\($0)" }
+    // Like a plugin which doesn't support cancellation, or one which is
+    // cancelled while it starts a download.
+    let fetcher = MockCachedOutputFetcher(latency: .seconds(60), cachedKeys: Set(keys),
+                                          ignoresCancellation: true)
+    let prefetcher = CachedOutputPrefetcher(fetcher: fetcher, maxInFlight: 2)
+    prefetcher.prefetch(keys)
+    prefetcher.cancel()
+    let start = DispatchTime.now()
+    let statistics = prefetcher.wait()
+    let elapsed = DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds
+
+    #expect(elapsed < 10_000_000_000)
+    #expect(fetcher.cancelledKeys.isEmpty)
+    #expect(statistics.abandoned == 2)
+    #expect(statistics.skipped == 2)
+  }
+}
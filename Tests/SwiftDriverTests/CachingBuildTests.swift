@@ -457,6 +457,96 @@ struct CachingBuildTests {
     }
   }
 
+  /// Compile job cache keys are computed concurrently after planning, and
+  /// must match the ones computed one job at a time.
+  @Test func batchedCompileJobCacheKeys() async throws {
+    try await withTemporaryDirectory { path in
+      let inputs = try (0..<8).map { index in
+        let input = path.appending(component: "testBatchedCacheKeys\(index).swift")
+        try localFileSystem.writeFileContents(input) {
+          $0.send("public func f\(index)() {}")
+        }
+        return input
+      }
+      let casPath = path.appending(component: "cas")
+      let moduleCachePath = path.appending(component: "ModuleCache")
+      try localFileSystem.createDirectory(moduleCachePath)
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+      var driver = try TestDriver(
+        args: [
+          "swiftc", "-module-name", "BatchedCacheKeys", "-c", "-j", "4",
+          "-explicit-module-build", "-module-cache-path", moduleCachePath.nativePathString(escaped: false),
+          "-cache-compile-job", "-cas-path", casPath.nativePathString(escaped: false),
+          "-working-directory", path.nativePathString(escaped: false),
+        ] + inputs.map { $0.nativePathString(escaped: false) } + sdkArgumentsForTesting,
+        interModuleDependencyOracle: InterModuleDependencyOracle()
+      )
+      let compileJobs = try await driver.planBuild().filter { $0.kind == .compile }
+      #expect(compileJobs.count == inputs.count)
+      for job in compileJobs {
+        #expect(job.outputCacheKeys.count == 1)
+        for (input, key) in job.outputCacheKeys {
+          let index = try #require(job.inputs.firstIndex(of: input))
+          let expectedKey = try driver.unwrap {
+            try $0.computeOutputCacheKey(commandLine: job.commandLine, index: index)
+          }
+          #expect(key == expectedKey)
+        }
+      }
+      #expect(!driver.diagnosticEngine.hasErrors)
+    }
+  }
+
+  /// Every planned job's cache keys are queried before execution: a fresh
+  /// CAS misses all of them, and the same build afterwards hits all of them.
+  @Test func cacheQueryBeforeExecution() async throws {
+    try await withTemporaryDirectory { path in
+      let inputs = try (0..<4).map { index in
+        let input = path.appending(component: "testCacheQuery\(index).swift")
+        try localFileSystem.writeFileContents(input) {
+          $0.send("public func f\(index)() {}")
+        }
+        return input
+      }
+      let casPath = path.appending(component: "cas")
+      let moduleCachePath = path.appending(component: "ModuleCache")
+      try localFileSystem.createDirectory(moduleCachePath)
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+      var driver = try TestDriver(
+        args: [
+          "swiftc", "-module-name", "CacheQuery", "-c", "-Rcache-compile-job",
+          "-explicit-module-build", "-module-cache-path", moduleCachePath.nativePathString(escaped: false),
+          "-cache-compile-job", "-cas-path", casPath.nativePathString(escaped: false),
+          "-working-directory", path.nativePathString(escaped: false),
+        ] + inputs.map { $0.nativePathString(escaped: false) } + sdkArgumentsForTesting,
+        interModuleDependencyOracle: InterModuleDependencyOracle()
+      )
+      let jobs = try await driver.planBuild()
+      let compileJobs = jobs.filter { $0.kind == .compile }
+      #expect(compileJobs.count == inputs.count)
+
+      let before = try #require(driver.unwrap { (d: Driver) in d.queryOutputCacheKeys(of: compileJobs) })
+      #expect(before.keys.count == inputs.count)
+      #expect(before.hitCount == 0)
+      for job in compileJobs {
+        #expect(before.status(of: job) == .miss)
+      }
+
+      try await driver.run(jobs: jobs)
+      #expect(!driver.diagnosticEngine.hasErrors)
+      #expect(driver.diagnosticEngine.diagnostics.contains {
+        $0.behavior == .remark && $0.message.text.hasPrefix("Compilation cache queried for ")
+      })
+
+      let after = try #require(driver.unwrap { (d: Driver) in d.queryOutputCacheKeys(of: compileJobs) })
+      #expect(after.hitCount == inputs.count)
+      #expect(after.missCount == 0)
+      for job in compileJobs {
+        #expect(after.status(of: job) == .hit)
+      }
+    }
+  }
+
   @Test func separateModuleJob() async throws {
     let (stdlibPath, shimsPath, _, _) = try getDriverArtifactsForScanning()
     try await withTemporaryDirectory { path in
@@ -1437,6 +1527,79 @@ struct CachingBuildTests {
     }
   }
 
+  @Test(.enabled(if: casSizeManagementSupported, "CAS size management is not supported"))
+  func casStorageManager() async throws {
+    #expect(CASStorageManager.parseSize("1024") == 1024)
+    #expect(CASStorageManager.parseSize("4k") == 4 << 10)
+    #expect(CASStorageManager.parseSize("20G") == 20 << 30)
+    #expect(CASStorageManager.parseSize("-1M") == nil)
+    #expect(CASStorageManager.parseSize("G") == nil)
+    #expect(CASStorageManager.parseSize("1T") == nil)
+
+    try withTemporaryDirectory { path in
+      let casPath = path.appending(component: "cas")
+      let driver = try TestDriver(args: ["swiftc"])
+      let scanLibPath = try #require(try driver.getSwiftScanLibPath())
+      let dependencyOracle = InterModuleDependencyOracle()
+      try dependencyOracle.verifyOrCreateScannerInstance(swiftScanLibPath: scanLibPath)
+      let cas = try dependencyOracle.getOrCreateCAS(pluginPath: nil, onDiskPath: casPath, pluginOptions: [])
+      _ = try cas.store(data: Data(count: 1000))
+
+      let manager = try #require(CASStorageManager(cas: cas, sizeLimit: 100))
+      #expect(try manager.wait() == nil)
+      manager.startEnforcingSizeLimit()
+      let result = try #require(try manager.wait())
+      #expect(result.sizeLimit == 100)
+      let sizeBefore = try #require(result.sizeBefore)
+      let sizeAfter = try #require(result.sizeAfter)
+      #expect(sizeBefore > 0)
+      #expect(sizeAfter <= sizeBefore)
+      #expect(try cas.getStorageSize() == sizeAfter)
+
+      let usage = try manager.usage(ofCacheKeys: ["missing-key", "missing-key"])
+      #expect(usage.outputs.isEmpty)
+      #expect(usage.missingKeys == 1)
+    }
+  }
+
+  @Test(.enabled(if: casSizeManagementSupported, "CAS size management is not supported"))
+  func casSizeLimitOption() async throws {
+    try await withTemporaryDirectory { path in
+      let moduleCachePath = path.appending(component: "ModuleCache")
+      let casPath = path.appending(component: "cas")
+      try localFileSystem.createDirectory(moduleCachePath)
+      let main = path.appending(component: "testCachingBuild.swift")
+      try localFileSystem.writeFileContents(main) { $0.send("let x = 1") }
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+
+      try await assertDriverDiagnostics(
+        args: [
+          "swiftc", "-no-color-diagnostics",
+          "-explicit-module-build", "-driver-warn-unused-options",
+          "-module-cache-path", moduleCachePath.nativePathString(escaped: false),
+          "-cache-compile-job", "-cas-path", casPath.nativePathString(escaped: false),
+          "-cas-size-limit", "1M", "-cache-remarks",
+          "-working-directory", path.nativePathString(escaped: false),
+          main.nativePathString(escaped: false),
+        ] + sdkArgumentsForTesting
+      ) { driver, verifier in
+        // The CAS is pruned while the jobs run, and reported on once they finish.
+        verifier.expect(.remark("CAS size limited to 1MB"))
+        verifier.expect(.remark("CAS outputs by kind"))
+        let jobs = try await driver.planBuild()
+        try await driver.run(jobs: jobs)
+        #expect(!driver.diagnosticEngine.hasErrors)
+      }
+    }
+  }
+
+  @Test func casSizeLimitDiagnostics() async throws {
+    try await assertDriverDiagnostics(args: "swiftc", "-cas-size-limit", "1X") {
+      $1.expect(.error("invalid value '1X' in '-cas-size-limit'"))
+    }
+    try await assertNoDriverDiagnostics(args: "swiftc", "-cas-size-limit", "10G")
+  }
+
   @Test(.flaky("cas resizing sometimes fails")) func casSizeLimiting() async throws {
     try await withTemporaryDirectory { path in
       let moduleCachePath = path.appending(component: "ModuleCache")
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+import TestUtilities
+import XCTest
+
+/// Benchmarks querying the compilation cache and fetching cached outputs from
+/// a remote cache, using a stand-in for the CAS plugin which adds a fixed
+/// latency to every fetch.
+///
+/// The `MockCAS` variants go through `SwiftScanCAS` to the in-memory CAS of
+/// the stand-in for libSwiftScan in `Tests/MockSwiftScan`, which adds the
+/// same latency to every remote query and load.
+class CachingPerformanceTests: XCTestCase {
+  let keys = (0..<64).map { "key\($0)" }
+  let latency = DispatchTimeInterval.milliseconds(10)
+
+  /// One fetch at a time, the way the frontend fetches each job's outputs
+  /// when the job starts.
+  func testFetchCachedOutputsSerially() {
+    measurePrefetch(maxInFlight: 1)
+  }
+
+  func testPrefetchCachedOutputs() {
+    measurePrefetch(maxInFlight: 16)
+  }
+
+  func testFetchFromMockCASSerially() throws {
+    try measurePrefetchFromMockCAS(maxInFlight: 1)
+  }
+
+  func testPrefetchFromMockCAS() throws {
+    try measurePrefetchFromMockCAS(maxInFlight: 16)
+  }
+
+  /// One local query at a time, the way the queries made before execution
+  /// are made without `swiftscan_cache_query_async`.
+  func testQueryMockCASSerially() throws {
+    try measureQueries { cas in
+      keys.map { key in Result { try cas.queryCacheKey(key, globally: false) } }
+    }
+  }
+
+  /// The local queries the driver makes, and waits for, before starting any
+  /// job.
+  func testQueryMockCAS() throws {
+    try measureQueries { cas in
+      cas.queryCacheKeys(keys, globally: false)
+    }
+  }
+
+  private func measurePrefetch(maxInFlight: Int) {
+    measure {
+      let fetcher = MockCachedOutputFetcher(latency: latency, cachedKeys: Set(keys))
+      let prefetcher = CachedOutputPrefetcher(fetcher: fetcher, maxInFlight: maxInFlight)
+      prefetcher.prefetch(keys)
+      XCTAssertEqual(prefetcher.wait().fetched, keys.count)
+    }
+  }
+
+  private func measureQueries(
+    _ query: (SwiftScanCAS) -> [Result<CachedCompilation?, Error>]
+  ) throws {
+    guard let libraryPath = MockSwiftScan.libraryPath else {
+      throw XCTSkip("MockSwiftScan is not built")
+    }
+    let pluginPath = try AbsolutePath(validating: "/mock/plugin")
+    let oracle = InterModuleDependencyOracle()
+    try oracle.verifyOrCreateScannerInstance(swiftScanLibPath: libraryPath)
+    let cas = try oracle.getOrCreateCAS(pluginPath: pluginPath, onDiskPath: nil,
+                                        pluginOptions: MockSwiftScan.casPluginOptions(latency: latency))
+    measure {
+      let answers = query(cas)
+      XCTAssertEqual(answers.count, keys.count)
+    }
+  }
+
+  private func measurePrefetchFromMockCAS(maxInFlight: Int) throws {
+    guard let libraryPath = MockSwiftScan.libraryPath else {
+      throw XCTSkip("MockSwiftScan is not built")
+    }
+    let pluginPath = try AbsolutePath(validating: "/mock/plugin")
+    measure {
+      // A new oracle for each iteration, so that nothing has been fetched yet.
+      let oracle = InterModuleDependencyOracle()
+      XCTAssertNoThrow(try oracle.verifyOrCreateScannerInstance(swiftScanLibPath: libraryPath))
+      guard let cas = try? oracle.getOrCreateCAS(pluginPath: pluginPath, onDiskPath: nil,
+                                                pluginOptions: MockSwiftScan.casPluginOptions(latency: latency)) else {
+        return XCTFail("unable to create the mock CAS")
+      }
+      let prefetcher = CachedOutputPrefetcher(fetcher: cas, maxInFlight: maxInFlight)
+      prefetcher.prefetch(keys)
+      XCTAssertEqual(prefetcher.wait().fetched, keys.count)
+    }
+  }
+}
@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_spi(Testing) import SwiftDriver
+@testable import SwiftOptions
+import TSCBasic
+import XCTest
+
+/// Benchmarks the command-line processing that happens on every driver
+/// invocation, one stage at a time, by replaying the recorded command lines in
+/// `TestInputs/CommandLineCorpus`.
+///
+/// Each corpus file is a response file with the flags of a large SwiftPM or
+/// Xcode build. The benchmark passes it to the driver as a nested response
+/// file which also refers to a generated response file listing the inputs,
+/// some of which need quoting.
+///
+/// `Sources/benchmarkOptions` parses the same corpus with LLVM's `OptTable`,
+/// as a baseline to compare against.
+class CommandLinePerformanceTests: XCTestCase {
+  /// The recorded command lines.
+  let corpus = ["swiftpm-debug.resp", "xcode-release.resp"]
+
+  let inputCount = benchmarkWorkload(debug: 500, release: 5000)
+
+  func testExpandResponseFiles() throws {
+    try withCorpus { commandLines in
+      measureTimeAndMemory {
+        for commandLine in commandLines {
+          _ = try Driver.expandResponseFiles(commandLine, fileSystem: localFileSystem,
+                                             diagnosticsEngine: DiagnosticsEngine())
+        }
+      }
+    }
+  }
+
+  func testParse() throws {
+    try withCorpus { commandLines in
+      let expandedCommandLines = try commandLines.map(expand)
+      let optionTable = OptionTable()
+      measureTimeAndMemory {
+        for arguments in expandedCommandLines {
+          _ = try optionTable.parse(arguments, for: .batch)
+        }
+      }
+    }
+  }
+
+  func testBuildIndex() throws {
+    try withCorpus { commandLines in
+      let parsedCommandLines = try commandLines.map(parse)
+      measureTimeAndMemory {
+        for var parsedOptions in parsedCommandLines {
+          parsedOptions.buildIndex()
+        }
+      }
+    }
+  }
+
+  func testComputeBuildRecordHash() throws {
+    try withCorpus { commandLines in
+      let parsedCommandLines = try commandLines.map(parse)
+      measureTimeAndMemory {
+        for parsedOptions in parsedCommandLines {
+          _ = BuildRecordArguments.computeHash(parsedOptions)
+        }
+      }
+    }
+  }
+
+  /// The hash recorded by earlier versions of the driver, for comparison.
+  func testComputeCompatibleBuildRecordHash() throws {
+    try withCorpus { commandLines in
+      let parsedCommandLines = try commandLines.map(parse)
+      measureTimeAndMemory {
+        for parsedOptions in parsedCommandLines {
+          _ = BuildRecordArguments.computeHash(parsedOptions, mode: .compatible)
+        }
+      }
+    }
+  }
+
+  /// Planning queries the parsed options for every job it creates, so this
+  /// makes a typical set of queries once per input.
+  func testOptionQueriesDuringPlanning() throws {
+    try withCorpus { commandLines in
+      let parsedCommandLines = try commandLines.map(parse)
+      measureTimeAndMemory {
+        for var parsedOptions in parsedCommandLines {
+          for _ in 0..<inputCount {
+            _ = parsedOptions.getLastArgument(.target)
+            _ = parsedOptions.getLastArgument(.moduleName)
+            _ = parsedOptions.hasArgument(.emitModule, .emitModulePath)
+            _ = parsedOptions.hasFlag(positive: .colorDiagnostics,
+                                      negative: .noColorDiagnostics,
+                                      default: false)
+            _ = parsedOptions.contains(.enableTesting)
+            _ = parsedOptions.getLast(in: .O)
+            _ = parsedOptions.arguments(for: .Xcc)
+            _ = parsedOptions.hasAnyInput
+          }
+        }
+      }
+    }
+  }
+
+  private func expand(_ commandLine: [String]) throws -> [String] {
+    try Driver.expandResponseFiles(commandLine, fileSystem: localFileSystem,
+                                   diagnosticsEngine: DiagnosticsEngine())
+  }
+
+  private func parse(_ commandLine: [String]) throws -> ParsedOptions {
+    try OptionTable().parse(expand(commandLine), for: .batch)
+  }
+
+  /// Writes the response files for the corpus to a temporary directory, and
+  /// calls `body` with a command line referring to each of them.
+  private func withCorpus(_ body: ([[String]]) throws -> Void) throws {
+    let corpusDirectory = try AbsolutePath(validating: #file)
+      .parentDirectory
+      .parentDirectory
+      .parentDirectory
+      .appending(components: "TestInputs", "CommandLineCorpus")
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { directory in
+      let inputs = directory.appending(component: "inputs.resp")
+      try localFileSystem.writeFileContents(inputs, bytes: ByteString(encodingAsUTF8:
+        (0..<inputCount).map { index in
+          let path = "Sources/Module\(index % 50)/File\(index).swift"
+          return index % 10 == 0 ? "\"/Users/build/My Project/\(path)\"" : "/Users/build/MyProject/\(path)"
+        }.joined(separator: "\n")))
+
+      var commandLines: [[String]] = []
+      for name in corpus {
+        let recorded = try localFileSystem.readFileContents(corpusDirectory.appending(component: name))
+        let invocation = directory.appending(component: name)
+        try localFileSystem.writeFileContents(invocation, bytes: ByteString(encodingAsUTF8:
+          recorded.cString + "@\(inputs.pathString)\n"))
+        commandLines.append(["@\(invocation.pathString)"])
+      }
+      try body(commandLines)
+    }
+  }
+}
@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+import TestUtilities
+import XCTest
+
+/// Benchmarks turning the dependency scanner's results into an
+/// `InterModuleDependencyGraph`, either by decoding every module up front or
+/// by decoding modules as they are looked up, over a generated project which
+/// imports a large number of Clang modules.
+///
+/// Each iteration scans the project and then walks the graph's structure the
+/// way planning does before it looks at individual modules.
+///
+/// It also compares scanning with a new scanner, as a standalone driver
+/// invocation does, with and without the scanner's cache from an earlier one.
+///
+/// The `Synthetic` variants decode a graph of the same size from the stand-in
+/// for libSwiftScan in `Tests/MockSwiftScan`, which needs no toolchain and
+/// takes no time to scan.
+class DependencyGraphPerformanceTests: XCTestCase {
+  let moduleCount = benchmarkWorkload(debug: 200, release: 2000)
+
+  func testDecodeScannedGraphEagerly() throws {
+    try measureScan(decodingModulesLazily: false)
+  }
+
+  func testDecodeScannedGraphLazily() throws {
+    try measureScan(decodingModulesLazily: true)
+  }
+
+  func testDecodeSyntheticGraphEagerly() throws {
+    try measureSyntheticScan(decodingModulesLazily: false)
+  }
+
+  func testDecodeSyntheticGraphLazily() throws {
+    try measureSyntheticScan(decodingModulesLazily: true)
+  }
+
+  func testScanWithColdScanner() throws {
+    try measureScanWithNewScanner(persistingScannerState: false)
+  }
+
+  func testScanWithPersistedScannerState() throws {
+    try measureScanWithNewScanner(persistingScannerState: true)
+  }
+
+  private func measureScan(decodingModulesLazily: Bool) throws {
+    try withSyntheticProject { oracle, _, workingDirectory, scannerCommand in
+      let scan = {
+        var diagnostics: [ScannerDiagnosticPayload] = []
+        let graph = try oracle.getDependencies(workingDirectory: workingDirectory,
+                                               commandLine: scannerCommand,
+                                               decodingModulesLazily: decodingModulesLazily,
+                                               diagnostics: &diagnostics)
+        let closure = try graph.computeTransitiveClosure()
+        XCTAssertGreaterThanOrEqual(closure[.swift("Main")]?.count ?? 0, self.moduleCount)
+      }
+      // Warm the scanner's cache, so that each iteration measures decoding
+      // rather than scanning from scratch.
+      try scan()
+      measureTimeAndMemory {
+        try scan()
+      }
+    }
+  }
+
+  private func measureSyntheticScan(decodingModulesLazily: Bool) throws {
+    guard let libraryPath = MockSwiftScan.libraryPath else {
+      throw XCTSkip("MockSwiftScan is not built")
+    }
+    let oracle = InterModuleDependencyOracle()
+    try oracle.verifyOrCreateScannerInstance(swiftScanLibPath: libraryPath)
+    let workingDirectory = try AbsolutePath(validating: "/tmp")
+    let scannerCommand = MockSwiftScan.scanArguments(moduleName: "Main", moduleCount: moduleCount)
+    let scan = {
+      var diagnostics: [ScannerDiagnosticPayload] = []
+      let graph = try oracle.getDependencies(workingDirectory: workingDirectory,
+                                             commandLine: scannerCommand,
+                                             decodingModulesLazily: decodingModulesLazily,
+                                             diagnostics: &diagnostics)
+      let closure = try graph.computeTransitiveClosure()
+      XCTAssertEqual(closure[.swift("Main")]?.count, self.moduleCount)
+    }
+    measureTimeAndMemory {
+      try scan()
+    }
+  }
+
+  private func measureScanWithNewScanner(persistingScannerState: Bool) throws {
+    try withSyntheticProject { _, scanLibPath, workingDirectory, scannerCommand in
+      let cachePath = workingDirectory.appending(component: "main.swiftmoduledeps")
+      let scan = { (cacheArguments: [String]) in
+        let oracle = InterModuleDependencyOracle()
+        try oracle.verifyOrCreateScannerInstance(swiftScanLibPath: scanLibPath)
+        var diagnostics: [ScannerDiagnosticPayload] = []
+        let graph = try oracle.getDependencies(workingDirectory: workingDirectory,
+                                               commandLine: scannerCommand + cacheArguments,
+                                               diagnostics: &diagnostics)
+        XCTAssertGreaterThanOrEqual(graph.moduleIds.count, self.moduleCount)
+      }
+      // The flags the driver passes with -persist-dependency-scan-cache.
+      let cacheArguments = ["-dependency-scan-cache-path", cachePath.nativePathString(escaped: false)]
+      let reuseArguments = persistingScannerState
+        ? cacheArguments + ["-reuse-dependency-scan-cache", "-validate-prior-dependency-scan-cache"]
+        : []
+      if persistingScannerState {
+        try scan(cacheArguments + ["-serialize-dependency-scan-cache"])
+      }
+      measureTimeAndMemory {
+        try scan(reuseArguments)
+      }
+    }
+  }
+
+  /// Generates a project with `moduleCount` Clang modules, each of which
+  /// imports a couple of the others, and calls `body` with a scanner, the
+  /// path of the library it was created from, and the command to scan the
+  /// project with.
+  private func withSyntheticProject(
+    _ body: (InterModuleDependencyOracle, AbsolutePath, AbsolutePath, [String]) throws -> Void
+  ) throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let headers = path.appending(component: "Headers")
+      try localFileSystem.createDirectory(headers)
+      var moduleMap = ""
+      for index in 0..<moduleCount {
+        moduleMap += "module M\(index) { header \"M\(index).h\" export * }\n"
+        // Import modules further down, so the graph is wide but shallow.
+        let imports = index == 0 ? [] : Set([index / 2, index / 3])
+        try localFileSystem.writeFileContents(
+          headers.appending(component: "M\(index).h"),
+          bytes: ByteString(encodingAsUTF8:
+            imports.sorted().map { "#include \"M\($0).h\"\n" }.joined() +
+            "int m\(index)(void);\n"))
+      }
+      try localFileSystem.writeFileContents(headers.appending(component: "module.modulemap"),
+                                            bytes: ByteString(encodingAsUTF8: moduleMap))
+      let main = path.appending(component: "main.swift")
+      try localFileSystem.writeFileContents(main, bytes: ByteString(encodingAsUTF8:
+        (moduleCount / 2..<moduleCount).map { "import M\($0)\n" }.joined()))
+
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+      var driver = try TestDriver(args: [
+        "swiftc", "-explicit-module-build", "-module-name", "Main",
+        "-I", headers.nativePathString(escaped: false),
+        "-working-directory", path.nativePathString(escaped: false),
+        main.nativePathString(escaped: false),
+      ] + sdkArgumentsForTesting)
+      guard let scanLibPath = try driver.toolchain.lookupSwiftScanLib() else {
+        throw XCTSkip("libSwiftScan is not available")
+      }
+      let oracle = InterModuleDependencyOracle()
+      try oracle.verifyOrCreateScannerInstance(swiftScanLibPath: scanLibPath)
+
+      let resolver = try ArgsResolver(fileSystem: localFileSystem)
+      var scannerCommand = try driver.dependencyScannerInvocationCommand().1.map { try resolver.resolve($0) }
+      if scannerCommand.first == "-frontend" {
+        scannerCommand.removeFirst()
+      }
+      try body(oracle, scanLibPath, path, scannerCommand)
+    }
+  }
+}
@@ -14,6 +14,7 @@
 
 @_spi(Testing) import SwiftDriver
 import TSCBasic
+import struct TSCUtility.Version
 import Testing
 
 @Suite struct DependencyGraphSerializationTests: ModuleDependencyGraphMocker {
@@ -60,7 +61,18 @@ import Testing
     }
   }
 
-  func roundTrip(_ originalGraph: ModuleDependencyGraph) throws {
+  /// Ensure that priors written in the oldest readable format are still read
+  @Test func oldestReadableVersionRoundTrip() throws {
+    let graph = Self.mockGraphCreator.mockUpAGraph()
+    graph.simulateLoad(0, [.nominal: ["A1@1", "A2@2", "B1->"]])
+    graph.simulateLoad(1, [.nominal: ["B1", "A1->B1"]])
+    graph.simulateLoad(2, [.externalDepend: ["/foo->"]], "ABCDEFG")
+    try roundTrip(graph,
+                  serializedGraphVersion: ModuleDependencyGraph.oldestReadableSerializedGraphVersion)
+  }
+
+  func roundTrip(_ originalGraph: ModuleDependencyGraph,
+                 serializedGraphVersion: Version? = nil) throws {
     let mockPath = VirtualPath.absolute(try AbsolutePath(validating: "/module-dependency-graph"))
     let fs = InMemoryFileSystem()
     let outputFileMap = OutputFileMap.mock(maxIndex: Self.maxIndex)
@@ -69,7 +81,8 @@ import Testing
       try originalGraph.write(
         to: mockPath,
         on: fs,
-        buildRecord: originalGraph.buildRecord
+        buildRecord: originalGraph.buildRecord,
+        mockSerializedGraphVersion: serializedGraphVersion
       )
     }
 
@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+import Testing
+
+@Suite struct DependencyScannerStateTests {
+  private func scannerState(in path: AbsolutePath, sdkPath: String = "/SDK") throws -> DependencyScannerState {
+    DependencyScannerState(buildRecordPath: try VirtualPath(path: path.appending(component: "main.swiftdeps").pathString),
+                           compilerVersion: "Swift version 6.3",
+                           compilerPath: "/usr/bin/swift-frontend",
+                           sdkPath: sdkPath,
+                           contextHash: "0123456789abcdef")
+  }
+
+  private func setModTime(of path: AbsolutePath, to date: Date) throws {
+    try FileManager.default.setAttributes([.modificationDate: date], ofItemAtPath: path.pathString)
+  }
+
+  /// When a scan which started after every edit the tests make began.
+  private var laterScanStartTime: TimePoint {
+    .now() + .seconds(300)
+  }
+
+  @Test func keyedByToolchainAndSDK() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let state = try scannerState(in: path)
+      let otherSDKState = try scannerState(in: path, sdkPath: "/OtherSDK")
+      #expect(state.key != otherSDKState.key)
+      #expect(state.cachePath != otherSDKState.cachePath)
+      #expect(state.key == (try scannerState(in: path)).key)
+    }
+  }
+
+  @Test func cacheReusedWhileInputsAreUnchanged() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let interface = path.appending(component: "A.swiftinterface")
+      let moduleMap = path.appending(component: "module.modulemap")
+      try localFileSystem.writeFileContents(interface, bytes: "// swift-module-flags: -module-name A")
+      try localFileSystem.writeFileContents(moduleMap, bytes: "module B { header \"B.h\" }")
+      let graph = try makeDependencyGraph(mainModuleName: "main", dependencies: [.swift("A")], modules: [
+        .swift("A", dependencies: [.clang("B")], interfacePath: interface.pathString),
+        .clang("B", moduleMapPath: moduleMap.pathString, contextHash: "X"),
+      ])
+
+      let state = try scannerState(in: path)
+      // Neither the cache nor its manifest exists yet.
+      #expect(!state.canReuseCache(fileSystem: localFileSystem))
+      try localFileSystem.writeFileContents(try #require(state.cachePath.absolutePath), bytes: "cache")
+      #expect(!state.canReuseCache(fileSystem: localFileSystem))
+
+      try state.recordInputs(of: graph, scannedSince: laterScanStartTime, fileSystem: localFileSystem)
+      #expect(state.canReuseCache(fileSystem: localFileSystem))
+      // A cache for another SDK doesn't use this one's manifest.
+      #expect(!(try scannerState(in: path, sdkPath: "/OtherSDK")).canReuseCache(fileSystem: localFileSystem))
+
+      // Touching an input without changing it keeps the cache.
+      try setModTime(of: interface, to: Date().addingTimeInterval(60))
+      #expect(state.canReuseCache(fileSystem: localFileSystem))
+
+      // Changing an input's contents doesn't.
+      try localFileSystem.writeFileContents(moduleMap, bytes: "module B { header \"C.h\" }")
+      try setModTime(of: moduleMap, to: Date().addingTimeInterval(120))
+      #expect(!state.canReuseCache(fileSystem: localFileSystem))
+
+      // Recording the new inputs makes it valid again, and removing one doesn't.
+      try state.recordInputs(of: graph, scannedSince: laterScanStartTime, fileSystem: localFileSystem)
+      #expect(state.canReuseCache(fileSystem: localFileSystem))
+      try localFileSystem.removeFileTree(interface)
+      #expect(!state.canReuseCache(fileSystem: localFileSystem))
+
+      state.invalidate(fileSystem: localFileSystem)
+      #expect(!localFileSystem.exists(try #require(state.cachePath.absolutePath)))
+      #expect(!localFileSystem.exists(try #require(state.manifestPath.absolutePath)))
+    }
+  }
+
+  @Test func inputModifiedDuringScanIsNotRecorded() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let interface = path.appending(component: "A.swiftinterface")
+      try localFileSystem.writeFileContents(interface, bytes: "// swift-module-flags: -module-name A")
+      let graph = try makeDependencyGraph(mainModuleName: "main", dependencies: [.swift("A")], modules: [
+        .swift("A", interfacePath: interface.pathString),
+      ])
+      let state = try scannerState(in: path)
+      try localFileSystem.writeFileContents(try #require(state.cachePath.absolutePath), bytes: "cache")
+
+      let scanStartTime = TimePoint.now()
+      try setModTime(of: interface, to: Date().addingTimeInterval(60))
+      #expect(throws: (any Error).self) {
+        try state.recordInputs(of: graph, scannedSince: scanStartTime, fileSystem: localFileSystem)
+      }
+      #expect(!localFileSystem.exists(try #require(state.manifestPath.absolutePath)))
+      #expect(!state.canReuseCache(fileSystem: localFileSystem))
+    }
+  }
+
+  @Test func cachesOfOtherKeysArePruned() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let graph = try makeDependencyGraph(mainModuleName: "main", dependencies: [], modules: [])
+      let priorScanPath = path.appending(component: "main.swiftmoduledeps.json")
+      try localFileSystem.writeFileContents(priorScanPath, bytes: "{}")
+      var states: [DependencyScannerState] = []
+      for index in 0...DependencyScannerState.maxCachedKeys {
+        let state = try scannerState(in: path, sdkPath: "/SDK\(index)")
+        try localFileSystem.writeFileContents(try #require(state.cachePath.absolutePath), bytes: "cache")
+        try state.recordInputs(of: graph, scannedSince: laterScanStartTime, fileSystem: localFileSystem)
+        // Record each key's manifest a minute after the previous one's.
+        try setModTime(of: try #require(state.manifestPath.absolutePath),
+                       to: Date().addingTimeInterval(Double(index - 10) * 60))
+        states.append(state)
+      }
+      // The oldest key's cache was removed to keep `maxCachedKeys` of them.
+      #expect(!localFileSystem.exists(try #require(states[0].cachePath.absolutePath)))
+      #expect(!localFileSystem.exists(try #require(states[0].manifestPath.absolutePath)))
+      for state in states.dropFirst() {
+        #expect(localFileSystem.exists(try #require(state.cachePath.absolutePath)))
+        #expect(localFileSystem.exists(try #require(state.manifestPath.absolutePath)))
+      }
+      // Files next to the build record which aren't a key's cache are kept.
+      #expect(localFileSystem.exists(priorScanPath))
+    }
+  }
+}
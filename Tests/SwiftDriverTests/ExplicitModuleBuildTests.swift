@@ -2741,6 +2741,129 @@ func getStdlibShimsPaths(_ driver: Driver) throws -> (AbsolutePath, AbsolutePath
     }
   }
 
+  @Test func lazilyDecodedDependencyGraph() async throws {
+    let (stdlibPath, shimsPath, toolchain, _) = try getDriverArtifactsForScanning()
+    let dependencyOracle = InterModuleDependencyOracle()
+    let scanLibPath = try #require(try toolchain.lookupSwiftScanLib())
+    try dependencyOracle.verifyOrCreateScannerInstance(swiftScanLibPath: scanLibPath)
+
+    try withTemporaryDirectory { path in
+      let main = path.appending(component: "testLazilyDecodedDependencyGraph.swift")
+      try localFileSystem.writeFileContents(main, bytes: "import C;import E;import G;")
+      let cHeadersPath: AbsolutePath =
+        try testInputsPath.appending(component: "ExplicitModuleBuilds")
+        .appending(component: "CHeaders")
+      let swiftModuleInterfacesPath: AbsolutePath =
+        try testInputsPath.appending(component: "ExplicitModuleBuilds")
+        .appending(component: "Swift")
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+      var driver = try TestDriver(
+        args: [
+          "swiftc",
+          "-I", cHeadersPath.nativePathString(escaped: false),
+          "-I", swiftModuleInterfacesPath.nativePathString(escaped: false),
+          "-I", stdlibPath.nativePathString(escaped: false),
+          "-I", shimsPath.nativePathString(escaped: false),
+          "-explicit-module-build",
+          "-working-directory", path.nativePathString(escaped: false),
+          "-disable-clang-target",
+          main.nativePathString(escaped: false),
+        ] + sdkArgumentsForTesting
+      )
+      let resolver = try ArgsResolver(fileSystem: localFileSystem)
+      var scannerCommand = try driver.dependencyScannerInvocationCommand().1.map { try resolver.resolve($0) }
+      if scannerCommand.first == "-frontend" {
+        scannerCommand.removeFirst()
+      }
+
+      var diagnostics: [ScannerDiagnosticPayload] = []
+      let eagerGraph = try dependencyOracle.getDependencies(workingDirectory: path,
+                                                            commandLine: scannerCommand,
+                                                            decodingModulesLazily: false,
+                                                            diagnostics: &diagnostics)
+      let lazyGraph = try dependencyOracle.getDependencies(workingDirectory: path,
+                                                           commandLine: scannerCommand,
+                                                           diagnostics: &diagnostics)
+
+      // Walking the graph's structure only decodes dependencies...
+      #expect(Set(lazyGraph.moduleIds) == Set(eagerGraph.modules.keys))
+      #expect(try lazyGraph.computeTransitiveClosure() == eagerGraph.computeTransitiveClosure())
+      for moduleId in eagerGraph.modules.keys {
+        #expect(lazyGraph.containsModule(moduleId))
+        #expect(try lazyGraph.moduleInfo(of: moduleId).allDependencies ==
+                eagerGraph.moduleInfo(of: moduleId).allDependencies)
+      }
+      #expect(!lazyGraph.containsModule(.clang("NotAModule")))
+      // ... and looking modules up decodes the same details.
+      #expect(lazyGraph.mainModule == eagerGraph.mainModule)
+      #expect(lazyGraph.modules == eagerGraph.modules)
+      let decoded = try JSONDecoder().decode(InterModuleDependencyGraph.self, from: lazyGraph.toJSONData())
+      #expect(decoded.modules == eagerGraph.modules)
+    }
+  }
+
+  @Test func batchDependencyScan() async throws {
+    let (stdlibPath, shimsPath, toolchain, _) = try getDriverArtifactsForScanning()
+    let dependencyOracle = InterModuleDependencyOracle()
+    let scanLibPath = try #require(try toolchain.lookupSwiftScanLib())
+    try dependencyOracle.verifyOrCreateScannerInstance(swiftScanLibPath: scanLibPath)
+
+    try withTemporaryDirectory { path in
+      let cHeadersPath: AbsolutePath =
+        try testInputsPath.appending(component: "ExplicitModuleBuilds")
+        .appending(component: "CHeaders")
+      let swiftModuleInterfacesPath: AbsolutePath =
+        try testInputsPath.appending(component: "ExplicitModuleBuilds")
+        .appending(component: "Swift")
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+      var invocations: [DependencyScanInvocation] = []
+      for (moduleName, imports) in [("First", "import C;import E;"), ("Second", "import E;import G;")] {
+        let main = path.appending(component: "\(moduleName).swift")
+        try localFileSystem.writeFileContents(main, bytes: ByteString(encodingAsUTF8: imports))
+        var driver = try TestDriver(
+          args: [
+            "swiftc", "-module-name", moduleName,
+            "-I", cHeadersPath.nativePathString(escaped: false),
+            "-I", swiftModuleInterfacesPath.nativePathString(escaped: false),
+            "-I", stdlibPath.nativePathString(escaped: false),
+            "-I", shimsPath.nativePathString(escaped: false),
+            "-explicit-module-build",
+            "-working-directory", path.nativePathString(escaped: false),
+            "-disable-clang-target",
+            main.nativePathString(escaped: false),
+          ] + sdkArgumentsForTesting
+        )
+        let resolver = try ArgsResolver(fileSystem: localFileSystem)
+        var scannerCommand = try driver.dependencyScannerInvocationCommand().1.map { try resolver.resolve($0) }
+        if scannerCommand.first == "-frontend" {
+          scannerCommand.removeFirst()
+        }
+        invocations.append(DependencyScanInvocation(workingDirectory: path, commandLine: scannerCommand))
+      }
+
+      let result = try dependencyOracle.getDependencies(forBatch: invocations)
+      #expect(result.graphs.map { $0.mainModuleName } == ["First", "Second"])
+      #expect(result.diagnostics.count == 2)
+      // Each graph is the one its invocation produces on its own.
+      for (invocation, batchGraph) in zip(invocations, result.graphs) {
+        var diagnostics: [ScannerDiagnosticPayload] = []
+        let graph = try dependencyOracle.getDependencies(workingDirectory: path,
+                                                         commandLine: invocation.commandLine,
+                                                         diagnostics: &diagnostics)
+        #expect(batchGraph.modules == graph.modules)
+      }
+
+      // Modules both scans found, in the same context, only appear once.
+      let uniqueModules = try result.uniqueModules()
+      let allModuleIds = Set(result.graphs.flatMap { graph in
+        graph.moduleIds.filter { $0 != .swift(graph.mainModuleName) }
+      })
+      #expect(Set(uniqueModules.keys.map { $0.id }) == allModuleIds)
+      #expect(uniqueModules.count == allModuleIds.count)
+      #expect(uniqueModules.keys.contains { $0.id == .swift("E") })
+    }
+  }
+
   // Ensure dependency scanning succeeds via fallback `swift-frontend -scan-dependenceis`
   // mechanism if libSwiftScan.dylib fails to load.
   @Test(.disabled("skipping until CAS is supported on all platforms"))
@@ -3183,6 +3306,94 @@ func getStdlibShimsPaths(_ driver: Driver) throws -> (AbsolutePath, AbsolutePath
     #expect(aModuleDependencies.contains(.swift("B")))
   }
 
+  @Test func mergingScanOfAddedImports() throws {
+    let priorGraph =
+      try JSONDecoder().decode(
+        InterModuleDependencyGraph.self,
+        from: ModuleDependenciesInputs.simpleDependencyGraphInputWithSwiftOverlayDep.data(using: .utf8)!
+      )
+    // A scan of a main module which imports `A` again and the new module `C`.
+    let scanOfAddedImports =
+      try JSONDecoder().decode(
+        InterModuleDependencyGraph.self,
+        from: """
+        {
+          "mainModuleName": "simpleTestModule",
+          "modules": [
+            { "swift": "simpleTestModule" },
+            {
+              "modulePath": "simpleTestModule.swiftmodule",
+              "sourceFiles": [ "/tmp/imports.swift" ],
+              "directDependencies": [ { "swift": "A" }, { "swift": "C" } ],
+              "details": { "swift": { "isFramework": false } }
+            },
+            { "swift": "A" },
+            {
+              "modulePath": "A-rescanned.swiftmodule",
+              "sourceFiles": [],
+              "directDependencies": [],
+              "details": { "swift": { "moduleInterfacePath": "A.swiftmodule/A.swiftinterface" } }
+            },
+            { "swift": "C" },
+            {
+              "modulePath": "C.swiftmodule",
+              "sourceFiles": [],
+              "directDependencies": [ { "swift": "A" } ],
+              "details": { "swift": { "moduleInterfacePath": "C.swiftmodule/C.swiftinterface" } }
+            }
+          ]
+        }
+        """.data(using: .utf8)!
+      )
+
+    let mergedGraph = try priorGraph.merging(scanOfAddedImports: scanOfAddedImports)
+    #expect(Set(mergedGraph.modules.keys) == Set(priorGraph.modules.keys).union([.swift("C")]))
+    // Modules which were already known keep their prior details.
+    #expect(mergedGraph.modules[.swift("A")] == priorGraph.modules[.swift("A")])
+    #expect(mergedGraph.modules[.swift("C")] == scanOfAddedImports.modules[.swift("C")])
+
+    let mainModule = try #require(mergedGraph.modules[.swift("simpleTestModule")])
+    #expect(mainModule.directDependencies == [.swift("A"), .swift("C")])
+    #expect(mainModule.sourceFiles == ["/main/simpleTestModule.swift"])
+    let reachabilityMap = try mergedGraph.computeTransitiveClosure()
+    #expect(try #require(reachabilityMap[.swift("simpleTestModule")]).contains(.swift("C")))
+  }
+
+  @Test func scanOfAddedImportsOnlyScansImportingSource() throws {
+    try withTemporaryDirectory { path in
+      let main = path.appending(component: "main.swift")
+      let importingSource = path.appending(component: "main-added-imports.swift")
+      try localFileSystem.writeFileContents(main, bytes: "import A\n")
+      var driver = try TestDriver(args: ["swiftc", "-explicit-module-build", "-module-name", "main",
+                                         "-working-directory", path.nativePathString(escaped: false),
+                                         main.nativePathString(escaped: false)] + sdkArgumentsForTesting)
+      let resolver = try ArgsResolver(fileSystem: localFileSystem)
+      let scannerCommand = try driver.dependencyScannerInvocationCommand(importingSource: .absolute(importingSource))
+        .1.map { try resolver.resolve($0) }
+      #expect(scannerCommand.contains(importingSource.pathString))
+      #expect(!scannerCommand.contains(main.pathString))
+      #expect(!scannerCommand.contains("-serialize-dependency-scan-cache"))
+    }
+  }
+
+  @Test func batchScanUniqueModulesByContextHash() throws {
+    func graph(_ mainModuleName: String, clangModules: [(String, String)]) throws -> InterModuleDependencyGraph {
+      try makeDependencyGraph(mainModuleName: mainModuleName,
+                              dependencies: clangModules.map { .clang($0.0) },
+                              modules: clangModules.map { .clang($0.0, contextHash: $0.1) })
+    }
+
+    // Each scan builds `B` in a different context, and `D` in the same one.
+    let result = BatchDependencyScanResult(graphs: [
+      try graph("First", clangModules: [("B", "X"), ("D", "X")]),
+      try graph("Second", clangModules: [("B", "Y"), ("D", "X")]),
+    ])
+    let uniqueModules = try result.uniqueModules()
+    #expect(Set(uniqueModules.keys.map { "\($0.id.moduleName)-\($0.contextHash ?? "")" }) == ["B-X", "B-Y", "D-X"])
+    let secondB = try #require(uniqueModules.first { $0.key.id == .clang("B") && $0.key.contextHash == "Y" })
+    #expect(secondB.value.modulePath.path == (try VirtualPath.intern(path: "B-Y.pcm")))
+  }
+
   @Test func explicitSwiftModuleMap() throws {
     let jsonExample: String = """
       [
@@ -3292,6 +3503,36 @@ func getStdlibShimsPaths(_ driver: Driver) throws -> (AbsolutePath, AbsolutePath
     }
   }
 
+  @Test func dependencyScanOverlapRemark() async throws {
+    try await withTemporaryDirectory { path in
+      let main = path.appending(component: "testDependencyScanOverlap.swift")
+      try localFileSystem.writeFileContents(main, bytes: "import C;import E;")
+      let cHeadersPath: AbsolutePath =
+        try testInputsPath.appending(component: "ExplicitModuleBuilds")
+        .appending(component: "CHeaders")
+      let swiftModuleInterfacesPath: AbsolutePath =
+        try testInputsPath.appending(component: "ExplicitModuleBuilds")
+        .appending(component: "Swift")
+      let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+
+      try await assertDriverDiagnostics(
+        args: [
+          "swiftc",
+          "-I", cHeadersPath.nativePathString(escaped: false),
+          "-I", swiftModuleInterfacesPath.nativePathString(escaped: false),
+          "-explicit-module-build",
+          "-driver-time-compilation",
+          "-working-directory", path.nativePathString(escaped: false),
+          main.nativePathString(escaped: false),
+        ] + sdkArgumentsForTesting
+      ) { driver, diagnostics in
+        diagnostics.expect(.remark("of which overlapped with planning"))
+        let jobs = try driver.planBuild()
+        #expect(jobs.contains { $0.moduleName == "E" })
+      }
+    }
+  }
+
   @Test func emitModuleSeparatelyJobs() async throws {
     try await withTemporaryDirectory { path in
       let moduleCachePath = path.appending(component: "ModuleCache")
@@ -3795,6 +4036,65 @@ func getStdlibShimsPaths(_ driver: Driver) throws -> (AbsolutePath, AbsolutePath
     }
   }
 
+  @Test func targetVariantScannedInBatch() async throws {
+    let (stdlibPath, shimsPath, _, _) = try getDriverArtifactsForScanning()
+    let cHeadersPath: AbsolutePath =
+      try testInputsPath.appending(component: "ExplicitModuleBuilds")
+      .appending(component: "CHeaders")
+    let swiftModuleInterfacesPath: AbsolutePath =
+      try testInputsPath.appending(component: "ExplicitModuleBuilds")
+      .appending(component: "Swift")
+    let sdkArgumentsForTesting = (try? Driver.sdkArgumentsForTesting()) ?? []
+
+    try await withTemporaryDirectory { path in
+      let main = path.appending(component: "testDependencyScanning.swift")
+      try localFileSystem.writeFileContents(
+        main,
+        bytes:
+          """
+          import C;\
+          import E;\
+          import G;
+          """
+      )
+      var driver = try TestDriver(
+        args: [
+          "swiftc",
+          "-module-name", "main",
+          "-experimental-emit-variant-module",
+          "-target", "x86_64-apple-macosx10.14",
+          "-target-variant", "x86_64-apple-ios13.1-macabi",
+          "-clang-target", "x86_64-apple-macosx12.14",
+          "-clang-target-variant", "x86_64-apple-ios15.1-macabi",
+          "-emit-module",
+          "-emit-module-path", "foo.swiftmodule/target.swiftmodule",
+          "-emit-variant-module-path", "foo.swiftmodule/variant.swiftmodule",
+          "-Xfrontend", "-disable-implicit-concurrency-module-import",
+          "-Xfrontend", "-disable-implicit-string-processing-module-import",
+          "-I", cHeadersPath.nativePathString(escaped: false),
+          "-I", swiftModuleInterfacesPath.nativePathString(escaped: false),
+          "-I", stdlibPath.nativePathString(escaped: false),
+          "-I", shimsPath.nativePathString(escaped: false),
+          "-explicit-module-build",
+          main.pathString,
+        ] + sdkArgumentsForTesting
+      )
+
+      // The variant is scanned in the same batch as the target module, so
+      // planning it doesn't need a scan of its own.
+      let pendingScan = try #require(try driver.startDependencyScan())
+      let (result, _) = try pendingScan.wait()
+      #expect(result.graphs.count == 2)
+      for graph in result.graphs {
+        #expect(graph.mainModuleName == "main")
+        #expect(graph.moduleIds.contains(.clang("C")))
+      }
+
+      let plannedJobs = try await driver.planBuild().removingAutolinkExtractJobs()
+      #expect(try plannedJobs.findJobs(.emitModule).count == 2)
+    }
+  }
+
   // We only care about prebuilt modules in macOS.
   #if os(macOS)
   @Test func prebuiltModuleGenerationJobs() throws {
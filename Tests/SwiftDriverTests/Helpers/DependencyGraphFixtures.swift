@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(Testing) import SwiftDriver
+
+/// A module of a dependency graph built by `makeDependencyGraph`, which only
+/// has the details tests need.
+struct FixtureModule {
+  let id: ModuleDependencyId
+  let modulePath: String
+  let dependencies: [ModuleDependencyId]
+  /// The JSON of the module's `details`.
+  let details: String
+
+  /// A Swift module built from `interfacePath`, if it has one.
+  static func swift(_ name: String, dependencies: [ModuleDependencyId] = [],
+                    interfacePath: String? = nil) -> FixtureModule {
+    let details = interfacePath.map { #"{ "moduleInterfacePath": "\#($0)" }"# } ?? "{}"
+    return FixtureModule(id: .swift(name), modulePath: "\(name).swiftmodule",
+                         dependencies: dependencies, details: #"{ "swift": \#(details) }"#)
+  }
+
+  /// A Clang module built in the context `contextHash`.
+  static func clang(_ name: String, dependencies: [ModuleDependencyId] = [],
+                    moduleMapPath: String? = nil, contextHash: String) -> FixtureModule {
+    let moduleMapPath = moduleMapPath ?? "/\(name)/module.modulemap"
+    return FixtureModule(id: .clang(name), modulePath: "\(name)-\(contextHash).pcm",
+                         dependencies: dependencies,
+                         details: #"{ "clang": { "moduleMapPath": "\#(moduleMapPath)", "contextHash": "\#(contextHash)" } }"#)
+  }
+}
+
+/// Decodes a dependency graph whose main module, with no sources, depends on
+/// `dependencies`, and which has `modules` besides.
+func makeDependencyGraph(mainModuleName: String,
+                         dependencies: [ModuleDependencyId],
+                         modules: [FixtureModule]) throws -> InterModuleDependencyGraph {
+  func json(_ id: ModuleDependencyId) -> String {
+    switch id {
+    case .swift(let name): return #"{ "swift": "\#(name)" }"#
+    case .clang(let name): return #"{ "clang": "\#(name)" }"#
+    case .swiftPrebuiltExternal(let name): return #"{ "swiftPrebuiltExternal": "\#(name)" }"#
+    }
+  }
+  func json(_ module: FixtureModule, sourceFiles: [String]? = nil) -> String {
+    """
+    \(json(module.id)),
+    {
+      "modulePath": "\(module.modulePath)",
+      \(sourceFiles.map { #""sourceFiles": [\#($0.joined(separator: ", "))],"# } ?? "")
+      "directDependencies": [ \(module.dependencies.map(json).joined(separator: ", ")) ],
+      "details": \(module.details)
+    }
+    """
+  }
+  let mainModule = FixtureModule.swift(mainModuleName, dependencies: dependencies)
+  let entries = [json(mainModule, sourceFiles: [])] + modules.map { json($0) }
+  return try JSONDecoder().decode(InterModuleDependencyGraph.self, from: Data("""
+    {
+      "mainModuleName": "\(mainModuleName)",
+      "modules": [
+        \(entries.joined(separator: ",\n"))
+      ]
+    }
+    """.utf8))
+}
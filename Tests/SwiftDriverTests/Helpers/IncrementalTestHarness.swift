@@ -1249,7 +1249,7 @@ extension DiagVerifiable {
     "No fingerprint in swiftmodule: Invalidating all nodes in newer: \(dependencyFile)"
   }
   @DiagsBuilder func dependencyNewerThanNode(_ dependencyFile: String) -> [Diagnostic.Message] {
-    "Newer: \(dependencyFile) -> SwiftDriver.ModuleDependencyGraph.Node"
+    "Newer: \(dependencyFile) -> "
   }
 
   // MARK: - tracing
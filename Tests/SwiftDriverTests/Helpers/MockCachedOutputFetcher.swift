@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Dispatch
+import Foundation
+@_spi(Testing) import SwiftDriver
+
+/// Stands in for a remote CAS plugin: every fetch takes `latency` to
+/// complete, and only the keys in `cachedKeys` have outputs to fetch. Unless
+/// `ignoresCancellation`, a cancelled fetch finishes early with an error.
+final class MockCachedOutputFetcher: CachedOutputFetcher {
+  let latency: DispatchTimeInterval
+  let cachedKeys: Set<String>
+  let ignoresCancellation: Bool
+
+  struct Cancelled: Error {}
+
+  private let lock = NSLock()
+  private var inFlight = 0
+  private(set) var peakInFlight = 0
+  private(set) var fetchedKeys: [String] = []
+  private(set) var cancelledKeys: [String] = []
+
+  init(latency: DispatchTimeInterval, cachedKeys: Set<String>,
+       ignoresCancellation: Bool = false) {
+    self.latency = latency
+    self.cachedKeys = cachedKeys
+    self.ignoresCancellation = ignoresCancellation
+  }
+
+  func fetchOutputs(of key: String,
+                    cancellation: CachedOutputPrefetcher.Cancellation,
+                    completion: @escaping (Result<Bool, Swift.Error>) -> Void) {
+    lock.lock()
+    inFlight += 1
+    peakInFlight = max(peakInFlight, inFlight)
+    lock.unlock()
+    var finished = false
+    func finish(cancelled: Bool) -> Bool {
+      // Whichever of cancellation and the download comes first wins.
+      lock.lock()
+      defer { lock.unlock() }
+      guard !finished else {
+        return false
+      }
+      finished = true
+      inFlight -= 1
+      if cancelled {
+        cancelledKeys.append(key)
+      } else {
+        fetchedKeys.append(key)
+      }
+      return true
+    }
+    if !ignoresCancellation {
+      cancellation.register {
+        // Finish early, like a download that is aborted.
+        guard finish(cancelled: true) else { return }
+        DispatchQueue.global().async { completion(.failure(Cancelled())) }
+      }
+    }
+    DispatchQueue.global().asyncAfter(deadline: .now() + latency) {
+      guard finish(cancelled: false) else { return }
+      completion(.success(self.cachedKeys.contains(key)))
+    }
+  }
+}
@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import XCTest
+
+/// The size of a benchmark's workload: just enough to be sure it works in a
+/// debug build, and the real test in optimized code.
+func benchmarkWorkload(debug: Int, release: Int) -> Int {
+  #if DEBUG
+  return debug
+  #else
+  return release
+  #endif
+}
+
+extension XCTestCase {
+  /// Measures `block`, reporting memory use alongside latency where XCTest
+  /// supports it.
+  func measureTimeAndMemory(_ block: () throws -> Void) {
+    #if canImport(Darwin)
+    measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+      XCTAssertNoThrow(try block())
+    }
+    #else
+    measure {
+      XCTAssertNoThrow(try block())
+    }
+    #endif
+  }
+}
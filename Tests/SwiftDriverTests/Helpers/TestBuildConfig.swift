@@ -255,6 +255,15 @@ let cachingFeatureSupported: Bool = {
   return driver.isFeatureSupported(.compilation_caching)
 }()
 
+/// Whether the on-disk CAS can limit and prune its size.
+let casSizeManagementSupported: Bool = {
+  guard let oracle = _scannerOracle else { return false }
+  return (try? withTemporaryDirectory { path in
+    try oracle.getOrCreateCAS(pluginPath: nil, onDiskPath: path.appending(component: "cas"),
+                              pluginOptions: []).supportsSizeManagement
+  }) ?? false
+}()
+
 /// Probe `swift-frontend -print-target-info` for whether it accepts a target triple.
 ///
 /// Returns `true` when the frontend handles the triple, `false` when it rejects
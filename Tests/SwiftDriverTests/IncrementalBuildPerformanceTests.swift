@@ -20,7 +20,7 @@ import TSCBasic
 import XCTest
 
 class IncrementalBuildPerformanceTests: XCTestCase {
-  enum WhatToMeasure { case readingSwiftDeps, writing, readingPriors }
+  enum WhatToMeasure { case readingSwiftDeps, readingSwiftDepsSerially, writing, readingPriors }
 
   /// Test the cost of reading `swiftdeps` files without doing a full build. Use the files in "TestInputs/SampleSwiftDeps"
   ///
@@ -37,6 +37,11 @@ class IncrementalBuildPerformanceTests: XCTestCase {
   func testCleanBuildSwiftDepsPerformance() throws {
     try testPerformance(.readingSwiftDeps)
   }
+  /// Like ``testCleanBuildSwiftDepsPerformance``, but decodes each `swiftdeps` file in turn on the
+  /// incremental compilation queue, as the driver used to.
+  func testCleanBuildSwiftDepsSeriallyPerformance() throws {
+    try testPerformance(.readingSwiftDepsSerially)
+  }
   func testSavingPriorsPerformance() throws {
     try testPerformance(.writing)
   }
@@ -83,9 +88,16 @@ class IncrementalBuildPerformanceTests: XCTestCase {
       .mock(options: [], outputFileMap: outputFileMap)
 
     let g = ModuleDependencyGraph.createForSimulatingCleanBuild(info.buildRecordInfo.buildRecord([], []), info)
+    if whatToMeasure == .readingSwiftDeps {
+      // Only integrating the decoded files needs the queue.
+      measure { readSwiftDepsConcurrently(for: inputs, into: g) }
+      return
+    }
     g.blockingConcurrentAccessOrMutation {
       switch whatToMeasure {
       case .readingSwiftDeps:
+        break
+      case .readingSwiftDepsSerially:
         measure { readSwiftDeps(for: inputs, into: g) }
       case .writing:
         readSwiftDeps(for: inputs, into: g)
@@ -160,4 +172,18 @@ class IncrementalBuildPerformanceTests: XCTestCase {
 
     XCTAssertEqual(result.count, 0, "Should be no invalid inputs left")
   }
+
+  /// Like ``readSwiftDeps(for:into:)``, but decodes the `swiftdeps` files concurrently, off the
+  /// incremental compilation queue, as the driver does when a batch of compiles finishes.
+  private func readSwiftDepsConcurrently(for inputs: [SwiftSourceFile], into g: ModuleDependencyGraph) {
+    let decodedDependencies = ModuleDependencyGraph.decodeDependencies(of: inputs, info: g.info)
+    let result = g.blockingConcurrentAccessOrMutation {
+      decodedDependencies.reduce(into: Set()) { invalidatedInputs, decoded in
+        invalidatedInputs.formUnion(g.collectInputsRequiringCompilation(byCompiling: decoded)!)
+      }
+    }
+    .subtracting(inputs)  // have already compiled these
+
+    XCTAssertEqual(result.count, 0, "Should be no invalid inputs left")
+  }
 }
@@ -268,6 +268,107 @@ struct IncrementalExplicitBuildTests: DiagVerifiable {
     }
   }
 
+  // MARK: - Reusing the prior dependency scan
+
+  /// Builds with `-reuse-prior-dependency-scan`, expecting the driver to report
+  /// how it brought the prior dependency scan up to date.
+  private func buildReusingPriorDependencyScan(
+    _ h: IncrementalTestHarness,
+    expecting decision: String? = nil
+  ) async throws {
+    let args = h.commonArgs + h.explicitBuildArgs + ["-reuse-prior-dependency-scan"] + h.sdkArgumentsForTesting
+    try await assertDriverDiagnostics(args: args) { driver, verifier in
+      if let decision {
+        verifier.expect(.remark("Incremental compilation: \(decision)"))
+      }
+      await h.doTheCompile(&driver)
+    }
+  }
+
+  /// Rewrites a field of the prior dependency scan saved by the last build.
+  private func editPriorDependencyScan(_ h: IncrementalTestHarness, _ key: String, to value: Any) throws {
+    let path = h.derivedDataPath.appending(component: "\(h.module)-main.swiftmoduledeps.json")
+    var scan = try #require(
+      try JSONSerialization.jsonObject(with: Data(localFileSystem.readFileContents(path).contents))
+        as? [String: Any])
+    scan[key] = value
+    try localFileSystem.writeFileContents(path, bytes: ByteString(try JSONSerialization.data(withJSONObject: scan)))
+  }
+
+  @Test(arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanWhenNothingChanged(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    try await buildReusingPriorDependencyScan(h)
+    try await buildReusingPriorDependencyScan(h, expecting: "Reusing prior dependency scan")
+  }
+
+  @Test(.requireScannerSupportsImportInfos(), arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanWhenImportsUnchanged(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    h.replace(contentsOf: "other", with: "import E;let bar = foo")
+    try await buildReusingPriorDependencyScan(h)
+    h.replace(contentsOf: "other", with: "import E;let bar = foo + 1")
+    try await buildReusingPriorDependencyScan(h, expecting: "Reusing prior dependency scan")
+  }
+
+  @Test(.requireScannerSupportsImportInfos(), arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanScansAddedImports(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    try await buildReusingPriorDependencyScan(h)
+    h.replace(contentsOf: "other", with: "import E;let bar = foo")
+    try await buildReusingPriorDependencyScan(h, expecting: "Scanning dependencies of added imports: [E]")
+    // The merged scan is saved for the next build.
+    try await buildReusingPriorDependencyScan(h, expecting: "Reusing prior dependency scan")
+  }
+
+  @Test(.requireScannerSupportsImportInfos(), arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanRescansRemovedImports(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    h.replace(contentsOf: "other", with: "import E;let bar = foo")
+    try await buildReusingPriorDependencyScan(h)
+    h.replace(contentsOf: "other", with: "let bar = foo")
+    try await buildReusingPriorDependencyScan(h, expecting: "Scanning all dependencies: imports were removed")
+  }
+
+  @Test(arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanRescansChangedKey(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    try await buildReusingPriorDependencyScan(h)
+    try editPriorDependencyScan(h, "key", to: "0000000000000000")
+    try await buildReusingPriorDependencyScan(
+      h, expecting: "Scanning all dependencies: the compiler, SDK, target or arguments changed")
+  }
+
+  @Test(arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanRescansChangedSerializedScan(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    try await buildReusingPriorDependencyScan(h)
+    h.touch(h.serializedDepScanCachePath)
+    try await buildReusingPriorDependencyScan(
+      h, expecting: "Scanning all dependencies: the serialized dependency scan changed")
+  }
+
+  @Test(arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanRescansChangedSourceFiles(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    try await buildReusingPriorDependencyScan(h)
+    try editPriorDependencyScan(h, "sourceFiles", to: [h.inputPath(basename: "main").pathString])
+    try await buildReusingPriorDependencyScan(
+      h, expecting: "Scanning all dependencies: the set of source files changed")
+  }
+
+  @Test(arguments: TestBuildConfig.explicitOnlyConfigs)
+  func reusePriorDependencyScanRescansStaleModules(config: TestBuildConfig) async throws {
+    let h = try IncrementalTestHarness(config: config)
+    h.replace(contentsOf: "other", with: "import E;let bar = foo")
+    try await buildReusingPriorDependencyScan(h)
+    let EInterfacePath = h.explicitSwiftDependenciesPath.appending(component: "E.swiftinterface")
+    h.touch(EInterfacePath)
+    h.touch(EInterfacePath)
+    try await buildReusingPriorDependencyScan(
+      h, expecting: "Scanning all dependencies: module dependencies changed: [E]")
+  }
+
   // MARK: - Binary dependency invalidation tests
 
   // A dependency has been re-built to be newer than its dependents so we must
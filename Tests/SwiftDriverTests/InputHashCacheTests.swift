@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+import Testing
+
+@Suite struct InputHashCacheTests {
+  /// Lets the cache keep the hashes of files written by the test.
+  private let later = TimePoint(seconds: UInt64(Date().timeIntervalSince1970) + 3600, nanoseconds: 0)
+
+  private func makeCache(in path: AbsolutePath, hashFunction: InputHashFunction = .sha256,
+                         now: TimePoint? = nil) throws -> InputHashCache {
+    InputHashCache(path: try VirtualPath(path: path.appending(component: "main.inputhashes.json").pathString),
+                   hashFunction: hashFunction, fileSystem: localFileSystem, now: now ?? later)
+  }
+
+  private func hash(of path: AbsolutePath, with cache: InputHashCache) throws -> String? {
+    let file = VirtualPath.absolute(path)
+    return cache.hash(of: file, modTime: try localFileSystem.lastModificationTime(for: file),
+                      fileSystem: localFileSystem)
+  }
+
+  @Test func hashFunctions() {
+    let contents: ByteString = "let x = 1\n"
+    #expect(InputHashFunction.sha256.hash(contents) == SHA256().hash(contents).hexadecimalRepresentation)
+    let stableHash = InputHashFunction.stable.hash(contents)
+    #expect(stableHash.count == 16)
+    #expect(stableHash == InputHashFunction.stable.hash("let x = 1\n"))
+    #expect(stableHash != InputHashFunction.stable.hash("let x = 2\n"))
+  }
+
+  @Test func unchangedFilesAreNotHashedAgain() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let main = path.appending(component: "main.swift")
+      let other = path.appending(component: "other.swift")
+      try localFileSystem.writeFileContents(main, bytes: "let x = 1\n")
+      try localFileSystem.writeFileContents(other, bytes: "let y = 1\n")
+
+      let coldCache = try makeCache(in: path)
+      let mainHash = try hash(of: main, with: coldCache)
+      #expect(mainHash == InputHashFunction.sha256.hash("let x = 1\n"))
+      _ = try hash(of: other, with: coldCache)
+      #expect(coldCache.hitCount == 0)
+      try coldCache.save(fileSystem: localFileSystem)
+
+      let warmCache = try makeCache(in: path)
+      #expect(try hash(of: main, with: warmCache) == mainHash)
+      #expect(warmCache.hitCount == 1)
+
+      // Writing to a file changes its size or modification time.
+      try localFileSystem.writeFileContents(other, bytes: "let y = 22\n")
+      #expect(try hash(of: other, with: warmCache) == InputHashFunction.sha256.hash("let y = 22\n"))
+      #expect(warmCache.hitCount == 1)
+    }
+  }
+
+  @Test func recentlyModifiedFilesAreNotCached() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let main = path.appending(component: "main.swift")
+      try localFileSystem.writeFileContents(main, bytes: "let x = 1\n")
+      let cache = try makeCache(in: path, now: .now())
+      _ = try hash(of: main, with: cache)
+      try cache.save(fileSystem: localFileSystem)
+      #expect(!localFileSystem.exists(path.appending(component: "main.inputhashes.json")))
+    }
+  }
+
+  @Test func cacheIsKeyedByHashFunction() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let main = path.appending(component: "main.swift")
+      try localFileSystem.writeFileContents(main, bytes: "let x = 1\n")
+      let cache = try makeCache(in: path)
+      _ = try hash(of: main, with: cache)
+      try cache.save(fileSystem: localFileSystem)
+
+      let stableCache = try makeCache(in: path, hashFunction: .stable)
+      #expect(try hash(of: main, with: stableCache) == InputHashFunction.stable.hash("let x = 1\n"))
+      #expect(stableCache.hitCount == 0)
+    }
+  }
+
+  @Test func recordInputMetadataConcurrently() throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      var inputs: [TypedVirtualPath] = []
+      for index in 0..<64 {
+        let file = path.appending(component: "file\(index).swift")
+        try localFileSystem.writeFileContents(file, bytes: ByteString(encodingAsUTF8: "let x\(index) = 1\n"))
+        inputs.append(TypedVirtualPath(file: VirtualPath.absolute(file).intern(), type: .swift))
+      }
+      let missing = TypedVirtualPath(file: VirtualPath.absolute(path.appending(component: "missing.swift")).intern(),
+                                     type: .swift)
+
+      let withoutHashes = Driver.recordInputMetadata(of: inputs + [missing, inputs[0]], hashFunction: nil,
+                                                     hashCache: nil, fileSystem: localFileSystem)
+      #expect(withoutHashes.count == inputs.count)
+      #expect(withoutHashes.values.allSatisfy { $0.hash == nil })
+
+      let cache = try makeCache(in: path, hashFunction: .stable)
+      let withHashes = Driver.recordInputMetadata(of: inputs, hashFunction: .stable,
+                                                  hashCache: cache, fileSystem: localFileSystem)
+      for (index, input) in inputs.enumerated() {
+        #expect(withHashes[input]?.hash ==
+                InputHashFunction.stable.hash(ByteString(encodingAsUTF8: "let x\(index) = 1\n")))
+        #expect(withHashes[input]?.mTime == withoutHashes[input]?.mTime)
+      }
+    }
+  }
+}
@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+import XCTest
+
+/// Benchmarks recording the modification times and hashes of a module's
+/// inputs, which the driver does before planning with
+/// `-enable-incremental-file-hashing`, over a generated module.
+///
+/// The cold variants hash every input, as the first build does. The warm
+/// variants start from the hashes an earlier build saved next to the build
+/// record, as a build in which no input changed does.
+class InputHashingPerformanceTests: XCTestCase {
+  let inputCount = benchmarkWorkload(debug: 300, release: 3000)
+
+  /// About the size of a typical source file.
+  let linesPerInput = 400
+
+  func testRecordModificationTimes() throws {
+    try measureRecording(hashFunction: nil, warmCache: false)
+  }
+
+  func testHashWithSHA256ColdCache() throws {
+    try measureRecording(hashFunction: .sha256, warmCache: false)
+  }
+
+  func testHashWithSHA256WarmCache() throws {
+    try measureRecording(hashFunction: .sha256, warmCache: true)
+  }
+
+  func testHashWithStableHasherColdCache() throws {
+    try measureRecording(hashFunction: .stable, warmCache: false)
+  }
+
+  func testHashWithStableHasherWarmCache() throws {
+    try measureRecording(hashFunction: .stable, warmCache: true)
+  }
+
+  private func measureRecording(hashFunction: InputHashFunction?, warmCache: Bool) throws {
+    try withTemporaryDirectory(removeTreeOnDeinit: true) { path in
+      let inputs = try (0..<inputCount).map { index -> TypedVirtualPath in
+        let file = path.appending(component: "File\(index).swift")
+        let contents = (0..<linesPerInput).map { "let value\(index)_\($0) = \($0) // padding the line out" }
+        try localFileSystem.writeFileContents(file, bytes: ByteString(encodingAsUTF8: contents.joined(separator: "\n")))
+        return TypedVirtualPath(file: VirtualPath.absolute(file).intern(), type: .swift)
+      }
+      let cachePath = try VirtualPath(path: path.appending(component: "main.inputhashes.json").pathString)
+      // Count the inputs as written long enough ago to be cached.
+      let now = TimePoint(seconds: UInt64(Date().timeIntervalSince1970) + 3600, nanoseconds: 0)
+      func makeCache() -> InputHashCache? {
+        hashFunction.map { InputHashCache(path: cachePath, hashFunction: $0, fileSystem: localFileSystem, now: now) }
+      }
+      if warmCache, let cache = makeCache() {
+        _ = Driver.recordInputMetadata(of: inputs, hashFunction: hashFunction,
+                                       hashCache: cache, fileSystem: localFileSystem)
+        try cache.save(fileSystem: localFileSystem)
+      }
+
+      func record() {
+        // Without a saved cache, this one starts empty.
+        let cache = makeCache()
+        let metadata = Driver.recordInputMetadata(of: inputs, hashFunction: hashFunction,
+                                                  hashCache: cache, fileSystem: localFileSystem)
+        XCTAssertEqual(metadata.count, inputs.count)
+        XCTAssertEqual(cache?.hitCount ?? 0, warmCache ? inputs.count : 0)
+      }
+      measureTimeAndMemory {
+        record()
+      }
+    }
+  }
+}
@@ -827,6 +827,22 @@ import CRT
     }
   }
 
+  @Test func buildRecordArgumentsHash() throws {
+    func hash(_ arguments: [String], mode: BuildRecordArguments.HashMode = .fast) throws -> String {
+      try BuildRecordArguments.computeHash(OptionTable().parse(arguments, for: .batch), mode: mode)
+    }
+    let arguments = ["-module-name", "A", "-Xcc", "-DX", "main.swift"]
+    #expect(try hash(arguments).count == 16)
+    // Inputs and options which don't affect incremental builds are ignored.
+    #expect(try hash(arguments) == hash(arguments + ["-color-diagnostics", "other.swift"]))
+    #expect(try hash(arguments) != hash(arguments + ["-O"]))
+    #expect(try hash(arguments) != hash(["-module-name", "A", "-Xcc", "-DY", "main.swift"]))
+    #expect(try hash(arguments) != hash(["-Xcc", "-DX", "-module-name", "A", "main.swift"]))
+    // The compatible mode matches the hash recorded by earlier drivers.
+    #expect(try hash(arguments, mode: .compatible) ==
+            SHA256().hash("-module-name A-Xcc -DX").hexadecimalRepresentation)
+  }
+
   @Test func warnConcurrency() async throws {
     do {
       var driver = try TestDriver(args: ["swiftc", "-warn-concurrency", "foo.swift"])
@@ -0,0 +1,162 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+import TestUtilities
+import Testing
+
+/// Exercises the driver's side of libSwiftScan against the stand-in built
+/// from `Tests/MockSwiftScan`, which needs no toolchain. Skipped unless the
+/// `MockSwiftScan` product has been built, e.g. with
+/// `swift build --product MockSwiftScan`.
+@Suite(.enabled(if: MockSwiftScan.libraryPath != nil, "MockSwiftScan is not built"))
+struct MockSwiftScanTests {
+  private func makeOracle() throws -> InterModuleDependencyOracle {
+    let libraryPath = try #require(MockSwiftScan.libraryPath)
+    let oracle = InterModuleDependencyOracle()
+    try oracle.verifyOrCreateScannerInstance(swiftScanLibPath: libraryPath)
+    return oracle
+  }
+
+  @Test func synthesizedGraph() throws {
+    let oracle = try makeOracle()
+    let workingDirectory = try AbsolutePath(validating: "/tmp")
+    let commandLine = MockSwiftScan.scanArguments(moduleName: "App", moduleCount: 10,
+                                                  fanout: 3, clangPercent: 40)
+    for decodingModulesLazily in [false, true] {
+      var diagnostics: [ScannerDiagnosticPayload] = []
+      let graph = try oracle.getDependencies(workingDirectory: workingDirectory,
+                                             commandLine: commandLine,
+                                             decodingModulesLazily: decodingModulesLazily,
+                                             diagnostics: &diagnostics)
+      #expect(diagnostics.isEmpty)
+      #expect(graph.mainModuleName == "App")
+      #expect(graph.modules.count == 11)
+      #expect(graph.mainModule.sourceFiles == ["App.swift"])
+      // The first modules, and the one every module imports.
+      #expect(graph.mainModule.directDependencies ==
+              [.swift("M0"), .swift("M1"), .swift("M2"), .clang("M9")])
+      // Clang modules only import Clang modules.
+      #expect(graph.modules[.clang("M6")]?.directDependencies == [.clang("M9")])
+      let closure = try graph.computeTransitiveClosure()
+      #expect(closure[.swift("App")]?.count == 10)
+    }
+
+    var diagnostics: [ScannerDiagnosticPayload] = []
+    let imports = try oracle.getImports(workingDirectory: workingDirectory,
+                                        commandLine: commandLine,
+                                        diagnostics: &diagnostics)
+    #expect(imports.imports == ["M0", "M1", "M2"])
+  }
+
+  @Test func batchScan() throws {
+    let oracle = try makeOracle()
+    let workingDirectory = try AbsolutePath(validating: "/tmp")
+    let invocations = ["First", "Second"].map {
+      DependencyScanInvocation(workingDirectory: workingDirectory,
+                               commandLine: MockSwiftScan.scanArguments(moduleName: $0,
+                                                                        moduleCount: 20))
+    }
+    let result = try oracle.getDependencies(forBatch: invocations)
+    #expect(result.graphs.map { $0.mainModuleName } == ["First", "Second"])
+    // Both main modules, and the modules they have in common.
+    #expect(try result.uniqueModules().count == 22)
+  }
+
+  @Test func pendingDependencyScan() throws {
+    let oracle = try makeOracle()
+    let invocation = DependencyScanInvocation(
+      workingDirectory: try AbsolutePath(validating: "/tmp"),
+      commandLine: MockSwiftScan.scanArguments(moduleName: "App", moduleCount: 10,
+                                               latency: .milliseconds(50)))
+    let pendingScan = PendingDependencyScan(oracle: oracle, invocations: [invocation])
+    // Stands in for the planning done while the scan runs.
+    Thread.sleep(forTimeInterval: 0.02)
+    let (result, timing) = try pendingScan.wait()
+    #expect(result.graphs.map { $0.mainModuleName } == ["App"])
+    #expect(result.graphs[0].modules.count == 11)
+    #expect(timing.scanNanoseconds >= 50_000_000)
+    #expect(timing.overlapNanoseconds > 0)
+    #expect(timing.overlapNanoseconds <= timing.scanNanoseconds)
+  }
+
+  @Test func abandonPendingDependencyScan() throws {
+    let oracle = try makeOracle()
+    let invocation = DependencyScanInvocation(
+      workingDirectory: try AbsolutePath(validating: "/tmp"),
+      commandLine: MockSwiftScan.scanArguments(moduleCount: 10, latency: .seconds(1)))
+    let pendingScan = PendingDependencyScan(oracle: oracle, invocations: [invocation])
+    pendingScan.abandon()
+    #expect(pendingScan.isAbandoned)
+    // Waiting for an abandoned scan doesn't wait for the scanner.
+    let startTime = DispatchTime.now()
+    #expect(throws: DependencyScanningError.self) { try pendingScan.wait() }
+    #expect(DispatchTime.now().uptimeNanoseconds - startTime.uptimeNanoseconds < 500_000_000)
+  }
+
+  @Test func prefetchFromRemoteCache() throws {
+    let oracle = try makeOracle()
+    let cas = try oracle.getOrCreateCAS(pluginPath: try AbsolutePath(validating: "/mock/plugin"),
+                                        onDiskPath: nil,
+                                        pluginOptions: MockSwiftScan.casPluginOptions(latency: .milliseconds(1),
+                                                                                      hitPercent: 100,
+                                                                                      outputsPerKey: 3))
+    let keys = try (0..<16).map { try cas.computeCacheKey(commandLine: ["-c", "main.swift"], index: $0) }
+    #expect(Set(keys).count == keys.count)
+    // Not in the local cache until fetched from the remote one.
+    #expect(try cas.queryCacheKey(keys[0], globally: false) == nil)
+
+    let prefetcher = CachedOutputPrefetcher(fetcher: cas, maxInFlight: 4)
+    prefetcher.prefetch(keys)
+    let statistics = prefetcher.wait()
+    #expect(statistics.fetched == keys.count)
+    #expect(statistics.peakInFlight <= 4)
+
+    let compilation = try #require(try cas.queryCacheKey(keys[0], globally: false))
+    #expect(compilation.count == 3)
+    #expect(compilation.allSatisfy { $0.isMaterialized })
+  }
+
+  @Test func cancelSlowFetches() throws {
+    let oracle = try makeOracle()
+    let cas = try oracle.getOrCreateCAS(pluginPath: try AbsolutePath(validating: "/mock/plugin"),
+                                        onDiskPath: nil,
+                                        pluginOptions: MockSwiftScan.casPluginOptions(latency: .seconds(60)))
+    let keys = (0..<8).map { "key\($0)" }
+    let prefetcher = CachedOutputPrefetcher(fetcher: cas, maxInFlight: 2)
+    prefetcher.prefetch(keys)
+    prefetcher.cancel()
+    // Cancelling abandons the fetches in flight instead of waiting them out.
+    let statistics = prefetcher.wait()
+    #expect(statistics.fetched == 0)
+    #expect(statistics.skipped == keys.count - 2)
+    #expect(statistics.abandoned == 2)
+  }
+
+  @Test func storageManagement() throws {
+    let oracle = try makeOracle()
+    let cas = try oracle.getOrCreateCAS(pluginPath: nil, onDiskPath: nil, pluginOptions: [])
+    _ = try cas.store(data: Data(count: 1000))
+    let manager = try #require(CASStorageManager(cas: cas, sizeLimit: 100))
+    let result = try manager.enforceSizeLimit()
+    #expect(result.sizeBefore == 1000)
+    #expect(result.sizeAfter == 0)
+
+    let usage = try manager.usage(ofCacheKeys: ["key"])
+    #expect(usage.outputs == ["object": 1, "swiftmodule": 1])
+    #expect(usage.materializedOutputs == usage.outputs)
+  }
+}
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+@_spi(Testing) import SwiftDriver
+import XCTest
+
+/// Benchmarks building, tracing and reading the ``ModuleDependencyGraph`` of a large
+/// generated module, to compare the time and memory taken by changes to how
+/// the graph stores its nodes and arcs.
+///
+/// Each file defines some top-level names, and uses names defined by other
+/// files, spread across the module. In the fan-out variants, every file also
+/// uses a few names defined by the first files, so that changing one of those
+/// invalidates the whole module.
+class ModuleDependencyGraphPerformanceTests: XCTestCase {
+  let fileCount = benchmarkWorkload(debug: 200, release: 2000)
+
+  let declsPerFile = 50
+  let usesPerFile = 50
+
+  /// Includes parsing the mock dependencies, which does not change with the
+  /// graph.
+  func testBuildingGraph() {
+    measureTimeAndMemory {
+      _ = buildGraph()
+    }
+  }
+
+  func testTracingGraph() {
+    measureTracing(from: 0..<fileCount, in: buildGraph())
+  }
+
+  /// A change to a widely used declaration, tracing most of the graph at once.
+  func testTracingFanOutFromOneFile() {
+    measureTracing(from: 0..<1, in: buildGraph(hubFiles: 4))
+  }
+
+  func testTracingFanOutFromEveryFile() {
+    measureTracing(from: 0..<fileCount, in: buildGraph(hubFiles: 4))
+  }
+
+  /// Reading the priors is all the work done on the graph at the start of a
+  /// build in which nothing changed.
+  func testReadingPriors() {
+    let creator = MockModuleDependencyGraphCreator(maxIndex: fileCount)
+    let graph = buildGraph(using: creator)
+    let priors = graph.blockingConcurrentAccessOrMutation {
+      ModuleDependencyGraph.Serializer.serialize(graph, graph.buildRecord,
+                                                 ModuleDependencyGraph.serializedGraphVersion)
+    }
+    func read() throws {
+      let readGraph = try creator.info.blockingConcurrentAccessOrMutation {
+        try ModuleDependencyGraph.deserialize(priors, info: creator.info)
+      }
+      XCTAssertEqual(readGraph.nodeFinder.nodeCount, graph.nodeFinder.nodeCount)
+    }
+    measureTimeAndMemory {
+      try read()
+    }
+  }
+
+  /// Traces from the nodes of each of `files` in turn, as the driver does
+  /// after each of them is compiled.
+  private func measureTracing(from files: Range<Int>, in graph: ModuleDependencyGraph) {
+    let sources = files.map {
+      DependencySource(SwiftSourceFile(mock: $0), graph.internedStringTable)
+    }
+    func trace() {
+      graph.blockingConcurrentAccessOrMutation {
+        graph.nodeFinder.forEachNode { $0.setUntraced() }
+        var invalidatedInputs = 0
+        for source in sources {
+          invalidatedInputs += graph.collectInputsUsing(dependencySource: source).count
+        }
+        XCTAssertGreaterThanOrEqual(invalidatedInputs, files.count)
+      }
+    }
+    measureTimeAndMemory {
+      trace()
+    }
+  }
+
+  /// - Parameter hubFiles: How many of the first files every file uses names from.
+  private func buildGraph(
+    hubFiles: Int = 0,
+    using creator: MockModuleDependencyGraphCreator? = nil
+  ) -> ModuleDependencyGraph {
+    let graph = (creator ?? MockModuleDependencyGraphCreator(maxIndex: fileCount)).mockUpAGraph()
+    for file in 0..<fileCount {
+      let defs = (0..<declsPerFile).map { "f\(file)d\($0)" }
+      let uses = (1...usesPerFile).map { use -> String in
+        let usedFile = (file + use * use * 7) % fileCount
+        return "f\(usedFile)d\(use % declsPerFile)->"
+      }
+      let hubUses = (0..<hubFiles).map { "f\($0)d\(file % declsPerFile)->" }
+      graph.simulateLoad(file, [.topLevel: defs + uses + hubUses])
+    }
+    graph.blockingConcurrentAccessOrMutation {
+      XCTAssertGreaterThan(graph.nodeFinder.nodeCount, fileCount * declsPerFile)
+    }
+    return graph
+  }
+}
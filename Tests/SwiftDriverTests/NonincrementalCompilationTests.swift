@@ -140,6 +140,54 @@ import Testing
     }
   }
 
+  @Test func integrateConcurrentlyDecodedSwiftDeps() throws {
+    let directory = try #require(
+      Fixture.fixturePath(at: try RelativePath(validating: "."), for: "SampleSwiftDeps")
+    )
+    let names = try localFileSystem.getDirectoryContents(directory)
+      .filter { $0.hasSuffix(".swiftdeps") && !$0.hasSuffix("-main.swiftdeps") }
+      .map { String($0.dropLast(".swiftdeps".count)) }
+      .sorted()
+      .prefix(16)
+    var entries: [VirtualPath.Handle: [FileType: VirtualPath.Handle]] = [:]
+    for name in names {
+      entries[VirtualPath.absolute(directory.appending(component: name + ".swift")).intern()] =
+        [.swiftDeps: VirtualPath.absolute(directory.appending(component: name + ".swiftdeps")).intern()]
+    }
+    let inputs = entries.keys.map { TypedVirtualPath(file: $0, type: .swift) }.swiftSourceFiles
+    let info = IncrementalCompilationState.IncrementalDependencyAndInputSetup
+      .mock(outputFileMap: OutputFileMap(entries: entries))
+
+    func nodeDescriptions(of graph: ModuleDependencyGraph) -> Set<String> {
+      var descriptions = Set<String>()
+      graph.nodeFinder.forEachNode {
+        descriptions.insert("\($0.description(in: graph)) \($0.fingerprint?.lookup(in: graph) ?? "")")
+      }
+      return descriptions
+    }
+
+    let serialGraph = ModuleDependencyGraph.createForSimulatingCleanBuild(
+      info.buildRecordInfo.buildRecord([], []), info)
+    let serialDescriptions = try serialGraph.blockingConcurrentAccessOrMutation {
+      for input in inputs {
+        _ = try #require(serialGraph.collectInputsRequiringCompilation(byCompiling: input))
+      }
+      return nodeDescriptions(of: serialGraph)
+    }
+
+    let graph = ModuleDependencyGraph.createForSimulatingCleanBuild(
+      info.buildRecordInfo.buildRecord([], []), info)
+    let decodedDependencies = ModuleDependencyGraph.decodeDependencies(of: inputs, info: info)
+    #expect(decodedDependencies.map { $0.input } == inputs)
+    try graph.blockingConcurrentAccessOrMutation {
+      for decoded in decodedDependencies {
+        _ = try #require(graph.collectInputsRequiringCompilation(byCompiling: decoded))
+      }
+      #expect(graph.verifyGraph())
+      #expect(nodeDescriptions(of: graph) == serialDescriptions)
+    }
+  }
+
   @Test func extractSourceFileDependencyGraphFromSwiftModule() async throws {
     let absolutePath = try #require(
       Fixture.fixturePath(
@@ -753,6 +753,58 @@ import Testing
     }
   }
 
+  /// Tests the tokenization rules of each platform, with special characters
+  /// on either side of the word boundaries of the fast path.
+  @Test func responseFileTokenizerStyles() throws {
+    func tokenize(_ contents: String, _ style: ResponseFileTokenizer.Style) -> [String] {
+      Array(contents.utf8).withUnsafeBytes {
+        ResponseFileTokenizer.arguments(in: $0, style: style)
+      }
+    }
+
+    let posix = "-module-name Long\\ Module\\ Name\r\n// -comment\n" +
+      "-DNAME=\"value with spaces\"\t'single quoted'\u{00A0}non\u{2028}breaking\r\n" +
+      "trailing\\\r\n\n\"unterminated quote\r\nlast\\\\line\r"
+    #expect(tokenize(posix, .posix) == [
+      "-module-name", "Long Module Name", "-DNAME=value with spaces", "single quoted",
+      "non", "breaking", "trailing", "unterminated quote", "last\\line",
+    ])
+
+    let windows = #"C:\Program Files\Swift\usr\bin "C:\Program Files\Swift" a\\\"b ""x"""# +
+      "\r\n\t \"quoted \"\"\" middle\"\0end\r\n//not-a-comment"
+    #expect(tokenize(windows, .windows) == [
+      #"C:\Program"#, #"Files\Swift\usr\bin"#, #"C:\Program Files\Swift"#, #"a\"b"#, #"x""#,
+      #"quoted " middle"#, "end", "//not-a-comment",
+    ])
+  }
+
+  /// Tests that response files which are mapped into memory are expanded the
+  /// same way as ones which are read through another file system.
+  @Test func responseFileExpansionMappedAndRead() throws {
+    try withTemporaryDirectory { path in
+      let inputsPath = path.appending(component: "inputs.rsp")
+      let paths = (0..<1000).map { "/tmp/My Project/Sources/File\($0).swift" }
+      try localFileSystem.writeFileContents(inputsPath, bytes: .init((0..<1000).map {
+        #if os(Windows)
+        "\"/tmp/My Project/Sources/File\($0).swift\""
+        #else
+        "/tmp/My\\ Project/Sources/File\($0).swift"
+        #endif
+      }.joined(separator: "\n").utf8))
+
+      for fileSystem in [localFileSystem, TestLocalFileSystem(cwd: path)] as [FileSystem] {
+        let diags = DiagnosticsEngine()
+        let args = try Driver.expandResponseFiles(
+          ["-c", "@" + inputsPath.pathString],
+          fileSystem: fileSystem,
+          diagnosticsEngine: diags
+        )
+        #expect(args == ["-c"] + paths)
+        #expect(diags.diagnostics.isEmpty)
+      }
+    }
+  }
+
   @Test func usingResponseFiles() async throws {
     let manyArgs = (1...200000).map { "-DTEST_\($0)" }
     // Needs response file
@@ -138,6 +138,46 @@ import class Foundation.NSString
     )
   }
 
+  @Test func cacheQueriedMessage() throws {
+    let queried = CacheQueriedMessage(keys: 4, hits: 3, misses: 1, latencyMilliseconds: 12)
+    let message = ParsableMessage(name: "cache-query", kind: .cacheQueried(queried))
+    let encoded = try message.toJSON()
+    let string = String(data: encoded, encoding: .utf8)!
+
+    #expect(
+      string == """
+        {
+          "hits" : 3,
+          "keys" : 4,
+          "kind" : "cache-queried",
+          "latency-ms" : 12,
+          "misses" : 1,
+          "name" : "cache-query"
+        }
+        """
+    )
+  }
+
+  @Test func cacheQueriedMessageIsOptIn() throws {
+    let results = CacheQueryResults(keys: ["a": true, "b": false], latencyNanoseconds: 0)
+    for reportsCacheQueries in [false, true] {
+      let buffer = BufferedOutputByteStream()
+      let stderrStream = ThreadSafeOutputByteStream(buffer)
+      let toolDelegate = ToolExecutionDelegate(
+        mode: .parsableOutput,
+        buildRecordInfo: nil,
+        showJobLifecycle: false,
+        reportsCacheQueries: reportsCacheQueries,
+        argsResolver: try ArgsResolver(fileSystem: localFileSystem),
+        diagnosticEngine: DiagnosticsEngine(),
+        stderrStream: stderrStream
+      )
+      toolDelegate.cacheQueried(results: results)
+      stderrStream.flush()
+      #expect(buffer.bytes.description.contains("\"kind\" : \"cache-queried\"") == reportsCacheQueries)
+    }
+  }
+
   @Test func beganBatchMessages() async throws {
     do {
       try await withTemporaryDirectory { path in
@@ -609,6 +609,40 @@ import CRT
     }
   }
 
+  @Test(.skipHostOS(.win32, comment: "Creates a symbolic link to the frontend"))
+  func frontendSupportedArgumentsFromOptionTable() throws {
+    try withTemporaryDirectory { path in
+      // A frontend with a binary option table next to it, which lists an
+      // option that neither libSwiftScan nor the real frontend knows.
+      let realFrontend = try TestDriver(args: ["swiftc"]).toolchain.getToolPath(.swiftCompiler)
+      let frontend = path.appending(component: realFrontend.basename)
+      try localFileSystem.createSymbolicLink(frontend, pointingAt: realFrontend, relative: false)
+
+      func integer<T: FixedWidthInteger>(_ value: T) -> [UInt8] {
+        withUnsafeBytes(of: value.littleEndian) { Array($0) }
+      }
+      func record(spellingOffset: UInt32, spellingLength: UInt16) -> [UInt8] {
+        integer(spellingOffset) + integer(spellingLength) + [1, 0] +
+          integer(UInt32(OptionAttributes.frontend.rawValue)) + integer(UInt16.max) +
+          integer(UInt16.max) + integer(UInt16(0)) + integer(UInt16(0)) +
+          integer(UInt32.max) + integer(UInt32.max)
+      }
+      let strings = Array("-emit-module\0-only-in-the-option-table\0".utf8)
+      let records = record(spellingOffset: 0, spellingLength: 12) +
+        record(spellingOffset: 13, spellingLength: 25)
+      let header = Array("SWIFTOPT".utf8) + integer(BinaryOptionTable.formatVersion) +
+        integer(UInt32(2)) + integer(UInt64(0)) + integer(UInt32(strings.count)) + integer(UInt32(0))
+      try localFileSystem.writeFileContents(path.appending(component: "swift-frontend.options"),
+                                            bytes: ByteString(header + records + strings))
+
+      var env = ProcessEnv.block
+      env["SWIFT_DRIVER_SWIFT_FRONTEND_EXEC"] = frontend.pathString
+      let driver = try TestDriver(args: ["swiftc", "foo.swift"], env: env)
+      #expect(driver.supportedFrontendFlags == ["emit-module", "only-in-the-option-table"])
+      #expect(driver.isFrontendArgSupported(.emitModule))
+    }
+  }
+
   @Test func emitSupportedArguments() async throws {
     var driver = try TestDriver(args: ["swiftc", "-emit-supported-arguments"])
 
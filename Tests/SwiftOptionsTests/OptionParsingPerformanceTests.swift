@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import SwiftOptions
+import XCTest
+
+class OptionParsingPerformanceTests: XCTestCase {
+  /// A typical, short command line, for which the cost of setting up option
+  /// matching dominates the cost of parsing.
+  let commandLine = [
+    "-module-name", "main", "-target", "x86_64-unknown-linux-gnu", "-Onone",
+    "-g", "-I", "/tmp/include", "-Xcc", "-DDEBUG=1", "-enable-testing",
+    "-emit-module", "-emit-module-path", "/tmp/main.swiftmodule",
+    "-o", "/tmp/main", "main.swift", "other.swift",
+  ]
+
+  /// The number of driver invocations simulated by each measurement.
+  let invocations = 100
+
+  /// Measure parsing with the prefix-match table generated by makeOptions.
+  func testParsingWithGeneratedPrefixTable() throws {
+    let options = OptionTable()
+    measure {
+      for _ in 0..<invocations {
+        _ = try? options.parse(commandLine, for: .batch)
+      }
+    }
+  }
+
+  /// Measure parsing with a customized option table, which builds a
+  /// `PrefixTrie` on every parse, as parsing the built-in options used to.
+  func testParsingWithPrefixTrie() throws {
+    var options = OptionTable()
+    options.options = Option.allOptions
+    measure {
+      for _ in 0..<invocations {
+        _ = try? options.parse(commandLine, for: .batch)
+      }
+    }
+  }
+}
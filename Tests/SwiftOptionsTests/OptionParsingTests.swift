@@ -15,6 +15,8 @@
 import SwiftOptions
 import Testing
 
+import struct Foundation.Data
+
 @Suite struct SwiftDriverTests {
     @Test func parsing() throws {
       // Form an options table
@@ -68,6 +70,179 @@ import Testing
     }
   }
 
+  @Test func parsingLongestPrefixMatch() throws {
+    let options = OptionTable()
+    // Joined options take the rest of the argument, even when it coincides
+    // with the beginning of other option spellings.
+    #expect(try options.parse(["-lto", "-lswiftCore"], for: .batch).description == "-l to -l swiftCore")
+    #expect(try options.parse(["-Dfoo", "-Fsystem", "bar"], for: .batch).description == "-D foo -Fsystem bar")
+
+    // The generated prefix table must agree with a trie built from the same
+    // options.
+    var trieOptions = OptionTable()
+    trieOptions.options = options.options
+    for option in options.options where !option.attributes.contains(.noDriver) {
+      for arguments in [[option.spelling], [option.spelling, "value"], [option.spelling + "=value"]] {
+        let fromTable = try? options.parse(arguments, for: .batch).description
+        let fromTrie = try? trieOptions.parse(arguments, for: .batch).description
+        #expect(fromTable == fromTrie, "mismatch parsing \(arguments)")
+      }
+    }
+  }
+
+  @Test func optionIDs() throws {
+    for (index, option) in Option.allOptions.enumerated() {
+      #expect(Int(option.id) == index)
+    }
+    #expect(Option.abi_.alias == .abi)
+    #expect(Option.abi.alias == nil)
+    #expect(Option.o.kind == .joinedOrSeparate)
+    #expect(Option.o.attributes.contains(.frontend))
+
+    // Options created at runtime get IDs after the built-in ones, which are
+    // shared between options with the same properties.
+    let runtime = Option("-runtime-only", .flag, helpText: "Created at runtime")
+    #expect(Int(runtime.id) >= Option.allOptions.count)
+    #expect(runtime.id == Option("-runtime-only", .flag, helpText: "Created at runtime").id)
+    #expect(runtime.id != Option("-runtime-only", .separate).id)
+    #expect(runtime.spelling == "-runtime-only")
+    #expect(runtime.helpText == "Created at runtime")
+
+    // Options with the same spelling compare equal, as they always have, even
+    // when one of them is built in.
+    let separate = Option("-runtime-only", .separate)
+    #expect(Set([runtime, separate]).count == 1)
+    let verbose = Option("-v", .flag)
+    #expect(verbose.id != Option.v.id)
+    #expect(verbose == .v)
+    #expect(verbose.hashValue == Option.v.hashValue)
+    #expect(OptionBitSet([Option.v]).contains(verbose))
+    let parsed = try OptionTable().parse(["-v"], for: .batch)
+    #expect(parsed.hasArgument(verbose))
+  }
+
+  @Test func optionBitsets() {
+    let frontendOptions = OptionBitSet.builtinOptions(with: .frontend)
+    let cacheInvariantPaths = OptionBitSet.builtinOptions(with: [.argumentIsPath, .cacheInvariant])
+    for option in Option.allOptions {
+      #expect(frontendOptions.contains(option) == option.attributes.contains(.frontend))
+      #expect(cacheInvariantPaths.contains(option) ==
+              option.attributes.isSuperset(of: [.argumentIsPath, .cacheInvariant]))
+      #expect(option.hasAttributes([.argumentIsPath, .cacheInvariant]) ==
+              option.attributes.isSuperset(of: [.argumentIsPath, .cacheInvariant]))
+      for driverKind in DriverKind.allCases {
+        let attributes = option.attributes
+        let expected = driverKind == .batch
+          ? attributes.isDisjoint(with: [.noDriver, .noBatch])
+          : attributes.isDisjoint(with: [.noDriver, .noInteractive])
+        #expect(OptionBitSet.builtinOptions(acceptedBy: driverKind).contains(option) == expected)
+      }
+    }
+
+    var set = OptionBitSet([Option.o, Option.c])
+    #expect(set.options == [Option.c, Option.o].sorted { $0.id < $1.id })
+    set.remove(.c)
+    #expect(set == OptionBitSet([Option.o]))
+    #expect(set.union(OptionBitSet([Option.c])) == OptionBitSet([Option.c, Option.o]))
+    #expect(set.intersection(frontendOptions) == set)
+    #expect(set.subtracting(frontendOptions).isEmpty)
+  }
+
+  @Test func groupsAndAliases() throws {
+    for option in Option.allOptions {
+      if let group = option.group {
+        #expect(group.options.contains(option))
+      }
+      var canonical = option
+      while let alias = canonical.alias {
+        canonical = alias
+      }
+      #expect(option.canonical == canonical)
+    }
+    #expect(Option.Group.O.options.allSatisfy { $0.group == .O })
+
+    var results = try OptionTable().parse(["-O", "-c", "-Onone", "-module-name", "main"], for: .batch)
+    #expect(results.arguments(in: .O).map(\.option) == [.O, .Onone])
+    results.eraseAllArguments(in: .O)
+    #expect(!results.contains(in: .O))
+    #expect(results.description == "-c -module-name main")
+  }
+
+  @Test func parsedOptionQueries() throws {
+    var results = try OptionTable().parse(
+      ["-g", "-emit-library", "-module-name", "a", "-module-name", "b", "-color-diagnostics",
+       "-no-color-diagnostics", "-wmo", "input.swift"], for: .batch)
+    #expect(results.getLastArgument(.moduleName)?.asSingle == "b")
+    #expect(results.hasFlag(positive: .colorDiagnostics, negative: .noColorDiagnostics,
+                            default: true) == false)
+    #expect(results.hasArgument(.emitLibrary, .o))
+    #expect(!results.hasArgument(.o))
+    #expect(results.unconsumedOptions.map(\.option) == [.g, .emitLibrary, .wmo, .INPUT])
+
+    // Aliases are found through their canonical option.
+    #expect(results.contains(.wholeModuleOptimization))
+    #expect(results.allInputs == ["input.swift"])
+
+    // Erasing an option leaves the others in place.
+    results.eraseArgument(.emitLibrary)
+    #expect(!results.contains(.emitLibrary))
+    #expect(results.getLastArgument(.moduleName)?.asSingle == "b")
+    #expect(results.unconsumedOptions.map(\.option) == [.g])
+  }
+
+  @Test func stringPool() {
+    #expect(Option.o.spelling == "-o")
+    #expect(Option.o.metaVar == "<file>")
+    #expect(Option.o.helpText == "Write output to <file>")
+    #expect(Option.moduleName.spelling == "-module-name")
+    #expect(Option.moduleName.metaVar == nil)
+    #expect(Option.Group.O.name == "<optimization level options>")
+    #expect(Option.Group.O.helpText == nil)
+    #expect(Option.Group.modes.helpText == "MODES")
+    #expect(Set(Option.allOptions.map(\.spelling)).count == Option.allOptions.count)
+  }
+
+  @Test func binaryOptionTable() throws {
+    func integer<T: FixedWidthInteger>(_ value: T) -> [UInt8] {
+      withUnsafeBytes(of: value.littleEndian) { Array($0) }
+    }
+    func record(spellingOffset: UInt32, spellingLength: UInt16, kind: UInt8,
+                attributes: OptionAttributes) -> [UInt8] {
+      integer(spellingOffset) + integer(spellingLength) + [kind, 0] +
+        integer(UInt32(attributes.rawValue)) + integer(UInt16.max) +
+        integer(UInt16.max) + integer(UInt16(0)) + integer(UInt16(0)) +
+        integer(UInt32.max) + integer(UInt32.max)
+    }
+    let strings = Array("-c\0-driver-only\0".utf8)
+    let records =
+      record(spellingOffset: 0, spellingLength: 2, kind: 1, attributes: .frontend) +
+      record(spellingOffset: 3, spellingLength: 12, kind: 3, attributes: .noDriver)
+    func header(version: UInt32) -> [UInt8] {
+      Array("SWIFTOPT".utf8) + integer(version) + integer(UInt32(2)) +
+        integer(UInt64(0x1234)) + integer(UInt32(strings.count)) + integer(UInt32(0))
+    }
+
+    let table = try BinaryOptionTable(data: Data(header(version: 1) + records + strings))
+    #expect(table.count == 2)
+    #expect(table.fingerprint == 0x1234)
+    #expect(!table.matchesBuiltinOptions)
+    #expect(table.spelling(at: 1) == "-driver-only")
+    #expect(table.kind(at: 0) == .flag)
+    #expect(table.kind(at: 1) == .separate)
+    #expect(table.attributes(at: 1) == .noDriver)
+    #expect(table.frontendSpellings == ["-c"])
+
+    #expect(throws: BinaryOptionTable.Error.unsupportedVersion(2)) {
+      try BinaryOptionTable(data: Data(header(version: 2) + records + strings))
+    }
+    #expect(throws: BinaryOptionTable.Error.invalidFormat) {
+      try BinaryOptionTable(data: Data(header(version: 1) + records))
+    }
+    #expect(throws: BinaryOptionTable.Error.invalidFormat) {
+      try BinaryOptionTable(data: Data(Array("NOTOPTS!".utf8) + header(version: 1).dropFirst(8)))
+    }
+  }
+
   @Test func parseErrors() {
     let options = OptionTable()
 
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE.txt for license information
+// See CONTRIBUTORS.txt for the list of Swift project authors
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+@_spi(Testing) import SwiftDriver
+import TSCBasic
+
+/// Helpers for the stand-in for libSwiftScan built from `Tests/MockSwiftScan`,
+/// which synthesizes dependency graphs and serves an in-memory CAS. See
+/// `mock_swiftscan.h` for the arguments and CAS plugin options it takes.
+public enum MockSwiftScan {
+  /// The path to the library, or `nil` if it hasn't been built alongside the
+  /// tests.
+  public static var libraryPath: AbsolutePath? {
+    #if os(Windows)
+    return nil
+    #else
+    guard let path = try? AbsolutePath(validating: productsDirectory.path)
+                                .appending(component: sharedLibraryName("MockSwiftScan")),
+          localFileSystem.exists(path) else {
+      return nil
+    }
+    return path
+    #endif
+  }
+
+  /// The arguments of a scan which reports `moduleCount` modules besides the
+  /// main one, each of which imports `fanout` others.
+  public static func scanArguments(moduleName: String = "main",
+                                   moduleCount: Int,
+                                   fanout: Int = 4,
+                                   clangPercent: Int = 50,
+                                   latency: DispatchTimeInterval? = nil) -> [String] {
+    var arguments = ["-frontend", "-scan-dependencies", "-module-name", moduleName,
+                     "\(moduleName).swift",
+                     "-mock-scan-modules", String(moduleCount),
+                     "-mock-scan-fanout", String(fanout),
+                     "-mock-scan-clang-percent", String(clangPercent)]
+    if let latency = latency {
+      arguments += ["-mock-scan-latency-us", String(microseconds(latency))]
+    }
+    return arguments
+  }
+
+  /// The plugin options of a CAS whose remote operations each take `latency`,
+  /// and which has a cached compilation for `hitPercent` percent of the keys.
+  public static func casPluginOptions(latency: DispatchTimeInterval,
+                                      hitPercent: Int = 100,
+                                      outputsPerKey: Int = 2) -> [(String, String)] {
+    [("mock-latency-us", String(microseconds(latency))),
+     ("mock-hit-percent", String(hitPercent)),
+     ("mock-outputs-per-key", String(outputsPerKey))]
+  }
+
+  private static func microseconds(_ interval: DispatchTimeInterval) -> Int {
+    switch interval {
+    case .seconds(let seconds): return seconds * 1_000_000
+    case .milliseconds(let milliseconds): return milliseconds * 1_000
+    case .microseconds(let microseconds): return microseconds
+    case .nanoseconds(let nanoseconds): return nanoseconds / 1_000
+    default: return 0
+    }
+  }
+
+  /// Where SwiftPM puts the package's products, next to the tests.
+  private static var productsDirectory: URL {
+    #if canImport(Darwin)
+    for bundle in Bundle.allBundles where bundle.bundlePath.hasSuffix(".xctest") {
+      return bundle.bundleURL.deletingLastPathComponent()
+    }
+    #endif
+    return Bundle.main.bundleURL
+  }
+}